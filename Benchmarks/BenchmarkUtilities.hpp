@@ -0,0 +1,95 @@
+#ifndef BENCHMARK_UTILITIES_HPP
+#define BENCHMARK_UTILITIES_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <utility>
+
+#include <forge-base/Core/Types.hpp>
+
+using namespace Forge;
+
+/**
+ * @brief Runs the specified function once and measures its wall-clock duration.
+ *
+ * @param function The function to be measured.
+ *
+ * @return The duration of the function in milliseconds.
+ */
+template<typename InFunctionType>
+F64 MeasureMilliseconds(InFunctionType&& function)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	std::forward<InFunctionType>(function)();
+
+	auto final = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<F64, std::milli>(final - start).count();
+}
+
+/**
+ * @brief Runs the specified worker on each of the specified number of threads and measures
+ * the wall-clock duration until all of them finish.
+ *
+ * @param thread_count The number of threads to run.
+ * @param worker The function to be run, invoked with the index of its thread.
+ *
+ * @return The duration in milliseconds.
+ */
+template<typename InWorkerType>
+F64 MeasureThreadsMilliseconds(Size thread_count, InWorkerType worker)
+{
+	return MeasureMilliseconds([&]()
+	{
+		std::vector<std::thread> threads;
+
+		threads.reserve(thread_count);
+
+		for (Size index = 0; index < thread_count; index++)
+			threads.emplace_back(worker, index);
+
+		for (std::thread& thread : threads)
+			thread.join();
+	});
+}
+
+/**
+ * @brief Prints a single benchmark result row.
+ *
+ * @param suite The name of the benchmark suite.
+ * @param name The name of the measured container or configuration.
+ * @param operations The number of operations performed.
+ * @param milliseconds The measured duration in milliseconds.
+ */
+inline Void ReportBenchmark(const char* suite, const char* name, Size operations, F64 milliseconds)
+{
+	std::printf("%-24s %-32s %12zu ops %10.2f ms %10.2f ns/op\n", suite, name, operations, milliseconds, (milliseconds * 1e6) / static_cast<F64>(operations));
+}
+
+/**
+ * @brief A small xorshift generator, so benchmark inputs are reproducible across platforms.
+ */
+class BenchmarkRandom
+{
+private:
+	U64 m_state;
+
+public:
+	BenchmarkRandom(U64 seed)
+		: m_state(seed ? seed : 0x9E3779B97F4A7C15ull) {}
+
+public:
+	U64 Next()
+	{
+		m_state ^= m_state << 13;
+		m_state ^= m_state >> 7;
+		m_state ^= m_state << 17;
+
+		return m_state;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef CONCURRENT_B_TREE_MAP_BENCHMARK_HPP
+#define CONCURRENT_B_TREE_MAP_BENCHMARK_HPP
+
+#include "BenchmarkUtilities.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+#include <Collections/BTreeMap.hpp>
+#include <Collections/ConcurrentBTreeMap.hpp>
+
+/**
+ * @brief Measures the scalability of the ConcurrentBTreeMap from 1 to 64 threads on an ordered
+ * index mix of one write for every eight reads, where one read in eight is a short range scan,
+ * against a BTreeMap guarded by a reader-writer lock.
+ */
+inline Void RunConcurrentBTreeMapBenchmark()
+{
+	constexpr U64 KEY_COUNT = 1 << 20;
+	constexpr Size OPERATION_COUNT = 1 << 21;
+	constexpr Size SCAN_LENGTH = 16;
+
+	constexpr Size THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+	ConcurrentBTreeMap<U64, U64> concurrent_map;
+	BTreeMap<U64, U64> locked_map;
+
+	std::shared_mutex mutex;
+
+	// Every worker publishes its checksum, so the compiler cannot drop the reads.
+	std::atomic<U64> checksums(0);
+
+	// Preloads the even keys, so the writes insert and remove the odd ones.
+	for (U64 key = 0; key < KEY_COUNT; key += 2)
+	{
+		concurrent_map.Insert(key, key);
+		locked_map.Insert(key, key);
+	}
+
+	for (Size thread_count : THREAD_COUNTS)
+	{
+		Size operations = OPERATION_COUNT / thread_count;
+
+		char name[64];
+
+		F64 concurrent_ms = MeasureThreadsMilliseconds(thread_count, [&](Size thread_index)
+		{
+			BenchmarkRandom random(thread_index + 1);
+			U64 checksum = 0;
+
+			for (Size counter = 0; counter < operations; counter++)
+			{
+				U64 key = random.Next() % KEY_COUNT;
+				U64 selector = random.Next() % 9;
+
+				if (selector == 0)
+				{
+					if (!concurrent_map.Insert(key | 1, key))
+						concurrent_map.Remove(key | 1);
+				}
+				else if (selector == 1)
+					concurrent_map.Scan(key, key + SCAN_LENGTH, [&checksum](U64, U64 value) { checksum += value; });
+				else
+				{
+					U64 value = 0;
+
+					concurrent_map.TryGet(key, value);
+					checksum += value;
+				}
+			}
+
+			checksums.fetch_add(checksum, std::memory_order_relaxed);
+		});
+
+		F64 locked_ms = MeasureThreadsMilliseconds(thread_count, [&](Size thread_index)
+		{
+			BenchmarkRandom random(thread_index + 1);
+			U64 checksum = 0;
+
+			for (Size counter = 0; counter < operations; counter++)
+			{
+				U64 key = random.Next() % KEY_COUNT;
+				U64 selector = random.Next() % 9;
+
+				if (selector == 0)
+				{
+					std::unique_lock<std::shared_mutex> lock(mutex);
+
+					if (!locked_map.Insert(key | 1, key))
+						locked_map.Remove(key | 1);
+				}
+				else if (selector == 1)
+				{
+					std::shared_lock<std::shared_mutex> lock(mutex);
+
+					locked_map.ForEachInRange(key, key + SCAN_LENGTH, [&checksum](U64, U64& value) { checksum += value; });
+				}
+				else
+				{
+					std::shared_lock<std::shared_mutex> lock(mutex);
+
+					const U64* value = locked_map.TryGet(key);
+
+					checksum += value ? *value : 0;
+				}
+			}
+
+			checksums.fetch_add(checksum, std::memory_order_relaxed);
+		});
+
+		std::snprintf(name, sizeof(name), "ConcurrentBTreeMap x%zu", thread_count);
+		ReportBenchmark("ConcurrentOrderedMap", name, operations * thread_count, concurrent_ms);
+
+		std::snprintf(name, sizeof(name), "BTreeMap + shared_mutex x%zu", thread_count);
+		ReportBenchmark("ConcurrentOrderedMap", name, operations * thread_count, locked_ms);
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+#ifndef CONCURRENT_HASH_MAP_BENCHMARK_HPP
+#define CONCURRENT_HASH_MAP_BENCHMARK_HPP
+
+#include "BenchmarkUtilities.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include <Collections/ConcurrentHashMap.hpp>
+
+/**
+ * @brief Runs one mix of lookups and writes against the ConcurrentHashMap and against an
+ * unordered_map behind a single mutex, at each thread count.
+ *
+ * @param suite The name of the mix.
+ * @param write_percentage The percentage of operations that insert or remove a key.
+ */
+inline Void RunConcurrentHashMapMix(const char* suite, U64 write_percentage)
+{
+	constexpr U64 KEY_COUNT = 1 << 20;
+	constexpr Size OPERATION_COUNT = 1 << 22;
+
+	constexpr Size THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+	// Every worker publishes its checksum, so the compiler cannot drop the reads.
+	std::atomic<U64> checksums(0);
+
+	for (Size thread_count : THREAD_COUNTS)
+	{
+		Size operations = OPERATION_COUNT / thread_count;
+
+		ConcurrentHashMap<U64, U64> concurrent_map;
+		std::unordered_map<U64, U64> locked_map;
+
+		std::mutex mutex;
+
+		// Preloads the even keys, so the writes insert and remove the odd ones. Both maps
+		// start small, so the concurrent map resizes while the workers run.
+		for (U64 key = 0; key < KEY_COUNT / 4; key += 2)
+		{
+			concurrent_map.Insert(key, key);
+			locked_map.emplace(key, key);
+		}
+
+		char name[64];
+
+		F64 concurrent_ms = MeasureThreadsMilliseconds(thread_count, [&](Size thread_index)
+		{
+			BenchmarkRandom random(thread_index + 1);
+			U64 checksum = 0;
+
+			for (Size counter = 0; counter < operations; counter++)
+			{
+				U64 key = random.Next() % KEY_COUNT;
+
+				if (random.Next() % 100 < write_percentage)
+				{
+					if (!concurrent_map.Insert(key | 1, key))
+						concurrent_map.Remove(key | 1);
+				}
+				else
+				{
+					U64 value = 0;
+
+					concurrent_map.TryGet(key, value);
+					checksum += value;
+				}
+			}
+
+			checksums.fetch_add(checksum, std::memory_order_relaxed);
+		});
+
+		F64 locked_ms = MeasureThreadsMilliseconds(thread_count, [&](Size thread_index)
+		{
+			BenchmarkRandom random(thread_index + 1);
+			U64 checksum = 0;
+
+			for (Size counter = 0; counter < operations; counter++)
+			{
+				U64 key = random.Next() % KEY_COUNT;
+
+				std::lock_guard<std::mutex> lock(mutex);
+
+				if (random.Next() % 100 < write_percentage)
+				{
+					if (!locked_map.emplace(key | 1, key).second)
+						locked_map.erase(key | 1);
+				}
+				else
+				{
+					auto iterator = locked_map.find(key);
+
+					checksum += iterator != locked_map.end() ? iterator->second : 0;
+				}
+			}
+
+			checksums.fetch_add(checksum, std::memory_order_relaxed);
+		});
+
+		std::snprintf(name, sizeof(name), "ConcurrentHashMap x%zu", thread_count);
+		ReportBenchmark(suite, name, operations * thread_count, concurrent_ms);
+
+		std::snprintf(name, sizeof(name), "unordered_map + mutex x%zu", thread_count);
+		ReportBenchmark(suite, name, operations * thread_count, locked_ms);
+	}
+}
+
+/**
+ * @brief Compares the ConcurrentHashMap against a mutex around unordered_map on a read-heavy
+ * mix of 95% lookups and a write-heavy mix of 50% writes, from 1 to 64 threads.
+ */
+inline Void RunConcurrentHashMapBenchmark()
+{
+	RunConcurrentHashMapMix("ConcurrentHashMapReads", 5);
+	RunConcurrentHashMapMix("ConcurrentHashMapWrites", 50);
+}
+
+#endif
\ No newline at end of file
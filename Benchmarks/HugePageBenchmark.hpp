@@ -0,0 +1,60 @@
+#ifndef HUGE_PAGE_BENCHMARK_HPP
+#define HUGE_PAGE_BENCHMARK_HPP
+
+#include "BenchmarkUtilities.hpp"
+
+#include <Collections/DynamicArray.hpp>
+
+#if defined(__linux__)
+
+#include <Policies/HugePageAllocationPolicy.hpp>
+
+/**
+ * @brief Gathers random elements of a large array, the access pattern of a hash join probe,
+ * which misses the TLB on almost every access unless the array sits on huge pages.
+ */
+template<typename InAllocationPolicy>
+F64 MeasureRandomGather(Allocator<InAllocationPolicy>* allocator, Size element_count, Size probe_count, U64& checksum)
+{
+	DynamicArrayWithPolicy<U64, InAllocationPolicy> array(allocator);
+
+	for (Size index = 0; index < element_count; index++)
+		array.PushBack(index);
+
+	return MeasureMilliseconds([&]()
+	{
+		BenchmarkRandom random(7);
+
+		for (Size counter = 0; counter < probe_count; counter++)
+			checksum += array[random.Next() % element_count];
+	});
+}
+
+inline Void RunHugePageBenchmark()
+{
+	constexpr Size ELEMENT_COUNT = 1 << 25;
+	constexpr Size PROBE_COUNT = 1 << 24;
+
+	U64 heap_checksum = 0;
+	U64 huge_page_checksum = 0;
+
+	Allocator<HeapAllocationPolicy> heap_allocator;
+	Allocator<HugePageAllocationPolicy> huge_page_allocator;
+
+	F64 heap_ms = MeasureRandomGather(&heap_allocator, ELEMENT_COUNT, PROBE_COUNT, heap_checksum);
+	F64 huge_page_ms = MeasureRandomGather(&huge_page_allocator, ELEMENT_COUNT, PROBE_COUNT, huge_page_checksum);
+
+	ReportBenchmark("RandomGather256MB", "HeapAllocationPolicy", PROBE_COUNT, heap_ms);
+	ReportBenchmark("RandomGather256MB", "HugePageAllocationPolicy", PROBE_COUNT, huge_page_ms);
+
+	if (heap_checksum != huge_page_checksum)
+		std::printf("RandomGather256MB checksum mismatch: %llu != %llu\n", static_cast<unsigned long long>(heap_checksum), static_cast<unsigned long long>(huge_page_checksum));
+}
+
+#else
+
+inline Void RunHugePageBenchmark() {}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef RADIX_HEAP_BENCHMARK_HPP
+#define RADIX_HEAP_BENCHMARK_HPP
+
+#include "BenchmarkUtilities.hpp"
+
+#include <Collections/RadixHeap.hpp>
+#include <Collections/IndexedPriorityQueue.hpp>
+
+/**
+ * @brief Compares the RadixHeap against the heap-based IndexedPriorityQueue on a monotone
+ * workload resembling Dijkstra: every popped key pushes a few keys at a bounded distance
+ * above it.
+ */
+inline Void RunRadixHeapBenchmark()
+{
+	constexpr Size KEY_COUNT = 1 << 20;
+	constexpr Size FAN_OUT = 4;
+	constexpr U32 MAX_DISTANCE = 1 << 10;
+
+	U64 radix_checksum = 0;
+	U64 binary_checksum = 0;
+
+	F64 radix_ms = MeasureMilliseconds([&]()
+	{
+		BenchmarkRandom random(42);
+		RadixHeap<U32, U32> heap;
+
+		Size next_id = 0;
+
+		heap.Push(0, static_cast<U32>(next_id++));
+
+		while (!heap.IsEmpty())
+		{
+			U32 key = heap.PeekKey();
+
+			radix_checksum += key;
+
+			heap.Pop();
+
+			for (Size counter = 0; counter < FAN_OUT && next_id < KEY_COUNT; counter++)
+				heap.Push(key + static_cast<U32>(random.Next() % MAX_DISTANCE), static_cast<U32>(next_id++));
+		}
+	});
+
+	F64 binary_ms = MeasureMilliseconds([&]()
+	{
+		BenchmarkRandom random(42);
+		IndexedPriorityQueue<U32, U32> heap(KEY_COUNT);
+
+		Size next_id = 0;
+
+		heap.Push(static_cast<U32>(next_id++), 0);
+
+		while (!heap.IsEmpty())
+		{
+			U32 key = heap.PeekPriority();
+
+			binary_checksum += key;
+
+			heap.Pop();
+
+			for (Size counter = 0; counter < FAN_OUT && next_id < KEY_COUNT; counter++)
+				heap.Push(static_cast<U32>(next_id++), key + static_cast<U32>(random.Next() % MAX_DISTANCE));
+		}
+	});
+
+	ReportBenchmark("MonotonePriorityQueue", "RadixHeap<U32, U32>", KEY_COUNT * 2, radix_ms);
+	ReportBenchmark("MonotonePriorityQueue", "IndexedPriorityQueue<U32, U32>", KEY_COUNT * 2, binary_ms);
+
+	if (radix_checksum != binary_checksum)
+		std::printf("MonotonePriorityQueue checksum mismatch: %llu != %llu\n", static_cast<unsigned long long>(radix_checksum), static_cast<unsigned long long>(binary_checksum));
+}
+
+#endif
\ No newline at end of file
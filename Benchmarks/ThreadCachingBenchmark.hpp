@@ -0,0 +1,61 @@
+#ifndef THREAD_CACHING_BENCHMARK_HPP
+#define THREAD_CACHING_BENCHMARK_HPP
+
+#include "BenchmarkUtilities.hpp"
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/ThreadCachingAllocationPolicy.hpp>
+
+/**
+ * @brief Creates and destroys small arrays on every thread, the allocation pattern of request
+ * handlers that build short-lived buffers.
+ */
+template<typename InAllocationPolicy>
+F64 MeasureArrayChurn(Allocator<InAllocationPolicy>* allocator, Size thread_count, Size array_count, U64& checksum)
+{
+	std::vector<U64> checksums(thread_count, 0);
+
+	F64 milliseconds = MeasureThreadsMilliseconds(thread_count, [&](Size thread_index)
+	{
+		BenchmarkRandom random(thread_index + 1);
+
+		for (Size counter = 0; counter < array_count; counter++)
+		{
+			DynamicArrayWithPolicy<U64, InAllocationPolicy> array(allocator);
+			Size element_count = 1 + random.Next() % 64;
+
+			for (Size index = 0; index < element_count; index++)
+				array.PushBack(index);
+
+			checksums[thread_index] += array[element_count - 1];
+		}
+	});
+
+	for (U64 value : checksums)
+		checksum += value;
+
+	return milliseconds;
+}
+
+inline Void RunThreadCachingBenchmark()
+{
+	constexpr Size THREAD_COUNT = 32;
+	constexpr Size ARRAY_COUNT = 1 << 16;
+
+	U64 heap_checksum = 0;
+	U64 caching_checksum = 0;
+
+	Allocator<HeapAllocationPolicy> heap_allocator;
+	Allocator<ThreadCachingAllocationPolicy> caching_allocator;
+
+	F64 heap_ms = MeasureArrayChurn(&heap_allocator, THREAD_COUNT, ARRAY_COUNT, heap_checksum);
+	F64 caching_ms = MeasureArrayChurn(&caching_allocator, THREAD_COUNT, ARRAY_COUNT, caching_checksum);
+
+	ReportBenchmark("ArrayChurn32Threads", "HeapAllocationPolicy", THREAD_COUNT * ARRAY_COUNT, heap_ms);
+	ReportBenchmark("ArrayChurn32Threads", "ThreadCachingAllocationPolicy", THREAD_COUNT * ARRAY_COUNT, caching_ms);
+
+	if (heap_checksum != caching_checksum)
+		std::printf("ArrayChurn32Threads checksum mismatch: %llu != %llu\n", static_cast<unsigned long long>(heap_checksum), static_cast<unsigned long long>(caching_checksum));
+}
+
+#endif
\ No newline at end of file
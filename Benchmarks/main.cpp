@@ -0,0 +1,16 @@
+#include "RadixHeapBenchmark.hpp"
+#include "ConcurrentBTreeMapBenchmark.hpp"
+#include "ConcurrentHashMapBenchmark.hpp"
+#include "HugePageBenchmark.hpp"
+#include "ThreadCachingBenchmark.hpp"
+
+int main()
+{
+	RunRadixHeapBenchmark();
+	RunConcurrentBTreeMapBenchmark();
+	RunConcurrentHashMapBenchmark();
+	RunHugePageBenchmark();
+	RunThreadCachingBenchmark();
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#ifndef BIT_OPERATIONS_INL_HPP
+#define BIT_OPERATIONS_INL_HPP
+
+#include "BitOperations.hpp"
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE Size BitWidth(U64 value)
+	{
+		if (value == 0)
+			return 0;
+
+		return 64 - CountLeadingZeros(value);
+	}
+
+	FORGE_FORCE_INLINE Size CountTrailingZeros(U64 value)
+	{
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, value);
+
+		return static_cast<Size>(index);
+	#else
+		return static_cast<Size>(__builtin_ctzll(static_cast<unsigned long long>(value)));
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size CountLeadingZeros(U64 value)
+	{
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+
+		return 63 - static_cast<Size>(index);
+	#else
+		return static_cast<Size>(__builtin_clzll(static_cast<unsigned long long>(value)));
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size PopCount(U64 value)
+	{
+	#if defined(_MSC_VER)
+		return static_cast<Size>(__popcnt64(value));
+	#else
+		return static_cast<Size>(__builtin_popcountll(static_cast<unsigned long long>(value)));
+	#endif
+	}
+
+	FORGE_FORCE_INLINE Size PopCount(const U64* words, Size word_count)
+	{
+		Size count = 0;
+		Size counter = 0;
+
+	#if defined(__AVX2__)
+		// Counts the bits of every nibble through a shuffle lookup table, then sums the bytes of
+		// each 64-bit lane.
+		const __m256i lookup = _mm256_setr_epi8(
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+		__m256i totals = _mm256_setzero_si256();
+
+		for (; counter + 4 <= word_count; counter += 4)
+		{
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + counter));
+
+			__m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(block, low_mask));
+			__m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(block, 4), low_mask));
+
+			totals = _mm256_add_epi64(totals, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+		}
+
+		count += static_cast<Size>(_mm256_extract_epi64(totals, 0));
+		count += static_cast<Size>(_mm256_extract_epi64(totals, 1));
+		count += static_cast<Size>(_mm256_extract_epi64(totals, 2));
+		count += static_cast<Size>(_mm256_extract_epi64(totals, 3));
+	#endif
+
+		for (; counter < word_count; counter++)
+			count += PopCount(words[counter]);
+
+		return count;
+	}
+
+	FORGE_FORCE_INLINE Size FindNextSet(const U64* words, Size word_count, Size bit_index)
+	{
+		Size word_index = bit_index >> 6;
+
+		if (word_index >= word_count)
+			return word_count << 6;
+
+		U64 word = words[word_index] & (~U64(0) << (bit_index & 63));
+
+		while (word == 0)
+		{
+			if (++word_index == word_count)
+				return word_count << 6;
+
+			word = words[word_index];
+		}
+
+		return (word_index << 6) + CountTrailingZeros(word);
+	}
+
+	FORGE_FORCE_INLINE Void BitwiseAnd(U64* target, const U64* source, Size word_count)
+	{
+		Size counter = 0;
+
+	#if defined(__AVX2__)
+		for (; counter + 4 <= word_count; counter += 4)
+		{
+			__m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + counter));
+			__m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + counter));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + counter), _mm256_and_si256(lhs, rhs));
+		}
+	#endif
+
+		for (; counter < word_count; counter++)
+			target[counter] &= source[counter];
+	}
+
+	FORGE_FORCE_INLINE Void BitwiseOr(U64* target, const U64* source, Size word_count)
+	{
+		Size counter = 0;
+
+	#if defined(__AVX2__)
+		for (; counter + 4 <= word_count; counter += 4)
+		{
+			__m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + counter));
+			__m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + counter));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + counter), _mm256_or_si256(lhs, rhs));
+		}
+	#endif
+
+		for (; counter < word_count; counter++)
+			target[counter] |= source[counter];
+	}
+
+	FORGE_FORCE_INLINE Void BitwiseXor(U64* target, const U64* source, Size word_count)
+	{
+		Size counter = 0;
+
+	#if defined(__AVX2__)
+		for (; counter + 4 <= word_count; counter += 4)
+		{
+			__m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + counter));
+			__m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + counter));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + counter), _mm256_xor_si256(lhs, rhs));
+		}
+	#endif
+
+		for (; counter < word_count; counter++)
+			target[counter] ^= source[counter];
+	}
+
+	FORGE_FORCE_INLINE Void BitwiseAndNot(U64* target, const U64* source, Size word_count)
+	{
+		Size counter = 0;
+
+	#if defined(__AVX2__)
+		for (; counter + 4 <= word_count; counter += 4)
+		{
+			__m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + counter));
+			__m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + counter));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + counter), _mm256_andnot_si256(rhs, lhs));
+		}
+	#endif
+
+		for (; counter < word_count; counter++)
+			target[counter] &= ~source[counter];
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,876 @@
+#include "Collections/BTreeMap.hpp"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	BTreeMap<InKeyType, InValueType, InAllocationPolicy>::BTreeMap(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_root(nullptr), m_head(nullptr), m_tail(nullptr)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InKeysAllocationPolicy, typename InValuesAllocationPolicy>
+	BTreeMap<InKeyType, InValueType, InAllocationPolicy>::BTreeMap(const DynamicArrayWithPolicy<KeyType, InKeysAllocationPolicy>& keys, const DynamicArrayWithPolicy<ValueType, InValuesAllocationPolicy>& values, AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_root(nullptr), m_head(nullptr), m_tail(nullptr)
+	{
+		this->m_allocator = allocator;
+
+		Size count = keys.GetCount();
+
+		if (values.GetCount() != count)
+			throw ::std::invalid_argument("The keys and the values must have the same count");
+
+		for (Size index = 1; index < count; index++)
+			if (!(keys[index - 1] < keys[index]))
+				throw ::std::invalid_argument("The keys must be sorted in strictly increasing order");
+
+		if (count == 0)
+			return;
+
+		DynamicArrayWithPolicy<Node*, InAllocationPolicy> level(allocator);
+		DynamicArrayWithPolicy<ConstKeyTypePtr, InAllocationPolicy> lows(allocator);
+
+		// The entries are spread evenly over the fewest leaves that hold them, so every leaf
+		// meets the minimum occupancy as soon as there is more than one.
+		Size leaf_count = (count + LEAF_CAPACITY - 1) / LEAF_CAPACITY;
+		Size position = 0;
+
+		level.Reserve(leaf_count);
+		lows.Reserve(leaf_count);
+
+		for (Size index = 0; index < leaf_count; index++)
+		{
+			Size take = count / leaf_count + (index < count % leaf_count);
+
+			LeafNode* leaf = this->_create_leaf();
+
+			CopyArray(_keys(leaf), keys.GetRawData() + position, take);
+			CopyArray(_values(leaf), values.GetRawData() + position, take);
+
+			leaf->count = static_cast<U16>(take);
+			leaf->previous = this->m_tail;
+
+			if (this->m_tail)
+				this->m_tail->next = leaf;
+			else
+				this->m_head = leaf;
+
+			this->m_tail = leaf;
+
+			level.PushBack(leaf);
+			lows.PushBack(_keys(leaf));
+
+			position += take;
+		}
+
+		// Each inner level is built the same way from the one below, with the smallest key of
+		// every subtree but the first as the separators.
+		while (level.GetCount() > 1)
+		{
+			Size child_count = level.GetCount();
+			Size node_count = (child_count + INNER_CAPACITY) / (INNER_CAPACITY + 1);
+
+			DynamicArrayWithPolicy<Node*, InAllocationPolicy> parents(allocator);
+			DynamicArrayWithPolicy<ConstKeyTypePtr, InAllocationPolicy> parent_lows(allocator);
+
+			parents.Reserve(node_count);
+			parent_lows.Reserve(node_count);
+
+			Size first = 0;
+
+			for (Size index = 0; index < node_count; index++)
+			{
+				Size take = child_count / node_count + (index < child_count % node_count);
+
+				InnerNode* inner = this->_create_inner();
+
+				for (Size child = 0; child < take; child++)
+				{
+					inner->children[child] = level[first + child];
+
+					if (child > 0)
+						CopyObject(_keys(inner) + child - 1, *lows[first + child]);
+				}
+
+				inner->count = static_cast<U16>(take - 1);
+
+				parents.PushBack(inner);
+				parent_lows.PushBack(lows[first]);
+
+				first += take;
+			}
+
+			level = ::std::move(parents);
+			lows = ::std::move(parent_lows);
+		}
+
+		this->m_root = level[0];
+		this->m_count = count;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	BTreeMap<InKeyType, InValueType, InAllocationPolicy>::BTreeMap(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_root(other.m_root), m_head(other.m_head), m_tail(other.m_tail)
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_root = nullptr;
+		other.m_head = nullptr;
+		other.m_tail = nullptr;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	BTreeMap<InKeyType, InValueType, InAllocationPolicy>::BTreeMap(ConstSelfTypeLRef other)
+		: BaseType(0, 0), m_root(nullptr), m_head(nullptr), m_tail(nullptr)
+	{
+		this->m_allocator = other.m_allocator;
+
+		if (other.m_root)
+		{
+			this->m_root = this->_clone(other.m_root, this->m_tail);
+			this->m_count = other.m_count;
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	BTreeMap<InKeyType, InValueType, InAllocationPolicy>::~BTreeMap()
+	{
+		this->Clear();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_root = other.m_root;
+			this->m_head = other.m_head;
+			this->m_tail = other.m_tail;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_root = nullptr;
+			other.m_head = nullptr;
+			other.m_tail = nullptr;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_allocator = other.m_allocator;
+
+			if (other.m_root)
+			{
+				this->m_root = this->_clone(other.m_root, this->m_tail);
+				this->m_count = other.m_count;
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::GetBeginIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, this->m_head, 0);
+		return it;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::GetFinalIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, nullptr, 0);
+		return it;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Iterator BTreeMap<InKeyType, InValueType, InAllocationPolicy>::LowerBound(ConstKeyTypeLRef key) const
+	{
+		LeafNode* leaf = this->_find_leaf(key);
+
+		if (!leaf)
+			return Iterator(this, nullptr, 0);
+
+		Size position = _search(_keys(leaf), leaf->count, key);
+
+		// Every key of the next leaf is at least the separator that routed the search here.
+		if (position == leaf->count)
+			return Iterator(this, leaf->next, 0);
+
+		return Iterator(this, leaf, position);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Contains(ConstKeyTypeLRef key) const
+	{
+		return this->TryGet(key) != nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Get(ConstKeyTypeLRef key)
+	{
+		ValueTypePtr value = this->TryGet(key);
+
+		if (!value)
+			throw ::std::out_of_range("The key is not contained in the B-tree map");
+
+		return *value;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypeLRef BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Get(ConstKeyTypeLRef key) const
+	{
+		ConstValueTypePtr value = this->TryGet(key);
+
+		if (!value)
+			throw ::std::out_of_range("The key is not contained in the B-tree map");
+
+		return *value;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(ConstKeyTypeLRef key)
+	{
+		return const_cast<ValueTypePtr>(static_cast<ConstSelfTypePtr>(this)->TryGet(key));
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(ConstKeyTypeLRef key) const
+	{
+		LeafNode* leaf = this->_find_leaf(key);
+
+		if (!leaf)
+			return nullptr;
+
+		KeyTypePtr keys = _keys(leaf);
+		Size position = _search(keys, leaf->count, key);
+
+		return position < leaf->count && !(key < keys[position]) ? _values(leaf) + position : nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InCallable>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ForEachInRange(ConstKeyTypeLRef first, ConstKeyTypeLRef last, InCallable callable) const
+	{
+		if (last < first)
+			return;
+
+		LeafNode* leaf = this->_find_leaf(first);
+
+		if (!leaf)
+			return;
+
+		Size index = _search(_keys(leaf), leaf->count, first);
+
+		// Once the first leaf is found the scan follows the leaf links only.
+		for (; leaf; leaf = leaf->next, index = 0)
+		{
+			KeyTypePtr keys = _keys(leaf);
+			ValueTypePtr values = _values(leaf);
+
+			for (; index < leaf->count; index++)
+			{
+				if (last < keys[index])
+					return;
+
+				callable(static_cast<ConstKeyTypeLRef>(keys[index]), values[index]);
+			}
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Size BTreeMap<InKeyType, InValueType, InAllocationPolicy>::GetHeight() const
+	{
+		Size height = 0;
+
+		for (const Node* node = this->m_root; node; node = node->is_leaf ? nullptr : static_cast<const InnerNode*>(node)->children[0])
+			height++;
+
+		return height;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Insert(ConstKeyTypeLRef key, ValueTypeRRef value)
+	{
+		ValueTypePtr slot = this->_insert_slot(key);
+
+		if (!slot)
+			return false;
+
+		MoveObject(slot, value);
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		ValueTypePtr slot = this->_insert_slot(key);
+
+		if (!slot)
+			return false;
+
+		CopyObject(slot, value);
+
+		return true;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Remove(ConstKeyTypeLRef key)
+	{
+		if (!this->m_root || !this->_remove(this->m_root, key))
+			return false;
+
+		// The root is exempt from the minimum occupancy, it only shrinks the tree once it is empty.
+		if (this->m_root->count == 0)
+		{
+			Node* root = this->m_root;
+
+			if (root->is_leaf)
+			{
+				this->m_root = nullptr;
+				this->m_head = nullptr;
+				this->m_tail = nullptr;
+			}
+			else
+				this->m_root = static_cast<InnerNode*>(root)->children[0];
+
+			this->m_allocator->Deallocate(root);
+		}
+
+		return true;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Clear()
+	{
+		if (this->m_root)
+			this->_release(this->m_root);
+
+		this->m_root = nullptr;
+		this->m_head = nullptr;
+		this->m_tail = nullptr;
+
+		this->m_count = 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::KeyTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_keys(LeafNode* node)
+	{
+		return reinterpret_cast<KeyTypePtr>(node->key_storage);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::KeyTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_keys(InnerNode* node)
+	{
+		return reinterpret_cast<KeyTypePtr>(node->key_storage);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_values(LeafNode* node)
+	{
+		return reinterpret_cast<ValueTypePtr>(node->value_storage);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_search(ConstKeyTypePtr keys, Size count, ConstKeyTypeLRef key)
+	{
+	#if defined(__AVX2__)
+		if constexpr (::std::is_integral<KeyType>::value && sizeof(KeyType) == 4)
+		{
+			// Unsigned keys are biased into the signed range, since AVX2 only compares signed lanes.
+			const __m256i bias = _mm256_set1_epi32(::std::is_signed<KeyType>::value ? 0 : ::std::numeric_limits<I32>::min());
+			const __m256i target = _mm256_xor_si256(_mm256_set1_epi32(static_cast<I32>(key)), bias);
+
+			Size index = 0;
+
+			// The keys are sorted, so the lanes below the key form a prefix of each block.
+			for (; index + 8 <= count; index += 8)
+			{
+				__m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + index)), bias);
+				U32 mask = static_cast<U32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, block))));
+
+				if (mask != 0xFF)
+					return index + PopCount(mask);
+			}
+
+			while (index < count && keys[index] < key)
+				index++;
+
+			return index;
+		}
+		else if constexpr (::std::is_integral<KeyType>::value && sizeof(KeyType) == 8)
+		{
+			const __m256i bias = _mm256_set1_epi64x(::std::is_signed<KeyType>::value ? 0 : ::std::numeric_limits<I64>::min());
+			const __m256i target = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<I64>(key)), bias);
+
+			Size index = 0;
+
+			for (; index + 4 <= count; index += 4)
+			{
+				__m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + index)), bias);
+				U32 mask = static_cast<U32>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(target, block))));
+
+				if (mask != 0xF)
+					return index + PopCount(mask);
+			}
+
+			while (index < count && keys[index] < key)
+				index++;
+
+			return index;
+		}
+		else
+	#endif
+		{
+			return BranchlessLowerBound(keys, count, key);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_child_index(InnerNode* node, ConstKeyTypeLRef key)
+	{
+		KeyTypePtr keys = _keys(node);
+		Size position = _search(keys, node->count, key);
+
+		// A separator is the smallest key of its right subtree, so equal keys descend to the right.
+		return position + (position < node->count && !(key < keys[position]));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InType>
+	FORGE_FORCE_INLINE Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_open_gap(InType* array, Size count, Size index)
+	{
+		for (Size position = count; position > index; position--)
+		{
+			MoveObject(array + position, array[position - 1]);
+			DestructArray(array + position - 1, 1);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InType>
+	FORGE_FORCE_INLINE Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_close_gap(InType* array, Size count, Size index)
+	{
+		DestructArray(array + index, 1);
+
+		for (Size position = index + 1; position < count; position++)
+		{
+			MoveObject(array + position - 1, array[position]);
+			DestructArray(array + position, 1);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InType>
+	FORGE_FORCE_INLINE Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_relocate(InType* target, InType* source, Size count)
+	{
+		MoveArray(target, source, count);
+		DestructArray(source, count);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::LeafNode* BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_create_leaf()
+	{
+		LeafNode* node = static_cast<LeafNode*>(this->m_allocator->Allocate(sizeof(LeafNode), alignof(LeafNode)));
+
+		node->count = 0;
+		node->is_leaf = true;
+		node->previous = nullptr;
+		node->next = nullptr;
+
+		return node;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::InnerNode* BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_create_inner()
+	{
+		InnerNode* node = static_cast<InnerNode*>(this->m_allocator->Allocate(sizeof(InnerNode), alignof(InnerNode)));
+
+		node->count = 0;
+		node->is_leaf = false;
+
+		return node;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_release(Node* node)
+	{
+		if (node->is_leaf)
+		{
+			LeafNode* leaf = static_cast<LeafNode*>(node);
+
+			DestructArray(_keys(leaf), leaf->count);
+			DestructArray(_values(leaf), leaf->count);
+		}
+		else
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+
+			for (Size index = 0; index <= inner->count; index++)
+				this->_release(inner->children[index]);
+
+			DestructArray(_keys(inner), inner->count);
+		}
+
+		this->m_allocator->Deallocate(node);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::Node* BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_clone(const Node* node, LeafNode*& previous)
+	{
+		if (node->is_leaf)
+		{
+			LeafNode* source = const_cast<LeafNode*>(static_cast<const LeafNode*>(node));
+			LeafNode* leaf = this->_create_leaf();
+
+			CopyArray(_keys(leaf), _keys(source), source->count);
+			CopyArray(_values(leaf), _values(source), source->count);
+
+			leaf->count = source->count;
+			leaf->previous = previous;
+
+			// The leaves are cloned in key order, so each one is appended to the new chain.
+			if (previous)
+				previous->next = leaf;
+			else
+				this->m_head = leaf;
+
+			previous = leaf;
+
+			return leaf;
+		}
+
+		InnerNode* source = const_cast<InnerNode*>(static_cast<const InnerNode*>(node));
+		InnerNode* inner = this->_create_inner();
+
+		CopyArray(_keys(inner), _keys(source), source->count);
+
+		for (Size index = 0; index <= source->count; index++)
+			inner->children[index] = this->_clone(source->children[index], previous);
+
+		inner->count = source->count;
+
+		return inner;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::LeafNode* BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_find_leaf(ConstKeyTypeLRef key) const
+	{
+		Node* node = this->m_root;
+
+		if (!node)
+			return nullptr;
+
+		while (!node->is_leaf)
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+
+			node = inner->children[_child_index(inner, key)];
+		}
+
+		return static_cast<LeafNode*>(node);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_is_full(const Node* node)
+	{
+		return node->count == (node->is_leaf ? LEAF_CAPACITY : INNER_CAPACITY);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename BTreeMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypePtr BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_insert_slot(ConstKeyTypeLRef key)
+	{
+		if (!this->m_root)
+		{
+			LeafNode* leaf = this->_create_leaf();
+
+			this->m_root = leaf;
+			this->m_head = leaf;
+			this->m_tail = leaf;
+		}
+
+		// Full nodes are split on the way down, so a split never has to propagate back up.
+		if (_is_full(this->m_root))
+		{
+			InnerNode* root = this->_create_inner();
+
+			root->children[0] = this->m_root;
+			this->m_root = root;
+
+			this->_split_child(root, 0);
+		}
+
+		Node* node = this->m_root;
+
+		while (!node->is_leaf)
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+			Size index = _child_index(inner, key);
+
+			if (_is_full(inner->children[index]))
+			{
+				this->_split_child(inner, index);
+
+				if (!(key < _keys(inner)[index]))
+					index++;
+			}
+
+			node = inner->children[index];
+		}
+
+		LeafNode* leaf = static_cast<LeafNode*>(node);
+		KeyTypePtr keys = _keys(leaf);
+		Size position = _search(keys, leaf->count, key);
+
+		if (position < leaf->count && !(key < keys[position]))
+			return nullptr;
+
+		_open_gap(keys, leaf->count, position);
+		_open_gap(_values(leaf), leaf->count, position);
+
+		CopyObject(keys + position, key);
+
+		leaf->count++;
+		this->m_count++;
+
+		return _values(leaf) + position;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_split_child(InnerNode* parent, Size index)
+	{
+		Node* child = parent->children[index];
+		Node* sibling;
+
+		KeyTypePtr parent_keys = _keys(parent);
+
+		_open_gap(parent_keys, parent->count, index);
+
+		if (child->is_leaf)
+		{
+			LeafNode* left = static_cast<LeafNode*>(child);
+			LeafNode* right = this->_create_leaf();
+
+			Size half = left->count / 2;
+
+			_relocate(_keys(right), _keys(left) + half, left->count - half);
+			_relocate(_values(right), _values(left) + half, left->count - half);
+
+			right->count = static_cast<U16>(left->count - half);
+			left->count = static_cast<U16>(half);
+
+			right->previous = left;
+			right->next = left->next;
+
+			if (left->next)
+				left->next->previous = right;
+			else
+				this->m_tail = right;
+
+			left->next = right;
+
+			// Leaves keep every key, so the separator is a copy of the first key on the right.
+			CopyObject(parent_keys + index, _keys(right)[0]);
+
+			sibling = right;
+		}
+		else
+		{
+			InnerNode* left = static_cast<InnerNode*>(child);
+			InnerNode* right = this->_create_inner();
+
+			Size middle = left->count / 2;
+			Size right_count = left->count - middle - 1;
+
+			_relocate(_keys(right), _keys(left) + middle + 1, right_count);
+			MemoryCopy(right->children, left->children + middle + 1, (right_count + 1) * sizeof(Node*));
+
+			// The middle key of an inner node moves up into the parent.
+			MoveObject(parent_keys + index, _keys(left)[middle]);
+			DestructArray(_keys(left) + middle, 1);
+
+			right->count = static_cast<U16>(right_count);
+			left->count = static_cast<U16>(middle);
+
+			sibling = right;
+		}
+
+		MemoryMove(parent->children + index + 2, parent->children + index + 1, (parent->count - index) * sizeof(Node*));
+
+		parent->children[index + 1] = sibling;
+		parent->count++;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_remove(Node* node, ConstKeyTypeLRef key)
+	{
+		if (node->is_leaf)
+		{
+			LeafNode* leaf = static_cast<LeafNode*>(node);
+			KeyTypePtr keys = _keys(leaf);
+			Size position = _search(keys, leaf->count, key);
+
+			if (position == leaf->count || key < keys[position])
+				return false;
+
+			_close_gap(keys, leaf->count, position);
+			_close_gap(_values(leaf), leaf->count, position);
+
+			leaf->count--;
+			this->m_count--;
+
+			return true;
+		}
+
+		InnerNode* inner = static_cast<InnerNode*>(node);
+		Size index = _child_index(inner, key);
+
+		if (!this->_remove(inner->children[index], key))
+			return false;
+
+		Node* child = inner->children[index];
+
+		// Separators equal to a removed key are left in place, they still partition the keys.
+		if (child->count < (child->is_leaf ? LEAF_MINIMUM : INNER_MINIMUM))
+			this->_rebalance(inner, index);
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_rebalance(InnerNode* parent, Size index)
+	{
+		Node* child = parent->children[index];
+		Node* left = index > 0 ? parent->children[index - 1] : nullptr;
+		Node* right = index < parent->count ? parent->children[index + 1] : nullptr;
+
+		Size minimum = child->is_leaf ? LEAF_MINIMUM : INNER_MINIMUM;
+
+		KeyTypePtr parent_keys = _keys(parent);
+
+		if (left && left->count > minimum)
+		{
+			if (child->is_leaf)
+			{
+				LeafNode* target = static_cast<LeafNode*>(child);
+				LeafNode* source = static_cast<LeafNode*>(left);
+
+				Size last = source->count - 1;
+
+				_open_gap(_keys(target), target->count, 0);
+				_open_gap(_values(target), target->count, 0);
+
+				_relocate(_keys(target), _keys(source) + last, 1);
+				_relocate(_values(target), _values(source) + last, 1);
+
+				parent_keys[index - 1] = _keys(target)[0];
+			}
+			else
+			{
+				InnerNode* target = static_cast<InnerNode*>(child);
+				InnerNode* source = static_cast<InnerNode*>(left);
+
+				Size last = source->count - 1;
+
+				// The separator rotates down into the child and the last key of the sibling up.
+				_open_gap(_keys(target), target->count, 0);
+				MoveObject(_keys(target), parent_keys[index - 1]);
+				MoveObject(parent_keys[index - 1], _keys(source)[last]);
+				DestructArray(_keys(source) + last, 1);
+
+				MemoryMove(target->children + 1, target->children, (target->count + 1) * sizeof(Node*));
+				target->children[0] = source->children[source->count];
+			}
+
+			left->count--;
+			child->count++;
+		}
+		else if (right && right->count > minimum)
+		{
+			if (child->is_leaf)
+			{
+				LeafNode* target = static_cast<LeafNode*>(child);
+				LeafNode* source = static_cast<LeafNode*>(right);
+
+				MoveObject(_keys(target) + target->count, _keys(source)[0]);
+				MoveObject(_values(target) + target->count, _values(source)[0]);
+
+				_close_gap(_keys(source), source->count, 0);
+				_close_gap(_values(source), source->count, 0);
+
+				parent_keys[index] = _keys(source)[0];
+			}
+			else
+			{
+				InnerNode* target = static_cast<InnerNode*>(child);
+				InnerNode* source = static_cast<InnerNode*>(right);
+
+				MoveObject(_keys(target) + target->count, parent_keys[index]);
+				MoveObject(parent_keys[index], _keys(source)[0]);
+				_close_gap(_keys(source), source->count, 0);
+
+				target->children[target->count + 1] = source->children[0];
+				MemoryMove(source->children, source->children + 1, source->count * sizeof(Node*));
+			}
+
+			right->count--;
+			child->count++;
+		}
+		else if (left)
+			this->_merge_children(parent, index - 1);
+		else
+			this->_merge_children(parent, index);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void BTreeMap<InKeyType, InValueType, InAllocationPolicy>::_merge_children(InnerNode* parent, Size index)
+	{
+		Node* left = parent->children[index];
+		Node* right = parent->children[index + 1];
+
+		KeyTypePtr parent_keys = _keys(parent);
+
+		if (left->is_leaf)
+		{
+			LeafNode* target = static_cast<LeafNode*>(left);
+			LeafNode* source = static_cast<LeafNode*>(right);
+
+			_relocate(_keys(target) + target->count, _keys(source), source->count);
+			_relocate(_values(target) + target->count, _values(source), source->count);
+
+			target->count += source->count;
+			target->next = source->next;
+
+			if (source->next)
+				source->next->previous = target;
+			else
+				this->m_tail = target;
+		}
+		else
+		{
+			InnerNode* target = static_cast<InnerNode*>(left);
+			InnerNode* source = static_cast<InnerNode*>(right);
+
+			// The separator comes down between the keys of the two nodes.
+			MoveObject(_keys(target) + target->count, parent_keys[index]);
+
+			_relocate(_keys(target) + target->count + 1, _keys(source), source->count);
+			MemoryCopy(target->children + target->count + 1, source->children, (source->count + 1) * sizeof(Node*));
+
+			target->count += source->count + 1;
+		}
+
+		_close_gap(parent_keys, parent->count, index);
+		MemoryMove(parent->children + index + 1, parent->children + index + 2, (parent->count - index - 1) * sizeof(Node*));
+
+		parent->count--;
+
+		this->m_allocator->Deallocate(right);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,482 @@
+#include "Collections/ConcurrentBTreeMap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::ConcurrentBTreeMap(AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_root(nullptr), m_count(0)
+	{
+		this->m_root.store(this->_create_leaf(), ::std::memory_order_release);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::~ConcurrentBTreeMap()
+	{
+		this->_release(this->m_root.load(::std::memory_order_acquire));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::GetCount() const
+	{
+		return this->m_count.load(::std::memory_order_relaxed);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::IsEmpty() const
+	{
+		return this->GetCount() == 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::Contains(ConstKeyTypeLRef key) const
+	{
+		for (;;)
+		{
+			LeafNode* leaf;
+			U64 version;
+
+			if (!this->_find_leaf(key, leaf, version))
+				continue;
+
+			Size count = leaf->count;
+			Size position = _lower_bound(leaf->keys, count, key);
+
+			Bool found = position < count && !(key < leaf->keys[position]);
+
+			if (leaf->lock.Validate(version))
+				return found;
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(ConstKeyTypeLRef key, ValueTypeLRef value) const
+	{
+		alignas(ValueType) Byte buffer[sizeof(ValueType)];
+
+		for (;;)
+		{
+			LeafNode* leaf;
+			U64 version;
+
+			if (!this->_find_leaf(key, leaf, version))
+				continue;
+
+			Size count = leaf->count;
+			Size position = _lower_bound(leaf->keys, count, key);
+
+			Bool found = position < count && !(key < leaf->keys[position]);
+
+			// The value is staged in a buffer, so the caller never sees a torn copy.
+			if (found)
+				MemoryCopy(buffer, leaf->values + position, sizeof(ValueType));
+
+			if (!leaf->lock.Validate(version))
+				continue;
+
+			if (found)
+				MemoryCopy(&value, buffer, sizeof(ValueType));
+
+			return found;
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	template<typename InCallable>
+	Size ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::Scan(ConstKeyTypeLRef first, ConstKeyTypeLRef last, InCallable callable) const
+	{
+		if (last < first)
+			return 0;
+
+		alignas(KeyType) Byte key_buffer[sizeof(KeyType) * LEAF_CAPACITY];
+		alignas(ValueType) Byte value_buffer[sizeof(ValueType) * LEAF_CAPACITY];
+
+		KeyTypePtr keys = reinterpret_cast<KeyTypePtr>(key_buffer);
+		ValueTypePtr values = reinterpret_cast<ValueTypePtr>(value_buffer);
+
+		KeyType resume = first;
+		Bool inclusive = true;
+
+		LeafNode* leaf = nullptr;
+		U64 version = 0;
+
+		Size visited = 0;
+
+		for (;;)
+		{
+			// A leaf that failed validation may have been split, so the scan descends again from
+			// the root to the leaf that now holds the resume key.
+			if (!leaf && !this->_find_leaf(resume, leaf, version))
+				continue;
+
+			Size count = leaf->count;
+			Size position = _lower_bound(leaf->keys, count, resume);
+
+			if (!inclusive && position < count && !(resume < leaf->keys[position]))
+				position++;
+
+			Size batch = 0;
+			Bool finished = false;
+
+			for (; position < count; position++, batch++)
+			{
+				if (last < leaf->keys[position])
+				{
+					finished = true;
+					break;
+				}
+
+				MemoryCopy(keys + batch, leaf->keys + position, sizeof(KeyType));
+				MemoryCopy(values + batch, leaf->values + position, sizeof(ValueType));
+			}
+
+			LeafNode* next = leaf->next;
+
+			if (!leaf->lock.Validate(version))
+			{
+				leaf = nullptr;
+				continue;
+			}
+
+			for (Size index = 0; index < batch; index++)
+				callable(static_cast<ConstKeyTypeLRef>(keys[index]), static_cast<ConstValueTypeLRef>(values[index]));
+
+			visited += batch;
+
+			if (batch > 0)
+			{
+				resume = keys[batch - 1];
+				inclusive = false;
+			}
+
+			if (finished || !next)
+				return visited;
+
+			leaf = next;
+
+			if (!leaf->lock.TryBeginRead(version))
+				leaf = nullptr;
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		return this->_write(key, value, false);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		return this->_write(key, value, true);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::Remove(ConstKeyTypeLRef key)
+	{
+		for (;;)
+		{
+			LeafNode* leaf;
+			U64 version;
+
+			// Nodes never merge, so the leaf that held the key when it was read still covers it as
+			// long as its own version is unchanged.
+			if (!this->_find_leaf(key, leaf, version) || !leaf->lock.TryUpgrade(version))
+				continue;
+
+			Size count = leaf->count;
+			Size position = _lower_bound(leaf->keys, count, key);
+
+			if (position == count || key < leaf->keys[position])
+			{
+				leaf->lock.WriteUnlock();
+
+				return false;
+			}
+
+			MemoryMove(leaf->keys + position, leaf->keys + position + 1, (count - position - 1) * sizeof(KeyType));
+			MemoryMove(leaf->values + position, leaf->values + position + 1, (count - position - 1) * sizeof(ValueType));
+
+			leaf->count--;
+			leaf->lock.WriteUnlock();
+
+			this->m_count.fetch_sub(1, ::std::memory_order_relaxed);
+
+			return true;
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_lower_bound(ConstKeyTypePtr keys, Size count, ConstKeyTypeLRef key)
+	{
+		// The keys may be torn under an optimistic read, which only affects the result, never the bounds.
+		return BranchlessLowerBound(keys, count, key);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::LeafNode* ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_create_leaf()
+	{
+		LeafNode* node = new (this->m_allocator->Allocate(sizeof(LeafNode), alignof(LeafNode))) LeafNode;
+
+		node->count = 0;
+		node->is_leaf = true;
+		node->next = nullptr;
+
+		return node;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::InnerNode* ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_create_inner()
+	{
+		InnerNode* node = new (this->m_allocator->Allocate(sizeof(InnerNode), alignof(InnerNode))) InnerNode;
+
+		node->count = 0;
+		node->is_leaf = false;
+
+		return node;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_release(Node* node)
+	{
+		if (node->is_leaf)
+			static_cast<LeafNode*>(node)->~LeafNode();
+		else
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+
+			for (Size index = 0; index <= inner->count; index++)
+				this->_release(inner->children[index]);
+
+			inner->~InnerNode();
+		}
+
+		this->m_allocator->Deallocate(node);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_find_leaf(ConstKeyTypeLRef key, LeafNode*& leaf, U64& version) const
+	{
+		Node* node = this->m_root.load(::std::memory_order_acquire);
+		U64 node_version;
+
+		if (!node->lock.TryBeginRead(node_version) || node != this->m_root.load(::std::memory_order_acquire))
+			return false;
+
+		while (!node->is_leaf)
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+
+			Size count = inner->count;
+			Size position = _lower_bound(inner->keys, count, key);
+
+			// A separator is the smallest key of its right subtree, so equal keys descend to the right.
+			position += position < count && !(key < inner->keys[position]);
+
+			Node* child = inner->children[position];
+			U64 child_version;
+
+			// The child pointer is only trusted once the parent is validated, and the parent is
+			// validated again after the child version is recorded to couple the two reads.
+			if (!inner->lock.Validate(node_version) || !child->lock.TryBeginRead(child_version) || !inner->lock.Validate(node_version))
+				return false;
+
+			node = child;
+			node_version = child_version;
+		}
+
+		leaf = static_cast<LeafNode*>(node);
+		version = node_version;
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_split(InnerNode* parent, U64& parent_version, Node* node, U64& node_version)
+	{
+		if (parent && !parent->lock.TryUpgrade(parent_version))
+			return false;
+
+		if (!node->lock.TryUpgrade(node_version))
+		{
+			if (parent)
+				parent->lock.WriteUnlock();
+
+			return false;
+		}
+
+		// Without a parent the node must still be the root, which another split may have replaced.
+		if (!parent && node != this->m_root.load(::std::memory_order_acquire))
+		{
+			node->lock.WriteUnlock();
+
+			return false;
+		}
+
+		Node* sibling;
+		ConstKeyTypePtr separator;
+
+		if (node->is_leaf)
+		{
+			LeafNode* left = static_cast<LeafNode*>(node);
+			LeafNode* right = this->_create_leaf();
+
+			Size half = left->count / 2;
+
+			MemoryCopy(right->keys, left->keys + half, (left->count - half) * sizeof(KeyType));
+			MemoryCopy(right->values, left->values + half, (left->count - half) * sizeof(ValueType));
+
+			right->count = static_cast<U16>(left->count - half);
+			right->next = left->next;
+
+			left->count = static_cast<U16>(half);
+			left->next = right;
+
+			separator = right->keys;
+			sibling = right;
+		}
+		else
+		{
+			InnerNode* left = static_cast<InnerNode*>(node);
+			InnerNode* right = this->_create_inner();
+
+			Size middle = left->count / 2;
+			Size right_count = left->count - middle - 1;
+
+			MemoryCopy(right->keys, left->keys + middle + 1, right_count * sizeof(KeyType));
+			MemoryCopy(right->children, left->children + middle + 1, (right_count + 1) * sizeof(Node*));
+
+			right->count = static_cast<U16>(right_count);
+			left->count = static_cast<U16>(middle);
+
+			// The middle key stays in place past the new count of the left node until it is copied.
+			separator = left->keys + middle;
+			sibling = right;
+		}
+
+		if (parent)
+		{
+			Size count = parent->count;
+			Size position = _lower_bound(parent->keys, count, *separator);
+
+			MemoryMove(parent->keys + position + 1, parent->keys + position, (count - position) * sizeof(KeyType));
+			MemoryMove(parent->children + position + 2, parent->children + position + 1, (count - position) * sizeof(Node*));
+
+			parent->keys[position] = *separator;
+			parent->children[position + 1] = sibling;
+			parent->count++;
+		}
+		else
+		{
+			InnerNode* root = this->_create_inner();
+
+			root->keys[0] = *separator;
+			root->children[0] = node;
+			root->children[1] = sibling;
+			root->count = 1;
+
+			this->m_root.store(root, ::std::memory_order_release);
+		}
+
+		node->lock.WriteUnlock();
+
+		if (parent)
+			parent->lock.WriteUnlock();
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>::_write(ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool assign)
+	{
+		for (;;)
+		{
+			Node* node = this->m_root.load(::std::memory_order_acquire);
+			U64 node_version;
+
+			if (!node->lock.TryBeginRead(node_version) || node != this->m_root.load(::std::memory_order_acquire))
+				continue;
+
+			InnerNode* parent = nullptr;
+			U64 parent_version = 0;
+
+			Bool restart = false;
+
+			while (!node->is_leaf)
+			{
+				InnerNode* inner = static_cast<InnerNode*>(node);
+
+				// Full nodes are split on the way down, so a parent always has room for a separator.
+				if (inner->count == INNER_CAPACITY)
+				{
+					this->_split(parent, parent_version, inner, node_version);
+
+					restart = true;
+					break;
+				}
+
+				if (parent && !parent->lock.Validate(parent_version))
+				{
+					restart = true;
+					break;
+				}
+
+				parent = inner;
+				parent_version = node_version;
+
+				Size count = inner->count;
+				Size position = _lower_bound(inner->keys, count, key);
+
+				position += position < count && !(key < inner->keys[position]);
+
+				node = inner->children[position];
+
+				if (!inner->lock.Validate(parent_version) || !node->lock.TryBeginRead(node_version))
+				{
+					restart = true;
+					break;
+				}
+			}
+
+			if (restart)
+				continue;
+
+			LeafNode* leaf = static_cast<LeafNode*>(node);
+
+			if (leaf->count == LEAF_CAPACITY)
+			{
+				this->_split(parent, parent_version, leaf, node_version);
+
+				continue;
+			}
+
+			if (!leaf->lock.TryUpgrade(node_version))
+				continue;
+
+			if (parent && !parent->lock.Validate(parent_version))
+			{
+				leaf->lock.WriteUnlock();
+
+				continue;
+			}
+
+			Size count = leaf->count;
+			Size position = _lower_bound(leaf->keys, count, key);
+
+			if (position < count && !(key < leaf->keys[position]))
+			{
+				if (assign)
+					leaf->values[position] = value;
+
+				leaf->lock.WriteUnlock();
+
+				return false;
+			}
+
+			MemoryMove(leaf->keys + position + 1, leaf->keys + position, (count - position) * sizeof(KeyType));
+			MemoryMove(leaf->values + position + 1, leaf->values + position, (count - position) * sizeof(ValueType));
+
+			leaf->keys[position] = key;
+			leaf->values[position] = value;
+			leaf->count++;
+
+			leaf->lock.WriteUnlock();
+
+			this->m_count.fetch_add(1, ::std::memory_order_relaxed);
+
+			return true;
+		}
+	}
+}
\ No newline at end of file
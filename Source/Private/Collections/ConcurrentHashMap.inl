@@ -0,0 +1,420 @@
+#include "Collections/ConcurrentHashMap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConcurrentHashMap(AllocatorTypePtr allocator)
+		: ConcurrentHashMap(MINIMUM_CAPACITY / 4 * 3, allocator) {}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConcurrentHashMap(Size capacity, AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_table(nullptr), m_count(0)
+	{
+		Size bucket_count = MINIMUM_CAPACITY;
+
+		// Keeps the table at most three quarters full for the requested capacity.
+		while (bucket_count / 4 * 3 < capacity)
+			bucket_count *= 2;
+
+		Table* table = this->_create_table(bucket_count);
+
+		this->_initialize_buckets(table, 0, bucket_count);
+
+		this->m_table.store(table, ::std::memory_order_release);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::~ConcurrentHashMap()
+	{
+		Table* table = this->m_table.load(::std::memory_order_acquire);
+		Table* next = table->next.load(::std::memory_order_acquire);
+
+		// An interrupted transfer leaves the chains of the buckets it did not reach in the old table.
+		for (Size index = 0; index < table->capacity; index++)
+		{
+			Node* head = table->buckets[index].load(::std::memory_order_relaxed);
+
+			if (head != _moved())
+				this->_release_chain(head);
+		}
+
+		// Only the buckets of the next table that a transfer reached are initialized.
+		if (next)
+		{
+			for (Size index = 0; index < table->capacity; index++)
+			{
+				if (table->buckets[index].load(::std::memory_order_relaxed) != _moved())
+					continue;
+
+				this->_release_chain(next->buckets[index].load(::std::memory_order_relaxed));
+				this->_release_chain(next->buckets[index + table->capacity].load(::std::memory_order_relaxed));
+			}
+
+			this->_release_table(next);
+		}
+
+		this->_release_table(table);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Size ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::GetCount() const
+	{
+		return this->m_count.load(::std::memory_order_relaxed);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Size ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::GetCapacity() const
+	{
+		Reclaim::Guard guard(this->m_reclaim);
+
+		return this->m_table.load(::std::memory_order_acquire)->capacity;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::IsEmpty() const
+	{
+		return this->GetCount() == 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Contains(ConstKeyTypeLRef key) const
+	{
+		Reclaim::Guard guard(this->m_reclaim);
+
+		U64 hash = _hash(key);
+		Table* table = this->m_table.load(::std::memory_order_acquire);
+
+		for (;;)
+		{
+			Node* node = table->buckets[hash & (table->capacity - 1)].load(::std::memory_order_acquire);
+
+			if (node == _moved())
+			{
+				table = table->next.load(::std::memory_order_acquire);
+				continue;
+			}
+
+			for (; node; node = node->next.load(::std::memory_order_acquire))
+				if (node->hash == hash && node->key == key)
+					return true;
+
+			return false;
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::TryGet(ConstKeyTypeLRef key, ValueTypeLRef value) const
+	{
+		Reclaim::Guard guard(this->m_reclaim);
+
+		U64 hash = _hash(key);
+		Table* table = this->m_table.load(::std::memory_order_acquire);
+
+		for (;;)
+		{
+			Node* node = table->buckets[hash & (table->capacity - 1)].load(::std::memory_order_acquire);
+
+			// A moved bucket only ever appears once the next table is attached.
+			if (node == _moved())
+			{
+				table = table->next.load(::std::memory_order_acquire);
+				continue;
+			}
+
+			for (; node; node = node->next.load(::std::memory_order_acquire))
+			{
+				if (node->hash == hash && node->key == key)
+				{
+					value = node->value;
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		return this->_write(key, value, false);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		return this->_write(key, value, true);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Remove(ConstKeyTypeLRef key)
+	{
+		Reclaim::Guard guard(this->m_reclaim);
+
+		U64 hash = _hash(key);
+		Size index;
+
+		Table* table = this->_lock_bucket(hash, index);
+
+		::std::atomic<Node*>* link = &table->buckets[index];
+		Node* removed = nullptr;
+
+		for (Node* node = link->load(::std::memory_order_relaxed); node; node = node->next.load(::std::memory_order_relaxed))
+		{
+			if (node->hash == hash && node->key == key)
+			{
+				// The removed node keeps its successor, so readers standing on it carry on.
+				link->store(node->next.load(::std::memory_order_relaxed), ::std::memory_order_release);
+				removed = node;
+
+				break;
+			}
+
+			link = &node->next;
+		}
+
+		_unlock(table, index);
+
+		if (removed)
+		{
+			this->m_count.fetch_sub(1, ::std::memory_order_relaxed);
+			this->m_reclaim.Retire(removed, this->m_allocator);
+		}
+
+		this->_help_transfer();
+
+		return removed != nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE U64 ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_hash(ConstKeyTypeLRef key)
+	{
+		U64 hash = static_cast<U64>(HasherType()(key));
+
+		// Mixes the hash, since identity hashes of integers would fill only a few buckets.
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ull;
+		hash ^= hash >> 33;
+
+		return hash;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_moved()
+	{
+		// Nodes are at least pointer aligned, so an odd address never refers to one.
+		return reinterpret_cast<Node*>(static_cast<::std::uintptr_t>(1));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_lock(Table* table, Size index)
+	{
+		while (table->locks[index].exchange(1, ::std::memory_order_acquire))
+		{
+			while (table->locks[index].load(::std::memory_order_relaxed))
+				OptimisticLock::Pause();
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_unlock(Table* table, Size index)
+	{
+		table->locks[index].store(0, ::std::memory_order_release);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Table* ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_create_table(Size capacity)
+	{
+		// The table, its bucket heads and its bucket locks share a single allocation.
+		Size size = sizeof(Table) + capacity * (sizeof(::std::atomic<Node*>) + sizeof(::std::atomic<U8>));
+		BytePtr memory = static_cast<BytePtr>(this->m_allocator->Allocate(size, alignof(Table)));
+
+		Table* table = new (memory) Table;
+
+		table->capacity = capacity;
+		table->buckets = reinterpret_cast<::std::atomic<Node*>*>(memory + sizeof(Table));
+		table->locks = reinterpret_cast<::std::atomic<U8>*>(table->buckets + capacity);
+
+		table->next.store(nullptr, ::std::memory_order_relaxed);
+		table->transfer_index.store(0, ::std::memory_order_relaxed);
+		table->transfer_count.store(0, ::std::memory_order_relaxed);
+
+		return table;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_initialize_buckets(Table* table, Size first, Size last)
+	{
+		for (Size index = first; index < last; index++)
+		{
+			new (table->buckets + index) ::std::atomic<Node*>(nullptr);
+			new (table->locks + index) ::std::atomic<U8>(0);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_release_table(Table* table)
+	{
+		table->~Table();
+
+		this->m_allocator->Deallocate(table);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_release_chain(Node* node)
+	{
+		while (node)
+		{
+			Node* next = node->next.load(::std::memory_order_relaxed);
+
+			node->~Node();
+			this->m_allocator->Deallocate(node);
+
+			node = next;
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_create_node(U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Node* next)
+	{
+		return new (this->m_allocator->Allocate(sizeof(Node), alignof(Node))) Node(hash, key, value, next);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Table* ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_lock_bucket(U64 hash, Size& index)
+	{
+		Table* table = this->m_table.load(::std::memory_order_acquire);
+
+		for (;;)
+		{
+			index = hash & (table->capacity - 1);
+
+			// Follows moved buckets without waiting, the bucket lock is only taken on the final table.
+			if (table->buckets[index].load(::std::memory_order_acquire) == _moved())
+			{
+				table = table->next.load(::std::memory_order_acquire);
+				continue;
+			}
+
+			_lock(table, index);
+
+			if (table->buckets[index].load(::std::memory_order_relaxed) != _moved())
+				return table;
+
+			_unlock(table, index);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_write(ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool assign)
+	{
+		Reclaim::Guard guard(this->m_reclaim);
+
+		U64 hash = _hash(key);
+		Size index;
+
+		Table* table = this->_lock_bucket(hash, index);
+
+		::std::atomic<Node*>* link = &table->buckets[index];
+		Node* node = link->load(::std::memory_order_relaxed);
+
+		for (; node; node = node->next.load(::std::memory_order_relaxed))
+		{
+			if (node->hash == hash && node->key == key)
+				break;
+
+			link = &node->next;
+		}
+
+		Bool inserted = !node;
+
+		if (inserted)
+			link->store(this->_create_node(hash, key, value, nullptr), ::std::memory_order_release);
+		else if (assign)
+		{
+			// Readers may be copying the old value, so a new node takes its place in the chain.
+			link->store(this->_create_node(hash, key, value, node->next.load(::std::memory_order_relaxed)), ::std::memory_order_release);
+		}
+
+		_unlock(table, index);
+
+		if (inserted)
+		{
+			Size count = this->m_count.fetch_add(1, ::std::memory_order_relaxed) + 1;
+			Table* current = this->m_table.load(::std::memory_order_acquire);
+
+			if (count > current->capacity / 4 * 3)
+				this->_start_resize(current);
+		}
+		else if (assign)
+			this->m_reclaim.Retire(node, this->m_allocator);
+
+		this->_help_transfer();
+
+		return inserted;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_start_resize(Table* table)
+	{
+		if (table->next.load(::std::memory_order_acquire))
+			return;
+
+		Table* next = this->_create_table(table->capacity * 2);
+		Table* expected = nullptr;
+
+		// Only one writer attaches its table, the others release theirs before anyone saw them.
+		if (!table->next.compare_exchange_strong(expected, next, ::std::memory_order_acq_rel))
+			this->_release_table(next);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_help_transfer()
+	{
+		Table* table = this->m_table.load(::std::memory_order_acquire);
+		Table* next = table->next.load(::std::memory_order_acquire);
+
+		if (!next)
+			return;
+
+		Size first = table->transfer_index.fetch_add(TRANSFER_STRIDE, ::std::memory_order_relaxed);
+
+		if (first >= table->capacity)
+			return;
+
+		Size last = first + TRANSFER_STRIDE < table->capacity ? first + TRANSFER_STRIDE : table->capacity;
+
+		for (Size index = first; index < last; index++)
+			this->_transfer_bucket(table, next, index);
+
+		// The writer that completes the last stride installs the new table and retires the old one.
+		if (table->transfer_count.fetch_add(last - first, ::std::memory_order_acq_rel) + (last - first) == table->capacity)
+		{
+			this->m_table.store(next, ::std::memory_order_release);
+			this->m_reclaim.Retire(table, this->m_allocator);
+		}
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_transfer_bucket(Table* table, Table* next, Size index)
+	{
+		_lock(table, index);
+
+		Node* head = table->buckets[index].load(::std::memory_order_relaxed);
+
+		// The chain splits into the two buckets of the doubled table that map back to this one,
+		// which nothing else reaches until this bucket is marked as moved.
+		this->_initialize_buckets(next, index, index + 1);
+		this->_initialize_buckets(next, index + table->capacity, index + table->capacity + 1);
+
+		// Readers may still be walking the old chain, so its nodes are copied rather than relinked.
+		for (Node* node = head; node; node = node->next.load(::std::memory_order_relaxed))
+		{
+			::std::atomic<Node*>& bucket = next->buckets[node->hash & (next->capacity - 1)];
+
+			bucket.store(this->_create_node(node->hash, node->key, node->value, bucket.load(::std::memory_order_relaxed)), ::std::memory_order_relaxed);
+		}
+
+		table->buckets[index].store(_moved(), ::std::memory_order_release);
+
+		_unlock(table, index);
+
+		if (head)
+			this->m_reclaim.Retire(head, this, &_reclaim_chain);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_reclaim_chain(VoidPtr pointer, VoidPtr context)
+	{
+		static_cast<SelfTypePtr>(context)->_release_chain(static_cast<Node*>(pointer));
+	}
+}
\ No newline at end of file
@@ -2,25 +2,6 @@
 
 namespace Forge
 {
-	template<typename InType>
-	static FORGE_FORCE_INLINE Void _shift_elements_forward(InType* data, Size to, Size steps, Size jumps = 0)
-	{
-		while(steps--) {
-			MoveObject(data + to, *(data + ((to + 1) + jumps)));
-
-			to++;
-		}
-	}
-	template<typename InType>
-	static FORGE_FORCE_INLINE Void _shift_elements_backward(InType* data, Size to, Size steps, Size jumps = 0)
-	{
-		while(steps--) {
-			MoveObject(data + (to + jumps), *(data + (to - 1)));
-
-			to--;
-		}
-	}
-
 	template<typename InElementType, typename InAllocationPolicy>
 	DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::DynamicArrayWithPolicy(AllocatorTypePtr allocator)
 		: BaseType(0, 0)
@@ -46,7 +27,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		ConstructArray(this->m_data, this->m_count);
 	}
@@ -63,7 +44,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		for (Size counter = 0; counter < this->m_count; counter++)
 			CopyObject((this->m_data + counter), value);
@@ -81,7 +62,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		CopyArray(this->m_data, buffer, this->m_count);
 	}
@@ -98,20 +79,20 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		CopyArray(this->m_data, list.begin(), this->m_count);
 	}
 
 	template<typename InElementType, typename InAllocationPolicy>
 	DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::DynamicArrayWithPolicy(SelfTypeRRef other)
-		: BaseType(other.m_count, other.m_capacity)
+		: BaseType(0, 0), m_memory_alignment(other.m_memory_alignment), m_capacity_alignment(other.m_capacity_alignment), m_data(nullptr)
 	{
 		*this = std::move(other);
 	}
 	template<typename InElementType, typename InAllocationPolicy>
 	DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::DynamicArrayWithPolicy(ConstSelfTypeLRef other)
-		: BaseType(other.m_count, other.m_capacity)
+		: BaseType(0, 0), m_memory_alignment(other.m_memory_alignment), m_capacity_alignment(other.m_capacity_alignment), m_data(nullptr)
 	{
 		*this = other;
 	}
@@ -121,25 +102,26 @@ namespace Forge
 	{
 		this->Clear();
 
-		this->m_allocator.Deallocate(this->m_data);
+		this->m_allocator->Deallocate(this->m_data);
 	}
 
 	template<typename InElementType, typename InAllocationPolicy>
 	typename DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::SelfTypeLRef DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
 	{
 		if (this == &other)
-			return;
+			return *this;
 
 		this->Clear();
+		this->Reserve(0);
 
 		this->m_count = other.m_count;
 		this->m_capacity = other.m_capacity;
 		this->m_allocator = other.m_allocator;
-		MoveArray(this->m_data, other.m_data, other.m_capacity);
+		this->m_data = other.m_data;
 
-		other.Clear();
-
-		MemoryZero(this, sizeof(DynamicArrayWithPolicy<InElementType, InAllocationPolicy>));
+		other.m_count = 0;
+		other.m_capacity = 0;
+		other.m_data = nullptr;
 
 		return *this;
 	}
@@ -147,14 +129,17 @@ namespace Forge
 	typename DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::SelfTypeLRef DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
 	{
 		if (this == &other)
-			return;
+			return *this;
 
 		this->Clear();
+		this->Reserve(0);
 
-		this->m_count = other.m_count;
-		this->m_capacity = other.m_capacity;
 		this->m_allocator = other.m_allocator;
-		CopyArray(this->m_data, other.m_data, other.m_capacity);
+		this->Reserve(other.m_count);
+
+		CopyArray(this->m_data, other.m_data, other.m_count);
+
+		this->m_count = other.m_count;
 
 		return *this;
 	}
@@ -251,9 +236,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::Resize(Size capacity)
 	{
-		if (this->m_capacity <= 0)
-			throw ::std::invalid_argument("The capacity must be greater than 0");
-
 		if (this->m_capacity >= capacity)
 			return;
 
@@ -267,15 +249,54 @@ namespace Forge
 		if (this->m_capacity == capacity)
 			return;
 
+		if (capacity < this->m_count) {
+			DestructArray(this->m_data + capacity, this->m_count - capacity);
+
+			this->m_count = capacity;
+		}
+
 		if (capacity <= 0) {
 			this->m_capacity = 0;
 			this->m_allocator->Deallocate(this->m_data);
+			this->m_data = nullptr;
 
 			return;
 		}
 
+		// Elements that cannot be relocated by copying their bytes are moved into a new block
+		// one by one, since reallocating could leave them pointing into the old block.
+		if constexpr (::std::is_trivially_copyable<ElementType>::value)
+		{
+			this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Reallocate(this->m_data, capacity * sizeof(ElementType), this->m_memory_alignment));
+		}
+		else
+		{
+			ElementTypePtr data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(capacity * sizeof(ElementType), this->m_memory_alignment));
+
+			MoveArray(data, this->m_data, this->m_count);
+			DestructArray(this->m_data, this->m_count);
+
+			this->m_allocator->Deallocate(this->m_data);
+			this->m_data = data;
+		}
+
+		this->m_capacity = capacity;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::Adopt(ElementTypePtr data, Size count, Size capacity)
+	{
+		if (count > capacity)
+			throw ::std::invalid_argument("The count must not exceed the capacity");
+
+		this->Clear();
+
+		if (this->m_data != data)
+			this->m_allocator->Deallocate(this->m_data);
+
+		this->m_data = data;
+		this->m_count = count;
 		this->m_capacity = capacity;
-		this->m_data = this->m_allocator->Reallocate(this->m_data, this->m_capacity, this->m_memory_alignment);
 	}
 
 	template<typename InElementType, typename InAllocationPolicy>
@@ -284,7 +305,7 @@ namespace Forge
 		if (this->IsEmpty())
 			throw ::std::length_error("The static array is empty");
 
-		this->m_count--;
+		DestructArray(this->m_data + --this->m_count, 1);
 	}
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::PopFront()
@@ -292,6 +313,8 @@ namespace Forge
 		if (this->IsEmpty())
 			throw ::std::length_error("The static array is empty");
 
+		DestructArray(this->m_data, 1);
+
 		_shift_elements_forward(this->m_data, 0, this->m_count - 1);
 
 		this->m_count--;
@@ -300,9 +323,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::PushBack(ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		MoveObject((this->m_data + this->m_count), element);
@@ -312,9 +332,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::PushFront(ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		if (!this->IsEmpty())
@@ -327,9 +344,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::PushBack(ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		CopyObject((this->m_data + this->m_count), element);
@@ -339,9 +353,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::PushFront(ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		if (!this->IsEmpty())
@@ -364,6 +375,8 @@ namespace Forge
 		Size shift_to = index;
 		Size shift_steps = this->m_count - index - 1;
 
+		DestructArray(this->m_data + index, 1);
+
 		_shift_elements_forward(this->m_data, shift_to, shift_steps);
 
 		this->m_count--;
@@ -383,10 +396,15 @@ namespace Forge
 		Size range_offset = iterator_first - this->GetBeginIterator();
 		Size range_difference = iterator_last - iterator_first;
 
+		if (range_difference == 0)
+			return;
+
 		Size shift_to = range_offset;
-		Size shift_steps = range_difference;
+		Size shift_steps = this->m_count - range_offset - range_difference;
 		Size shift_jumps = range_difference - 1;
 
+		DestructArray(this->m_data + range_offset, range_difference);
+
 		_shift_elements_forward(this->m_data, shift_to, shift_steps, shift_jumps);
 
 		this->m_count -= range_difference;
@@ -436,9 +454,6 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::Insert(Size index, ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		if (this->m_count <= index)
 			throw ::std::out_of_range("The index is out of range");
 
@@ -449,16 +464,13 @@ namespace Forge
 
 		_shift_elements_backward(this->m_data, shift_to, shift_steps);
 
-		MoveObject(this->m_data[index], element);
+		MoveObject(this->m_data + index, element);
 
 		this->m_count++;
 	}
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::Insert(Size index, ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		if (this->m_count <= index)
 			throw ::std::out_of_range("The index is out of range");
 
@@ -469,7 +481,7 @@ namespace Forge
 
 		_shift_elements_backward(this->m_data, shift_to, shift_steps);
 
-		CopyObject(this->m_data[index], element);
+		CopyObject(this->m_data + index, element);
 
 		this->m_count++;
 	}
@@ -534,11 +546,38 @@ namespace Forge
 	template<typename InElementType, typename InAllocationPolicy>
 	Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::Clear()
 	{
-		DestructArray(this->m_data, this->m_count);
+		// Skips the pass over trivially destructible elements, which may live in a mapped file.
+		if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+			DestructArray(this->m_data, this->m_count);
 
 		this->m_count = 0;
 	}
 
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::_shift_elements_forward(ElementTypePtr data, Size to, Size steps, Size jumps)
+	{
+		// Each element is moved into the vacant slot before it and its source destroyed, which
+		// leaves the last source slot vacant.
+		while(steps--) {
+			MoveObject(data + to, *(data + ((to + 1) + jumps)));
+			if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+				DestructArray(data + ((to + 1) + jumps), 1);
+
+			to++;
+		}
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void DynamicArrayWithPolicy<InElementType, InAllocationPolicy>::_shift_elements_backward(ElementTypePtr data, Size to, Size steps, Size jumps)
+	{
+		while(steps--) {
+			MoveObject(data + (to + jumps), *(data + (to - 1)));
+			if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+				DestructArray(data + (to - 1), 1);
+
+			to--;
+		}
+	}
+
 
 	template<typename InElementType>
 	DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::DynamicArrayWithPolicy(AllocatorTypePtr allocator)
@@ -565,7 +604,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		ConstructArray(this->m_data, this->m_count);
 	}
@@ -582,7 +621,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		for (Size counter = 0; counter < this->m_count; counter++)
 			CopyObject((this->m_data + counter), value);
@@ -600,7 +639,7 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		CopyArray(this->m_data, buffer, this->m_count);
 	}
@@ -617,20 +656,20 @@ namespace Forge
 		this->m_capacity_alignment = 16;
 
 		this->m_allocator = allocator;
-		this->m_data = this->m_allocator.Allocate(this->m_capcity, this->m_memory_alignment);
+		this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(this->m_capacity * sizeof(ElementType), this->m_memory_alignment));
 
 		CopyArray(this->m_data, list.begin(), this->m_count);
 	}
 
 	template<typename InElementType>
 	DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::DynamicArrayWithPolicy(SelfTypeRRef other)
-		: BaseType(other.m_count, other.m_capacity)
+		: BaseType(0, 0), m_memory_alignment(other.m_memory_alignment), m_capacity_alignment(other.m_capacity_alignment), m_data(nullptr)
 	{
 		*this = std::move(other);
 	}
 	template<typename InElementType>
 	DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::DynamicArrayWithPolicy(ConstSelfTypeLRef other)
-		: BaseType(other.m_count, other.m_capacity)
+		: BaseType(0, 0), m_memory_alignment(other.m_memory_alignment), m_capacity_alignment(other.m_capacity_alignment), m_data(nullptr)
 	{
 		*this = other;
 	}
@@ -640,25 +679,26 @@ namespace Forge
 	{
 		this->Clear();
 
-		this->m_allocator.Deallocate(this->m_data);
+		this->m_allocator->Deallocate(this->m_data);
 	}
 
 	template<typename InElementType>
 	typename DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::SelfTypeLRef DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::operator=(SelfTypeRRef other)
 	{
 		if (this == &other)
-			return;
+			return *this;
 
 		this->Clear();
+		this->Reserve(0);
 
 		this->m_count = other.m_count;
 		this->m_capacity = other.m_capacity;
 		this->m_allocator = other.m_allocator;
-		MoveArray(this->m_data, other.m_data, other.m_capacity);
+		this->m_data = other.m_data;
 
-		other.Clear();
-
-		MemoryZero(this, sizeof(DynamicArrayWithPolicy<InElementType, InAllocationPolicy>));
+		other.m_count = 0;
+		other.m_capacity = 0;
+		other.m_data = nullptr;
 
 		return *this;
 	}
@@ -666,14 +706,17 @@ namespace Forge
 	typename DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::SelfTypeLRef DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::operator=(ConstSelfTypeLRef other)
 	{
 		if (this == &other)
-			return;
+			return *this;
 
 		this->Clear();
+		this->Reserve(0);
 
-		this->m_count = other.m_count;
-		this->m_capacity = other.m_capacity;
 		this->m_allocator = other.m_allocator;
-		CopyArray(this->m_data, other.m_data, other.m_capacity);
+		this->Reserve(other.m_count);
+
+		CopyArray(this->m_data, other.m_data, other.m_count);
+
+		this->m_count = other.m_count;
 
 		return *this;
 	}
@@ -770,9 +813,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::Resize(Size capacity)
 	{
-		if (this->m_capacity <= 0)
-			throw ::std::invalid_argument("The capacity must be greater than 0");
-
 		if (this->m_capacity >= capacity)
 			return;
 
@@ -786,15 +826,54 @@ namespace Forge
 		if (this->m_capacity == capacity)
 			return;
 
+		if (capacity < this->m_count) {
+			DestructArray(this->m_data + capacity, this->m_count - capacity);
+
+			this->m_count = capacity;
+		}
+
 		if (capacity <= 0) {
 			this->m_capacity = 0;
 			this->m_allocator->Deallocate(this->m_data);
+			this->m_data = nullptr;
 
 			return;
 		}
 
+		// Elements that cannot be relocated by copying their bytes are moved into a new block
+		// one by one, since reallocating could leave them pointing into the old block.
+		if constexpr (::std::is_trivially_copyable<ElementType>::value)
+		{
+			this->m_data = static_cast<ElementTypePtr>(this->m_allocator->Reallocate(this->m_data, capacity * sizeof(ElementType), this->m_memory_alignment));
+		}
+		else
+		{
+			ElementTypePtr data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(capacity * sizeof(ElementType), this->m_memory_alignment));
+
+			MoveArray(data, this->m_data, this->m_count);
+			DestructArray(this->m_data, this->m_count);
+
+			this->m_allocator->Deallocate(this->m_data);
+			this->m_data = data;
+		}
+
+		this->m_capacity = capacity;
+	}
+
+	template<typename InElementType>
+	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::Adopt(ElementTypePtr data, Size count, Size capacity)
+	{
+		if (count > capacity)
+			throw ::std::invalid_argument("The count must not exceed the capacity");
+
+		this->Clear();
+
+		if (this->m_data != data)
+			this->m_allocator->Deallocate(this->m_data);
+
+		this->m_data = data;
+		this->m_count = count;
 		this->m_capacity = capacity;
-		this->m_data = this->m_allocator->Reallocate(this->m_data, this->m_capacity, this->m_memory_alignment);
 	}
 
 	template<typename InElementType>
@@ -803,7 +882,7 @@ namespace Forge
 		if (this->IsEmpty())
 			throw ::std::length_error("The static array is empty");
 
-		this->m_count--;
+		DestructArray(this->m_data + --this->m_count, 1);
 	}
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::PopFront()
@@ -811,6 +890,8 @@ namespace Forge
 		if (this->IsEmpty())
 			throw ::std::length_error("The static array is empty");
 
+		DestructArray(this->m_data, 1);
+
 		_shift_elements_forward(this->m_data, 0, this->m_count - 1);
 
 		this->m_count--;
@@ -819,9 +900,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::PushBack(ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		MoveObject((this->m_data + this->m_count), element);
@@ -831,9 +909,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::PushFront(ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		if (!this->IsEmpty())
@@ -846,9 +921,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::PushBack(ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		CopyObject((this->m_data + this->m_count), element);
@@ -858,9 +930,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::PushFront(ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		this->Resize(this->m_count + 1);
 
 		if (!this->IsEmpty())
@@ -883,6 +952,8 @@ namespace Forge
 		Size shift_to = index;
 		Size shift_steps = this->m_count - index - 1;
 
+		DestructArray(this->m_data + index, 1);
+
 		_shift_elements_forward(this->m_data, shift_to, shift_steps);
 
 		this->m_count--;
@@ -902,10 +973,15 @@ namespace Forge
 		Size range_offset = iterator_first - this->GetBeginIterator();
 		Size range_difference = iterator_last - iterator_first;
 
+		if (range_difference == 0)
+			return;
+
 		Size shift_to = range_offset;
-		Size shift_steps = range_difference;
+		Size shift_steps = this->m_count - range_offset - range_difference;
 		Size shift_jumps = range_difference - 1;
 
+		DestructArray(this->m_data + range_offset, range_difference);
+
 		_shift_elements_forward(this->m_data, shift_to, shift_steps, shift_jumps);
 
 		this->m_count -= range_difference;
@@ -955,9 +1031,6 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::Insert(Size index, ElementTypeRRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		if (this->m_count <= index)
 			throw ::std::out_of_range("The index is out of range");
 
@@ -968,16 +1041,13 @@ namespace Forge
 
 		_shift_elements_backward(this->m_data, shift_to, shift_steps);
 
-		MoveObject(this->m_data[index], element);
+		MoveObject(this->m_data + index, element);
 
 		this->m_count++;
 	}
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::Insert(Size index, ConstElementTypeLRef element)
 	{
-		if (this->IsFull())
-			throw ::std::length_error("The static array is full");
-
 		if (this->m_count <= index)
 			throw ::std::out_of_range("The index is out of range");
 
@@ -988,7 +1058,7 @@ namespace Forge
 
 		_shift_elements_backward(this->m_data, shift_to, shift_steps);
 
-		CopyObject(this->m_data[index], element);
+		CopyObject(this->m_data + index, element);
 
 		this->m_count++;
 	}
@@ -1053,8 +1123,35 @@ namespace Forge
 	template<typename InElementType>
 	Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::Clear()
 	{
-		DestructArray(this->m_data, this->m_count);
+		// Skips the pass over trivially destructible elements, which may live in a mapped file.
+		if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+			DestructArray(this->m_data, this->m_count);
 
 		this->m_count = 0;
 	}
+
+	template<typename InElementType>
+	FORGE_FORCE_INLINE Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::_shift_elements_forward(ElementTypePtr data, Size to, Size steps, Size jumps)
+	{
+		// Each element is moved into the vacant slot before it and its source destroyed, which
+		// leaves the last source slot vacant.
+		while(steps--) {
+			MoveObject(data + to, *(data + ((to + 1) + jumps)));
+			if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+				DestructArray(data + ((to + 1) + jumps), 1);
+
+			to++;
+		}
+	}
+	template<typename InElementType>
+	FORGE_FORCE_INLINE Void DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy>::_shift_elements_backward(ElementTypePtr data, Size to, Size steps, Size jumps)
+	{
+		while(steps--) {
+			MoveObject(data + (to + jumps), *(data + (to - 1)));
+			if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+				DestructArray(data + (to - 1), 1);
+
+			to--;
+		}
+	}
 }
\ No newline at end of file
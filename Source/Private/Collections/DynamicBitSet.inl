@@ -0,0 +1,327 @@
+#include "Collections/DynamicBitSet.hpp"
+
+namespace Forge
+{
+	template<typename InAllocationPolicy>
+	DynamicBitSet<InAllocationPolicy>::DynamicBitSet(AllocatorTypePtr allocator)
+		: m_bit_count(0), m_words(allocator) {}
+	template<typename InAllocationPolicy>
+	DynamicBitSet<InAllocationPolicy>::DynamicBitSet(Size bit_count, AllocatorTypePtr allocator)
+		: m_bit_count(0), m_words(allocator)
+	{
+		this->Resize(bit_count);
+	}
+
+	template<typename InAllocationPolicy>
+	DynamicBitSet<InAllocationPolicy>::DynamicBitSet(SelfTypeRRef other)
+		: m_bit_count(other.m_bit_count), m_words(::std::move(other.m_words))
+	{
+		other.m_bit_count = 0;
+	}
+	template<typename InAllocationPolicy>
+	DynamicBitSet<InAllocationPolicy>::DynamicBitSet(ConstSelfTypeLRef other)
+		: m_bit_count(other.m_bit_count), m_words(other.m_words) {}
+
+	template<typename InAllocationPolicy>
+	typename DynamicBitSet<InAllocationPolicy>::SelfTypeLRef DynamicBitSet<InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_words = ::std::move(other.m_words);
+			this->m_bit_count = other.m_bit_count;
+
+			other.m_bit_count = 0;
+		}
+
+		return *this;
+	}
+	template<typename InAllocationPolicy>
+	typename DynamicBitSet<InAllocationPolicy>::SelfTypeLRef DynamicBitSet<InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_words = other.m_words;
+			this->m_bit_count = other.m_bit_count;
+		}
+
+		return *this;
+	}
+
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::operator==(ConstSelfTypeLRef other) const
+	{
+		if (this->m_bit_count != other.m_bit_count)
+			return false;
+
+		for (Size counter = 0; counter < this->m_words.GetCount(); counter++)
+			if (this->m_words[counter] != other.m_words[counter])
+				return false;
+
+		return true;
+	}
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::operator!=(ConstSelfTypeLRef other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool DynamicBitSet<InAllocationPolicy>::operator[](Size index) const
+	{
+		return (this->m_words[index >> 6] >> (index & 63)) & 1;
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool DynamicBitSet<InAllocationPolicy>::IsEmpty() const
+	{
+		return this->m_bit_count == 0;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size DynamicBitSet<InAllocationPolicy>::GetBitCount() const
+	{
+		return this->m_bit_count;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size DynamicBitSet<InAllocationPolicy>::GetWordCount() const
+	{
+		return this->m_words.GetCount();
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE const typename DynamicBitSet<InAllocationPolicy>::WordType* DynamicBitSet<InAllocationPolicy>::GetRawData() const
+	{
+		return this->m_words.GetRawData();
+	}
+
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::Test(Size index) const
+	{
+		if (index >= this->m_bit_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::Any() const
+	{
+		for (Size counter = 0; counter < this->m_words.GetCount(); counter++)
+			if (this->m_words[counter] != 0)
+				return true;
+
+		return false;
+	}
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::All() const
+	{
+		Size word_count = this->m_words.GetCount();
+
+		if (word_count == 0)
+			return true;
+
+		for (Size counter = 0; counter + 1 < word_count; counter++)
+			if (this->m_words[counter] != ~WordType(0))
+				return false;
+
+		return this->m_words[word_count - 1] == this->_last_word_mask();
+	}
+	template<typename InAllocationPolicy>
+	Bool DynamicBitSet<InAllocationPolicy>::None() const
+	{
+		return !this->Any();
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size DynamicBitSet<InAllocationPolicy>::PopCount() const
+	{
+		return Forge::PopCount(this->m_words.GetRawData(), this->m_words.GetCount());
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size DynamicBitSet<InAllocationPolicy>::FindFirstSet() const
+	{
+		Size first = Forge::FindNextSet(this->m_words.GetRawData(), this->m_words.GetCount(), 0);
+
+		return first < this->m_bit_count ? first : this->m_bit_count;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size DynamicBitSet<InAllocationPolicy>::FindNextSet(Size index) const
+	{
+		if (index + 1 >= this->m_bit_count)
+			return this->m_bit_count;
+
+		Size next = Forge::FindNextSet(this->m_words.GetRawData(), this->m_words.GetCount(), index + 1);
+
+		return next < this->m_bit_count ? next : this->m_bit_count;
+	}
+
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Reserve(Size bit_count)
+	{
+		this->m_words.Reserve((bit_count + 63) >> 6);
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Resize(Size bit_count, Bool value)
+	{
+		Size word_count = (bit_count + 63) >> 6;
+
+		if (bit_count > this->m_bit_count)
+		{
+			// Bits past the old count are already clear, so only setting needs work.
+			if (value && this->m_words.GetCount() > 0)
+				this->m_words[this->m_words.GetCount() - 1] |= ~this->_last_word_mask();
+
+			this->m_words.Resize(word_count);
+
+			while (this->m_words.GetCount() < word_count)
+				this->m_words.PushBack(value ? ~WordType(0) : 0);
+		}
+		else
+		{
+			while (this->m_words.GetCount() > word_count)
+				this->m_words.PopBack();
+		}
+
+		this->m_bit_count = bit_count;
+
+		if (word_count > 0)
+			this->m_words[word_count - 1] &= this->_last_word_mask();
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::PushBack(Bool value)
+	{
+		Size index = this->m_bit_count++;
+
+		if ((index & 63) == 0)
+		{
+			this->m_words.Resize(this->m_words.GetCount() + 1);
+			this->m_words.PushBack(0);
+		}
+
+		if (value)
+			this->m_words[index >> 6] |= WordType(1) << (index & 63);
+	}
+
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Set(Size index)
+	{
+		if (index >= this->m_bit_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] |= WordType(1) << (index & 63);
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Reset(Size index)
+	{
+		if (index >= this->m_bit_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] &= ~(WordType(1) << (index & 63));
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Flip(Size index)
+	{
+		if (index >= this->m_bit_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] ^= WordType(1) << (index & 63);
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Assign(Size index, Bool value)
+	{
+		if (value)
+			this->Set(index);
+		else
+			this->Reset(index);
+	}
+
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::SetAll()
+	{
+		Size word_count = this->m_words.GetCount();
+
+		if (word_count == 0)
+			return;
+
+		MemorySet(this->_words(), 0xFF, word_count * sizeof(WordType));
+
+		this->m_words[word_count - 1] = this->_last_word_mask();
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::ResetAll()
+	{
+		Size word_count = this->m_words.GetCount();
+
+		if (word_count == 0)
+			return;
+
+		MemorySet(this->_words(), 0, word_count * sizeof(WordType));
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::FlipAll()
+	{
+		Size word_count = this->m_words.GetCount();
+
+		if (word_count == 0)
+			return;
+
+		for (Size counter = 0; counter < word_count; counter++)
+			this->m_words[counter] = ~this->m_words[counter];
+
+		this->m_words[word_count - 1] &= this->_last_word_mask();
+	}
+
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::And(ConstSelfTypeLRef other)
+	{
+		this->_check_same_size(other);
+
+		BitwiseAnd(this->_words(), other.m_words.GetRawData(), this->m_words.GetCount());
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Or(ConstSelfTypeLRef other)
+	{
+		this->_check_same_size(other);
+
+		BitwiseOr(this->_words(), other.m_words.GetRawData(), this->m_words.GetCount());
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Xor(ConstSelfTypeLRef other)
+	{
+		this->_check_same_size(other);
+
+		BitwiseXor(this->_words(), other.m_words.GetRawData(), this->m_words.GetCount());
+	}
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::AndNot(ConstSelfTypeLRef other)
+	{
+		this->_check_same_size(other);
+
+		BitwiseAndNot(this->_words(), other.m_words.GetRawData(), this->m_words.GetCount());
+	}
+
+	template<typename InAllocationPolicy>
+	Void DynamicBitSet<InAllocationPolicy>::Clear()
+	{
+		this->m_words.Clear();
+
+		this->m_bit_count = 0;
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename DynamicBitSet<InAllocationPolicy>::WordType* DynamicBitSet<InAllocationPolicy>::_words()
+	{
+		return this->m_words.GetCount() > 0 ? &this->m_words[0] : nullptr;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename DynamicBitSet<InAllocationPolicy>::WordType DynamicBitSet<InAllocationPolicy>::_last_word_mask() const
+	{
+		Size tail = this->m_bit_count & 63;
+
+		return tail == 0 ? ~WordType(0) : (WordType(1) << tail) - 1;
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void DynamicBitSet<InAllocationPolicy>::_check_same_size(ConstSelfTypeLRef other) const
+	{
+		if (this->m_bit_count != other.m_bit_count)
+			throw ::std::invalid_argument("The bit sets must have the same bit count");
+	}
+}
\ No newline at end of file
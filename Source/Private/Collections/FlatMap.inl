@@ -0,0 +1,293 @@
+#include "Collections/FlatMap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FlatMap<InKeyType, InValueType, InAllocationPolicy>::FlatMap(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_keys(allocator), m_values(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FlatMap<InKeyType, InValueType, InAllocationPolicy>::FlatMap(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_keys(::std::move(other.m_keys)), m_values(::std::move(other.m_values))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FlatMap<InKeyType, InValueType, InAllocationPolicy>::FlatMap(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity), m_keys(other.m_keys), m_values(other.m_values)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = ::std::move(other.m_keys);
+			this->m_values = ::std::move(other.m_values);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = other.m_keys;
+			this->m_values = other.m_values;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::GetBeginIterator()
+	{
+		return this->m_values.GetBeginIterator();
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::GetFinalIterator()
+	{
+		return this->m_values.GetFinalIterator();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool FlatMap<InKeyType, InValueType, InAllocationPolicy>::Contains(ConstKeyTypeLRef key) const
+	{
+		Size index = this->LowerBound(key);
+
+		return index < this->m_count && !(key < this->m_keys[index]);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size FlatMap<InKeyType, InValueType, InAllocationPolicy>::LowerBound(ConstKeyTypeLRef key) const
+	{
+		return BranchlessLowerBound(this->m_keys.GetRawData(), this->m_count, key);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::Get(ConstKeyTypeLRef key)
+	{
+		ValueTypePtr value = this->TryGet(key);
+
+		if (!value)
+			throw ::std::out_of_range("The key is not contained in the flat map");
+
+		return *value;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypeLRef FlatMap<InKeyType, InValueType, InAllocationPolicy>::Get(ConstKeyTypeLRef key) const
+	{
+		ConstValueTypePtr value = this->TryGet(key);
+
+		if (!value)
+			throw ::std::out_of_range("The key is not contained in the flat map");
+
+		return *value;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypePtr FlatMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(ConstKeyTypeLRef key)
+	{
+		Size index = this->LowerBound(key);
+
+		return index < this->m_count && !(key < this->m_keys[index]) ? &this->m_values[index] : nullptr;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypePtr FlatMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(ConstKeyTypeLRef key) const
+	{
+		Size index = this->LowerBound(key);
+
+		return index < this->m_count && !(key < this->m_keys[index]) ? &this->m_values[index] : nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ConstKeyTypePtr FlatMap<InKeyType, InValueType, InAllocationPolicy>::GetKeys() const
+	{
+		return this->m_keys.GetRawData();
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypePtr FlatMap<InKeyType, InValueType, InAllocationPolicy>::GetValues() const
+	{
+		return this->m_values.GetRawData();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void FlatMap<InKeyType, InValueType, InAllocationPolicy>::Reserve(Size capacity)
+	{
+		this->m_keys.Resize(capacity);
+		this->m_values.Resize(capacity);
+
+		this->m_capacity = this->m_keys.GetCapacity();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool FlatMap<InKeyType, InValueType, InAllocationPolicy>::Insert(ConstKeyTypeLRef key, ValueTypeRRef value)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index < this->m_count && !(key < this->m_keys[index]))
+			return false;
+
+		if (index == this->m_count)
+		{
+			this->m_keys.PushBack(key);
+			this->m_values.PushBack(::std::move(value));
+		}
+		else
+		{
+			this->m_keys.Insert(index, key);
+			this->m_values.Insert(index, ::std::move(value));
+		}
+
+		this->m_count++;
+		this->m_capacity = this->m_keys.GetCapacity();
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool FlatMap<InKeyType, InValueType, InAllocationPolicy>::Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index < this->m_count && !(key < this->m_keys[index]))
+			return false;
+
+		if (index == this->m_count)
+		{
+			this->m_keys.PushBack(key);
+			this->m_values.PushBack(value);
+		}
+		else
+		{
+			this->m_keys.Insert(index, key);
+			this->m_values.Insert(index, value);
+		}
+
+		this->m_count++;
+		this->m_capacity = this->m_keys.GetCapacity();
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void FlatMap<InKeyType, InValueType, InAllocationPolicy>::InsertAll(ConstKeyTypePtr keys, ConstValueTypePtr values, Size count)
+	{
+		Size head_count = this->m_count;
+
+		this->m_keys.Resize(head_count + count);
+		this->m_values.Resize(head_count + count);
+
+		for (Size counter = 0; counter < count; counter++)
+		{
+			this->m_keys.PushBack(keys[counter]);
+			this->m_values.PushBack(values[counter]);
+		}
+
+		this->_merge_tail(head_count);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void FlatMap<InKeyType, InValueType, InAllocationPolicy>::InsertAll(ConstSelfTypeLRef other)
+	{
+		if (this == &other)
+			return;
+
+		this->InsertAll(other.m_keys.GetRawData(), other.m_values.GetRawData(), other.m_count);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool FlatMap<InKeyType, InValueType, InAllocationPolicy>::Remove(ConstKeyTypeLRef key)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index == this->m_count || key < this->m_keys[index])
+			return false;
+
+		this->m_keys.Remove(index);
+		this->m_values.Remove(index);
+
+		this->m_count--;
+
+		return true;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void FlatMap<InKeyType, InValueType, InAllocationPolicy>::Clear()
+	{
+		this->m_keys.Clear();
+		this->m_values.Clear();
+
+		this->m_count = 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void FlatMap<InKeyType, InValueType, InAllocationPolicy>::_merge_tail(Size head_count)
+	{
+		Size total_count = this->m_keys.GetCount();
+
+		if (total_count == head_count)
+			return;
+
+		// The appended entries are sorted through a permutation, so each value is only moved
+		// once, straight into its merged position.
+		DynamicArrayWithPolicy<U32, InAllocationPolicy> order(this->m_allocator);
+
+		order.Resize(total_count - head_count);
+
+		for (Size counter = head_count; counter < total_count; counter++)
+			order.PushBack(static_cast<U32>(counter));
+
+		ConstKeyTypePtr keys = this->m_keys.GetRawData();
+
+		::std::stable_sort(&order[0], &order[0] + order.GetCount(), [keys](U32 first, U32 second) { return keys[first] < keys[second]; });
+
+		DynamicArrayWithPolicy<KeyType, InAllocationPolicy> merged_keys(this->m_allocator);
+		DynamicArrayWithPolicy<ValueType, InAllocationPolicy> merged_values(this->m_allocator);
+
+		merged_keys.Resize(total_count);
+		merged_values.Resize(total_count);
+
+		Size first = 0;
+		Size second = 0;
+
+		// Existing entries win ties, and of several equal appended keys the first one wins,
+		// since the sort is stable and an entry equal to the last merged key is dropped.
+		while (first < head_count || second < order.GetCount())
+		{
+			Size index;
+
+			if (second == order.GetCount() || (first < head_count && !(keys[order[second]] < keys[first])))
+				index = first++;
+			else
+				index = order[second++];
+
+			if (merged_keys.GetCount() > 0 && !(merged_keys.GetBack() < keys[index]))
+				continue;
+
+			merged_keys.PushBack(::std::move(this->m_keys[index]));
+			merged_values.PushBack(::std::move(this->m_values[index]));
+		}
+
+		this->m_keys = ::std::move(merged_keys);
+		this->m_values = ::std::move(merged_values);
+
+		this->m_count = this->m_keys.GetCount();
+		this->m_capacity = this->m_keys.GetCapacity();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "Collections/FlatSet.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	FlatSet<InElementType, InAllocationPolicy>::FlatSet(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_keys(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FlatSet<InElementType, InAllocationPolicy>::FlatSet(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_keys(allocator)
+	{
+		this->m_allocator = allocator;
+
+		this->InsertAll(init_list.begin(), init_list.size());
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FlatSet<InElementType, InAllocationPolicy>::FlatSet(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_keys(::std::move(other.m_keys))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FlatSet<InElementType, InAllocationPolicy>::FlatSet(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity), m_keys(other.m_keys)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename FlatSet<InElementType, InAllocationPolicy>::SelfTypeLRef FlatSet<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = ::std::move(other.m_keys);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename FlatSet<InElementType, InAllocationPolicy>::SelfTypeLRef FlatSet<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = other.m_keys;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatSet<InElementType, InAllocationPolicy>::ConstElementTypeLRef FlatSet<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return this->m_keys[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef FlatSet<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		return this->m_keys.GetBeginIterator();
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef FlatSet<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		return this->m_keys.GetFinalIterator();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename FlatSet<InElementType, InAllocationPolicy>::ConstElementTypePtr FlatSet<InElementType, InAllocationPolicy>::GetRawData() const
+	{
+		return this->m_keys.GetRawData();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool FlatSet<InElementType, InAllocationPolicy>::Contains(ConstElementTypeLRef key) const
+	{
+		Size index = this->LowerBound(key);
+
+		return index < this->m_count && !(key < this->m_keys[index]);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size FlatSet<InElementType, InAllocationPolicy>::LowerBound(ConstElementTypeLRef key) const
+	{
+		return BranchlessLowerBound(this->m_keys.GetRawData(), this->m_count, key);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void FlatSet<InElementType, InAllocationPolicy>::Reserve(Size capacity)
+	{
+		this->m_keys.Resize(capacity);
+
+		this->m_capacity = this->m_keys.GetCapacity();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool FlatSet<InElementType, InAllocationPolicy>::Insert(ElementTypeRRef key)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index < this->m_count && !(key < this->m_keys[index]))
+			return false;
+
+		if (index == this->m_count)
+			this->m_keys.PushBack(::std::move(key));
+		else
+			this->m_keys.Insert(index, ::std::move(key));
+
+		this->m_count++;
+		this->m_capacity = this->m_keys.GetCapacity();
+
+		return true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool FlatSet<InElementType, InAllocationPolicy>::Insert(ConstElementTypeLRef key)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index < this->m_count && !(key < this->m_keys[index]))
+			return false;
+
+		if (index == this->m_count)
+			this->m_keys.PushBack(key);
+		else
+			this->m_keys.Insert(index, key);
+
+		this->m_count++;
+		this->m_capacity = this->m_keys.GetCapacity();
+
+		return true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void FlatSet<InElementType, InAllocationPolicy>::InsertAll(ConstElementTypePtr keys, Size count)
+	{
+		Size head_count = this->m_count;
+
+		this->m_keys.Resize(head_count + count);
+
+		for (Size counter = 0; counter < count; counter++)
+			this->m_keys.PushBack(keys[counter]);
+
+		this->_merge_tail(head_count);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void FlatSet<InElementType, InAllocationPolicy>::InsertAll(ConstSelfTypeLRef other)
+	{
+		if (this == &other)
+			return;
+
+		this->InsertAll(other.m_keys.GetRawData(), other.m_count);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool FlatSet<InElementType, InAllocationPolicy>::Remove(ConstElementTypeLRef key)
+	{
+		Size index = this->LowerBound(key);
+
+		if (index == this->m_count || key < this->m_keys[index])
+			return false;
+
+		this->m_keys.Remove(index);
+
+		this->m_count--;
+
+		return true;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void FlatSet<InElementType, InAllocationPolicy>::Clear()
+	{
+		this->m_keys.Clear();
+
+		this->m_count = 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void FlatSet<InElementType, InAllocationPolicy>::_merge_tail(Size head_count)
+	{
+		Size total_count = this->m_keys.GetCount();
+
+		if (total_count == head_count)
+			return;
+
+		ElementTypePtr keys = &this->m_keys[0];
+
+		::std::sort(keys + head_count, keys + total_count);
+
+		// The merge is stable, so an existing key stays ahead of an equal appended key and
+		// survives the final pass that drops duplicates. A tail that sorts entirely after the
+		// head needs no merge at all.
+		Size tail_count = ::std::unique(keys + head_count, keys + total_count, [](ConstElementTypeLRef first, ConstElementTypeLRef second) { return !(first < second) && !(second < first); }) - (keys + head_count);
+
+		if (head_count > 0 && keys[head_count - 1] < keys[head_count])
+		{
+			while (this->m_keys.GetCount() > head_count + tail_count)
+				this->m_keys.PopBack();
+		}
+		else
+		{
+			::std::inplace_merge(keys, keys + head_count, keys + head_count + tail_count);
+
+			Size unique_count = ::std::unique(keys, keys + head_count + tail_count, [](ConstElementTypeLRef first, ConstElementTypeLRef second) { return !(first < second) && !(second < first); }) - keys;
+
+			while (this->m_keys.GetCount() > unique_count)
+				this->m_keys.PopBack();
+		}
+
+		this->m_count = this->m_keys.GetCount();
+		this->m_capacity = this->m_keys.GetCapacity();
+	}
+}
\ No newline at end of file
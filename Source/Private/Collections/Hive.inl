@@ -0,0 +1,439 @@
+#include "Collections/Hive.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	Hive<InElementType, InAllocationPolicy>::Hive(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_head(nullptr), m_tail(nullptr), m_free_blocks(nullptr), m_block_count(0)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Hive<InElementType, InAllocationPolicy>::Hive(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: Hive(allocator)
+	{
+		for (ConstElementTypeLRef element : init_list)
+			this->Insert(element);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Hive<InElementType, InAllocationPolicy>::Hive(SelfTypeRRef other)
+		: Hive(other.m_allocator)
+	{
+		*this = ::std::move(other);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Hive<InElementType, InAllocationPolicy>::Hive(ConstSelfTypeLRef other)
+		: Hive(other.m_allocator)
+	{
+		*this = other;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Hive<InElementType, InAllocationPolicy>::~Hive()
+	{
+		this->Clear();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Hive<InElementType, InAllocationPolicy>::SelfTypeLRef Hive<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_head = other.m_head;
+			this->m_tail = other.m_tail;
+			this->m_free_blocks = other.m_free_blocks;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_block_count = other.m_block_count;
+
+			other.m_head = nullptr;
+			other.m_tail = nullptr;
+			other.m_free_blocks = nullptr;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+			other.m_block_count = 0;
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Hive<InElementType, InAllocationPolicy>::SelfTypeLRef Hive<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_allocator = other.m_allocator;
+
+			for (Block* block = other.m_head; block; block = block->next)
+				for (Size index = block->skip[0]; index < block->high_water; index++, index += block->skip[index])
+					this->Insert(block->data[index]);
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef Hive<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		static Iterator it;
+
+		// Empty blocks are released immediately, so the first block always holds an element.
+		it = this->m_head ? Iterator(this, this->m_head, this->m_head->skip[0]) : Iterator(this, nullptr, 0);
+		return it;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef Hive<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, nullptr, 0);
+		return it;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size Hive<InElementType, InAllocationPolicy>::GetBlockCount() const
+	{
+		return this->m_block_count;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Hive<InElementType, InAllocationPolicy>::ElementTypeLRef Hive<InElementType, InAllocationPolicy>::Insert(ElementTypeRRef element)
+	{
+		ElementTypePtr slot = this->_acquire_slot();
+
+		MoveObject(slot, element);
+
+		return *slot;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Hive<InElementType, InAllocationPolicy>::ElementTypeLRef Hive<InElementType, InAllocationPolicy>::Insert(ConstElementTypeLRef element)
+	{
+		ElementTypePtr slot = this->_acquire_slot();
+
+		CopyObject(slot, element);
+
+		return *slot;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::Remove(Iterator& iterator)
+	{
+		if (!iterator.m_block)
+			throw ::std::out_of_range("The iterator is out of range");
+
+		Block* block = iterator.m_block;
+		Size index = iterator.m_index;
+
+		// Advance before erasing, since erasing may release the block.
+		++iterator;
+
+		this->_erase_slot(block, index);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::Remove(ConstElementTypePtr element)
+	{
+		for (Block* block = this->m_head; block; block = block->next)
+		{
+			if (element < block->data || element >= block->data + block->high_water)
+				continue;
+
+			Size index = static_cast<Size>(element - block->data);
+
+			if (block->skip[index] != 0)
+				break;
+
+			this->_erase_slot(block, index);
+
+			return;
+		}
+
+		throw ::std::invalid_argument("The element is not contained in the hive");
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::Clear()
+	{
+		while (this->m_head)
+		{
+			Block* block = this->m_head;
+
+			for (Size index = block->skip[0]; index < block->high_water; index++, index += block->skip[index])
+				DestructArray(block->data + index, 1);
+
+			this->_release_block(block);
+		}
+
+		this->m_count = 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_advance(Block*& block, Size& index)
+	{
+		index++;
+		index += block->skip[index];
+
+		if (index < block->high_water)
+			return;
+
+		block = block->next;
+		index = block ? block->skip[0] : 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_retreat(Block*& block, Size& index)
+	{
+		while (block)
+		{
+			if (index > 0)
+			{
+				index--;
+
+				// The last slot of an erased run stores the length of the run.
+				Size skip = block->skip[index];
+
+				if (skip <= index)
+				{
+					index -= skip;
+					return;
+				}
+			}
+
+			block = block->prev;
+			index = block ? block->high_water : 0;
+		}
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Hive<InElementType, InAllocationPolicy>::ElementTypePtr Hive<InElementType, InAllocationPolicy>::_acquire_slot()
+	{
+		Block* block = this->m_free_blocks;
+		Size index;
+
+		if (block)
+		{
+			index = block->free_head;
+
+			Size length = block->skip[index];
+
+			if (length > 1)
+			{
+				block->skip[index + 1] = static_cast<SkipType>(length - 1);
+				block->skip[index + length - 1] = static_cast<SkipType>(length - 1);
+
+				_replace_run(block, index, index + 1);
+			}
+			else
+			{
+				_unlink_run(block, index);
+
+				if (block->free_head == NO_RUN)
+					this->_unlink_free_block(block);
+			}
+
+			block->skip[index] = 0;
+		}
+		else
+		{
+			if (!this->m_tail || this->m_tail->high_water == this->m_tail->capacity)
+				this->_append_block();
+
+			block = this->m_tail;
+			index = block->high_water++;
+		}
+
+		block->size++;
+
+		this->m_count++;
+
+		return block->data + index;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::_erase_slot(Block* block, Size index)
+	{
+		DestructArray(block->data + index, 1);
+
+		this->m_count--;
+
+		if (--block->size == 0)
+		{
+			this->_release_block(block);
+			return;
+		}
+
+		// The neighbours of an occupied slot are either occupied or the boundary of a run, so
+		// their skip values are either 0 or the length of that run.
+		Size left = index > 0 ? block->skip[index - 1] : 0;
+		Size right = block->skip[index + 1];
+
+		if (left == 0 && right == 0)
+		{
+			block->skip[index] = 1;
+
+			if (block->free_head == NO_RUN)
+				this->_link_free_block(block);
+
+			_push_run(block, index);
+		}
+		else if (right == 0)
+		{
+			block->skip[index - left] = static_cast<SkipType>(left + 1);
+			block->skip[index] = static_cast<SkipType>(left + 1);
+		}
+		else if (left == 0)
+		{
+			block->skip[index] = static_cast<SkipType>(right + 1);
+			block->skip[index + right] = static_cast<SkipType>(right + 1);
+
+			_replace_run(block, index + 1, index);
+		}
+		else
+		{
+			block->skip[index - left] = static_cast<SkipType>(left + right + 1);
+			block->skip[index + right] = static_cast<SkipType>(left + right + 1);
+
+			// Only the boundaries are read while iterating, but a non-zero value lets Remove tell
+			// this interior slot apart from an element.
+			block->skip[index] = static_cast<SkipType>(left + right + 1);
+
+			_unlink_run(block, index + 1);
+		}
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::_append_block()
+	{
+		Size capacity = this->m_tail ? this->m_tail->capacity * 2 : MINIMUM_BLOCK_CAPACITY;
+
+		if (capacity > MAXIMUM_BLOCK_CAPACITY)
+			capacity = MAXIMUM_BLOCK_CAPACITY;
+
+		Block* block = static_cast<Block*>(this->m_allocator->Allocate(sizeof(Block), alignof(Block)));
+
+		block->data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(capacity * sizeof(ElementType), alignof(ElementType)));
+
+		// The skip field has a trailing sentinel slot, followed by the previous and next links of
+		// the run free list.
+		block->skip = static_cast<SkipType*>(this->m_allocator->Allocate((capacity * 3 + 1) * sizeof(SkipType), alignof(SkipType)));
+		block->links = block->skip + capacity + 1;
+
+		MemorySet(block->skip, 0, (capacity + 1) * sizeof(SkipType));
+
+		block->capacity = capacity;
+		block->size = 0;
+		block->high_water = 0;
+		block->free_head = NO_RUN;
+
+		block->prev = this->m_tail;
+		block->next = nullptr;
+		block->prev_free = nullptr;
+		block->next_free = nullptr;
+
+		if (this->m_tail)
+			this->m_tail->next = block;
+		else
+			this->m_head = block;
+
+		this->m_tail = block;
+
+		this->m_block_count++;
+		this->m_capacity += capacity;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Hive<InElementType, InAllocationPolicy>::_release_block(Block* block)
+	{
+		if (block->free_head != NO_RUN)
+			this->_unlink_free_block(block);
+
+		if (block->prev)
+			block->prev->next = block->next;
+		else
+			this->m_head = block->next;
+
+		if (block->next)
+			block->next->prev = block->prev;
+		else
+			this->m_tail = block->prev;
+
+		this->m_block_count--;
+		this->m_capacity -= block->capacity;
+
+		this->m_allocator->Deallocate(block->skip);
+		this->m_allocator->Deallocate(block->data);
+		this->m_allocator->Deallocate(block);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_link_free_block(Block* block)
+	{
+		block->prev_free = nullptr;
+		block->next_free = this->m_free_blocks;
+
+		if (this->m_free_blocks)
+			this->m_free_blocks->prev_free = block;
+
+		this->m_free_blocks = block;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_unlink_free_block(Block* block)
+	{
+		if (block->prev_free)
+			block->prev_free->next_free = block->next_free;
+		else
+			this->m_free_blocks = block->next_free;
+
+		if (block->next_free)
+			block->next_free->prev_free = block->prev_free;
+
+		block->prev_free = nullptr;
+		block->next_free = nullptr;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_push_run(Block* block, Size start)
+	{
+		block->links[start * 2] = NO_RUN;
+		block->links[start * 2 + 1] = block->free_head;
+
+		if (block->free_head != NO_RUN)
+			block->links[block->free_head * 2] = static_cast<SkipType>(start);
+
+		block->free_head = static_cast<SkipType>(start);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_unlink_run(Block* block, Size start)
+	{
+		SkipType prev = block->links[start * 2];
+		SkipType next = block->links[start * 2 + 1];
+
+		if (prev != NO_RUN)
+			block->links[prev * 2 + 1] = next;
+		else
+			block->free_head = next;
+
+		if (next != NO_RUN)
+			block->links[next * 2] = prev;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void Hive<InElementType, InAllocationPolicy>::_replace_run(Block* block, Size start, Size new_start)
+	{
+		SkipType prev = block->links[start * 2];
+		SkipType next = block->links[start * 2 + 1];
+
+		block->links[new_start * 2] = prev;
+		block->links[new_start * 2 + 1] = next;
+
+		if (prev != NO_RUN)
+			block->links[prev * 2 + 1] = static_cast<SkipType>(new_start);
+		else
+			block->free_head = static_cast<SkipType>(new_start);
+
+		if (next != NO_RUN)
+			block->links[next * 2] = static_cast<SkipType>(new_start);
+	}
+}
\ No newline at end of file
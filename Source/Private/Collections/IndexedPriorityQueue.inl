@@ -0,0 +1,297 @@
+#include "Collections/IndexedPriorityQueue.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::IndexedPriorityQueue(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_heap_keys(allocator), m_heap_priorities(allocator), m_positions(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::IndexedPriorityQueue(Size key_count, AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_heap_keys(allocator), m_heap_priorities(allocator), m_positions(allocator)
+	{
+		if (key_count <= 0)
+			throw ::std::invalid_argument("The key count must be greater than 0");
+
+		this->m_allocator = allocator;
+
+		this->Reserve(key_count);
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::IndexedPriorityQueue(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_heap_keys(::std::move(other.m_heap_keys)),
+		  m_heap_priorities(::std::move(other.m_heap_priorities)),
+		  m_positions(::std::move(other.m_positions))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::IndexedPriorityQueue(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_heap_keys(other.m_heap_keys),
+		  m_heap_priorities(other.m_heap_priorities),
+		  m_positions(other.m_positions)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::SelfTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_heap_keys = ::std::move(other.m_heap_keys);
+			this->m_heap_priorities = ::std::move(other.m_heap_priorities);
+			this->m_positions = ::std::move(other.m_positions);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::SelfTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_heap_keys = other.m_heap_keys;
+			this->m_heap_priorities = other.m_heap_priorities;
+			this->m_positions = other.m_positions;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename AbstractIterator<InKeyType>::SelfTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::GetBeginIterator()
+	{
+		return this->m_heap_keys.GetBeginIterator();
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename AbstractIterator<InKeyType>::SelfTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::GetFinalIterator()
+	{
+		return this->m_heap_keys.GetFinalIterator();
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Bool IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Contains(KeyType key) const
+	{
+		Size index = static_cast<Size>(key);
+
+		return index < this->m_positions.GetCount() && this->m_positions[index] != INVALID_POSITION;
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::ConstPriorityTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::GetPriority(KeyType key) const
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the indexed priority queue");
+
+		return this->m_heap_priorities[this->m_positions[static_cast<Size>(key)]];
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::ConstKeyTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Peek() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The indexed priority queue is empty");
+
+		return this->m_heap_keys[0];
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	typename IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::ConstPriorityTypeLRef IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::PeekPriority() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The indexed priority queue is empty");
+
+		return this->m_heap_priorities[0];
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Pop()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The indexed priority queue is empty");
+
+		this->_remove_at(0);
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Push(KeyType key, ConstPriorityTypeLRef priority)
+	{
+		if (this->Contains(key))
+			throw ::std::invalid_argument("The key is already contained in the indexed priority queue");
+
+		this->Reserve(static_cast<Size>(key) + 1);
+
+		this->m_heap_keys.PushBack(key);
+		this->m_heap_priorities.PushBack(priority);
+		this->m_positions[static_cast<Size>(key)] = static_cast<U32>(this->m_count);
+
+		this->m_count++;
+		this->m_capacity = this->m_heap_keys.GetCapacity();
+
+		this->_sift_up(this->m_count - 1);
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::DecreaseKey(KeyType key, ConstPriorityTypeLRef priority)
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the indexed priority queue");
+
+		Size index = this->m_positions[static_cast<Size>(key)];
+
+		if (this->m_heap_priorities[index] < priority)
+			throw ::std::invalid_argument("The new priority must not be greater than the current priority");
+
+		this->m_heap_priorities[index] = priority;
+
+		this->_sift_up(index);
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Update(KeyType key, ConstPriorityTypeLRef priority)
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the indexed priority queue");
+
+		Size index = this->m_positions[static_cast<Size>(key)];
+
+		Bool is_decrease = priority < this->m_heap_priorities[index];
+
+		this->m_heap_priorities[index] = priority;
+
+		if (is_decrease)
+			this->_sift_up(index);
+		else
+			this->_sift_down(index);
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Remove(KeyType key)
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the indexed priority queue");
+
+		this->_remove_at(this->m_positions[static_cast<Size>(key)]);
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Reserve(Size key_count)
+	{
+		if (this->m_positions.GetCount() >= key_count)
+			return;
+
+		this->m_positions.Resize(key_count);
+
+		while (this->m_positions.GetCount() < key_count)
+			this->m_positions.PushBack(INVALID_POSITION);
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::Clear()
+	{
+		for (Size counter = 0; counter < this->m_count; counter++)
+			this->m_positions[static_cast<Size>(this->m_heap_keys[counter])] = INVALID_POSITION;
+
+		this->m_heap_keys.Clear();
+		this->m_heap_priorities.Clear();
+
+		this->m_count = 0;
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::_place(Size index, KeyType key, PriorityTypeRRef priority)
+	{
+		this->m_heap_keys[index] = key;
+		this->m_heap_priorities[index] = ::std::move(priority);
+		this->m_positions[static_cast<Size>(key)] = static_cast<U32>(index);
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::_remove_at(Size index)
+	{
+		Size last = this->m_count - 1;
+
+		this->m_positions[static_cast<Size>(this->m_heap_keys[index])] = INVALID_POSITION;
+
+		if (index != last)
+			this->_place(index, this->m_heap_keys[last], ::std::move(this->m_heap_priorities[last]));
+
+		this->m_heap_keys.PopBack();
+		this->m_heap_priorities.PopBack();
+
+		this->m_count--;
+
+		if (index == last)
+			return;
+
+		if (index > 0 && this->m_heap_priorities[index] < this->m_heap_priorities[(index - 1) / HEAP_ARITY])
+			this->_sift_up(index);
+		else
+			this->_sift_down(index);
+	}
+
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::_sift_up(Size index)
+	{
+		KeyType key = this->m_heap_keys[index];
+		PriorityType priority = ::std::move(this->m_heap_priorities[index]);
+
+		while (index > 0)
+		{
+			Size parent = (index - 1) / HEAP_ARITY;
+
+			if (!(priority < this->m_heap_priorities[parent]))
+				break;
+
+			this->_place(index, this->m_heap_keys[parent], ::std::move(this->m_heap_priorities[parent]));
+
+			index = parent;
+		}
+
+		this->_place(index, key, ::std::move(priority));
+	}
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy>
+	Void IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>::_sift_down(Size index)
+	{
+		KeyType key = this->m_heap_keys[index];
+		PriorityType priority = ::std::move(this->m_heap_priorities[index]);
+
+		while (true)
+		{
+			Size first_child = index * HEAP_ARITY + 1;
+
+			if (first_child >= this->m_count)
+				break;
+
+			Size last_child = ::std::min(first_child + HEAP_ARITY, this->m_count);
+			Size best_child = first_child;
+
+			for (Size child = first_child + 1; child < last_child; child++)
+				if (this->m_heap_priorities[child] < this->m_heap_priorities[best_child])
+					best_child = child;
+
+			if (!(this->m_heap_priorities[best_child] < priority))
+				break;
+
+			this->_place(index, this->m_heap_keys[best_child], ::std::move(this->m_heap_priorities[best_child]));
+
+			index = best_child;
+		}
+
+		this->_place(index, key, ::std::move(priority));
+	}
+}
\ No newline at end of file
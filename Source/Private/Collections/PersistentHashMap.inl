@@ -0,0 +1,653 @@
+#include "Collections/PersistentHashMap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::Transient(const PersistentHashMap& map)
+		: m_allocator(map.m_allocator), m_root(map._acquire()) {}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::Transient(SelfTypeRRef other)
+		: m_allocator(other.m_allocator), m_root(other.m_root)
+	{
+		other.m_root = nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::~Transient()
+	{
+		_release(this->m_root);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Size PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::GetCount() const
+	{
+		return this->m_root ? this->m_root->size : 0;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::Contains(ConstKeyTypeLRef key) const
+	{
+		return this->TryGet(key) != nullptr;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConstValueTypePtr PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::TryGet(ConstKeyTypeLRef key) const
+	{
+		return _find(this->m_root, _hash(key), key);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value)
+	{
+		return _insert_root(this->m_allocator, this->m_root, key, value, true);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::Remove(ConstKeyTypeLRef key)
+	{
+		return _remove_root(this->m_root, key, true);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType> PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient::Persistent()
+	{
+		PersistentHashMap map(this->m_allocator, this->m_root);
+
+		this->m_root = nullptr;
+
+		return map;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::PersistentHashMap(AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_root(nullptr) {}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::PersistentHashMap(SelfTypeRRef other)
+		: m_allocator(other.m_allocator), m_root(other.m_root.exchange(nullptr, ::std::memory_order_relaxed)) {}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::PersistentHashMap(ConstSelfTypeLRef other)
+		: m_allocator(other.m_allocator), m_root(other._acquire()) {}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::PersistentHashMap(AllocatorTypePtr allocator, Node* root)
+		: m_allocator(allocator), m_root(root) {}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::~PersistentHashMap()
+	{
+		_release(this->m_root.load(::std::memory_order_relaxed));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfTypeLRef PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_allocator = other.m_allocator;
+
+			this->_retire(this->m_root.exchange(other.m_root.exchange(nullptr, ::std::memory_order_relaxed), ::std::memory_order_acq_rel));
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfTypeLRef PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+			this->Store(other);
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfType PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Load() const
+	{
+		return SelfType(*this);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Store(ConstSelfTypeLRef other)
+	{
+		this->_retire(this->m_root.exchange(other._acquire(), ::std::memory_order_acq_rel));
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfType PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Exchange(ConstSelfTypeLRef other)
+	{
+		Node* root = this->m_root.exchange(other._acquire(), ::std::memory_order_acq_rel);
+
+		// The returned map takes a reference of its own, since readers that loaded the old root
+		// before the exchange rely on the reference of this map until it is retired.
+		if (root)
+			_retain(root);
+
+		this->_retire(root);
+
+		return SelfType(this->m_allocator, root);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Size PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::GetCount() const
+	{
+		Reclaim::Guard guard;
+
+		Node* root = this->m_root.load(::std::memory_order_acquire);
+
+		return root ? root->size : 0;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::IsEmpty() const
+	{
+		return this->GetCount() == 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Contains(ConstKeyTypeLRef key) const
+	{
+		Reclaim::Guard guard;
+
+		return this->TryGet(key) != nullptr;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConstValueTypeLRef PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Get(ConstKeyTypeLRef key) const
+	{
+		ConstValueTypePtr value = this->TryGet(key);
+
+		if (!value)
+			throw ::std::out_of_range("The key is not contained in the persistent hash map");
+
+		return *value;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConstValueTypePtr PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::TryGet(ConstKeyTypeLRef key) const
+	{
+		return _find(this->m_root.load(::std::memory_order_acquire), _hash(key), key);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	template<typename InCallable>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ForEach(InCallable callable) const
+	{
+		Reclaim::Guard guard;
+
+		Node* root = this->m_root.load(::std::memory_order_acquire);
+
+		if (root)
+			_for_each(root, callable);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfType PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value) const
+	{
+		Node* root = this->_acquire();
+
+		_insert_root(this->m_allocator, root, key, value, false);
+
+		return SelfType(this->m_allocator, root);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::SelfType PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Remove(ConstKeyTypeLRef key) const
+	{
+		Node* root = this->_acquire();
+
+		_remove_root(root, key, false);
+
+		return SelfType(this->m_allocator, root);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Transient PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ToTransient() const
+	{
+		return Transient(*this);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE U64 PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_hash(ConstKeyTypeLRef key)
+	{
+		U64 hash = static_cast<U64>(HasherType()(key));
+
+		// Mixes the hash, since identity hashes of integers would differ only in the first levels.
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ull;
+		hash ^= hash >> 33;
+
+		return hash;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Entry* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_entries(Node* node)
+	{
+		return reinterpret_cast<Entry*>(reinterpret_cast<BytePtr>(node) + ENTRIES_OFFSET);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node** PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_children(Node* node)
+	{
+		Size offset = (ENTRIES_OFFSET + node->count * sizeof(Entry) + alignof(Node*) - 1) & ~(alignof(Node*) - 1);
+
+		return reinterpret_cast<Node**>(reinterpret_cast<BytePtr>(node) + offset);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_create(AllocatorTypePtr allocator, U32 entry_map, U32 child_map, Size count, Size size)
+	{
+		Size offset = (ENTRIES_OFFSET + count * sizeof(Entry) + alignof(Node*) - 1) & ~(alignof(Node*) - 1);
+		VoidPtr memory = allocator->Allocate(offset + PopCount(child_map) * sizeof(Node*), NODE_ALIGNMENT);
+
+		return new (memory) Node{ { 1 }, allocator, size, entry_map, child_map, U32(count) };
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	FORGE_FORCE_INLINE typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_retain(Node* node)
+	{
+		node->references.fetch_add(1, ::std::memory_order_relaxed);
+
+		return node;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_release(Node* node)
+	{
+		if (!node || node->references.fetch_sub(1, ::std::memory_order_acq_rel) != 1)
+			return;
+
+		if constexpr (!::std::is_trivially_destructible<Entry>::value)
+			DestructArray(_entries(node), node->count);
+
+		Node** children = _children(node);
+		Size child_count = PopCount(node->child_map);
+
+		for (Size index = 0; index < child_count; index++)
+			_release(children[index]);
+
+		AllocatorTypePtr allocator = node->allocator;
+
+		node->~Node();
+
+		allocator->Deallocate(node);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_release_retired(VoidPtr node, VoidPtr)
+	{
+		_release(static_cast<Node*>(node));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_copy(Node* node)
+	{
+		Node* copy = _create(node->allocator, node->entry_map, node->child_map, node->count, node->size);
+
+		CopyArray(_entries(copy), static_cast<const Entry*>(_entries(node)), node->count);
+
+		Node** children = _children(node);
+		Node** copy_children = _children(copy);
+		Size child_count = PopCount(node->child_map);
+
+		for (Size index = 0; index < child_count; index++)
+			copy_children[index] = _retain(children[index]);
+
+		return copy;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_rebuild(Node* node, U32 entry_map, U32 child_map, Size size, U64 hash, ConstKeyTypePtr key, ConstValueTypePtr value, Node* child)
+	{
+		// Copies every slot the maps share with the node, and fills the one slot that moved in
+		// with the specified entry or child.
+		Node* rebuilt = _create(node->allocator, entry_map, child_map, PopCount(entry_map), size);
+		Entry* entries = _entries(rebuilt);
+		Node** children = _children(rebuilt);
+
+		for (U32 map = entry_map; map != 0; map &= map - 1)
+		{
+			U32 bit = map & (~map + 1);
+
+			if (node->entry_map & bit)
+				new (entries++) Entry(_entries(node)[PopCount(node->entry_map & (bit - 1))]);
+			else
+				new (entries++) Entry(hash, *key, *value);
+		}
+
+		for (U32 map = child_map; map != 0; map &= map - 1)
+		{
+			U32 bit = map & (~map + 1);
+
+			if (node->child_map & bit)
+				*children++ = _retain(_children(node)[PopCount(node->child_map & (bit - 1))]);
+			else
+				*children++ = child;
+		}
+
+		return rebuilt;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_pair(AllocatorTypePtr allocator, const Entry& entry, U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Size shift)
+	{
+		if (shift >= HASH_BITS)
+		{
+			Node* collision = _create(allocator, 0, 0, 2, 2);
+
+			new (_entries(collision)) Entry(entry);
+			new (_entries(collision) + 1) Entry(hash, key, value);
+
+			return collision;
+		}
+
+		U32 first_bit = U32(1) << ((entry.hash >> shift) & MASK);
+		U32 second_bit = U32(1) << ((hash >> shift) & MASK);
+
+		if (first_bit == second_bit)
+		{
+			Node* node = _create(allocator, 0, first_bit, 0, 2);
+
+			_children(node)[0] = _pair(allocator, entry, hash, key, value, shift + BITS);
+
+			return node;
+		}
+
+		Node* node = _create(allocator, first_bit | second_bit, 0, 2, 2);
+		Entry* entries = _entries(node);
+
+		if (first_bit < second_bit)
+		{
+			new (entries) Entry(entry);
+			new (entries + 1) Entry(hash, key, value);
+		}
+		else
+		{
+			new (entries) Entry(hash, key, value);
+			new (entries + 1) Entry(entry);
+		}
+
+		return node;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::ConstValueTypePtr PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_find(Node* root, U64 hash, ConstKeyTypeLRef key)
+	{
+		Node* node = root;
+
+		for (Size shift = 0; node; shift += BITS)
+		{
+			if (shift >= HASH_BITS)
+			{
+				Entry* entries = _entries(node);
+
+				for (Size index = 0; index < node->count; index++)
+				{
+					if (entries[index].key == key)
+						return &entries[index].value;
+				}
+
+				return nullptr;
+			}
+
+			U32 bit = U32(1) << ((hash >> shift) & MASK);
+
+			if (node->entry_map & bit)
+			{
+				const Entry& entry = _entries(node)[PopCount(node->entry_map & (bit - 1))];
+
+				return entry.hash == hash && entry.key == key ? &entry.value : nullptr;
+			}
+
+			if (!(node->child_map & bit))
+				return nullptr;
+
+			node = _children(node)[PopCount(node->child_map & (bit - 1))];
+		}
+
+		return nullptr;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_insert(AllocatorTypePtr allocator, Node* node, Size shift, U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool mutate, Bool& added)
+	{
+		// A node is only updated in place if it and every node above it are owned by a single
+		// version, since a node with one reference may still be reachable through a shared parent.
+		Bool in_place = mutate && node->references.load(::std::memory_order_acquire) == 1;
+
+		if (shift >= HASH_BITS)
+		{
+			Entry* entries = _entries(node);
+
+			for (Size index = 0; index < node->count; index++)
+			{
+				if (entries[index].key == key)
+				{
+					Node* updated = in_place ? node : _copy(node);
+
+					_entries(updated)[index].value = value;
+					added = false;
+
+					return updated;
+				}
+			}
+
+			Node* collision = _create(node->allocator, 0, 0, node->count + 1, node->size + 1);
+
+			CopyArray(_entries(collision), static_cast<const Entry*>(entries), node->count);
+
+			new (_entries(collision) + node->count) Entry(hash, key, value);
+			added = true;
+
+			return collision;
+		}
+
+		U32 bit = U32(1) << ((hash >> shift) & MASK);
+
+		if (node->entry_map & bit)
+		{
+			Size index = PopCount(node->entry_map & (bit - 1));
+			const Entry& entry = _entries(node)[index];
+
+			if (entry.hash == hash && entry.key == key)
+			{
+				Node* updated = in_place ? node : _copy(node);
+
+				_entries(updated)[index].value = value;
+				added = false;
+
+				return updated;
+			}
+
+			// The slot is taken by another key, so both move down into a new child.
+			Node* child = _pair(allocator, entry, hash, key, value, shift + BITS);
+
+			added = true;
+
+			return _rebuild(node, node->entry_map & ~bit, node->child_map | bit, node->size + 1, 0, nullptr, nullptr, child);
+		}
+
+		if (node->child_map & bit)
+		{
+			Size index = PopCount(node->child_map & (bit - 1));
+			Node* child = _children(node)[index];
+			Node* inserted = _insert(allocator, child, shift + BITS, hash, key, value, in_place, added);
+			Node* parent = in_place ? node : _copy(node);
+
+			if (inserted != child)
+			{
+				_release(child);
+
+				_children(parent)[index] = inserted;
+			}
+
+			if (added)
+				parent->size++;
+
+			return parent;
+		}
+
+		added = true;
+
+		return _rebuild(node, node->entry_map | bit, node->child_map, node->size + 1, hash, &key, &value, nullptr);
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_remove(Node* node, Size shift, U64 hash, ConstKeyTypeLRef key, Bool mutate, Bool& removed)
+	{
+		Bool in_place = mutate && node->references.load(::std::memory_order_acquire) == 1;
+
+		removed = false;
+
+		if (shift >= HASH_BITS)
+		{
+			Entry* entries = _entries(node);
+
+			for (Size index = 0; index < node->count; index++)
+			{
+				if (!(entries[index].key == key))
+					continue;
+
+				removed = true;
+
+				if (node->count == 1)
+					return nullptr;
+
+				Node* collision = _create(node->allocator, 0, 0, node->count - 1, node->size - 1);
+
+				CopyArray(_entries(collision), static_cast<const Entry*>(entries), index);
+				CopyArray(_entries(collision) + index, static_cast<const Entry*>(entries + index + 1), node->count - index - 1);
+
+				return collision;
+			}
+
+			return node;
+		}
+
+		U32 bit = U32(1) << ((hash >> shift) & MASK);
+
+		if (node->entry_map & bit)
+		{
+			const Entry& entry = _entries(node)[PopCount(node->entry_map & (bit - 1))];
+
+			if (entry.hash != hash || !(entry.key == key))
+				return node;
+
+			removed = true;
+
+			if (node->size == 1)
+				return nullptr;
+
+			return _rebuild(node, node->entry_map & ~bit, node->child_map, node->size - 1, 0, nullptr, nullptr, nullptr);
+		}
+
+		if (!(node->child_map & bit))
+			return node;
+
+		Size index = PopCount(node->child_map & (bit - 1));
+		Node* child = _children(node)[index];
+		Node* remaining = _remove(child, shift + BITS, hash, key, in_place, removed);
+
+		if (!removed)
+			return node;
+
+		// A child always holds at least two entries, so a child left with a single entry is
+		// folded back into this node, which keeps the trie canonical and never empties a child.
+		if (remaining->size == 1)
+		{
+			const Entry& entry = _entries(remaining)[0];
+			Node* parent = _rebuild(node, node->entry_map | bit, node->child_map & ~bit, node->size - 1, entry.hash, &entry.key, &entry.value, nullptr);
+
+			if (remaining != child)
+				_release(remaining);
+
+			return parent;
+		}
+
+		Node* parent = in_place ? node : _copy(node);
+
+		if (remaining != child)
+		{
+			_release(child);
+
+			_children(parent)[index] = remaining;
+		}
+
+		parent->size--;
+
+		return parent;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_insert_root(AllocatorTypePtr allocator, Node*& root, ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool mutate)
+	{
+		U64 hash = _hash(key);
+
+		if (!root)
+		{
+			root = _create(allocator, U32(1) << (hash & MASK), 0, 1, 1);
+
+			new (_entries(root)) Entry(hash, key, value);
+
+			return true;
+		}
+
+		Bool added;
+		Node* inserted = _insert(allocator, root, 0, hash, key, value, mutate, added);
+
+		if (inserted != root)
+		{
+			_release(root);
+
+			root = inserted;
+		}
+
+		return added;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Bool PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_remove_root(Node*& root, ConstKeyTypeLRef key, Bool mutate)
+	{
+		if (!root)
+			return false;
+
+		Bool removed;
+		Node* remaining = _remove(root, 0, _hash(key), key, mutate, removed);
+
+		if (remaining != root)
+		{
+			_release(root);
+
+			root = remaining;
+		}
+
+		return removed;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	template<typename InCallable>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_for_each(Node* node, InCallable& callable)
+	{
+		const Entry* entries = _entries(node);
+
+		for (Size index = 0; index < node->count; index++)
+			callable(entries[index].key, entries[index].value);
+
+		Node** children = _children(node);
+		Size child_count = PopCount(node->child_map);
+
+		for (Size index = 0; index < child_count; index++)
+			_for_each(children[index], callable);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	typename PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::Node* PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_acquire() const
+	{
+		// A root replaced by Store keeps the reference of this map until no pinned thread can
+		// hold its pointer, so the count cannot drop to zero before the increment.
+		Reclaim::Guard guard;
+
+		Node* root = this->m_root.load(::std::memory_order_acquire);
+
+		if (root)
+			_retain(root);
+
+		return root;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy, typename InHasherType>
+	Void PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>::_retire(Node* node)
+	{
+		if (!node)
+			return;
+
+		Reclaim::EpochManager& manager = Reclaim::EpochManager::GetDefault();
+
+		manager.Retire(node, nullptr, &_release_retired);
+
+		// A replaced root may hold the only reference to large subtrees, so it is not left
+		// waiting for COLLECT_INTERVAL more retirements on this thread.
+		manager.Collect();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,817 @@
+#include "Collections/PersistentVector.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::Transient::Transient(const PersistentVector& vector)
+		: m_allocator(vector.m_allocator), m_root(vector.m_root ? _acquire(vector.m_root) : nullptr), m_shift(vector.m_shift), m_count(vector.m_count) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::Transient::Transient(SelfTypeRRef other)
+		: m_allocator(other.m_allocator), m_root(other.m_root), m_shift(other.m_shift), m_count(other.m_count)
+	{
+		other.m_root = nullptr;
+		other.m_shift = 0;
+		other.m_count = 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::Transient::~Transient()
+	{
+		_release(this->m_root, this->m_shift);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size PersistentVector<InElementType, InAllocationPolicy>::Transient::GetCount() const
+	{
+		return this->m_count;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::ConstElementTypeLRef PersistentVector<InElementType, InAllocationPolicy>::Transient::Get(Size index) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return _get(this->m_root, this->m_shift, index);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::Transient::PushBack(ConstElementTypeLRef element)
+	{
+		_push_root(this->m_allocator, this->m_root, this->m_shift, element, true);
+
+		this->m_count++;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::Transient::Set(Size index, ConstElementTypeLRef element)
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		_set_root(this->m_root, this->m_shift, index, element, true);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy> PersistentVector<InElementType, InAllocationPolicy>::Transient::Persistent()
+	{
+		PersistentVector vector(this->m_allocator, this->m_root, this->m_shift, this->m_count);
+
+		this->m_root = nullptr;
+		this->m_shift = 0;
+		this->m_count = 0;
+
+		return vector;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::PersistentVector(AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_root(nullptr), m_shift(0), m_count(0) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::PersistentVector(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_root(nullptr), m_shift(0), m_count(0)
+	{
+		for (ConstElementTypeLRef element : init_list)
+		{
+			_push_root(this->m_allocator, this->m_root, this->m_shift, element, true);
+
+			this->m_count++;
+		}
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::PersistentVector(SelfTypeRRef other)
+		: m_allocator(other.m_allocator), m_root(other.m_root), m_shift(other.m_shift), m_count(other.m_count)
+	{
+		other.m_root = nullptr;
+		other.m_shift = 0;
+		other.m_count = 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::PersistentVector(ConstSelfTypeLRef other)
+		: m_allocator(other.m_allocator), m_root(other.m_root ? _acquire(other.m_root) : nullptr), m_shift(other.m_shift), m_count(other.m_count) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::PersistentVector(AllocatorTypePtr allocator, Node* root, Size shift, Size count)
+		: m_allocator(allocator), m_root(root), m_shift(shift), m_count(count) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	PersistentVector<InElementType, InAllocationPolicy>::~PersistentVector()
+	{
+		_release(this->m_root, this->m_shift);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfTypeLRef PersistentVector<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			_release(this->m_root, this->m_shift);
+
+			this->m_allocator = other.m_allocator;
+			this->m_root = other.m_root;
+			this->m_shift = other.m_shift;
+			this->m_count = other.m_count;
+
+			other.m_root = nullptr;
+			other.m_shift = 0;
+			other.m_count = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfTypeLRef PersistentVector<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			Node* root = other.m_root ? _acquire(other.m_root) : nullptr;
+
+			_release(this->m_root, this->m_shift);
+
+			this->m_allocator = other.m_allocator;
+			this->m_root = root;
+			this->m_shift = other.m_shift;
+			this->m_count = other.m_count;
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size PersistentVector<InElementType, InAllocationPolicy>::GetCount() const
+	{
+		return this->m_count;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool PersistentVector<InElementType, InAllocationPolicy>::IsEmpty() const
+	{
+		return this->m_count == 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::ConstElementTypeLRef PersistentVector<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return _get(this->m_root, this->m_shift, index);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::ConstElementTypeLRef PersistentVector<InElementType, InAllocationPolicy>::Get(Size index) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfType PersistentVector<InElementType, InAllocationPolicy>::PushBack(ConstElementTypeLRef element) const
+	{
+		SelfType version(*this);
+
+		_push_root(version.m_allocator, version.m_root, version.m_shift, element, false);
+
+		version.m_count++;
+
+		return version;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfType PersistentVector<InElementType, InAllocationPolicy>::Set(Size index, ConstElementTypeLRef element) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		SelfType version(*this);
+
+		_set_root(version.m_root, version.m_shift, index, element, false);
+
+		return version;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfType PersistentVector<InElementType, InAllocationPolicy>::Slice(Size first, Size last) const
+	{
+		if (first > last || last > this->m_count)
+			throw ::std::out_of_range("The range is out of range");
+
+		if (first == last)
+			return SelfType(this->m_allocator);
+
+		Node* prefix = _take(this->m_root, this->m_shift, last);
+		Node* root = _drop(prefix, this->m_shift, first);
+		Size shift = this->m_shift;
+
+		_release(prefix, shift);
+		_collapse(root, shift);
+
+		return SelfType(this->m_allocator, root, shift, last - first);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::SelfType PersistentVector<InElementType, InAllocationPolicy>::Concatenate(ConstSelfTypeLRef other) const
+	{
+		if (other.IsEmpty())
+			return *this;
+
+		if (this->IsEmpty())
+			return other;
+
+		Node* root = _merge(this->m_allocator, this->m_root, this->m_shift, other.m_root, other.m_shift);
+		Size shift = (this->m_shift > other.m_shift ? this->m_shift : other.m_shift) + BITS;
+
+		_collapse(root, shift);
+
+		return SelfType(this->m_allocator, root, shift, this->m_count + other.m_count);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::Transient PersistentVector<InElementType, InAllocationPolicy>::ToTransient() const
+	{
+		return Transient(*this);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::ElementTypePtr PersistentVector<InElementType, InAllocationPolicy>::_elements(Node* node)
+	{
+		return reinterpret_cast<ElementTypePtr>(reinterpret_cast<BytePtr>(node) + LEAF_OFFSET);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::Node** PersistentVector<InElementType, InAllocationPolicy>::_children(Node* node)
+	{
+		return reinterpret_cast<Node**>(reinterpret_cast<BytePtr>(node) + CHILDREN_OFFSET);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size* PersistentVector<InElementType, InAllocationPolicy>::_sizes(Node* node)
+	{
+		return reinterpret_cast<Size*>(reinterpret_cast<BytePtr>(node) + SIZES_OFFSET);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_create(AllocatorTypePtr allocator, Bool leaf)
+	{
+		Size size = leaf ? LEAF_OFFSET + BRANCH * sizeof(ElementType) : SIZES_OFFSET + BRANCH * sizeof(Size);
+		VoidPtr memory = allocator->Allocate(size, NODE_ALIGNMENT);
+
+		return new (memory) Node{ { 1 }, allocator, 0, false };
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_acquire(Node* node)
+	{
+		node->references.fetch_add(1, ::std::memory_order_relaxed);
+
+		return node;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_release(Node* node, Size shift)
+	{
+		if (!node || node->references.fetch_sub(1, ::std::memory_order_acq_rel) != 1)
+			return;
+
+		if (shift == 0)
+		{
+			if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+				DestructArray(_elements(node), node->count);
+		}
+		else
+		{
+			Node** children = _children(node);
+
+			for (Size slot = 0; slot < node->count; slot++)
+				_release(children[slot], shift - BITS);
+		}
+
+		AllocatorTypePtr allocator = node->allocator;
+
+		node->~Node();
+
+		allocator->Deallocate(node);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Size PersistentVector<InElementType, InAllocationPolicy>::_size(Node* node, Size shift)
+	{
+		Size size = 0;
+
+		// Every child of a regular node but the last is full, so only the rightmost path needs
+		// to be walked.
+		while (shift > 0)
+		{
+			if (node->relaxed)
+				return size + _sizes(node)[node->count - 1];
+
+			size += Size(node->count - 1) << shift;
+
+			node = _children(node)[node->count - 1];
+			shift -= BITS;
+		}
+
+		return size + node->count;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size PersistentVector<InElementType, InAllocationPolicy>::_locate(Node* node, Size shift, Size index, Size& slot)
+	{
+		slot = index >> shift;
+
+		if (!node->relaxed)
+			return index - (slot << shift);
+
+		// Children hold at most 1 << shift elements, so the radix slot never overshoots and the
+		// search step invariant bounds the scan to a few slots.
+		Size* sizes = _sizes(node);
+
+		while (sizes[slot] <= index)
+			slot++;
+
+		return slot > 0 ? index - sizes[slot - 1] : index;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_update_sizes(Node* node, Size shift)
+	{
+		Node** children = _children(node);
+		Size* sizes = _sizes(node);
+		Size total = 0;
+
+		for (Size slot = 0; slot < node->count; slot++)
+		{
+			total += _size(children[slot], shift - BITS);
+
+			sizes[slot] = total;
+		}
+
+		node->relaxed = true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_copy(Node* node, Size shift)
+	{
+		Node* copy = _create(node->allocator, shift == 0);
+
+		_append_slots(copy, node, 0, node->count, shift);
+
+		if (shift > 0 && node->relaxed)
+		{
+			CopyArray(_sizes(copy), static_cast<const Size*>(_sizes(node)), node->count);
+
+			copy->relaxed = true;
+		}
+
+		return copy;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_append_slots(Node* target, Node* source, Size first, Size count, Size shift)
+	{
+		if (shift == 0)
+		{
+			CopyArray(_elements(target) + target->count, static_cast<ConstElementTypePtr>(_elements(source) + first), count);
+		}
+		else
+		{
+			Node** targets = _children(target) + target->count;
+			Node** sources = _children(source) + first;
+
+			for (Size slot = 0; slot < count; slot++)
+				targets[slot] = _acquire(sources[slot]);
+		}
+
+		target->count += U32(count);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_collapse(Node*& root, Size& shift)
+	{
+		while (shift > 0 && root->count == 1)
+		{
+			Node* child = _acquire(_children(root)[0]);
+
+			_release(root, shift);
+
+			root = child;
+			shift -= BITS;
+		}
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename PersistentVector<InElementType, InAllocationPolicy>::ConstElementTypeLRef PersistentVector<InElementType, InAllocationPolicy>::_get(Node* root, Size shift, Size index)
+	{
+		Node* node = root;
+		Size slot;
+
+		for (; shift > 0; shift -= BITS)
+		{
+			index = _locate(node, shift, index, slot);
+			node = _children(node)[slot];
+		}
+
+		return _elements(node)[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_new_path(AllocatorTypePtr allocator, Size shift, ConstElementTypeLRef element)
+	{
+		Node* node = _create(allocator, true);
+
+		new (_elements(node)) ElementType(element);
+
+		node->count = 1;
+
+		for (Size level = 0; level < shift; level += BITS)
+		{
+			Node* parent = _create(allocator, false);
+
+			_children(parent)[0] = node;
+			parent->count = 1;
+
+			node = parent;
+		}
+
+		return node;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_push(AllocatorTypePtr allocator, Node* node, Size shift, ConstElementTypeLRef element, Bool mutate)
+	{
+		// A node is only updated in place if it and every node above it are owned by a single
+		// version, since a node with one reference may still be reachable through a shared parent.
+		Bool in_place = mutate && node->references.load(::std::memory_order_acquire) == 1;
+
+		if (shift == 0)
+		{
+			if (node->count == BRANCH)
+				return nullptr;
+
+			Node* leaf = in_place ? node : _copy(node, shift);
+
+			new (_elements(leaf) + leaf->count) ElementType(element);
+
+			leaf->count++;
+
+			return leaf;
+		}
+
+		Size last = node->count - 1;
+		Node* child = _children(node)[last];
+		Node* pushed = _push(allocator, child, shift - BITS, element, in_place);
+
+		if (!pushed && node->count == BRANCH)
+			return nullptr;
+
+		Node* parent = in_place ? node : _copy(node, shift);
+
+		if (pushed)
+		{
+			if (pushed != child)
+			{
+				_release(child, shift - BITS);
+
+				_children(parent)[last] = pushed;
+			}
+
+			if (parent->relaxed)
+				_sizes(parent)[last]++;
+
+			return parent;
+		}
+
+		// A regular node indexes by radix, which only holds while every child but the last is full.
+		if (!parent->relaxed && _size(child, shift - BITS) != (Size(1) << shift))
+			_update_sizes(parent, shift);
+
+		_children(parent)[parent->count] = _new_path(allocator, shift - BITS, element);
+
+		if (parent->relaxed)
+			_sizes(parent)[parent->count] = _sizes(parent)[last] + 1;
+
+		parent->count++;
+
+		return parent;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_push_root(AllocatorTypePtr allocator, Node*& root, Size& shift, ConstElementTypeLRef element, Bool mutate)
+	{
+		if (!root)
+		{
+			root = _new_path(allocator, 0, element);
+			shift = 0;
+
+			return;
+		}
+
+		Node* pushed = _push(allocator, root, shift, element, mutate);
+
+		if (pushed)
+		{
+			if (pushed != root)
+			{
+				_release(root, shift);
+
+				root = pushed;
+			}
+
+			return;
+		}
+
+		// The tree is full, so it grows a level and the previous root becomes its first child.
+		Node* parent = _create(allocator, false);
+
+		_children(parent)[0] = root;
+		_children(parent)[1] = _new_path(allocator, shift, element);
+
+		parent->count = 2;
+
+		if (_size(root, shift) != (Size(1) << (shift + BITS)))
+			_update_sizes(parent, shift + BITS);
+
+		root = parent;
+		shift += BITS;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_set(Node* node, Size shift, Size index, ConstElementTypeLRef element, Bool mutate)
+	{
+		Bool in_place = mutate && node->references.load(::std::memory_order_acquire) == 1;
+
+		if (shift == 0)
+		{
+			Node* leaf = in_place ? node : _copy(node, shift);
+
+			_elements(leaf)[index] = element;
+
+			return leaf;
+		}
+
+		Size slot;
+		Size child_index = _locate(node, shift, index, slot);
+		Node* child = _children(node)[slot];
+		Node* updated = _set(child, shift - BITS, child_index, element, in_place);
+
+		if (updated == child)
+			return node;
+
+		Node* parent = in_place ? node : _copy(node, shift);
+
+		_release(child, shift - BITS);
+
+		_children(parent)[slot] = updated;
+
+		return parent;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void PersistentVector<InElementType, InAllocationPolicy>::_set_root(Node*& root, Size shift, Size index, ConstElementTypeLRef element, Bool mutate)
+	{
+		Node* updated = _set(root, shift, index, element, mutate);
+
+		if (updated != root)
+		{
+			_release(root, shift);
+
+			root = updated;
+		}
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_take(Node* node, Size shift, Size count)
+	{
+		if (shift == 0)
+		{
+			if (count == node->count)
+				return _acquire(node);
+
+			Node* leaf = _create(node->allocator, true);
+
+			_append_slots(leaf, node, 0, count, shift);
+
+			return leaf;
+		}
+
+		Size slot;
+		Size child_count = _locate(node, shift, count - 1, slot) + 1;
+		Node* child = _children(node)[slot];
+		Node* taken = _take(child, shift - BITS, child_count);
+
+		if (taken == child && slot == node->count - Size(1))
+		{
+			_release(taken, shift - BITS);
+
+			return _acquire(node);
+		}
+
+		// Every child kept before the last one is whole, so a regular node stays regular.
+		Node* parent = _create(node->allocator, false);
+
+		_append_slots(parent, node, 0, slot, shift);
+
+		_children(parent)[slot] = taken;
+		parent->count++;
+
+		if (node->relaxed)
+		{
+			Size* sizes = _sizes(parent);
+
+			CopyArray(sizes, static_cast<const Size*>(_sizes(node)), slot);
+
+			sizes[slot] = (slot > 0 ? sizes[slot - 1] : 0) + _size(taken, shift - BITS);
+			parent->relaxed = true;
+		}
+
+		return parent;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_drop(Node* node, Size shift, Size count)
+	{
+		if (count == 0)
+			return _acquire(node);
+
+		if (shift == 0)
+		{
+			Node* leaf = _create(node->allocator, true);
+
+			_append_slots(leaf, node, count, node->count - count, shift);
+
+			return leaf;
+		}
+
+		Size slot;
+		Size child_count = _locate(node, shift, count, slot);
+		Node* parent = _create(node->allocator, false);
+
+		_children(parent)[0] = _drop(_children(node)[slot], shift - BITS, child_count);
+		parent->count = 1;
+
+		_append_slots(parent, node, slot + 1, node->count - slot - 1, shift);
+
+		// The first child is now partially filled, so the node can no longer be indexed by radix.
+		_update_sizes(parent, shift);
+
+		return parent;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_merge(AllocatorTypePtr allocator, Node* left, Size left_shift, Node* right, Size right_shift)
+	{
+		// Merging two trees joins the rightmost path of the left tree with the leftmost path of
+		// the right tree. The result is one level above the taller tree and has one or two
+		// children, whose own children along the seam are rebalanced.
+		if (left_shift == 0 && right_shift == 0)
+		{
+			Node* parent = _create(allocator, false);
+
+			if (left->count + right->count <= BRANCH)
+			{
+				Node* leaf = _create(allocator, true);
+
+				_append_slots(leaf, left, 0, left->count, 0);
+				_append_slots(leaf, right, 0, right->count, 0);
+
+				_children(parent)[0] = leaf;
+				parent->count = 1;
+			}
+			else
+			{
+				_children(parent)[0] = _acquire(left);
+				_children(parent)[1] = _acquire(right);
+				parent->count = 2;
+			}
+
+			_update_sizes(parent, BITS);
+
+			return parent;
+		}
+
+		Node* merged;
+		Node* middle;
+
+		if (left_shift > right_shift)
+		{
+			middle = _merge(allocator, _children(left)[left->count - 1], left_shift - BITS, right, right_shift);
+			merged = _rebalance(allocator, _children(left), left->count - 1, middle, nullptr, 0, left_shift - BITS);
+
+			_release(middle, left_shift);
+		}
+		else if (left_shift < right_shift)
+		{
+			middle = _merge(allocator, left, left_shift, _children(right)[0], right_shift - BITS);
+			merged = _rebalance(allocator, nullptr, 0, middle, _children(right) + 1, right->count - 1, right_shift - BITS);
+
+			_release(middle, right_shift);
+		}
+		else
+		{
+			middle = _merge(allocator, _children(left)[left->count - 1], left_shift - BITS, _children(right)[0], right_shift - BITS);
+			merged = _rebalance(allocator, _children(left), left->count - 1, middle, _children(right) + 1, right->count - 1, left_shift - BITS);
+
+			_release(middle, left_shift);
+		}
+
+		return merged;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename PersistentVector<InElementType, InAllocationPolicy>::Node* PersistentVector<InElementType, InAllocationPolicy>::_rebalance(AllocatorTypePtr allocator, Node* const* left, Size left_count, Node* middle, Node* const* right, Size right_count, Size shift)
+	{
+		// The nodes along the seam are at most 2 * BRANCH, since the middle holds at most two
+		// children and each side gives up one of its own to the middle.
+		Node* nodes[2 * BRANCH];
+		Size counts[2 * BRANCH];
+		Size node_count = 0;
+		Size total = 0;
+
+		for (Size index = 0; index < left_count; index++)
+			nodes[node_count++] = left[index];
+
+		for (Size index = 0; index < middle->count; index++)
+			nodes[node_count++] = _children(middle)[index];
+
+		for (Size index = 0; index < right_count; index++)
+			nodes[node_count++] = right[index];
+
+		for (Size index = 0; index < node_count; index++)
+		{
+			counts[index] = nodes[index]->count;
+			total += counts[index];
+		}
+
+		// Plan the concatenation: as long as there are more than EXTRA_SLOTS nodes beyond the
+		// optimum, spread the slots of the first node with room to spare over the nodes that
+		// follow it and drop it.
+		Size optimal = (total + BRANCH - 1) / BRANCH;
+		Size planned = node_count;
+		Size index = 0;
+
+		while (planned > optimal + EXTRA_SLOTS)
+		{
+			while (counts[index] > BRANCH - INVARIANT_SLOTS)
+				index++;
+
+			Size remaining = counts[index];
+
+			do
+			{
+				Size merged = remaining + counts[index + 1] < BRANCH ? remaining + counts[index + 1] : BRANCH;
+
+				remaining = remaining + counts[index + 1] - merged;
+				counts[index] = merged;
+
+				index++;
+			}
+			while (remaining > 0);
+
+			for (Size next = index; next < planned - 1; next++)
+				counts[next] = counts[next + 1];
+
+			planned--;
+			index--;
+		}
+
+		// Execute the plan, reusing every node whose slots are not moved.
+		Node* rebalanced[2 * BRANCH];
+		Size source = 0;
+		Size offset = 0;
+
+		for (Size target = 0; target < planned; target++)
+		{
+			if (offset == 0 && nodes[source]->count == counts[target])
+			{
+				rebalanced[target] = _acquire(nodes[source++]);
+
+				continue;
+			}
+
+			Node* node = _create(allocator, shift == 0);
+
+			while (node->count < counts[target])
+			{
+				Size available = nodes[source]->count - offset;
+				Size needed = counts[target] - node->count;
+				Size moved = available < needed ? available : needed;
+
+				_append_slots(node, nodes[source], offset, moved, shift);
+
+				offset += moved;
+
+				if (offset == nodes[source]->count)
+				{
+					source++;
+					offset = 0;
+				}
+			}
+
+			if (shift > 0)
+				_update_sizes(node, shift);
+
+			rebalanced[target] = node;
+		}
+
+		Node* parent = _create(allocator, false);
+
+		for (Size first = 0; first < planned; first += BRANCH)
+		{
+			Node* node = _create(allocator, false);
+			Size count = planned - first < BRANCH ? planned - first : BRANCH;
+
+			CopyArray(_children(node), static_cast<Node* const*>(rebalanced + first), count);
+
+			node->count = U32(count);
+
+			_update_sizes(node, shift + BITS);
+
+			_children(parent)[parent->count++] = node;
+		}
+
+		_update_sizes(parent, shift + 2 * BITS);
+
+		return parent;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include "Collections/RadixHeap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	RadixHeap<InKeyType, InValueType, InAllocationPolicy>::RadixHeap(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_last_key(0), m_buckets(allocator)
+	{
+		this->m_allocator = allocator;
+
+		this->_create_buckets();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	RadixHeap<InKeyType, InValueType, InAllocationPolicy>::RadixHeap(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_last_key(other.m_last_key), m_buckets(::std::move(other.m_buckets))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_last_key = 0;
+
+		// The buckets were moved out, and Push and Clear index them unchecked.
+		other._create_buckets();
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	RadixHeap<InKeyType, InValueType, InAllocationPolicy>::RadixHeap(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity), m_last_key(other.m_last_key), m_buckets(other.m_buckets)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename RadixHeap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_buckets = ::std::move(other.m_buckets);
+
+			this->m_count = other.m_count;
+			this->m_last_key = other.m_last_key;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_last_key = 0;
+
+			other._create_buckets();
+		}
+
+		return *this;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename RadixHeap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_buckets = other.m_buckets;
+
+			this->m_count = other.m_count;
+			this->m_last_key = other.m_last_key;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::GetBeginIterator()
+	{
+		throw std::logic_error("A radix heap only allows access to the minimum element");
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::GetFinalIterator()
+	{
+		throw std::logic_error("A radix heap only allows access to the minimum element");
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename RadixHeap<InKeyType, InValueType, InAllocationPolicy>::KeyType RadixHeap<InKeyType, InValueType, InAllocationPolicy>::GetLastKey() const
+	{
+		return this->m_last_key;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename RadixHeap<InKeyType, InValueType, InAllocationPolicy>::ConstKeyTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::PeekKey()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The radix heap is empty");
+
+		this->_refill();
+
+		return this->m_buckets[0].GetBack().key;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename RadixHeap<InKeyType, InValueType, InAllocationPolicy>::ValueTypeLRef RadixHeap<InKeyType, InValueType, InAllocationPolicy>::PeekValue()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The radix heap is empty");
+
+		this->_refill();
+
+		return this->m_buckets[0].GetBack().value;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::Pop()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The radix heap is empty");
+
+		this->_refill();
+
+		this->m_buckets[0].PopBack();
+
+		this->m_count--;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::Push(KeyType key, ValueTypeRRef value)
+	{
+		if (key < this->m_last_key)
+			throw ::std::invalid_argument("The key must not be smaller than the last retrieved key");
+
+		this->m_buckets[this->_bucket_index(key)].PushBack(Entry{ key, ::std::move(value) });
+
+		this->m_count++;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::Push(KeyType key, ConstValueTypeLRef value)
+	{
+		if (key < this->m_last_key)
+			throw ::std::invalid_argument("The key must not be smaller than the last retrieved key");
+
+		this->m_buckets[this->_bucket_index(key)].PushBack(Entry{ key, value });
+
+		this->m_count++;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::Clear()
+	{
+		for (Size counter = 0; counter < BUCKET_COUNT; counter++)
+			this->m_buckets[counter].Clear();
+
+		this->m_count = 0;
+		this->m_last_key = 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size RadixHeap<InKeyType, InValueType, InAllocationPolicy>::_bucket_index(KeyType key) const
+	{
+		return BitWidth(static_cast<U64>(key ^ this->m_last_key));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::_create_buckets()
+	{
+		this->m_buckets.Reserve(BUCKET_COUNT);
+
+		for (Size counter = 0; counter < BUCKET_COUNT; counter++)
+			this->m_buckets.PushBack(BucketType(this->m_allocator));
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void RadixHeap<InKeyType, InValueType, InAllocationPolicy>::_refill()
+	{
+		if (!this->m_buckets[0].IsEmpty())
+			return;
+
+		Size bucket = 1;
+
+		while (this->m_buckets[bucket].IsEmpty())
+			bucket++;
+
+		BucketType& source = this->m_buckets[bucket];
+
+		KeyType minimum_key = source[0].key;
+
+		for (Size counter = 1; counter < source.GetCount(); counter++)
+			if (source[counter].key < minimum_key)
+				minimum_key = source[counter].key;
+
+		this->m_last_key = minimum_key;
+
+		// Every entry shares the bits above the source bucket with the new last key, so each
+		// one lands in a strictly lower bucket.
+		for (Size counter = 0; counter < source.GetCount(); counter++)
+			this->m_buckets[this->_bucket_index(source[counter].key)].PushBack(::std::move(source[counter]));
+
+		source.Clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "Collections/Replicated.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::Replicated(ConstSourceTypeLRef source)
+		: m_replica_count(0)
+	{
+		this->Update(source);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::~Replicated()
+	{
+		this->_release();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::GetReplicaCount() const
+	{
+		return this->m_replica_count;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::ConstReplicaTypeLRef Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::GetLocal() const
+	{
+		Size node = NumaAllocationPolicy::GetCurrentNode();
+
+		return *this->m_replicas[node < this->m_replica_count ? node : 0];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::ConstReplicaTypeLRef Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::GetReplica(Size node) const
+	{
+		if (node >= this->m_replica_count)
+			throw ::std::out_of_range("The node has no replica");
+
+		return *this->m_replicas[node];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::Update(ConstSourceTypeLRef source)
+	{
+		Size replica_count = NumaAllocationPolicy::GetNodeCount();
+
+		ReplicaAllocatorType* allocators[NumaAllocationPolicy::MAXIMUM_NODE_COUNT];
+		ReplicaType* replicas[NumaAllocationPolicy::MAXIMUM_NODE_COUNT];
+
+		Size built_count = 0;
+
+		// The new replicas are built aside and only replace the current ones once every copy succeeded.
+		try
+		{
+			for (; built_count < replica_count; built_count++)
+			{
+				allocators[built_count] = nullptr;
+				replicas[built_count] = nullptr;
+
+				// The replica is bound to its node, so the copy lands there whichever thread writes it.
+				allocators[built_count] = new ReplicaAllocatorType(NumaAllocationPolicy::PLACEMENT_BIND, U64(1) << built_count);
+				replicas[built_count] = source.GetCount() > 0
+					? new ReplicaType(source.GetRawData(), source.GetCount(), allocators[built_count])
+					: new ReplicaType(allocators[built_count]);
+			}
+		}
+		catch (...)
+		{
+			// The node that threw may already own an allocator, so it is released with the finished ones.
+			for (Size node = 0; node <= built_count; node++)
+			{
+				delete replicas[node];
+				delete allocators[node];
+			}
+
+			throw;
+		}
+
+		this->_release();
+
+		for (Size node = 0; node < replica_count; node++)
+		{
+			this->m_allocators[node] = allocators[node];
+			this->m_replicas[node] = replicas[node];
+		}
+
+		this->m_replica_count = replica_count;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>::_release()
+	{
+		for (Size node = 0; node < this->m_replica_count; node++)
+		{
+			delete this->m_replicas[node];
+			delete this->m_allocators[node];
+		}
+
+		this->m_replica_count = 0;
+	}
+}
\ No newline at end of file
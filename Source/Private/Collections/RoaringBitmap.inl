@@ -0,0 +1,1325 @@
+#include "Collections/RoaringBitmap.hpp"
+
+namespace Forge
+{
+	template<typename InAllocationPolicy>
+	RoaringBitmap<InAllocationPolicy>::RoaringBitmap(AllocatorTypePtr allocator)
+		: m_cardinality(0), m_allocator(allocator), m_keys(allocator), m_containers(allocator) {}
+	template<typename InAllocationPolicy>
+	RoaringBitmap<InAllocationPolicy>::RoaringBitmap(std::initializer_list<U32> init_list, AllocatorTypePtr allocator)
+		: m_cardinality(0), m_allocator(allocator), m_keys(allocator), m_containers(allocator)
+	{
+		this->AddAll(init_list.begin(), init_list.size());
+	}
+	template<typename InAllocationPolicy>
+	RoaringBitmap<InAllocationPolicy>::RoaringBitmap(const RoaringBitmapView& view, AllocatorTypePtr allocator)
+		: m_cardinality(0), m_allocator(allocator), m_keys(allocator), m_containers(allocator)
+	{
+		this->m_keys.Reserve(view.GetContainerCount());
+		this->m_containers.Reserve(view.GetContainerCount());
+
+		for (Size counter = 0; counter < view.GetContainerCount(); counter++)
+		{
+			RoaringBitmapView::Descriptor descriptor = view.GetDescriptor(counter);
+
+			Container container = this->_make_container(descriptor.type);
+
+			switch (descriptor.type)
+			{
+			case ARRAY_CONTAINER:
+				container.values.Reserve(descriptor.element_count);
+
+				for (Size index = 0; index < descriptor.element_count; index++)
+					container.values.PushBack(RoaringBitmapView::LoadU16(descriptor.payload + index * 2));
+
+				container.cardinality = static_cast<U32>(descriptor.element_count);
+				break;
+
+			case BITMAP_CONTAINER:
+				container.words.Reserve(BITMAP_WORD_COUNT);
+
+				for (Size index = 0; index < BITMAP_WORD_COUNT; index++)
+					container.words.PushBack(RoaringBitmapView::LoadU64(descriptor.payload + index * 8));
+
+				container.cardinality = static_cast<U32>(PopCount(container.words.GetRawData(), BITMAP_WORD_COUNT));
+
+				if (container.cardinality <= ARRAY_MAXIMUM_COUNT)
+					_to_array(container);
+				break;
+
+			default:
+				container.values.Reserve(descriptor.element_count * 2);
+
+				for (Size index = 0; index < descriptor.element_count * 2; index += 2)
+				{
+					container.values.PushBack(RoaringBitmapView::LoadU16(descriptor.payload + index * 2));
+					container.values.PushBack(RoaringBitmapView::LoadU16(descriptor.payload + index * 2 + 2));
+
+					container.cardinality += container.values[index + 1] + 1U;
+				}
+				break;
+			}
+
+			// The cardinality is recomputed from the payload rather than trusted, and empty
+			// containers written by other producers are dropped.
+			if (container.cardinality == 0)
+				continue;
+
+			this->m_cardinality += container.cardinality;
+
+			this->m_keys.PushBack(descriptor.key);
+			this->m_containers.PushBack(::std::move(container));
+		}
+	}
+
+	template<typename InAllocationPolicy>
+	RoaringBitmap<InAllocationPolicy>::RoaringBitmap(SelfTypeRRef other)
+		: m_cardinality(other.m_cardinality), m_allocator(other.m_allocator), m_keys(::std::move(other.m_keys)), m_containers(::std::move(other.m_containers))
+	{
+		other.m_cardinality = 0;
+	}
+	template<typename InAllocationPolicy>
+	RoaringBitmap<InAllocationPolicy>::RoaringBitmap(ConstSelfTypeLRef other)
+		: m_cardinality(other.m_cardinality), m_allocator(other.m_allocator), m_keys(other.m_keys), m_containers(other.m_containers) {}
+
+	template<typename InAllocationPolicy>
+	typename RoaringBitmap<InAllocationPolicy>::SelfTypeLRef RoaringBitmap<InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = ::std::move(other.m_keys);
+			this->m_containers = ::std::move(other.m_containers);
+
+			this->m_cardinality = other.m_cardinality;
+			this->m_allocator = other.m_allocator;
+
+			other.m_cardinality = 0;
+		}
+
+		return *this;
+	}
+	template<typename InAllocationPolicy>
+	typename RoaringBitmap<InAllocationPolicy>::SelfTypeLRef RoaringBitmap<InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = other.m_keys;
+			this->m_containers = other.m_containers;
+
+			this->m_cardinality = other.m_cardinality;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::operator==(ConstSelfTypeLRef other) const
+	{
+		if (this->m_cardinality != other.m_cardinality || this->m_keys.GetCount() != other.m_keys.GetCount())
+			return false;
+
+		Container first_scratch = this->_make_container(ARRAY_CONTAINER);
+		Container second_scratch = this->_make_container(ARRAY_CONTAINER);
+
+		for (Size counter = 0; counter < this->m_keys.GetCount(); counter++)
+		{
+			if (this->m_keys[counter] != other.m_keys[counter])
+				return false;
+
+			// Once runs are expanded, a container holds an array exactly when its cardinality is
+			// at most ARRAY_MAXIMUM_COUNT, so equal containers have equal representations.
+			const Container& first = this->_expanded(this->m_containers[counter], first_scratch);
+			const Container& second = this->_expanded(other.m_containers[counter], second_scratch);
+
+			if (first.cardinality != second.cardinality)
+				return false;
+
+			if (first.type == ARRAY_CONTAINER)
+			{
+				for (Size index = 0; index < first.values.GetCount(); index++)
+					if (first.values[index] != second.values[index])
+						return false;
+			}
+			else
+			{
+				for (Size index = 0; index < BITMAP_WORD_COUNT; index++)
+					if (first.words[index] != second.words[index])
+						return false;
+			}
+		}
+
+		return true;
+	}
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::operator!=(ConstSelfTypeLRef other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool RoaringBitmap<InAllocationPolicy>::IsEmpty() const
+	{
+		return this->m_cardinality == 0;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE U64 RoaringBitmap<InAllocationPolicy>::GetCardinality() const
+	{
+		return this->m_cardinality;
+	}
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size RoaringBitmap<InAllocationPolicy>::GetContainerCount() const
+	{
+		return this->m_keys.GetCount();
+	}
+
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::Contains(U32 value) const
+	{
+		U16 key = static_cast<U16>(value >> 16);
+
+		Size index = this->_lower_bound_key(key);
+
+		if (index == this->m_keys.GetCount() || this->m_keys[index] != key)
+			return false;
+
+		return _container_contains(this->m_containers[index], static_cast<U16>(value));
+	}
+	template<typename InAllocationPolicy>
+	U32 RoaringBitmap<InAllocationPolicy>::GetMinimum() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The roaring bitmap is empty");
+
+		const Container& container = this->m_containers.GetFront();
+
+		U32 high = static_cast<U32>(this->m_keys.GetFront()) << 16;
+
+		if (container.type == BITMAP_CONTAINER)
+			return high | static_cast<U32>(FindNextSet(container.words.GetRawData(), BITMAP_WORD_COUNT, 0));
+
+		return high | container.values[0];
+	}
+	template<typename InAllocationPolicy>
+	U32 RoaringBitmap<InAllocationPolicy>::GetMaximum() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The roaring bitmap is empty");
+
+		const Container& container = this->m_containers.GetBack();
+
+		U32 high = static_cast<U32>(this->m_keys.GetBack()) << 16;
+
+		switch (container.type)
+		{
+		case ARRAY_CONTAINER:
+			return high | container.values.GetBack();
+
+		case BITMAP_CONTAINER:
+		{
+			Size index = BITMAP_WORD_COUNT - 1;
+
+			while (container.words[index] == 0)
+				index--;
+
+			return high | static_cast<U32>((index << 6) + 63 - CountLeadingZeros(container.words[index]));
+		}
+
+		default:
+			return high | (static_cast<U32>(container.values[container.values.GetCount() - 2]) + container.values.GetBack());
+		}
+	}
+
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::Add(U32 value)
+	{
+		if (!_container_add(this->_container_for(static_cast<U16>(value >> 16)), static_cast<U16>(value)))
+			return false;
+
+		this->m_cardinality++;
+
+		return true;
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::AddAll(const U32* values, Size count)
+	{
+		Container* container = nullptr;
+		U32 current_key = 0;
+
+		for (Size counter = 0; counter < count; counter++)
+		{
+			U32 key = values[counter] >> 16;
+
+			if (!container || key != current_key)
+			{
+				container = &this->_container_for(static_cast<U16>(key));
+				current_key = key;
+			}
+
+			if (_container_add(*container, static_cast<U16>(values[counter])))
+				this->m_cardinality++;
+		}
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::AddRange(U32 first, U32 last)
+	{
+		if (first > last)
+			throw ::std::invalid_argument("The first value of the range must not be greater than the last");
+
+		for (U32 key = first >> 16; key <= (last >> 16); key++)
+		{
+			Size range_first = key == (first >> 16) ? (first & 0xFFFF) : 0;
+			Size range_last = key == (last >> 16) ? (last & 0xFFFF) : 0xFFFF;
+
+			Container& container = this->_container_for(static_cast<U16>(key));
+
+			this->m_cardinality -= container.cardinality;
+
+			if (container.type == RUN_CONTAINER)
+				_expand_runs(container);
+
+			if (container.type == ARRAY_CONTAINER)
+				_to_bitmap(container);
+
+			_set_bit_range(&container.words[0], range_first, range_last);
+
+			container.cardinality = static_cast<U32>(PopCount(container.words.GetRawData(), BITMAP_WORD_COUNT));
+
+			if (container.cardinality <= ARRAY_MAXIMUM_COUNT)
+				_to_array(container);
+
+			this->m_cardinality += container.cardinality;
+		}
+	}
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::Remove(U32 value)
+	{
+		U16 key = static_cast<U16>(value >> 16);
+
+		Size index = this->_lower_bound_key(key);
+
+		if (index == this->m_keys.GetCount() || this->m_keys[index] != key)
+			return false;
+
+		Container& container = this->m_containers[index];
+
+		if (!_container_remove(container, static_cast<U16>(value)))
+			return false;
+
+		if (container.cardinality == 0)
+			this->_remove_container(index);
+
+		this->m_cardinality--;
+
+		return true;
+	}
+
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::And(ConstSelfTypeLRef other)
+	{
+		DynamicArrayWithPolicy<U16, InAllocationPolicy> keys(this->m_allocator);
+		DynamicArrayWithPolicy<Container, InAllocationPolicy> containers(this->m_allocator);
+
+		this->m_cardinality = 0;
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < this->m_keys.GetCount() && second < other.m_keys.GetCount())
+		{
+			if (this->m_keys[first] < other.m_keys[second])
+			{
+				first++;
+			}
+			else if (other.m_keys[second] < this->m_keys[first])
+			{
+				second++;
+			}
+			else
+			{
+				Container& container = this->m_containers[first];
+
+				this->_and_containers(container, other.m_containers[second]);
+
+				if (container.cardinality != 0)
+				{
+					this->m_cardinality += container.cardinality;
+
+					keys.PushBack(this->m_keys[first]);
+					containers.PushBack(::std::move(container));
+				}
+
+				first++;
+				second++;
+			}
+		}
+
+		this->m_keys = ::std::move(keys);
+		this->m_containers = ::std::move(containers);
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::Or(ConstSelfTypeLRef other)
+	{
+		if (this == &other)
+			return;
+
+		DynamicArrayWithPolicy<U16, InAllocationPolicy> keys(this->m_allocator);
+		DynamicArrayWithPolicy<Container, InAllocationPolicy> containers(this->m_allocator);
+
+		keys.Reserve(this->m_keys.GetCount() + other.m_keys.GetCount());
+		containers.Reserve(this->m_keys.GetCount() + other.m_keys.GetCount());
+
+		this->m_cardinality = 0;
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < this->m_keys.GetCount() || second < other.m_keys.GetCount())
+		{
+			if (second == other.m_keys.GetCount() || (first < this->m_keys.GetCount() && this->m_keys[first] < other.m_keys[second]))
+			{
+				keys.PushBack(this->m_keys[first]);
+				containers.PushBack(::std::move(this->m_containers[first]));
+
+				first++;
+			}
+			else if (first == this->m_keys.GetCount() || other.m_keys[second] < this->m_keys[first])
+			{
+				keys.PushBack(other.m_keys[second]);
+				containers.PushBack(other.m_containers[second]);
+
+				second++;
+			}
+			else
+			{
+				this->_or_containers(this->m_containers[first], other.m_containers[second]);
+
+				keys.PushBack(this->m_keys[first]);
+				containers.PushBack(::std::move(this->m_containers[first]));
+
+				first++;
+				second++;
+			}
+
+			this->m_cardinality += containers.GetBack().cardinality;
+		}
+
+		this->m_keys = ::std::move(keys);
+		this->m_containers = ::std::move(containers);
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::AndNot(ConstSelfTypeLRef other)
+	{
+		if (this == &other)
+		{
+			this->Clear();
+
+			return;
+		}
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < this->m_keys.GetCount() && second < other.m_keys.GetCount())
+		{
+			if (this->m_keys[first] < other.m_keys[second])
+			{
+				first++;
+			}
+			else if (other.m_keys[second] < this->m_keys[first])
+			{
+				second++;
+			}
+			else
+			{
+				Container& container = this->m_containers[first];
+
+				this->m_cardinality -= container.cardinality;
+
+				this->_and_not_containers(container, other.m_containers[second]);
+
+				this->m_cardinality += container.cardinality;
+
+				if (container.cardinality == 0)
+					this->_remove_container(first);
+				else
+					first++;
+
+				second++;
+			}
+		}
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::Xor(ConstSelfTypeLRef other)
+	{
+		if (this == &other)
+		{
+			this->Clear();
+
+			return;
+		}
+
+		DynamicArrayWithPolicy<U16, InAllocationPolicy> keys(this->m_allocator);
+		DynamicArrayWithPolicy<Container, InAllocationPolicy> containers(this->m_allocator);
+
+		keys.Reserve(this->m_keys.GetCount() + other.m_keys.GetCount());
+		containers.Reserve(this->m_keys.GetCount() + other.m_keys.GetCount());
+
+		this->m_cardinality = 0;
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < this->m_keys.GetCount() || second < other.m_keys.GetCount())
+		{
+			if (second == other.m_keys.GetCount() || (first < this->m_keys.GetCount() && this->m_keys[first] < other.m_keys[second]))
+			{
+				keys.PushBack(this->m_keys[first]);
+				containers.PushBack(::std::move(this->m_containers[first]));
+
+				first++;
+			}
+			else if (first == this->m_keys.GetCount() || other.m_keys[second] < this->m_keys[first])
+			{
+				keys.PushBack(other.m_keys[second]);
+				containers.PushBack(other.m_containers[second]);
+
+				second++;
+			}
+			else
+			{
+				this->_xor_containers(this->m_containers[first], other.m_containers[second]);
+
+				// Equal containers cancel out entirely.
+				if (this->m_containers[first].cardinality == 0)
+				{
+					first++;
+					second++;
+
+					continue;
+				}
+
+				keys.PushBack(this->m_keys[first]);
+				containers.PushBack(::std::move(this->m_containers[first]));
+
+				first++;
+				second++;
+			}
+
+			this->m_cardinality += containers.GetBack().cardinality;
+		}
+
+		this->m_keys = ::std::move(keys);
+		this->m_containers = ::std::move(containers);
+	}
+	template<typename InAllocationPolicy>
+	U64 RoaringBitmap<InAllocationPolicy>::AndCardinality(ConstSelfTypeLRef other) const
+	{
+		U64 cardinality = 0;
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < this->m_keys.GetCount() && second < other.m_keys.GetCount())
+		{
+			if (this->m_keys[first] < other.m_keys[second])
+			{
+				first++;
+			}
+			else if (other.m_keys[second] < this->m_keys[first])
+			{
+				second++;
+			}
+			else
+			{
+				cardinality += this->_and_cardinality(this->m_containers[first], other.m_containers[second]);
+
+				first++;
+				second++;
+			}
+		}
+
+		return cardinality;
+	}
+
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::RunOptimize()
+	{
+		Bool converted = false;
+
+		for (Size counter = 0; counter < this->m_containers.GetCount(); counter++)
+			if (this->m_containers[counter].type != RUN_CONTAINER && _to_runs(this->m_containers[counter]))
+				converted = true;
+
+		return converted;
+	}
+
+	template<typename InAllocationPolicy>
+	template<typename InCallable>
+	Void RoaringBitmap<InAllocationPolicy>::ForEach(InCallable callable) const
+	{
+		for (Size counter = 0; counter < this->m_keys.GetCount(); counter++)
+			_for_each(this->m_containers[counter], static_cast<U32>(this->m_keys[counter]) << 16, callable);
+	}
+	template<typename InAllocationPolicy>
+	template<typename InValuesAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::ToArray(DynamicArrayWithPolicy<U32, InValuesAllocationPolicy>& values) const
+	{
+		values.Reserve(values.GetCount() + static_cast<Size>(this->m_cardinality));
+
+		this->ForEach([&values](U32 value) { values.PushBack(value); });
+	}
+
+	template<typename InAllocationPolicy>
+	Size RoaringBitmap<InAllocationPolicy>::GetSerializedSize() const
+	{
+		Size size = RoaringBitmapView::HEADER_SIZE + this->m_keys.GetCount() * RoaringBitmapView::DESCRIPTOR_SIZE;
+
+		for (Size counter = 0; counter < this->m_containers.GetCount(); counter++)
+		{
+			const Container& container = this->m_containers[counter];
+
+			size = (size + 7) & ~static_cast<Size>(7);
+			size += container.type == BITMAP_CONTAINER ? BITMAP_WORD_COUNT * 8 : container.values.GetCount() * 2;
+		}
+
+		return size;
+	}
+	template<typename InAllocationPolicy>
+	Size RoaringBitmap<InAllocationPolicy>::Serialize(Byte* buffer) const
+	{
+		RoaringBitmapView::StoreU32(buffer, RoaringBitmapView::MAGIC);
+		RoaringBitmapView::StoreU32(buffer + 4, static_cast<U32>(this->m_keys.GetCount()));
+
+		Size offset = RoaringBitmapView::HEADER_SIZE + this->m_keys.GetCount() * RoaringBitmapView::DESCRIPTOR_SIZE;
+
+		for (Size counter = 0; counter < this->m_containers.GetCount(); counter++)
+		{
+			const Container& container = this->m_containers[counter];
+
+			while (offset % 8 != 0)
+				buffer[offset++] = 0;
+
+			Size element_count = container.values.GetCount();
+
+			if (container.type == BITMAP_CONTAINER)
+				element_count = BITMAP_WORD_COUNT;
+			else if (container.type == RUN_CONTAINER)
+				element_count /= 2;
+
+			Byte* descriptor = buffer + RoaringBitmapView::HEADER_SIZE + counter * RoaringBitmapView::DESCRIPTOR_SIZE;
+
+			RoaringBitmapView::StoreU16(descriptor, this->m_keys[counter]);
+			descriptor[2] = container.type;
+			descriptor[3] = 0;
+			RoaringBitmapView::StoreU32(descriptor + 4, container.cardinality);
+			RoaringBitmapView::StoreU32(descriptor + 8, static_cast<U32>(element_count));
+			RoaringBitmapView::StoreU32(descriptor + 12, static_cast<U32>(offset));
+
+			if (container.type == BITMAP_CONTAINER)
+			{
+				for (Size index = 0; index < BITMAP_WORD_COUNT; index++, offset += 8)
+					RoaringBitmapView::StoreU64(buffer + offset, container.words[index]);
+			}
+			else
+			{
+				for (Size index = 0; index < container.values.GetCount(); index++, offset += 2)
+					RoaringBitmapView::StoreU16(buffer + offset, container.values[index]);
+			}
+		}
+
+		return offset;
+	}
+
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::Clear()
+	{
+		this->m_keys.Clear();
+		this->m_containers.Clear();
+
+		this->m_cardinality = 0;
+	}
+
+	template<typename InAllocationPolicy>
+	Size RoaringBitmap<InAllocationPolicy>::_lower_bound_key(U16 key) const
+	{
+		Size first = 0;
+		Size last = this->m_keys.GetCount();
+
+		while (first < last)
+		{
+			Size middle = first + (last - first) / 2;
+
+			if (this->m_keys[middle] < key)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+
+		return first;
+	}
+	template<typename InAllocationPolicy>
+	typename RoaringBitmap<InAllocationPolicy>::Container& RoaringBitmap<InAllocationPolicy>::_container_for(U16 key)
+	{
+		Size index = this->_lower_bound_key(key);
+
+		if (index < this->m_keys.GetCount() && this->m_keys[index] == key)
+			return this->m_containers[index];
+
+		if (index == this->m_keys.GetCount())
+		{
+			this->m_keys.PushBack(key);
+			this->m_containers.PushBack(this->_make_container(ARRAY_CONTAINER));
+		}
+		else
+		{
+			this->m_keys.Insert(index, key);
+			this->m_containers.Insert(index, this->_make_container(ARRAY_CONTAINER));
+		}
+
+		return this->m_containers[index];
+	}
+
+	template<typename InAllocationPolicy>
+	typename RoaringBitmap<InAllocationPolicy>::Container RoaringBitmap<InAllocationPolicy>::_make_container(U8 type) const
+	{
+		return Container{
+			type,
+			0,
+			DynamicArrayWithPolicy<U16, InAllocationPolicy>(this->m_allocator),
+			DynamicArrayWithPolicy<U64, InAllocationPolicy>(this->m_allocator)
+		};
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_remove_container(Size index)
+	{
+		this->m_keys.Remove(index);
+		this->m_containers.Remove(index);
+	}
+
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::_container_contains(const Container& container, U16 low)
+	{
+		if (container.type == BITMAP_CONTAINER)
+			return (container.words[low >> 6] >> (low & 63)) & 1;
+
+		const U16* values = container.values.GetRawData();
+
+		if (container.type == ARRAY_CONTAINER)
+		{
+			Size index = _lower_bound_value(values, container.values.GetCount(), low);
+
+			return index < container.values.GetCount() && values[index] == low;
+		}
+
+		// Finds the last run that starts at or before the value.
+		Size first = 0;
+		Size last = container.values.GetCount() / 2;
+
+		while (first < last)
+		{
+			Size middle = first + (last - first) / 2;
+
+			if (values[middle * 2] <= low)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+
+		return first != 0 && static_cast<Size>(low) <= static_cast<Size>(values[first * 2 - 2]) + values[first * 2 - 1];
+	}
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::_container_add(Container& container, U16 low)
+	{
+		if (container.type == RUN_CONTAINER)
+			_expand_runs(container);
+
+		if (container.type == ARRAY_CONTAINER)
+		{
+			Size index = _lower_bound_value(container.values.GetRawData(), container.values.GetCount(), low);
+
+			if (index < container.values.GetCount() && container.values[index] == low)
+				return false;
+
+			if (container.cardinality < ARRAY_MAXIMUM_COUNT)
+			{
+				if (index == container.values.GetCount())
+					container.values.PushBack(low);
+				else
+					container.values.Insert(index, low);
+
+				container.cardinality++;
+
+				return true;
+			}
+
+			_to_bitmap(container);
+		}
+
+		U64& word = container.words[low >> 6];
+		U64 bit = static_cast<U64>(1) << (low & 63);
+
+		if (word & bit)
+			return false;
+
+		word |= bit;
+		container.cardinality++;
+
+		return true;
+	}
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::_container_remove(Container& container, U16 low)
+	{
+		if (container.type == RUN_CONTAINER)
+		{
+			if (!_container_contains(container, low))
+				return false;
+
+			_expand_runs(container);
+		}
+
+		if (container.type == ARRAY_CONTAINER)
+		{
+			Size index = _lower_bound_value(container.values.GetRawData(), container.values.GetCount(), low);
+
+			if (index == container.values.GetCount() || container.values[index] != low)
+				return false;
+
+			container.values.Remove(index);
+			container.cardinality--;
+
+			return true;
+		}
+
+		U64& word = container.words[low >> 6];
+		U64 bit = static_cast<U64>(1) << (low & 63);
+
+		if (!(word & bit))
+			return false;
+
+		word &= ~bit;
+		container.cardinality--;
+
+		if (container.cardinality <= ARRAY_MAXIMUM_COUNT)
+			_to_array(container);
+
+		return true;
+	}
+
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_to_bitmap(Container& container)
+	{
+		container.words.Reserve(BITMAP_WORD_COUNT);
+
+		for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+			container.words.PushBack(0);
+
+		U64* words = &container.words[0];
+
+		for (Size counter = 0; counter < container.values.GetCount(); counter++)
+			words[container.values[counter] >> 6] |= static_cast<U64>(1) << (container.values[counter] & 63);
+
+		container.values.Clear();
+		container.values.Compact();
+
+		container.type = BITMAP_CONTAINER;
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_to_array(Container& container)
+	{
+		container.values.Reserve(container.cardinality);
+
+		for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+		{
+			for (U64 word = container.words[counter]; word != 0; word &= word - 1)
+				container.values.PushBack(static_cast<U16>((counter << 6) + CountTrailingZeros(word)));
+		}
+
+		container.words.Clear();
+		container.words.Compact();
+
+		container.type = ARRAY_CONTAINER;
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_expand_runs(Container& container)
+	{
+		DynamicArrayWithPolicy<U16, InAllocationPolicy> runs(container.values);
+
+		container.values.Clear();
+
+		if (container.cardinality > ARRAY_MAXIMUM_COUNT)
+		{
+			container.words.Reserve(BITMAP_WORD_COUNT);
+
+			for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+				container.words.PushBack(0);
+
+			for (Size counter = 0; counter < runs.GetCount(); counter += 2)
+				_set_bit_range(&container.words[0], runs[counter], static_cast<Size>(runs[counter]) + runs[counter + 1]);
+
+			container.values.Compact();
+
+			container.type = BITMAP_CONTAINER;
+		}
+		else
+		{
+			container.values.Reserve(container.cardinality);
+
+			for (Size counter = 0; counter < runs.GetCount(); counter += 2)
+			{
+				Size last = static_cast<Size>(runs[counter]) + runs[counter + 1];
+
+				for (Size value = runs[counter]; value <= last; value++)
+					container.values.PushBack(static_cast<U16>(value));
+			}
+
+			container.type = ARRAY_CONTAINER;
+		}
+	}
+	template<typename InAllocationPolicy>
+	Bool RoaringBitmap<InAllocationPolicy>::_to_runs(Container& container)
+	{
+		Size run_count = 0;
+
+		if (container.type == ARRAY_CONTAINER)
+		{
+			for (Size counter = 0; counter < container.values.GetCount(); counter++)
+				if (counter == 0 || container.values[counter] != container.values[counter - 1] + 1)
+					run_count++;
+		}
+		else
+		{
+			U64 carry = 0;
+
+			// A run starts at every set bit whose lower neighbour is clear.
+			for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+			{
+				U64 word = container.words[counter];
+
+				run_count += PopCount(word & ~((word << 1) | carry));
+				carry = word >> 63;
+			}
+		}
+
+		Size current_size = container.type == ARRAY_CONTAINER ? container.values.GetCount() * 2 : BITMAP_WORD_COUNT * 8;
+
+		if (run_count * 4 >= current_size)
+			return false;
+
+		Container source(container);
+
+		container.values.Clear();
+		container.words.Clear();
+
+		container.values.Reserve(run_count * 2);
+		container.words.Compact();
+
+		Bool started = false;
+		U32 previous = 0;
+
+		auto append = [&container, &started, &previous](U32 value)
+		{
+			if (started && value == previous + 1)
+			{
+				container.values.GetBack()++;
+			}
+			else
+			{
+				container.values.PushBack(static_cast<U16>(value));
+				container.values.PushBack(0);
+			}
+
+			started = true;
+			previous = value;
+		};
+
+		_for_each(source, 0, append);
+
+		container.type = RUN_CONTAINER;
+
+		return true;
+	}
+
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_and_containers(Container& target, const Container& source) const
+	{
+		Container scratch = this->_make_container(ARRAY_CONTAINER);
+
+		const Container& other = this->_expanded(source, scratch);
+
+		if (target.type == RUN_CONTAINER)
+			_expand_runs(target);
+
+		if (target.type == ARRAY_CONTAINER)
+		{
+			Size count = 0;
+
+			if (other.type == ARRAY_CONTAINER)
+				count = _intersect_values(&target.values[0], target.values.GetCount(), other.values.GetRawData(), other.values.GetCount());
+			else
+			{
+				for (Size counter = 0; counter < target.values.GetCount(); counter++)
+				{
+					U16 value = target.values[counter];
+
+					if ((other.words[value >> 6] >> (value & 63)) & 1)
+						target.values[count++] = value;
+				}
+			}
+
+			while (target.values.GetCount() > count)
+				target.values.PopBack();
+
+			target.cardinality = static_cast<U32>(count);
+		}
+		else if (other.type == ARRAY_CONTAINER)
+		{
+			for (Size counter = 0; counter < other.values.GetCount(); counter++)
+			{
+				U16 value = other.values[counter];
+
+				if ((target.words[value >> 6] >> (value & 63)) & 1)
+					target.values.PushBack(value);
+			}
+
+			target.words.Clear();
+			target.words.Compact();
+
+			target.cardinality = static_cast<U32>(target.values.GetCount());
+			target.type = ARRAY_CONTAINER;
+		}
+		else
+		{
+			BitwiseAnd(&target.words[0], other.words.GetRawData(), BITMAP_WORD_COUNT);
+
+			target.cardinality = static_cast<U32>(PopCount(target.words.GetRawData(), BITMAP_WORD_COUNT));
+
+			if (target.cardinality <= ARRAY_MAXIMUM_COUNT)
+				_to_array(target);
+		}
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_or_containers(Container& target, const Container& source) const
+	{
+		Container scratch = this->_make_container(ARRAY_CONTAINER);
+
+		const Container& other = this->_expanded(source, scratch);
+
+		if (target.type == RUN_CONTAINER)
+			_expand_runs(target);
+
+		if (target.type == ARRAY_CONTAINER && other.type == ARRAY_CONTAINER && target.cardinality + other.cardinality <= ARRAY_MAXIMUM_COUNT)
+		{
+			DynamicArrayWithPolicy<U16, InAllocationPolicy> values(target.values);
+
+			target.values.Clear();
+			target.values.Reserve(values.GetCount() + other.values.GetCount());
+
+			Size first = 0;
+			Size second = 0;
+
+			while (first < values.GetCount() || second < other.values.GetCount())
+			{
+				if (second == other.values.GetCount() || (first < values.GetCount() && values[first] < other.values[second]))
+					target.values.PushBack(values[first++]);
+				else if (first == values.GetCount() || other.values[second] < values[first])
+					target.values.PushBack(other.values[second++]);
+				else
+				{
+					target.values.PushBack(values[first++]);
+					second++;
+				}
+			}
+
+			target.cardinality = static_cast<U32>(target.values.GetCount());
+
+			return;
+		}
+
+		if (target.type == ARRAY_CONTAINER)
+			_to_bitmap(target);
+
+		if (other.type == ARRAY_CONTAINER)
+		{
+			U64* words = &target.words[0];
+
+			for (Size counter = 0; counter < other.values.GetCount(); counter++)
+				words[other.values[counter] >> 6] |= static_cast<U64>(1) << (other.values[counter] & 63);
+		}
+		else
+		{
+			BitwiseOr(&target.words[0], other.words.GetRawData(), BITMAP_WORD_COUNT);
+		}
+
+		target.cardinality = static_cast<U32>(PopCount(target.words.GetRawData(), BITMAP_WORD_COUNT));
+
+		if (target.cardinality <= ARRAY_MAXIMUM_COUNT)
+			_to_array(target);
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_and_not_containers(Container& target, const Container& source) const
+	{
+		Container scratch = this->_make_container(ARRAY_CONTAINER);
+
+		const Container& other = this->_expanded(source, scratch);
+
+		if (target.type == RUN_CONTAINER)
+			_expand_runs(target);
+
+		if (target.type == ARRAY_CONTAINER)
+		{
+			Size count = 0;
+			Size second = 0;
+
+			for (Size counter = 0; counter < target.values.GetCount(); counter++)
+			{
+				U16 value = target.values[counter];
+
+				Bool excluded;
+
+				if (other.type == ARRAY_CONTAINER)
+				{
+					while (second < other.values.GetCount() && other.values[second] < value)
+						second++;
+
+					excluded = second < other.values.GetCount() && other.values[second] == value;
+				}
+				else
+				{
+					excluded = (other.words[value >> 6] >> (value & 63)) & 1;
+				}
+
+				if (!excluded)
+					target.values[count++] = value;
+			}
+
+			while (target.values.GetCount() > count)
+				target.values.PopBack();
+
+			target.cardinality = static_cast<U32>(count);
+
+			return;
+		}
+
+		if (other.type == ARRAY_CONTAINER)
+		{
+			U64* words = &target.words[0];
+
+			for (Size counter = 0; counter < other.values.GetCount(); counter++)
+				words[other.values[counter] >> 6] &= ~(static_cast<U64>(1) << (other.values[counter] & 63));
+		}
+		else
+		{
+			BitwiseAndNot(&target.words[0], other.words.GetRawData(), BITMAP_WORD_COUNT);
+		}
+
+		target.cardinality = static_cast<U32>(PopCount(target.words.GetRawData(), BITMAP_WORD_COUNT));
+
+		if (target.cardinality <= ARRAY_MAXIMUM_COUNT)
+			_to_array(target);
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_xor_containers(Container& target, const Container& source) const
+	{
+		Container scratch = this->_make_container(ARRAY_CONTAINER);
+
+		const Container& other = this->_expanded(source, scratch);
+
+		if (target.type == RUN_CONTAINER)
+			_expand_runs(target);
+
+		if (target.type == ARRAY_CONTAINER && other.type == ARRAY_CONTAINER)
+		{
+			DynamicArrayWithPolicy<U16, InAllocationPolicy> values(target.values);
+
+			target.values.Clear();
+			target.values.Reserve(values.GetCount() + other.values.GetCount());
+
+			Size first = 0;
+			Size second = 0;
+
+			while (first < values.GetCount() || second < other.values.GetCount())
+			{
+				if (second == other.values.GetCount() || (first < values.GetCount() && values[first] < other.values[second]))
+					target.values.PushBack(values[first++]);
+				else if (first == values.GetCount() || other.values[second] < values[first])
+					target.values.PushBack(other.values[second++]);
+				else
+				{
+					first++;
+					second++;
+				}
+			}
+
+			target.cardinality = static_cast<U32>(target.values.GetCount());
+
+			if (target.cardinality > ARRAY_MAXIMUM_COUNT)
+				_to_bitmap(target);
+
+			return;
+		}
+
+		if (target.type == ARRAY_CONTAINER)
+			_to_bitmap(target);
+
+		if (other.type == ARRAY_CONTAINER)
+		{
+			U64* words = &target.words[0];
+
+			for (Size counter = 0; counter < other.values.GetCount(); counter++)
+				words[other.values[counter] >> 6] ^= static_cast<U64>(1) << (other.values[counter] & 63);
+		}
+		else
+		{
+			BitwiseXor(&target.words[0], other.words.GetRawData(), BITMAP_WORD_COUNT);
+		}
+
+		target.cardinality = static_cast<U32>(PopCount(target.words.GetRawData(), BITMAP_WORD_COUNT));
+
+		if (target.cardinality <= ARRAY_MAXIMUM_COUNT)
+			_to_array(target);
+	}
+	template<typename InAllocationPolicy>
+	U64 RoaringBitmap<InAllocationPolicy>::_and_cardinality(const Container& first, const Container& second) const
+	{
+		Container first_scratch = this->_make_container(ARRAY_CONTAINER);
+		Container second_scratch = this->_make_container(ARRAY_CONTAINER);
+
+		const Container& left = this->_expanded(first, first_scratch);
+		const Container& right = this->_expanded(second, second_scratch);
+
+		if (left.type == BITMAP_CONTAINER && right.type == BITMAP_CONTAINER)
+		{
+			U64 cardinality = 0;
+
+			for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+				cardinality += PopCount(left.words[counter] & right.words[counter]);
+
+			return cardinality;
+		}
+
+		if (left.type == ARRAY_CONTAINER && right.type == ARRAY_CONTAINER)
+		{
+			U64 cardinality = 0;
+
+			Size first_index = 0;
+			Size second_index = 0;
+
+			while (first_index < left.values.GetCount() && second_index < right.values.GetCount())
+			{
+				U16 first_value = left.values[first_index];
+				U16 second_value = right.values[second_index];
+
+				first_index += first_value <= second_value;
+				second_index += second_value <= first_value;
+				cardinality += first_value == second_value;
+			}
+
+			return cardinality;
+		}
+
+		const Container& array = left.type == ARRAY_CONTAINER ? left : right;
+		const Container& bitmap = left.type == ARRAY_CONTAINER ? right : left;
+
+		U64 cardinality = 0;
+
+		for (Size counter = 0; counter < array.values.GetCount(); counter++)
+			cardinality += (bitmap.words[array.values[counter] >> 6] >> (array.values[counter] & 63)) & 1;
+
+		return cardinality;
+	}
+	template<typename InAllocationPolicy>
+	const typename RoaringBitmap<InAllocationPolicy>::Container& RoaringBitmap<InAllocationPolicy>::_expanded(const Container& container, Container& scratch) const
+	{
+		if (container.type != RUN_CONTAINER)
+			return container;
+
+		scratch = container;
+
+		_expand_runs(scratch);
+
+		return scratch;
+	}
+
+	template<typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size RoaringBitmap<InAllocationPolicy>::_lower_bound_value(const U16* values, Size count, U16 value)
+	{
+		return BranchlessLowerBound(values, count, value);
+	}
+	template<typename InAllocationPolicy>
+	Size RoaringBitmap<InAllocationPolicy>::_intersect_values(U16* target, Size target_count, const U16* source, Size source_count)
+	{
+		Size count = 0;
+
+		Size first = 0;
+		Size second = 0;
+
+		while (first < target_count && second < source_count)
+		{
+			U16 first_value = target[first];
+			U16 second_value = source[second];
+
+			target[count] = first_value;
+
+			count += first_value == second_value;
+			first += first_value <= second_value;
+			second += second_value <= first_value;
+		}
+
+		return count;
+	}
+	template<typename InAllocationPolicy>
+	Void RoaringBitmap<InAllocationPolicy>::_set_bit_range(U64* words, Size first, Size last)
+	{
+		Size first_word = first >> 6;
+		Size last_word = last >> 6;
+
+		U64 first_mask = ~static_cast<U64>(0) << (first & 63);
+		U64 last_mask = ~static_cast<U64>(0) >> (63 - (last & 63));
+
+		if (first_word == last_word)
+		{
+			words[first_word] |= first_mask & last_mask;
+
+			return;
+		}
+
+		words[first_word] |= first_mask;
+
+		for (Size counter = first_word + 1; counter < last_word; counter++)
+			words[counter] = ~static_cast<U64>(0);
+
+		words[last_word] |= last_mask;
+	}
+
+	template<typename InAllocationPolicy>
+	template<typename InCallable>
+	Void RoaringBitmap<InAllocationPolicy>::_for_each(const Container& container, U32 high, InCallable& callable)
+	{
+		switch (container.type)
+		{
+		case ARRAY_CONTAINER:
+			for (Size counter = 0; counter < container.values.GetCount(); counter++)
+				callable(high | container.values[counter]);
+			break;
+
+		case BITMAP_CONTAINER:
+			for (Size counter = 0; counter < BITMAP_WORD_COUNT; counter++)
+			{
+				for (U64 word = container.words[counter]; word != 0; word &= word - 1)
+					callable(high | static_cast<U32>((counter << 6) + CountTrailingZeros(word)));
+			}
+			break;
+
+		default:
+			for (Size counter = 0; counter < container.values.GetCount(); counter += 2)
+			{
+				U32 last = static_cast<U32>(container.values[counter]) + container.values[counter + 1];
+
+				for (U32 value = container.values[counter]; value <= last; value++)
+					callable(high | value);
+			}
+			break;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,271 @@
+#ifndef ROARING_BITMAP_VIEW_INL_HPP
+#define ROARING_BITMAP_VIEW_INL_HPP
+
+#include "Collections/RoaringBitmapView.hpp"
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE RoaringBitmapView::RoaringBitmapView(const Byte* data, Size size)
+		: m_data(data), m_size(size), m_container_count(0)
+	{
+		if (!data || size < HEADER_SIZE || LoadU32(data) != MAGIC)
+			throw ::std::invalid_argument("The buffer does not hold a serialized roaring bitmap");
+
+		Size container_count = LoadU32(data + 4);
+
+		if (container_count > (size - HEADER_SIZE) / DESCRIPTOR_SIZE)
+			throw ::std::invalid_argument("The buffer is too small for its container descriptors");
+
+		m_container_count = container_count;
+
+		for (Size counter = 0; counter < container_count; counter++)
+		{
+			const Byte* descriptor = data + HEADER_SIZE + counter * DESCRIPTOR_SIZE;
+
+			U8 type = descriptor[2];
+			Size element_count = LoadU32(descriptor + 8);
+			Size offset = LoadU32(descriptor + 12);
+
+			Size payload_size;
+
+			switch (type)
+			{
+			case ARRAY_CONTAINER:
+				payload_size = element_count * 2;
+				break;
+			case BITMAP_CONTAINER:
+				payload_size = element_count * 8;
+				break;
+			case RUN_CONTAINER:
+				payload_size = element_count * 4;
+				break;
+			default:
+				throw ::std::invalid_argument("The buffer holds an unknown container type");
+			}
+
+			if ((type == ARRAY_CONTAINER && element_count > ARRAY_MAXIMUM_COUNT) || (type == BITMAP_CONTAINER && element_count != BITMAP_WORD_COUNT))
+				throw ::std::invalid_argument("The buffer holds a malformed container");
+
+			if (offset % 8 != 0 || offset > size || payload_size > size - offset)
+				throw ::std::invalid_argument("The buffer is too small for its container payloads");
+
+			if (counter > 0 && LoadU16(descriptor) <= LoadU16(descriptor - DESCRIPTOR_SIZE))
+				throw ::std::invalid_argument("The buffer holds unsorted container keys");
+
+			// Queries and GetCardinality trust the payload and the descriptor, so the payload must be
+			// ordered and agree with the cardinality the descriptor states.
+			const Byte* payload = data + offset;
+			Size cardinality = 0;
+
+			switch (type)
+			{
+			case ARRAY_CONTAINER:
+				for (Size index = 1; index < element_count; index++)
+					if (LoadU16(payload + index * 2) <= LoadU16(payload + (index - 1) * 2))
+						throw ::std::invalid_argument("The buffer holds unsorted container values");
+
+				cardinality = element_count;
+				break;
+
+			case BITMAP_CONTAINER:
+				for (Size index = 0; index < BITMAP_WORD_COUNT; index++)
+					cardinality += PopCount(LoadU64(payload + index * 8));
+				break;
+
+			default:
+				for (Size index = 0; index < element_count; index++)
+				{
+					Size start = LoadU16(payload + index * 4);
+					Size end = start + LoadU16(payload + index * 4 + 2);
+
+					// Runs must not reach past the 16-bit range of their container.
+					if (end > 0xFFFF)
+						throw ::std::invalid_argument("The buffer holds a malformed container");
+
+					if (index > 0 && start <= static_cast<Size>(LoadU16(payload + (index - 1) * 4)) + LoadU16(payload + (index - 1) * 4 + 2))
+						throw ::std::invalid_argument("The buffer holds unsorted or overlapping runs");
+
+					cardinality += end - start + 1;
+				}
+				break;
+			}
+
+			if (cardinality != LoadU32(descriptor + 4))
+				throw ::std::invalid_argument("The buffer holds a container whose cardinality does not match its payload");
+		}
+	}
+
+	FORGE_FORCE_INLINE Size RoaringBitmapView::GetContainerCount() const
+	{
+		return this->m_container_count;
+	}
+	FORGE_FORCE_INLINE RoaringBitmapView::Descriptor RoaringBitmapView::GetDescriptor(Size index) const
+	{
+		const Byte* descriptor = this->m_data + HEADER_SIZE + index * DESCRIPTOR_SIZE;
+
+		return Descriptor{
+			LoadU16(descriptor),
+			descriptor[2],
+			LoadU32(descriptor + 4),
+			LoadU32(descriptor + 8),
+			this->m_data + LoadU32(descriptor + 12)
+		};
+	}
+
+	FORGE_FORCE_INLINE U64 RoaringBitmapView::GetCardinality() const
+	{
+		U64 cardinality = 0;
+
+		for (Size counter = 0; counter < this->m_container_count; counter++)
+			cardinality += LoadU32(this->m_data + HEADER_SIZE + counter * DESCRIPTOR_SIZE + 4);
+
+		return cardinality;
+	}
+	FORGE_FORCE_INLINE Bool RoaringBitmapView::Contains(U32 value) const
+	{
+		U16 key = static_cast<U16>(value >> 16);
+		U16 low = static_cast<U16>(value);
+
+		Size first = 0;
+		Size last = this->m_container_count;
+
+		while (first < last)
+		{
+			Size middle = first + (last - first) / 2;
+
+			if (LoadU16(this->m_data + HEADER_SIZE + middle * DESCRIPTOR_SIZE) < key)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+
+		if (first == this->m_container_count)
+			return false;
+
+		Descriptor descriptor = this->GetDescriptor(first);
+
+		if (descriptor.key != key)
+			return false;
+
+		switch (descriptor.type)
+		{
+		case BITMAP_CONTAINER:
+			return (LoadU64(descriptor.payload + (low >> 6) * 8) >> (low & 63)) & 1;
+
+		case ARRAY_CONTAINER:
+		{
+			Size lower = 0;
+			Size upper = descriptor.element_count;
+
+			while (lower < upper)
+			{
+				Size middle = lower + (upper - lower) / 2;
+				U16 current = LoadU16(descriptor.payload + middle * 2);
+
+				if (current == low)
+					return true;
+
+				if (current < low)
+					lower = middle + 1;
+				else
+					upper = middle;
+			}
+
+			return false;
+		}
+
+		default:
+		{
+			Size lower = 0;
+			Size upper = descriptor.element_count;
+
+			// Finds the last run that starts at or before the value.
+			while (lower < upper)
+			{
+				Size middle = lower + (upper - lower) / 2;
+
+				if (LoadU16(descriptor.payload + middle * 4) <= low)
+					lower = middle + 1;
+				else
+					upper = middle;
+			}
+
+			if (lower == 0)
+				return false;
+
+			const Byte* run = descriptor.payload + (lower - 1) * 4;
+
+			return static_cast<Size>(low) <= static_cast<Size>(LoadU16(run)) + LoadU16(run + 2);
+		}
+		}
+	}
+
+	template<typename InCallable>
+	Void RoaringBitmapView::ForEach(InCallable callable) const
+	{
+		for (Size counter = 0; counter < this->m_container_count; counter++)
+		{
+			Descriptor descriptor = this->GetDescriptor(counter);
+
+			U32 high = static_cast<U32>(descriptor.key) << 16;
+
+			switch (descriptor.type)
+			{
+			case ARRAY_CONTAINER:
+				for (Size index = 0; index < descriptor.element_count; index++)
+					callable(high | LoadU16(descriptor.payload + index * 2));
+				break;
+
+			case BITMAP_CONTAINER:
+				for (Size index = 0; index < BITMAP_WORD_COUNT; index++)
+				{
+					for (U64 word = LoadU64(descriptor.payload + index * 8); word != 0; word &= word - 1)
+						callable(high | static_cast<U32>((index << 6) + CountTrailingZeros(word)));
+				}
+				break;
+
+			default:
+				for (Size index = 0; index < descriptor.element_count; index++)
+				{
+					U32 start = LoadU16(descriptor.payload + index * 4);
+					U32 length = LoadU16(descriptor.payload + index * 4 + 2);
+
+					for (U32 value = start; value <= start + length; value++)
+						callable(high | value);
+				}
+				break;
+			}
+		}
+	}
+
+	FORGE_FORCE_INLINE U16 RoaringBitmapView::LoadU16(const Byte* data)
+	{
+		return static_cast<U16>(data[0] | (data[1] << 8));
+	}
+	FORGE_FORCE_INLINE U32 RoaringBitmapView::LoadU32(const Byte* data)
+	{
+		return static_cast<U32>(LoadU16(data)) | (static_cast<U32>(LoadU16(data + 2)) << 16);
+	}
+	FORGE_FORCE_INLINE U64 RoaringBitmapView::LoadU64(const Byte* data)
+	{
+		return static_cast<U64>(LoadU32(data)) | (static_cast<U64>(LoadU32(data + 4)) << 32);
+	}
+
+	FORGE_FORCE_INLINE Void RoaringBitmapView::StoreU16(Byte* data, U16 value)
+	{
+		data[0] = static_cast<Byte>(value);
+		data[1] = static_cast<Byte>(value >> 8);
+	}
+	FORGE_FORCE_INLINE Void RoaringBitmapView::StoreU32(Byte* data, U32 value)
+	{
+		StoreU16(data, static_cast<U16>(value));
+		StoreU16(data + 2, static_cast<U16>(value >> 16));
+	}
+	FORGE_FORCE_INLINE Void RoaringBitmapView::StoreU64(Byte* data, U64 value)
+	{
+		StoreU32(data, static_cast<U32>(value));
+		StoreU32(data + 4, static_cast<U32>(value >> 32));
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "Collections/SegmentedArray.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	SegmentedArray<InElementType, InAllocationPolicy>::SegmentedArray(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_segment_count(0), m_published_count(0)
+	{
+		this->m_allocator = allocator;
+
+		for (Size counter = 0; counter < MAXIMUM_SEGMENT_COUNT; counter++)
+			this->m_segments[counter].store(nullptr, ::std::memory_order_relaxed);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	SegmentedArray<InElementType, InAllocationPolicy>::SegmentedArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: SegmentedArray(allocator)
+	{
+		this->Reserve(init_list.size());
+
+		for (ConstElementTypeLRef element : init_list)
+			this->PushBack(element);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SegmentedArray<InElementType, InAllocationPolicy>::SegmentedArray(SelfTypeRRef other)
+		: SegmentedArray(other.m_allocator)
+	{
+		*this = ::std::move(other);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	SegmentedArray<InElementType, InAllocationPolicy>::SegmentedArray(ConstSelfTypeLRef other)
+		: SegmentedArray(other.m_allocator)
+	{
+		*this = other;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SegmentedArray<InElementType, InAllocationPolicy>::~SegmentedArray()
+	{
+		this->Clear();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::SelfTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			for (Size counter = 0; counter < other.m_segment_count; counter++)
+			{
+				this->m_segments[counter].store(other.m_segments[counter].load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+				other.m_segments[counter].store(nullptr, ::std::memory_order_relaxed);
+			}
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_segment_count = other.m_segment_count;
+			this->m_published_count.store(other.m_count, ::std::memory_order_release);
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+			other.m_segment_count = 0;
+			other.m_published_count.store(0, ::std::memory_order_release);
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::SelfTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_allocator = other.m_allocator;
+			this->Reserve(other.m_count);
+
+			for (Size counter = 0; counter < other.m_count; counter++)
+				this->PushBack(other[counter]);
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::operator[](Size index)
+	{
+		return *this->_element_at(index);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SegmentedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return *this->_element_at(index);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, 0, this->GetCount());
+		return it;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		static Iterator it;
+
+		Size count = this->GetCount();
+
+		it = Iterator(this, count, count);
+		return it;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SegmentedArray<InElementType, InAllocationPolicy>::IsEmpty() const
+	{
+		return this->GetCount() == 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size SegmentedArray<InElementType, InAllocationPolicy>::GetCount() const
+	{
+		return this->m_published_count.load(::std::memory_order_acquire);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size SegmentedArray<InElementType, InAllocationPolicy>::GetSegmentCount() const
+	{
+		return this->m_segment_count;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::At(Size index)
+	{
+		if (index >= this->GetCount())
+			throw ::std::out_of_range("The index is out of range");
+
+		return *this->_element_at(index);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::At(Size index) const
+	{
+		if (index >= this->GetCount())
+			throw ::std::out_of_range("The index is out of range");
+
+		return *this->_element_at(index);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetBack()
+	{
+		Size count = this->GetCount();
+
+		if (count == 0)
+			throw ::std::length_error("The segmented array is empty");
+
+		return *this->_element_at(count - 1);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetFront()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The segmented array is empty");
+
+		return *this->_element_at(0);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetBack() const
+	{
+		Size count = this->GetCount();
+
+		if (count == 0)
+			throw ::std::length_error("The segmented array is empty");
+
+		return *this->_element_at(count - 1);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::GetFront() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The segmented array is empty");
+
+		return *this->_element_at(0);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SegmentedArray<InElementType, InAllocationPolicy>::Reserve(Size capacity)
+	{
+		while (this->m_capacity < capacity)
+			this->_append_segment();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SegmentedArray<InElementType, InAllocationPolicy>::PopBack()
+	{
+		if (this->m_count == 0)
+			throw ::std::length_error("The segmented array is empty");
+
+		this->m_published_count.store(this->m_count - 1, ::std::memory_order_release);
+
+		DestructArray(this->_element_at(--this->m_count), 1);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::PushBack(ElementTypeRRef element)
+	{
+		ElementTypePtr slot = this->_next_slot();
+
+		MoveObject(slot, element);
+
+		this->m_published_count.store(++this->m_count, ::std::memory_order_release);
+
+		return *slot;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SegmentedArray<InElementType, InAllocationPolicy>::PushBack(ConstElementTypeLRef element)
+	{
+		ElementTypePtr slot = this->_next_slot();
+
+		CopyObject(slot, element);
+
+		this->m_published_count.store(++this->m_count, ::std::memory_order_release);
+
+		return *slot;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SegmentedArray<InElementType, InAllocationPolicy>::Clear()
+	{
+		this->m_published_count.store(0, ::std::memory_order_release);
+
+		for (Size counter = 0; counter < this->m_count; counter++)
+			DestructArray(this->_element_at(counter), 1);
+
+		this->m_count = 0;
+
+		this->_release_segments();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypePtr SegmentedArray<InElementType, InAllocationPolicy>::_element_at(Size index) const
+	{
+		// Offsetting the index by the first segment capacity makes the highest set bit select
+		// the segment and the remaining bits the slot within it.
+		Size position = index + FIRST_SEGMENT_CAPACITY;
+		Size high_bit = BitWidth(position) - 1;
+
+		return this->m_segments[high_bit - FIRST_SEGMENT_SHIFT].load(::std::memory_order_acquire) + (position ^ (Size(1) << high_bit));
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SegmentedArray<InElementType, InAllocationPolicy>::ElementTypePtr SegmentedArray<InElementType, InAllocationPolicy>::_next_slot()
+	{
+		if (this->m_count == this->m_capacity)
+			this->_append_segment();
+
+		return this->_element_at(this->m_count);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SegmentedArray<InElementType, InAllocationPolicy>::_append_segment()
+	{
+		if (this->m_segment_count == MAXIMUM_SEGMENT_COUNT)
+			throw ::std::length_error("The segmented array cannot grow any further");
+
+		Size segment_capacity = FIRST_SEGMENT_CAPACITY << this->m_segment_count;
+
+		ElementTypePtr segment = static_cast<ElementTypePtr>(this->m_allocator->Allocate(segment_capacity * sizeof(ElementType), alignof(ElementType)));
+
+		this->m_segments[this->m_segment_count++].store(segment, ::std::memory_order_release);
+
+		this->m_capacity += segment_capacity;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SegmentedArray<InElementType, InAllocationPolicy>::_release_segments()
+	{
+		for (Size counter = 0; counter < this->m_segment_count; counter++)
+		{
+			this->m_allocator->Deallocate(this->m_segments[counter].load(::std::memory_order_relaxed));
+			this->m_segments[counter].store(nullptr, ::std::memory_order_relaxed);
+		}
+
+		this->m_segment_count = 0;
+		this->m_capacity = 0;
+	}
+}
\ No newline at end of file
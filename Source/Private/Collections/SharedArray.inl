@@ -0,0 +1,300 @@
+#include "Collections/SharedArray.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_storage(nullptr) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(ConstElementTypePtr buffer, Size count, AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_storage(nullptr)
+	{
+		this->_assign(buffer, count);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_storage(nullptr)
+	{
+		this->_assign(init_list.begin(), init_list.size());
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	template<typename InOtherAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(const DynamicArrayWithPolicy<InElementType, InOtherAllocationPolicy>& array, AllocatorTypePtr allocator)
+		: m_allocator(allocator), m_storage(nullptr)
+	{
+		this->_assign(array.GetRawData(), array.GetCount());
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(SelfTypeRRef other)
+		: m_allocator(other.m_allocator), m_storage(other.m_storage.exchange(nullptr, ::std::memory_order_relaxed)) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::SharedArray(ConstSelfTypeLRef other)
+		: m_allocator(other.m_allocator), m_storage(other._acquire()) {}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SharedArray<InElementType, InAllocationPolicy>::~SharedArray()
+	{
+		_release(this->m_storage.load(::std::memory_order_relaxed));
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::SelfTypeLRef SharedArray<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_allocator = other.m_allocator;
+
+			this->_retire(this->m_storage.exchange(other.m_storage.exchange(nullptr, ::std::memory_order_relaxed), ::std::memory_order_acq_rel));
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::SelfTypeLRef SharedArray<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+			this->Store(other);
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SharedArray<InElementType, InAllocationPolicy>::SelfType SharedArray<InElementType, InAllocationPolicy>::Load() const
+	{
+		return SelfType(*this);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::Store(ConstSelfTypeLRef other)
+	{
+		this->_retire(this->m_storage.exchange(other._acquire(), ::std::memory_order_acq_rel));
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::SelfType SharedArray<InElementType, InAllocationPolicy>::Exchange(ConstSelfTypeLRef other)
+	{
+		SelfType previous(this->m_allocator);
+		Storage* storage = this->m_storage.exchange(other._acquire(), ::std::memory_order_acq_rel);
+
+		// The returned array takes a reference of its own, since readers that loaded the old
+		// storage before the exchange rely on the reference of this array until it is retired.
+		if (storage)
+			storage->references.fetch_add(1, ::std::memory_order_relaxed);
+
+		previous.m_storage.store(storage, ::std::memory_order_relaxed);
+
+		this->_retire(storage);
+
+		return previous;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Size SharedArray<InElementType, InAllocationPolicy>::GetCount() const
+	{
+		Storage* storage = this->m_storage.load(::std::memory_order_acquire);
+
+		return storage ? storage->count : 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SharedArray<InElementType, InAllocationPolicy>::IsEmpty() const
+	{
+		return this->GetCount() == 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SharedArray<InElementType, InAllocationPolicy>::IsShared() const
+	{
+		Storage* storage = this->m_storage.load(::std::memory_order_acquire);
+
+		return storage && storage->references.load(::std::memory_order_acquire) > 1;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SharedArray<InElementType, InAllocationPolicy>::ConstElementTypePtr SharedArray<InElementType, InAllocationPolicy>::GetRawData() const
+	{
+		Storage* storage = this->m_storage.load(::std::memory_order_acquire);
+
+		return storage ? _elements(storage) : nullptr;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SharedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SharedArray<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return _elements(this->m_storage.load(::std::memory_order_acquire))[index];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SharedArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef SharedArray<InElementType, InAllocationPolicy>::Get(Size index) const
+	{
+		if (index >= this->GetCount())
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::ElementTypeLRef SharedArray<InElementType, InAllocationPolicy>::GetMutable(Size index)
+	{
+		Size count = this->GetCount();
+
+		if (index >= count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return _elements(this->_mutable(count))[index];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::Set(Size index, ConstElementTypeLRef element)
+	{
+		this->GetMutable(index) = element;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::PushBack(ConstElementTypeLRef element)
+	{
+		Size count = this->GetCount();
+		ConstElementTypePtr data = this->GetRawData();
+
+		// An element of this array would not survive its storage being replaced.
+		if (data && &element >= data && &element < data + count)
+		{
+			ElementType copy(element);
+
+			this->PushBack(copy);
+
+			return;
+		}
+
+		Storage* storage = this->_mutable(count + 1);
+
+		new (_elements(storage) + storage->count) ElementType(element);
+
+		storage->count++;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::PopBack()
+	{
+		Size count = this->GetCount();
+
+		if (count == 0)
+			throw ::std::length_error("The shared array is empty");
+
+		Storage* storage = this->_mutable(count);
+
+		_elements(storage)[storage->count - 1].~ElementType();
+
+		storage->count--;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::Clear()
+	{
+		_release(this->m_storage.exchange(nullptr, ::std::memory_order_acq_rel));
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SharedArray<InElementType, InAllocationPolicy>::ElementTypePtr SharedArray<InElementType, InAllocationPolicy>::_elements(Storage* storage)
+	{
+		return reinterpret_cast<ElementTypePtr>(reinterpret_cast<BytePtr>(storage) + ELEMENTS_OFFSET);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::Storage* SharedArray<InElementType, InAllocationPolicy>::_create(Size capacity, AllocatorTypePtr allocator)
+	{
+		VoidPtr memory = allocator->Allocate(ELEMENTS_OFFSET + capacity * sizeof(ElementType), STORAGE_ALIGNMENT);
+
+		return new (memory) Storage{ { 1 }, 0, capacity, allocator };
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::_release(Storage* storage)
+	{
+		if (!storage || storage->references.fetch_sub(1, ::std::memory_order_acq_rel) != 1)
+			return;
+
+		if constexpr (!::std::is_trivially_destructible<ElementType>::value)
+			DestructArray(_elements(storage), storage->count);
+
+		AllocatorTypePtr allocator = storage->allocator;
+
+		storage->~Storage();
+
+		allocator->Deallocate(storage);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::_release_retired(VoidPtr storage, VoidPtr)
+	{
+		_release(static_cast<Storage*>(storage));
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::Storage* SharedArray<InElementType, InAllocationPolicy>::_acquire() const
+	{
+		// A storage replaced by Store keeps the reference of this array until no pinned thread
+		// can hold its pointer, so the count cannot drop to zero before the increment.
+		Reclaim::Guard guard;
+
+		Storage* storage = this->m_storage.load(::std::memory_order_acquire);
+
+		if (storage)
+			storage->references.fetch_add(1, ::std::memory_order_relaxed);
+
+		return storage;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SharedArray<InElementType, InAllocationPolicy>::Storage* SharedArray<InElementType, InAllocationPolicy>::_mutable(Size capacity)
+	{
+		Storage* storage = this->m_storage.load(::std::memory_order_relaxed);
+		Bool unique = storage && storage->references.load(::std::memory_order_acquire) == 1;
+
+		if (unique && storage->capacity >= capacity)
+			return storage;
+
+		Size current_capacity = storage ? storage->capacity : 0;
+		Size count = storage ? storage->count : 0;
+
+		if (capacity > current_capacity)
+			capacity = capacity > current_capacity * 2 ? capacity : current_capacity * 2;
+		else
+			capacity = current_capacity;
+
+		Storage* copy = _create(capacity, this->m_allocator);
+
+		if (unique)
+			MoveArray(_elements(copy), _elements(storage), count);
+		else if (storage)
+			CopyArray(_elements(copy), static_cast<ConstElementTypePtr>(_elements(storage)), count);
+
+		copy->count = count;
+
+		this->m_storage.store(copy, ::std::memory_order_release);
+
+		_release(storage);
+
+		return copy;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::_retire(Storage* storage)
+	{
+		if (!storage)
+			return;
+
+		Reclaim::EpochManager& manager = Reclaim::EpochManager::GetDefault();
+
+		manager.Retire(storage, nullptr, &_release_retired);
+
+		// Storages can be large and publications rare, so the replaced storage is not left
+		// waiting for COLLECT_INTERVAL more retirements on this thread.
+		manager.Collect();
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SharedArray<InElementType, InAllocationPolicy>::_assign(ConstElementTypePtr buffer, Size count)
+	{
+		if (count == 0)
+			return;
+
+		Storage* storage = _create(count, this->m_allocator);
+
+		CopyArray(_elements(storage), buffer, count);
+
+		storage->count = count;
+
+		this->m_storage.store(storage, ::std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
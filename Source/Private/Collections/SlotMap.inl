@@ -0,0 +1,272 @@
+#include "Collections/SlotMap.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	SlotMap<InElementType, InAllocationPolicy>::SlotMap(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_free_head(INVALID_INDEX), m_slots(allocator), m_values(allocator), m_value_slots(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SlotMap<InElementType, InAllocationPolicy>::SlotMap(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_free_head(other.m_free_head),
+		  m_slots(::std::move(other.m_slots)),
+		  m_values(::std::move(other.m_values)),
+		  m_value_slots(::std::move(other.m_value_slots))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+		other.m_free_head = INVALID_INDEX;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	SlotMap<InElementType, InAllocationPolicy>::SlotMap(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_free_head(other.m_free_head),
+		  m_slots(other.m_slots),
+		  m_values(other.m_values),
+		  m_value_slots(other.m_value_slots)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::SelfTypeLRef SlotMap<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_slots = ::std::move(other.m_slots);
+			this->m_values = ::std::move(other.m_values);
+			this->m_value_slots = ::std::move(other.m_value_slots);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_free_head = other.m_free_head;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+			other.m_free_head = INVALID_INDEX;
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::SelfTypeLRef SlotMap<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_slots = other.m_slots;
+			this->m_values = other.m_values;
+			this->m_value_slots = other.m_value_slots;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_free_head = other.m_free_head;
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SlotMap<InElementType, InAllocationPolicy>::ElementTypeLRef SlotMap<InElementType, InAllocationPolicy>::operator[](Handle handle)
+	{
+		return this->m_values[this->m_slots[handle.index].index];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SlotMap<InElementType, InAllocationPolicy>::ConstElementTypeLRef SlotMap<InElementType, InAllocationPolicy>::operator[](Handle handle) const
+	{
+		return this->m_values[this->m_slots[handle.index].index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SlotMap<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		return this->m_values.GetBeginIterator();
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SlotMap<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		return this->m_values.GetFinalIterator();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SlotMap<InElementType, InAllocationPolicy>::Contains(Handle handle) const
+	{
+		// Occupied slots always have an odd generation, so a default constructed handle or one
+		// whose slot has been freed never matches.
+		return handle.index < this->m_slots.GetCount()
+			&& this->m_slots[handle.index].generation == handle.generation
+			&& (handle.generation & 1) != 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::ElementTypeLRef SlotMap<InElementType, InAllocationPolicy>::Get(Handle handle)
+	{
+		if (!this->Contains(handle))
+			throw ::std::out_of_range("The handle is not contained in the slot map");
+
+		return (*this)[handle];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::ConstElementTypeLRef SlotMap<InElementType, InAllocationPolicy>::Get(Handle handle) const
+	{
+		if (!this->Contains(handle))
+			throw ::std::out_of_range("The handle is not contained in the slot map");
+
+		return (*this)[handle];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SlotMap<InElementType, InAllocationPolicy>::ElementTypePtr SlotMap<InElementType, InAllocationPolicy>::TryGet(Handle handle)
+	{
+		return this->Contains(handle) ? &(*this)[handle] : nullptr;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SlotMap<InElementType, InAllocationPolicy>::ConstElementTypePtr SlotMap<InElementType, InAllocationPolicy>::TryGet(Handle handle) const
+	{
+		return this->Contains(handle) ? &(*this)[handle] : nullptr;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::Handle SlotMap<InElementType, InAllocationPolicy>::GetHandle(Size index) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		U32 slot_index = this->m_value_slots[index];
+
+		return Handle{ slot_index, this->m_slots[slot_index].generation };
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SlotMap<InElementType, InAllocationPolicy>::ConstElementTypePtr SlotMap<InElementType, InAllocationPolicy>::GetRawData() const
+	{
+		return this->m_values.GetRawData();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SlotMap<InElementType, InAllocationPolicy>::Reserve(Size capacity)
+	{
+		if (capacity > INVALID_INDEX)
+			throw ::std::length_error("The capacity exceeds the number of addressable slots");
+
+		if (capacity <= this->m_capacity)
+			return;
+
+		this->m_slots.Reserve(capacity);
+		this->m_values.Reserve(capacity);
+		this->m_value_slots.Reserve(capacity);
+
+		this->m_capacity = capacity;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::Handle SlotMap<InElementType, InAllocationPolicy>::Insert(ElementTypeRRef element)
+	{
+		// The slot is made available first, so a full map throws before the value is added.
+		this->_reserve_slot();
+
+		this->m_values.PushBack(::std::move(element));
+
+		U32 slot_index = this->_acquire_slot();
+
+		return Handle{ slot_index, this->m_slots[slot_index].generation };
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SlotMap<InElementType, InAllocationPolicy>::Handle SlotMap<InElementType, InAllocationPolicy>::Insert(ConstElementTypeLRef element)
+	{
+		// The slot is made available first, so a full map throws before the value is added.
+		this->_reserve_slot();
+
+		this->m_values.PushBack(element);
+
+		U32 slot_index = this->_acquire_slot();
+
+		return Handle{ slot_index, this->m_slots[slot_index].generation };
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SlotMap<InElementType, InAllocationPolicy>::Remove(Handle handle)
+	{
+		if (!this->Contains(handle))
+			throw ::std::out_of_range("The handle is not contained in the slot map");
+
+		U32 index = this->m_slots[handle.index].index;
+		U32 last_index = static_cast<U32>(this->m_count - 1);
+
+		if (index != last_index)
+		{
+			this->m_values[index] = ::std::move(this->m_values[last_index]);
+			this->m_value_slots[index] = this->m_value_slots[last_index];
+
+			this->m_slots[this->m_value_slots[index]].index = index;
+		}
+
+		this->m_values.PopBack();
+		this->m_value_slots.PopBack();
+
+		this->_release_slot(handle.index);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SlotMap<InElementType, InAllocationPolicy>::Clear()
+	{
+		while (this->m_count > 0)
+			this->_release_slot(this->m_value_slots[this->m_count - 1]);
+
+		this->m_values.Clear();
+		this->m_value_slots.Clear();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SlotMap<InElementType, InAllocationPolicy>::_reserve_slot()
+	{
+		if (this->m_free_head != INVALID_INDEX)
+			return;
+
+		if (this->m_slots.GetCount() == INVALID_INDEX)
+			throw ::std::length_error("The slot map cannot hold any more elements");
+
+		// A new slot joins the free list with the even generation of a freed slot.
+		this->m_slots.PushBack(Slot{ INVALID_INDEX, 0 });
+
+		this->m_free_head = static_cast<U32>(this->m_slots.GetCount() - 1);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	U32 SlotMap<InElementType, InAllocationPolicy>::_acquire_slot()
+	{
+		U32 slot_index = this->m_free_head;
+
+		this->m_free_head = this->m_slots[slot_index].index;
+
+		Slot& slot = this->m_slots[slot_index];
+
+		slot.index = static_cast<U32>(this->m_count);
+		slot.generation++;
+
+		this->m_value_slots.PushBack(slot_index);
+
+		this->m_count++;
+
+		if (this->m_count > this->m_capacity)
+			this->m_capacity = this->m_count;
+
+		return slot_index;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SlotMap<InElementType, InAllocationPolicy>::_release_slot(U32 slot_index)
+	{
+		Slot& slot = this->m_slots[slot_index];
+
+		slot.index = this->m_free_head;
+		slot.generation++;
+
+		this->m_free_head = slot_index;
+
+		this->m_count--;
+	}
+}
\ No newline at end of file
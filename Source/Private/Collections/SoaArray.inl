@@ -0,0 +1,358 @@
+#include "Collections/SoaArray.hpp"
+
+namespace Forge
+{
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SoaArrayWithPolicy(AllocatorTypePtr allocator)
+		: m_count(0), m_capacity(0), m_allocator(allocator), m_columns() {}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SoaArrayWithPolicy(Size capacity, AllocatorTypePtr allocator)
+		: m_count(0), m_capacity(0), m_allocator(allocator), m_columns()
+	{
+		this->Reserve(capacity);
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SoaArrayWithPolicy(SelfTypeRRef other)
+		: m_count(other.m_count), m_capacity(other.m_capacity), m_allocator(other.m_allocator), m_columns(other.m_columns)
+	{
+		other.m_count = 0;
+		other.m_capacity = 0;
+		other.m_columns = ColumnsType();
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SoaArrayWithPolicy(ConstSelfTypeLRef other)
+		: m_count(0), m_capacity(0), m_allocator(other.m_allocator), m_columns()
+	{
+		this->Reserve(other.m_count);
+
+		this->_copy_columns(other, IndexesType());
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::~SoaArrayWithPolicy()
+	{
+		this->_release();
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SelfTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->_release();
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_columns = other.m_columns;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+			other.m_columns = ColumnsType();
+		}
+
+		return *this;
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::SelfTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->_release();
+
+			this->m_allocator = other.m_allocator;
+
+			this->Reserve(other.m_count);
+
+			this->_copy_columns(other, IndexesType());
+		}
+
+		return *this;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::RowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::operator[](Size index)
+	{
+		return this->_row(index, IndexesType());
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::ConstRowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::operator[](Size index) const
+	{
+		return this->_row(index, IndexesType());
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::RowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::At(Size index)
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return this->_row(index, IndexesType());
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::ConstRowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::At(Size index) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return this->_row(index, IndexesType());
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size InIndex>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template FieldType<InIndex>& SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Get(Size index)
+	{
+		return ::std::get<InIndex>(this->m_columns)[index];
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size InIndex>
+	FORGE_FORCE_INLINE const typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template FieldType<InIndex>& SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Get(Size index) const
+	{
+		return ::std::get<InIndex>(this->m_columns)[index];
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size InIndex>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template FieldType<InIndex>* SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::GetRawData()
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<FieldType<InIndex>*>(__builtin_assume_aligned(::std::get<InIndex>(this->m_columns), COLUMN_ALIGNMENT));
+	#else
+		return ::std::get<InIndex>(this->m_columns);
+	#endif
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size InIndex>
+	FORGE_FORCE_INLINE const typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template FieldType<InIndex>* SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::GetRawData() const
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<const FieldType<InIndex>*>(__builtin_assume_aligned(::std::get<InIndex>(this->m_columns), COLUMN_ALIGNMENT));
+	#else
+		return ::std::get<InIndex>(this->m_columns);
+	#endif
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template ZipView<typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Iterator> SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Zip()
+	{
+		return ZipView<Iterator>(Iterator(this->m_columns, 0), Iterator(this->m_columns, this->m_count));
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::template ZipView<typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::ConstIterator> SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Zip() const
+	{
+		return ZipView<ConstIterator>(ConstIterator(this->m_columns, 0), ConstIterator(this->m_columns, this->m_count));
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	FORGE_FORCE_INLINE Bool SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::IsEmpty() const
+	{
+		return this->m_count == 0;
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	FORGE_FORCE_INLINE Size SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::GetCount() const
+	{
+		return this->m_count;
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	FORGE_FORCE_INLINE Size SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::GetCapacity() const
+	{
+		return this->m_capacity;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Reserve(Size capacity)
+	{
+		if (capacity <= this->m_capacity)
+			return;
+
+		AllocatorTypePtr allocator = this->m_allocator;
+		ColumnsType columns;
+		Bool aligned = true;
+
+		::std::apply([allocator, capacity, &aligned](auto&... new_columns)
+		{
+			((new_columns = static_cast<::std::remove_reference_t<decltype(new_columns)>>(allocator->Allocate(capacity * sizeof(*new_columns), COLUMN_ALIGNMENT))), ...);
+
+			aligned = ((reinterpret_cast<uintptr_t>(new_columns) % COLUMN_ALIGNMENT == 0) && ...);
+		}, columns);
+
+		// GetRawData lets the compiler assume this alignment, so a policy that ignores it must fail
+		// here, before the current columns are released.
+		if (!aligned)
+		{
+			::std::apply([allocator](auto&... new_columns) { (allocator->Deallocate(new_columns), ...); }, columns);
+
+			throw ::std::logic_error("The allocation policy did not align a column to the column alignment");
+		}
+
+		this->_relocate_columns(columns, IndexesType());
+
+		this->m_capacity = capacity;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::PushBack(RowType&& row)
+	{
+		if (this->m_count == this->m_capacity)
+			this->_grow();
+
+		this->_move_row(this->m_count, row, IndexesType());
+
+		this->m_count++;
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::PushBack(const RowType& row)
+	{
+		if (this->m_count == this->m_capacity)
+			this->_grow();
+
+		this->_copy_row(this->m_count, row, IndexesType());
+
+		this->m_count++;
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::PopBack()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The soa array is empty");
+
+		Size last = --this->m_count;
+
+		::std::apply([last](auto&... columns) { (DestructArray(columns + last, 1), ...); }, this->m_columns);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Remove(Size index)
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		Size last = --this->m_count;
+
+		::std::apply([index, last](auto&... columns)
+		{
+			auto shift = [index, last](auto* column)
+			{
+				for (Size counter = index; counter < last; counter++)
+					MoveObject(column[counter], column[counter + 1]);
+
+				DestructArray(column + last, 1);
+			};
+
+			(shift(columns), ...);
+		}, this->m_columns);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::RemoveSwap(Size index)
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		Size last = --this->m_count;
+
+		::std::apply([index, last](auto&... columns)
+		{
+			auto swap = [index, last](auto* column)
+			{
+				if (index != last)
+					MoveObject(column[index], column[last]);
+
+				DestructArray(column + last, 1);
+			};
+
+			(swap(columns), ...);
+		}, this->m_columns);
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::Clear()
+	{
+		Size count = this->m_count;
+
+		::std::apply([count](auto&... columns) { (DestructArray(columns, count), ...); }, this->m_columns);
+
+		this->m_count = 0;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::RowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_row(Size index, ::std::index_sequence<InIndexes...>)
+	{
+		return RowTypeLRef(::std::get<InIndexes>(this->m_columns)[index]...);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	FORGE_FORCE_INLINE typename SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::ConstRowTypeLRef SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_row(Size index, ::std::index_sequence<InIndexes...>) const
+	{
+		return ConstRowTypeLRef(::std::get<InIndexes>(this->m_columns)[index]...);
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_move_row(Size index, RowType& row, ::std::index_sequence<InIndexes...>)
+	{
+		(MoveObject(::std::get<InIndexes>(this->m_columns) + index, ::std::get<InIndexes>(row)), ...);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_copy_row(Size index, const RowType& row, ::std::index_sequence<InIndexes...>)
+	{
+		(CopyObject(::std::get<InIndexes>(this->m_columns) + index, ::std::get<InIndexes>(row)), ...);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_copy_columns(ConstSelfTypeLRef other, ::std::index_sequence<InIndexes...>)
+	{
+		(CopyArray(::std::get<InIndexes>(this->m_columns), ::std::get<InIndexes>(other.m_columns), other.m_count), ...);
+
+		this->m_count = other.m_count;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	template<Size... InIndexes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_relocate_columns(ColumnsType columns, ::std::index_sequence<InIndexes...>)
+	{
+		AllocatorTypePtr allocator = this->m_allocator;
+		Size count = this->m_count;
+
+		auto relocate = [allocator, count](auto* target, auto* source)
+		{
+			// Fields that cannot be relocated by copying their bytes are moved one by one.
+			if constexpr (::std::is_trivially_copyable<::std::remove_pointer_t<decltype(source)>>::value)
+			{
+				if (count > 0)
+					MemoryCopy(target, source, count * sizeof(*source));
+			}
+			else
+			{
+				MoveArray(target, source, count);
+				DestructArray(source, count);
+			}
+
+			allocator->Deallocate(source);
+		};
+
+		(relocate(::std::get<InIndexes>(columns), ::std::get<InIndexes>(this->m_columns)), ...);
+
+		this->m_columns = columns;
+	}
+
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_grow()
+	{
+		Size capacity = this->m_capacity + this->m_capacity / 2;
+
+		this->Reserve(capacity < 16 ? 16 : capacity);
+	}
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	Void SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>::_release()
+	{
+		this->Clear();
+
+		AllocatorTypePtr allocator = this->m_allocator;
+
+		::std::apply([allocator](auto&... columns) { (allocator->Deallocate(columns), ...); }, this->m_columns);
+
+		this->m_columns = ColumnsType();
+		this->m_capacity = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "Collections/SparseMap.hpp"
+
+namespace Forge
+{
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	SparseMap<InKeyType, InValueType, InAllocationPolicy>::SparseMap(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_keys(allocator), m_values(allocator), m_sparse(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	SparseMap<InKeyType, InValueType, InAllocationPolicy>::SparseMap(Size universe, AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_keys(allocator), m_values(allocator), m_sparse(allocator)
+	{
+		if (universe <= 0)
+			throw ::std::invalid_argument("The universe must be greater than 0");
+
+		this->m_allocator = allocator;
+
+		this->Reserve(universe);
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	SparseMap<InKeyType, InValueType, InAllocationPolicy>::SparseMap(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_keys(::std::move(other.m_keys)),
+		  m_values(::std::move(other.m_values)),
+		  m_sparse(::std::move(other.m_sparse))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	SparseMap<InKeyType, InValueType, InAllocationPolicy>::SparseMap(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity),
+		  m_keys(other.m_keys),
+		  m_values(other.m_values),
+		  m_sparse(other.m_sparse)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = ::std::move(other.m_keys);
+			this->m_values = ::std::move(other.m_values);
+			this->m_sparse = ::std::move(other.m_sparse);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::SelfTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_keys = other.m_keys;
+			this->m_values = other.m_values;
+			this->m_sparse = other.m_sparse;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::GetBeginIterator()
+	{
+		return this->m_values.GetBeginIterator();
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename AbstractIterator<InValueType>::SelfTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::GetFinalIterator()
+	{
+		return this->m_values.GetFinalIterator();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SparseMap<InKeyType, InValueType, InAllocationPolicy>::Contains(KeyType key) const
+	{
+		Size index = static_cast<Size>(key);
+
+		if (index >= this->m_sparse.GetCount())
+			return false;
+
+		Size position = this->m_sparse[index];
+
+		return position < this->m_count && this->m_keys[position] == key;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::Get(KeyType key)
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the sparse map");
+
+		return this->m_values[this->m_sparse[static_cast<Size>(key)]];
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypeLRef SparseMap<InKeyType, InValueType, InAllocationPolicy>::Get(KeyType key) const
+	{
+		if (!this->Contains(key))
+			throw ::std::out_of_range("The key is not contained in the sparse map");
+
+		return this->m_values[this->m_sparse[static_cast<Size>(key)]];
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ValueTypePtr SparseMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(KeyType key)
+	{
+		return this->Contains(key) ? &this->m_values[this->m_sparse[static_cast<Size>(key)]] : nullptr;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypePtr SparseMap<InKeyType, InValueType, InAllocationPolicy>::TryGet(KeyType key) const
+	{
+		return this->Contains(key) ? &this->m_values[this->m_sparse[static_cast<Size>(key)]] : nullptr;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ConstKeyTypePtr SparseMap<InKeyType, InValueType, InAllocationPolicy>::GetKeys() const
+	{
+		return this->m_keys.GetRawData();
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseMap<InKeyType, InValueType, InAllocationPolicy>::ConstValueTypePtr SparseMap<InKeyType, InValueType, InAllocationPolicy>::GetValues() const
+	{
+		return this->m_values.GetRawData();
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void SparseMap<InKeyType, InValueType, InAllocationPolicy>::Reserve(Size universe)
+	{
+		if (universe > static_cast<Size>(::std::numeric_limits<U32>::max()))
+			throw ::std::length_error("The universe exceeds the range of the sparse index");
+
+		if (this->m_sparse.GetCount() >= universe)
+			return;
+
+		this->m_sparse.Resize(universe);
+
+		// Sparse entries are validated against the dense keys, so their initial value is irrelevant.
+		while (this->m_sparse.GetCount() < universe)
+			this->m_sparse.PushBack(0);
+
+		this->m_capacity = universe;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool SparseMap<InKeyType, InValueType, InAllocationPolicy>::Insert(KeyType key, ValueTypeRRef value)
+	{
+		if (this->Contains(key))
+			return false;
+
+		this->m_values.PushBack(::std::move(value));
+		this->_push_key(key);
+
+		return true;
+	}
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool SparseMap<InKeyType, InValueType, InAllocationPolicy>::Insert(KeyType key, ConstValueTypeLRef value)
+	{
+		if (this->Contains(key))
+			return false;
+
+		this->m_values.PushBack(value);
+		this->_push_key(key);
+
+		return true;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Bool SparseMap<InKeyType, InValueType, InAllocationPolicy>::Remove(KeyType key)
+	{
+		if (!this->Contains(key))
+			return false;
+
+		Size position = this->m_sparse[static_cast<Size>(key)];
+		Size last_position = --this->m_count;
+
+		if (position != last_position)
+		{
+			KeyType last_key = this->m_keys[last_position];
+
+			this->m_keys[position] = last_key;
+			this->m_values[position] = ::std::move(this->m_values[last_position]);
+
+			this->m_sparse[static_cast<Size>(last_key)] = static_cast<U32>(position);
+		}
+
+		this->m_values.PopBack();
+
+		return true;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	Void SparseMap<InKeyType, InValueType, InAllocationPolicy>::Clear()
+	{
+		this->m_values.Clear();
+
+		this->m_count = 0;
+	}
+
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void SparseMap<InKeyType, InValueType, InAllocationPolicy>::_push_key(KeyType key)
+	{
+		Size index = static_cast<Size>(key);
+
+		this->Reserve(index + 1);
+
+		// The dense keys may hold stale entries past the count after a Clear, which are reused.
+		if (this->m_count < this->m_keys.GetCount())
+			this->m_keys[this->m_count] = key;
+		else
+			this->m_keys.PushBack(key);
+
+		this->m_sparse[index] = static_cast<U32>(this->m_count++);
+	}
+}
\ No newline at end of file
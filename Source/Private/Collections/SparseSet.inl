@@ -0,0 +1,211 @@
+#include "Collections/SparseSet.hpp"
+
+namespace Forge
+{
+	template<typename InElementType, typename InAllocationPolicy>
+	SparseSet<InElementType, InAllocationPolicy>::SparseSet(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_dense(allocator), m_sparse(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	SparseSet<InElementType, InAllocationPolicy>::SparseSet(Size universe, AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_dense(allocator), m_sparse(allocator)
+	{
+		if (universe <= 0)
+			throw ::std::invalid_argument("The universe must be greater than 0");
+
+		this->m_allocator = allocator;
+
+		this->Reserve(universe);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	SparseSet<InElementType, InAllocationPolicy>::SparseSet(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_dense(::std::move(other.m_dense)), m_sparse(::std::move(other.m_sparse))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	SparseSet<InElementType, InAllocationPolicy>::SparseSet(ConstSelfTypeLRef other)
+		: BaseType(other.m_count, other.m_capacity), m_dense(other.m_dense), m_sparse(other.m_sparse)
+	{
+		this->m_allocator = other.m_allocator;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SparseSet<InElementType, InAllocationPolicy>::SelfTypeLRef SparseSet<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->m_dense = ::std::move(other.m_dense);
+			this->m_sparse = ::std::move(other.m_sparse);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename SparseSet<InElementType, InAllocationPolicy>::SelfTypeLRef SparseSet<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->m_dense = other.m_dense;
+			this->m_sparse = other.m_sparse;
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseSet<InElementType, InAllocationPolicy>::ConstElementTypeLRef SparseSet<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return this->m_dense[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SparseSet<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		static typename DenseArrayType::Iterator it;
+
+		it = typename DenseArrayType::Iterator(const_cast<ElementTypePtr>(this->m_dense.GetRawData()));
+		return it;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef SparseSet<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		static typename DenseArrayType::Iterator it;
+
+		// The dense array may hold stale elements past the count after a Clear.
+		it = typename DenseArrayType::Iterator(const_cast<ElementTypePtr>(this->m_dense.GetRawData()) + this->m_count);
+		return it;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Bool SparseSet<InElementType, InAllocationPolicy>::Contains(ElementType element) const
+	{
+		Size index = static_cast<Size>(element);
+
+		if (index >= this->m_sparse.GetCount())
+			return false;
+
+		Size position = this->m_sparse[index];
+
+		return position < this->m_count && this->m_dense[position] == element;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool SparseSet<InElementType, InAllocationPolicy>::ContainsAll(ConstSelfTypeLRef other) const
+	{
+		for (Size counter = 0; counter < other.m_count; counter++)
+			if (!this->Contains(other.m_dense[counter]))
+				return false;
+
+		return true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename SparseSet<InElementType, InAllocationPolicy>::ConstElementTypePtr SparseSet<InElementType, InAllocationPolicy>::GetRawData() const
+	{
+		return this->m_dense.GetRawData();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SparseSet<InElementType, InAllocationPolicy>::Reserve(Size universe)
+	{
+		if (universe > static_cast<Size>(::std::numeric_limits<U32>::max()))
+			throw ::std::length_error("The universe exceeds the range of the sparse index");
+
+		if (this->m_sparse.GetCount() >= universe)
+			return;
+
+		this->m_sparse.Resize(universe);
+
+		// Sparse entries are validated against the dense array, so their initial value is irrelevant.
+		while (this->m_sparse.GetCount() < universe)
+			this->m_sparse.PushBack(0);
+
+		this->m_capacity = universe;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool SparseSet<InElementType, InAllocationPolicy>::Insert(ElementType element)
+	{
+		if (this->Contains(element))
+			return false;
+
+		Size index = static_cast<Size>(element);
+
+		this->Reserve(index + 1);
+
+		if (this->m_count < this->m_dense.GetCount())
+			this->m_dense[this->m_count] = element;
+		else
+			this->m_dense.PushBack(element);
+
+		this->m_sparse[index] = static_cast<U32>(this->m_count++);
+
+		return true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SparseSet<InElementType, InAllocationPolicy>::InsertAll(ConstSelfTypeLRef other)
+	{
+		for (Size counter = 0; counter < other.m_count; counter++)
+			this->Insert(other.m_dense[counter]);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Bool SparseSet<InElementType, InAllocationPolicy>::Remove(ElementType element)
+	{
+		if (!this->Contains(element))
+			return false;
+
+		Size position = this->m_sparse[static_cast<Size>(element)];
+		ElementType last = this->m_dense[--this->m_count];
+
+		this->m_dense[position] = last;
+		this->m_sparse[static_cast<Size>(last)] = static_cast<U32>(position);
+
+		return true;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SparseSet<InElementType, InAllocationPolicy>::RemoveAll(ConstSelfTypeLRef other)
+	{
+		if (other.m_count < this->m_count)
+		{
+			for (Size counter = 0; counter < other.m_count; counter++)
+				this->Remove(other.m_dense[counter]);
+		}
+		else
+		{
+			for (Size counter = this->m_count; counter > 0; counter--)
+				if (other.Contains(this->m_dense[counter - 1]))
+					this->Remove(this->m_dense[counter - 1]);
+		}
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void SparseSet<InElementType, InAllocationPolicy>::RetainAll(ConstSelfTypeLRef other)
+	{
+		// Walking backwards means every removal swaps in an element that was already visited.
+		for (Size counter = this->m_count; counter > 0; counter--)
+			if (!other.Contains(this->m_dense[counter - 1]))
+				this->Remove(this->m_dense[counter - 1]);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void SparseSet<InElementType, InAllocationPolicy>::Clear()
+	{
+		this->m_count = 0;
+	}
+}
\ No newline at end of file
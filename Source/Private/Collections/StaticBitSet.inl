@@ -0,0 +1,177 @@
+#include "Collections/StaticBitSet.hpp"
+
+namespace Forge
+{
+	template<Size InBitCount>
+	StaticBitSet<InBitCount>::StaticBitSet()
+	{
+		MemorySet(this->m_words, 0, sizeof(this->m_words));
+	}
+
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::operator==(ConstSelfTypeLRef other) const
+	{
+		for (Size counter = 0; counter < WORD_COUNT; counter++)
+			if (this->m_words[counter] != other.m_words[counter])
+				return false;
+
+		return true;
+	}
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::operator!=(ConstSelfTypeLRef other) const
+	{
+		return !(*this == other);
+	}
+
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Bool StaticBitSet<InBitCount>::operator[](Size index) const
+	{
+		return (this->m_words[index >> 6] >> (index & 63)) & 1;
+	}
+
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE constexpr Size StaticBitSet<InBitCount>::GetBitCount() const
+	{
+		return BIT_COUNT;
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE constexpr Size StaticBitSet<InBitCount>::GetWordCount() const
+	{
+		return WORD_COUNT;
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE const typename StaticBitSet<InBitCount>::WordType* StaticBitSet<InBitCount>::GetRawData() const
+	{
+		return this->m_words;
+	}
+
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::Test(Size index) const
+	{
+		if (index >= BIT_COUNT)
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::Any() const
+	{
+		for (Size counter = 0; counter < WORD_COUNT; counter++)
+			if (this->m_words[counter] != 0)
+				return true;
+
+		return false;
+	}
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::All() const
+	{
+		for (Size counter = 0; counter + 1 < WORD_COUNT; counter++)
+			if (this->m_words[counter] != ~WordType(0))
+				return false;
+
+		return this->m_words[WORD_COUNT - 1] == LAST_WORD_MASK;
+	}
+	template<Size InBitCount>
+	Bool StaticBitSet<InBitCount>::None() const
+	{
+		return !this->Any();
+	}
+
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Size StaticBitSet<InBitCount>::PopCount() const
+	{
+		return Forge::PopCount(this->m_words, WORD_COUNT);
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Size StaticBitSet<InBitCount>::FindFirstSet() const
+	{
+		Size first = Forge::FindNextSet(this->m_words, WORD_COUNT, 0);
+
+		return first < BIT_COUNT ? first : BIT_COUNT;
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Size StaticBitSet<InBitCount>::FindNextSet(Size index) const
+	{
+		if (index + 1 >= BIT_COUNT)
+			return BIT_COUNT;
+
+		Size next = Forge::FindNextSet(this->m_words, WORD_COUNT, index + 1);
+
+		return next < BIT_COUNT ? next : BIT_COUNT;
+	}
+
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::Set(Size index)
+	{
+		if (index >= BIT_COUNT)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] |= WordType(1) << (index & 63);
+	}
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::Reset(Size index)
+	{
+		if (index >= BIT_COUNT)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] &= ~(WordType(1) << (index & 63));
+	}
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::Flip(Size index)
+	{
+		if (index >= BIT_COUNT)
+			throw ::std::out_of_range("The index is out of range");
+
+		this->m_words[index >> 6] ^= WordType(1) << (index & 63);
+	}
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::Assign(Size index, Bool value)
+	{
+		if (value)
+			this->Set(index);
+		else
+			this->Reset(index);
+	}
+
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::SetAll()
+	{
+		MemorySet(this->m_words, 0xFF, sizeof(this->m_words));
+
+		this->m_words[WORD_COUNT - 1] = LAST_WORD_MASK;
+	}
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::ResetAll()
+	{
+		MemorySet(this->m_words, 0, sizeof(this->m_words));
+	}
+	template<Size InBitCount>
+	Void StaticBitSet<InBitCount>::FlipAll()
+	{
+		for (Size counter = 0; counter < WORD_COUNT; counter++)
+			this->m_words[counter] = ~this->m_words[counter];
+
+		this->m_words[WORD_COUNT - 1] &= LAST_WORD_MASK;
+	}
+
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Void StaticBitSet<InBitCount>::And(ConstSelfTypeLRef other)
+	{
+		BitwiseAnd(this->m_words, other.m_words, WORD_COUNT);
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Void StaticBitSet<InBitCount>::Or(ConstSelfTypeLRef other)
+	{
+		BitwiseOr(this->m_words, other.m_words, WORD_COUNT);
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Void StaticBitSet<InBitCount>::Xor(ConstSelfTypeLRef other)
+	{
+		BitwiseXor(this->m_words, other.m_words, WORD_COUNT);
+	}
+	template<Size InBitCount>
+	FORGE_FORCE_INLINE Void StaticBitSet<InBitCount>::AndNot(ConstSelfTypeLRef other)
+	{
+		BitwiseAndNot(this->m_words, other.m_words, WORD_COUNT);
+	}
+}
\ No newline at end of file
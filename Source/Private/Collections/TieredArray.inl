@@ -0,0 +1,431 @@
+#include "Collections/TieredArray.hpp"
+
+namespace Forge
+{
+	template<typename InType>
+	static FORGE_FORCE_INLINE Void _relocate_element(InType* to, InType* from)
+	{
+		MoveObject(to, *from);
+		DestructArray(from, 1);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	TieredArray<InElementType, InAllocationPolicy>::TieredArray(AllocatorTypePtr allocator)
+		: BaseType(0, 0), m_block_shift(MINIMUM_BLOCK_SHIFT), m_block_mask((Size(1) << MINIMUM_BLOCK_SHIFT) - 1), m_blocks(allocator)
+	{
+		this->m_allocator = allocator;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	TieredArray<InElementType, InAllocationPolicy>::TieredArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator)
+		: TieredArray(allocator)
+	{
+		for (ConstElementTypeLRef element : init_list)
+			this->PushBack(element);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	TieredArray<InElementType, InAllocationPolicy>::TieredArray(SelfTypeRRef other)
+		: BaseType(other.m_count, other.m_capacity), m_block_shift(other.m_block_shift), m_block_mask(other.m_block_mask), m_blocks(::std::move(other.m_blocks))
+	{
+		this->m_allocator = other.m_allocator;
+
+		other.m_count = 0;
+		other.m_capacity = 0;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	TieredArray<InElementType, InAllocationPolicy>::TieredArray(ConstSelfTypeLRef other)
+		: TieredArray(other.m_allocator)
+	{
+		*this = other;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	TieredArray<InElementType, InAllocationPolicy>::~TieredArray()
+	{
+		this->Clear();
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::SelfTypeLRef TieredArray<InElementType, InAllocationPolicy>::operator=(SelfTypeRRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			this->m_blocks = ::std::move(other.m_blocks);
+
+			this->m_count = other.m_count;
+			this->m_capacity = other.m_capacity;
+			this->m_allocator = other.m_allocator;
+			this->m_block_shift = other.m_block_shift;
+			this->m_block_mask = other.m_block_mask;
+
+			other.m_count = 0;
+			other.m_capacity = 0;
+		}
+
+		return *this;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::SelfTypeLRef TieredArray<InElementType, InAllocationPolicy>::operator=(ConstSelfTypeLRef other)
+	{
+		if (this != &other)
+		{
+			this->Clear();
+
+			for (Size counter = 0; counter < other.m_count; counter++)
+				this->PushBack(other[counter]);
+		}
+
+		return *this;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::operator[](Size index)
+	{
+		return *this->_slot(this->m_blocks[index >> this->m_block_shift], index & this->m_block_mask);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::operator[](Size index) const
+	{
+		return *this->_slot(this->m_blocks[index >> this->m_block_shift], index & this->m_block_mask);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetBeginIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, 0);
+		return it;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename AbstractIterator<InElementType>::SelfTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetFinalIterator()
+	{
+		static Iterator it;
+
+		it = Iterator(this, this->m_count);
+		return it;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::At(Size index)
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::At(Size index) const
+	{
+		if (index >= this->m_count)
+			throw ::std::out_of_range("The index is out of range");
+
+		return (*this)[index];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetBack()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		return (*this)[this->m_count - 1];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetFront()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		return (*this)[0];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetBack() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		return (*this)[this->m_count - 1];
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ConstElementTypeLRef TieredArray<InElementType, InAllocationPolicy>::GetFront() const
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		return (*this)[0];
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Size TieredArray<InElementType, InAllocationPolicy>::GetBlockCapacity() const
+	{
+		return this->m_block_mask + 1;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PopBack()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		this->Remove(this->m_count - 1);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PopFront()
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		this->Remove(0);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PushBack(ElementTypeRRef element)
+	{
+		this->Insert(this->m_count, ::std::move(element));
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PushFront(ElementTypeRRef element)
+	{
+		this->Insert(0, ::std::move(element));
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PushBack(ConstElementTypeLRef element)
+	{
+		this->Insert(this->m_count, element);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::PushFront(ConstElementTypeLRef element)
+	{
+		this->Insert(0, element);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::Remove(Size index)
+	{
+		if (this->IsEmpty())
+			throw ::std::length_error("The tiered array is empty");
+
+		if (this->m_count <= index)
+			throw ::std::out_of_range("The index is out of range");
+
+		DestructArray(this->_element_at(index), 1);
+
+		this->_close_gap(index);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::Insert(Size index, ElementTypeRRef element)
+	{
+		if (this->m_count < index)
+			throw ::std::out_of_range("The index is out of range");
+
+		MoveObject(this->_make_room(index), element);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::Insert(Size index, ConstElementTypeLRef element)
+	{
+		if (this->m_count < index)
+			throw ::std::out_of_range("The index is out of range");
+
+		CopyObject(this->_make_room(index), element);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::Clear()
+	{
+		for (Size counter = 0; counter < this->m_blocks.GetCount(); counter++)
+		{
+			Block& block = this->m_blocks[counter];
+
+			for (Size offset = 0; offset < block.count; offset++)
+				DestructArray(this->_slot(block, offset), 1);
+
+			block.count = 0;
+		}
+
+		this->_release_blocks();
+
+		this->m_block_shift = MINIMUM_BLOCK_SHIFT;
+		this->m_block_mask = (Size(1) << MINIMUM_BLOCK_SHIFT) - 1;
+
+		this->m_count = 0;
+		this->m_capacity = 0;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename TieredArray<InElementType, InAllocationPolicy>::ElementTypePtr TieredArray<InElementType, InAllocationPolicy>::_element_at(Size index) const
+	{
+		if (index >= this->m_count)
+			return nullptr;
+
+		return this->_slot(this->m_blocks[index >> this->m_block_shift], index & this->m_block_mask);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE typename TieredArray<InElementType, InAllocationPolicy>::ElementTypePtr TieredArray<InElementType, InAllocationPolicy>::_slot(const Block& block, Size offset) const
+	{
+		return block.data + ((block.head + offset) & this->m_block_mask);
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::_append_block()
+	{
+		Size block_capacity = this->m_block_mask + 1;
+
+		Block block;
+		block.data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(block_capacity * sizeof(ElementType), alignof(ElementType)));
+		block.head = 0;
+		block.count = 0;
+
+		this->m_blocks.PushBack(block);
+
+		this->m_capacity += block_capacity;
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::_release_blocks()
+	{
+		for (Size counter = 0; counter < this->m_blocks.GetCount(); counter++)
+			this->m_allocator->Deallocate(this->m_blocks[counter].data);
+
+		this->m_blocks.Clear();
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::_grow_block_capacity()
+	{
+		Size old_block_count = this->m_blocks.GetCount();
+		Size new_block_capacity = (this->m_block_mask + 1) << 1;
+
+		DynamicArrayWithPolicy<Block, InAllocationPolicy> new_blocks(this->m_allocator);
+		new_blocks.Reserve((old_block_count + 1) / 2);
+
+		// Every pair of neighbouring blocks is merged into one block of twice the capacity, so
+		// the order of the elements is preserved.
+		for (Size counter = 0; counter < old_block_count; counter += 2)
+		{
+			Block merged;
+			merged.data = static_cast<ElementTypePtr>(this->m_allocator->Allocate(new_block_capacity * sizeof(ElementType), alignof(ElementType)));
+			merged.head = 0;
+			merged.count = 0;
+
+			for (Size source = counter; source < counter + 2 && source < old_block_count; source++)
+			{
+				Block& block = this->m_blocks[source];
+
+				for (Size offset = 0; offset < block.count; offset++)
+					_relocate_element(merged.data + merged.count++, this->_slot(block, offset));
+
+				block.count = 0;
+			}
+
+			new_blocks.PushBack(merged);
+		}
+
+		this->_release_blocks();
+
+		this->m_blocks = ::std::move(new_blocks);
+
+		this->m_block_shift++;
+		this->m_block_mask = new_block_capacity - 1;
+
+		this->m_capacity = this->m_blocks.GetCount() * new_block_capacity;
+	}
+
+	template<typename InElementType, typename InAllocationPolicy>
+	typename TieredArray<InElementType, InAllocationPolicy>::ElementTypePtr TieredArray<InElementType, InAllocationPolicy>::_make_room(Size index)
+	{
+		if (this->m_count >> this->m_block_shift >= this->m_block_mask + 1)
+			this->_grow_block_capacity();
+
+		if (this->m_blocks.IsEmpty() || this->m_blocks.GetBack().count > this->m_block_mask)
+			this->_append_block();
+
+		Size block_index = index >> this->m_block_shift;
+		Size offset = index & this->m_block_mask;
+
+		// Rotate one element from the back of each block into the front of the next one, until
+		// the target block has a free slot.
+		for (Size counter = this->m_blocks.GetCount() - 1; counter > block_index; counter--)
+		{
+			Block& source = this->m_blocks[counter - 1];
+			Block& target = this->m_blocks[counter];
+
+			target.head = (target.head - 1) & this->m_block_mask;
+
+			_relocate_element(target.data + target.head, this->_slot(source, source.count - 1));
+
+			source.count--;
+			target.count++;
+		}
+
+		Block& block = this->m_blocks[block_index];
+
+		if (offset < block.count / 2)
+		{
+			block.head = (block.head - 1) & this->m_block_mask;
+
+			for (Size counter = 0; counter < offset; counter++)
+				_relocate_element(this->_slot(block, counter), this->_slot(block, counter + 1));
+		}
+		else
+		{
+			for (Size counter = block.count; counter > offset; counter--)
+				_relocate_element(this->_slot(block, counter), this->_slot(block, counter - 1));
+		}
+
+		block.count++;
+
+		this->m_count++;
+
+		return this->_slot(block, offset);
+	}
+	template<typename InElementType, typename InAllocationPolicy>
+	Void TieredArray<InElementType, InAllocationPolicy>::_close_gap(Size index)
+	{
+		Size block_index = index >> this->m_block_shift;
+		Size offset = index & this->m_block_mask;
+
+		Block& block = this->m_blocks[block_index];
+
+		if (offset < block.count / 2)
+		{
+			for (Size counter = offset; counter > 0; counter--)
+				_relocate_element(this->_slot(block, counter), this->_slot(block, counter - 1));
+
+			block.head = (block.head + 1) & this->m_block_mask;
+		}
+		else
+		{
+			for (Size counter = offset; counter + 1 < block.count; counter++)
+				_relocate_element(this->_slot(block, counter), this->_slot(block, counter + 1));
+		}
+
+		block.count--;
+
+		// Rotate one element from the front of each following block into the back of the
+		// previous one, so every block but the last stays full.
+		for (Size counter = block_index + 1; counter < this->m_blocks.GetCount(); counter++)
+		{
+			Block& source = this->m_blocks[counter];
+			Block& target = this->m_blocks[counter - 1];
+
+			_relocate_element(this->_slot(target, target.count), source.data + source.head);
+
+			source.head = (source.head + 1) & this->m_block_mask;
+
+			source.count--;
+			target.count++;
+		}
+
+		if (this->m_blocks.GetBack().count == 0)
+		{
+			this->m_allocator->Deallocate(this->m_blocks.GetBack().data);
+			this->m_blocks.PopBack();
+
+			this->m_capacity -= this->m_block_mask + 1;
+		}
+
+		this->m_count--;
+	}
+}
\ No newline at end of file
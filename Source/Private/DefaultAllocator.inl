@@ -0,0 +1,28 @@
+#ifndef DEFAULT_ALLOCATOR_INL_HPP
+#define DEFAULT_ALLOCATOR_INL_HPP
+
+#include "DefaultAllocator.hpp"
+
+#include <type_traits>
+
+namespace Forge
+{
+	template<typename InAllocatorType>
+	FORGE_FORCE_INLINE InAllocatorType* GetDefaultAllocator()
+	{
+		if constexpr (::std::is_empty<InAllocatorType>::value && ::std::is_trivially_destructible<InAllocatorType>::value)
+		{
+			static InAllocatorType allocator;
+
+			return &allocator;
+		}
+		else
+		{
+			static InAllocatorType* allocator = new InAllocatorType();
+
+			return allocator;
+		}
+	}
+}
+
+#endif
\ No newline at end of file
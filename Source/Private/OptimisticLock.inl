@@ -0,0 +1,72 @@
+#ifndef OPTIMISTIC_LOCK_INL_HPP
+#define OPTIMISTIC_LOCK_INL_HPP
+
+#include "OptimisticLock.hpp"
+
+#include <thread>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+#endif
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE OptimisticLock::OptimisticLock()
+		: m_version(0) {}
+
+	FORGE_FORCE_INLINE Bool OptimisticLock::TryBeginRead(U64& version) const
+	{
+		version = this->m_version.load(::std::memory_order_acquire);
+
+		if (version & LOCKED_BIT)
+		{
+			Pause();
+
+			return false;
+		}
+
+		return true;
+	}
+	FORGE_FORCE_INLINE Bool OptimisticLock::Validate(U64 version) const
+	{
+		// Orders the optimistic loads of the protected data before the second version load.
+		::std::atomic_thread_fence(::std::memory_order_acquire);
+
+		return this->m_version.load(::std::memory_order_relaxed) == version;
+	}
+
+	FORGE_FORCE_INLINE Bool OptimisticLock::TryUpgrade(U64& version)
+	{
+		if (!this->m_version.compare_exchange_strong(version, version + LOCKED_BIT, ::std::memory_order_acquire))
+			return false;
+
+		version += LOCKED_BIT;
+
+		return true;
+	}
+	FORGE_FORCE_INLINE Void OptimisticLock::WriteLock()
+	{
+		U64 version;
+
+		while (!this->TryBeginRead(version) || !this->TryUpgrade(version))
+			continue;
+	}
+	FORGE_FORCE_INLINE Void OptimisticLock::WriteUnlock()
+	{
+		// Clears the locked bit by carrying it into the version counter.
+		this->m_version.fetch_add(LOCKED_BIT, ::std::memory_order_release);
+	}
+
+	FORGE_FORCE_INLINE Void OptimisticLock::Pause()
+	{
+	#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+		_mm_pause();
+	#else
+		::std::this_thread::yield();
+	#endif
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,222 @@
+#ifndef HUGE_PAGE_ALLOCATION_POLICY_INL_HPP
+#define HUGE_PAGE_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/HugePageAllocationPolicy.hpp"
+
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+
+#include <sys/mman.h>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE HugePageAllocationPolicy::HugePageAllocationPolicy(Size threshold, Bool use_huge_tlb)
+		: m_threshold(threshold), m_use_huge_tlb(use_huge_tlb) {}
+
+	FORGE_FORCE_INLINE Size HugePageAllocationPolicy::GetThreshold() const
+	{
+		return this->m_threshold;
+	}
+	FORGE_FORCE_INLINE Bool HugePageAllocationPolicy::IsMapped(VoidPtr pointer) const
+	{
+		return _header(pointer)->kind >= MAPPED_BLOCK;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr HugePageAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		return size >= this->m_threshold ? this->_map(size) : this->_allocate_heap(size, alignment);
+	}
+	FORGE_FORCE_INLINE VoidPtr HugePageAllocationPolicy::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		Header* header = _header(pointer);
+
+		if (header->kind >= MAPPED_BLOCK)
+		{
+			Size mapped_size = _mapped_size(size);
+
+			if (mapped_size != header->mapped_size)
+			{
+				VoidPtr base = _remap(header, mapped_size);
+
+				// A huge page pool without room for the new size, or a mapping the caller split with
+				// mprotect or madvise, falls back to a fresh mapping.
+				if (base == MAP_FAILED)
+				{
+					VoidPtr data = this->_map(size);
+
+					::std::memcpy(data, pointer, header->size < size ? header->size : size);
+					::munmap(header, header->mapped_size);
+
+					return data;
+				}
+
+				header = static_cast<Header*>(base);
+				header->mapped_size = mapped_size;
+			}
+
+			header->size = size;
+
+			return reinterpret_cast<BytePtr>(header) + HEADER_SIZE;
+		}
+
+		if (size >= this->m_threshold)
+		{
+			VoidPtr data = this->_map(size);
+
+			::std::memcpy(data, pointer, header->size);
+			this->Deallocate(pointer);
+
+			return data;
+		}
+
+		if (header->kind == HEAP_BLOCK)
+		{
+			VoidPtr base = ::std::realloc(header, HEADER_SIZE + size);
+
+			if (!base)
+				throw ::std::bad_alloc();
+
+			header = static_cast<Header*>(base);
+			header->size = size;
+
+			return static_cast<BytePtr>(base) + HEADER_SIZE;
+		}
+
+		// Over-aligned blocks cannot go through realloc, which only preserves the default alignment.
+		VoidPtr data = this->_allocate_heap(size, alignment);
+
+		::std::memcpy(data, pointer, header->size < size ? header->size : size);
+		this->Deallocate(pointer);
+
+		return data;
+	}
+	FORGE_FORCE_INLINE Void HugePageAllocationPolicy::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		Header* header = _header(pointer);
+
+		if (header->kind >= MAPPED_BLOCK)
+			::munmap(header, header->mapped_size);
+		else
+			::std::free(header);
+	}
+
+	FORGE_FORCE_INLINE HugePageAllocationPolicy::Header* HugePageAllocationPolicy::_header(VoidPtr pointer)
+	{
+		return reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+	}
+	FORGE_FORCE_INLINE Size HugePageAllocationPolicy::_mapped_size(Size size)
+	{
+		return (HEADER_SIZE + size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+	}
+
+	FORGE_FORCE_INLINE VoidPtr HugePageAllocationPolicy::_remap(Header* header, Size mapped_size)
+	{
+		// The kernel places huge page pool mappings on huge page boundaries wherever they move.
+		if (header->kind == HUGE_TLB_BLOCK)
+			return ::mremap(header, header->mapped_size, mapped_size, MREMAP_MAYMOVE);
+
+		VoidPtr base = ::mremap(header, header->mapped_size, mapped_size, 0);
+
+		if (base != MAP_FAILED)
+			return base;
+
+		// A moved mapping is only page aligned, so it is moved onto a reserved range that starts
+		// on a huge page boundary instead, which still moves page table entries without copying.
+		BytePtr target = _reserve(mapped_size);
+
+		if (!target)
+			return MAP_FAILED;
+
+		base = ::mremap(header, header->mapped_size, mapped_size, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+
+		if (base == MAP_FAILED)
+			::munmap(target, mapped_size);
+
+		return base;
+	}
+	FORGE_FORCE_INLINE BytePtr HugePageAllocationPolicy::_reserve(Size mapped_size)
+	{
+		// Reserves one extra huge page so that the range can start on a huge page boundary,
+		// which transparent huge pages need to back its first page.
+		BytePtr reserved = static_cast<BytePtr>(::mmap(nullptr, mapped_size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+		if (reserved == MAP_FAILED)
+			return nullptr;
+
+		BytePtr aligned = reinterpret_cast<BytePtr>((reinterpret_cast<::std::uintptr_t>(reserved) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+
+		Size head = aligned - reserved;
+
+		if (head != 0)
+			::munmap(reserved, head);
+
+		::munmap(aligned + mapped_size, HUGE_PAGE_SIZE - head);
+
+		return aligned;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr HugePageAllocationPolicy::_map(Size size)
+	{
+		Size mapped_size = _mapped_size(size);
+
+		VoidPtr base = MAP_FAILED;
+		U8 kind = HUGE_TLB_BLOCK;
+
+		if (this->m_use_huge_tlb)
+			base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+		if (base == MAP_FAILED)
+		{
+			kind = MAPPED_BLOCK;
+
+			BytePtr aligned = _reserve(mapped_size);
+
+			if (!aligned)
+				throw ::std::bad_alloc();
+
+#if defined(MADV_HUGEPAGE)
+			// A kernel without transparent huge pages rejects the advice and keeps regular pages.
+			::madvise(aligned, mapped_size, MADV_HUGEPAGE);
+#endif
+
+			base = aligned;
+		}
+
+		new (base) Header{ size, mapped_size, kind };
+
+		return static_cast<BytePtr>(base) + HEADER_SIZE;
+	}
+	FORGE_FORCE_INLINE VoidPtr HugePageAllocationPolicy::_allocate_heap(Size size, Size alignment)
+	{
+		U8 kind = alignment <= alignof(::std::max_align_t) ? HEAP_BLOCK : ALIGNED_HEAP_BLOCK;
+
+		VoidPtr base = kind == HEAP_BLOCK
+			? ::std::malloc(HEADER_SIZE + size)
+			: ::std::aligned_alloc(HEADER_SIZE, (HEADER_SIZE + size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1));
+
+		if (!base)
+			throw ::std::bad_alloc();
+
+		new (base) Header{ size, 0, kind };
+
+		return static_cast<BytePtr>(base) + HEADER_SIZE;
+	}
+}
+
+#endif
\ No newline at end of file
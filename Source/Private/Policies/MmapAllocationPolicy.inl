@@ -0,0 +1,199 @@
+#ifndef MMAP_ALLOCATION_POLICY_INL_HPP
+#define MMAP_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/MmapAllocationPolicy.hpp"
+
+#include <new>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE MmapAllocationPolicy::MmapAllocationPolicy()
+		: m_file(-1), m_read_only(false), m_data(nullptr), m_size(0), m_release_size(NO_TRUNCATION) {}
+	FORGE_FORCE_INLINE MmapAllocationPolicy::MmapAllocationPolicy(const Char* path, Bool read_only)
+		: m_file(-1), m_read_only(read_only), m_data(nullptr), m_size(0), m_release_size(NO_TRUNCATION)
+	{
+		this->m_file = ::open(path, read_only ? O_RDONLY | O_CLOEXEC : O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+		if (this->m_file < 0)
+			throw ::std::system_error(errno, ::std::generic_category(), "The file could not be opened");
+	}
+
+	FORGE_FORCE_INLINE MmapAllocationPolicy::~MmapAllocationPolicy()
+	{
+		this->Deallocate(this->m_data);
+
+		if (this->m_file >= 0)
+			::close(this->m_file);
+	}
+
+	FORGE_FORCE_INLINE Bool MmapAllocationPolicy::IsReadOnly() const
+	{
+		return this->m_read_only;
+	}
+	FORGE_FORCE_INLINE Size MmapAllocationPolicy::GetMappedSize() const
+	{
+		return this->m_size;
+	}
+	FORGE_FORCE_INLINE Size MmapAllocationPolicy::GetFileSize() const
+	{
+		if (this->m_file < 0)
+			return 0;
+
+		struct stat status;
+
+		if (::fstat(this->m_file, &status) != 0)
+			throw ::std::system_error(errno, ::std::generic_category(), "The file could not be queried");
+
+		return static_cast<Size>(status.st_size);
+	}
+
+	FORGE_FORCE_INLINE VoidPtr MmapAllocationPolicy::MapFile(Size& size)
+	{
+		size = this->GetFileSize();
+
+		return this->Allocate(size, 1);
+	}
+
+	FORGE_FORCE_INLINE VoidPtr MmapAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		if (this->m_data)
+			throw ::std::logic_error("The mapping policy already holds an allocation");
+
+		if (alignment > _page_size())
+			throw ::std::invalid_argument("The alignment must not exceed the page size");
+
+		if (size == 0)
+			return nullptr;
+
+		this->_grow_file(size);
+
+		// A read-only file is mapped privately, so the pages stay shared with the page cache until
+		// they are written to.
+		I32 flags = this->m_file < 0 ? MAP_PRIVATE | MAP_ANONYMOUS : this->m_read_only ? MAP_PRIVATE : MAP_SHARED;
+		VoidPtr data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, this->m_file, 0);
+
+		if (data == MAP_FAILED)
+			throw ::std::bad_alloc();
+
+		this->m_data = static_cast<BytePtr>(data);
+		this->m_size = size;
+
+		return data;
+	}
+	FORGE_FORCE_INLINE VoidPtr MmapAllocationPolicy::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		if (size == 0)
+		{
+			this->Deallocate(pointer);
+
+			return nullptr;
+		}
+
+		this->_grow_file(size);
+
+		// The kernel moves the page table entries, so growing never copies the contents.
+		VoidPtr data = ::mremap(this->m_data, this->m_size, size, MREMAP_MAYMOVE);
+
+		if (data == MAP_FAILED)
+			throw ::std::bad_alloc();
+
+		this->m_data = static_cast<BytePtr>(data);
+		this->m_size = size;
+
+		return data;
+	}
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		::munmap(this->m_data, this->m_size);
+
+		this->m_data = nullptr;
+		this->m_size = 0;
+
+		if (this->m_release_size != NO_TRUNCATION && this->m_file >= 0 && !this->m_read_only)
+		{
+			// Nothing can report a failure from here, and the untrimmed file is still valid.
+			static_cast<Void>(::ftruncate(this->m_file, static_cast<off_t>(this->m_release_size)));
+
+			this->m_release_size = NO_TRUNCATION;
+		}
+	}
+
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::Sync(Size offset, Size size, Bool wait)
+	{
+		BytePtr first;
+		Size length;
+
+		this->_page_range(offset, size, first, length);
+
+		if (length != 0 && ::msync(first, length, wait ? MS_SYNC : MS_ASYNC) != 0)
+			throw ::std::system_error(errno, ::std::generic_category(), "The range could not be synchronized");
+	}
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::Advise(Size offset, Size size, I32 advice)
+	{
+		BytePtr first;
+		Size length;
+
+		this->_page_range(offset, size, first, length);
+
+		if (length != 0 && ::madvise(first, length, advice) != 0)
+			throw ::std::system_error(errno, ::std::generic_category(), "The advice was rejected");
+	}
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::TruncateOnRelease(Size size)
+	{
+		this->m_release_size = size;
+	}
+
+	FORGE_FORCE_INLINE Size MmapAllocationPolicy::_page_size()
+	{
+		static const Size page_size = static_cast<Size>(::sysconf(_SC_PAGESIZE));
+
+		return page_size;
+	}
+
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::_grow_file(Size size)
+	{
+		if (this->m_file < 0)
+			return;
+
+		if (this->GetFileSize() >= size)
+			return;
+
+		// Pages past the end of a file fault on access, so a private mapping cannot outgrow it.
+		if (this->m_read_only)
+			throw ::std::length_error("A read-only mapping cannot grow past the end of its file");
+
+		if (::ftruncate(this->m_file, static_cast<off_t>(size)) != 0)
+			throw ::std::bad_alloc();
+	}
+	FORGE_FORCE_INLINE Void MmapAllocationPolicy::_page_range(Size offset, Size size, BytePtr& first, Size& length) const
+	{
+		if (offset >= this->m_size)
+		{
+			first = this->m_data;
+			length = 0;
+
+			return;
+		}
+
+		Size last = size < this->m_size - offset ? offset + size : this->m_size;
+		Size start = offset & ~(_page_size() - 1);
+
+		first = this->m_data + start;
+		length = last - start;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,219 @@
+#ifndef NUMA_ALLOCATION_POLICY_INL_HPP
+#define NUMA_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/NumaAllocationPolicy.hpp"
+
+#include <new>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+namespace Forge
+{
+	template<typename InCallable>
+	Void NumaAllocationPolicy::_parse_list(const Char* path, InCallable callable)
+	{
+		::std::FILE* file = ::std::fopen(path, "r");
+
+		if (!file)
+			return;
+
+		Char text[4096];
+		Size length = ::std::fread(text, 1, sizeof(text) - 1, file);
+
+		::std::fclose(file);
+
+		text[length] = '\0';
+
+		// Lists are comma separated ranges such as "0-3,8-11", where a range may be a single value.
+		for (Char* cursor = text; *cursor >= '0' && *cursor <= '9';)
+		{
+			Size first = ::std::strtoull(cursor, &cursor, 10);
+			Size last = first;
+
+			if (*cursor == '-')
+				last = ::std::strtoull(cursor + 1, &cursor, 10);
+
+			callable(first, last);
+
+			if (*cursor == ',')
+				cursor++;
+		}
+	}
+
+	FORGE_FORCE_INLINE NumaAllocationPolicy::Topology::Topology()
+		: node_count(1)
+	{
+		for (Size cpu = 0; cpu < MAXIMUM_CPU_COUNT; cpu++)
+			this->cpu_nodes[cpu] = 0;
+
+		_parse_list("/sys/devices/system/node/online", [this](Size, Size last)
+		{
+			if (last + 1 > this->node_count)
+				this->node_count = last + 1 < MAXIMUM_NODE_COUNT ? last + 1 : MAXIMUM_NODE_COUNT;
+		});
+
+		for (Size node = 0; node < this->node_count; node++)
+		{
+			Char path[64];
+
+			::std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%zu/cpulist", node);
+
+			_parse_list(path, [this, node](Size first, Size last)
+			{
+				for (Size cpu = first; cpu <= last && cpu < MAXIMUM_CPU_COUNT; cpu++)
+					this->cpu_nodes[cpu] = static_cast<U16>(node);
+			});
+		}
+	}
+
+	FORGE_FORCE_INLINE NumaAllocationPolicy::NumaAllocationPolicy(U8 placement, U64 node_mask)
+		: m_placement(placement), m_node_mask(_existing_nodes(node_mask))
+	{
+		if (placement > PLACEMENT_BIND)
+			throw ::std::invalid_argument("The placement is unknown");
+
+		if (placement != PLACEMENT_LOCAL && this->m_node_mask == 0)
+			throw ::std::invalid_argument("The node mask holds no existing node");
+	}
+
+	FORGE_FORCE_INLINE U8 NumaAllocationPolicy::GetPlacement() const
+	{
+		return this->m_placement;
+	}
+	FORGE_FORCE_INLINE U64 NumaAllocationPolicy::GetNodeMask() const
+	{
+		return this->m_node_mask;
+	}
+
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetNodeCount()
+	{
+		return _topology().node_count;
+	}
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::GetCurrentNode()
+	{
+		// sched_getcpu goes through the vDSO, so this costs no system call.
+		I32 cpu = ::sched_getcpu();
+
+		if (cpu < 0 || static_cast<Size>(cpu) >= MAXIMUM_CPU_COUNT)
+			return 0;
+
+		return _topology().cpu_nodes[cpu];
+	}
+	FORGE_FORCE_INLINE Bool NumaAllocationPolicy::SetThreadPlacement(U8 placement, U64 node_mask)
+	{
+		U64 mask = _existing_nodes(node_mask);
+
+		switch (placement)
+		{
+		case PLACEMENT_LOCAL:
+			return ::syscall(SYS_set_mempolicy, static_cast<long>(MODE_PREFERRED), nullptr, 0L) == 0;
+		case PLACEMENT_INTERLEAVE:
+			return mask != 0 && ::syscall(SYS_set_mempolicy, static_cast<long>(MODE_INTERLEAVE), &mask, MAXIMUM_NODE_COUNT + 1) == 0;
+		case PLACEMENT_BIND:
+			return mask != 0 && ::syscall(SYS_set_mempolicy, static_cast<long>(MODE_BIND), &mask, MAXIMUM_NODE_COUNT + 1) == 0;
+		default:
+			return false;
+		}
+	}
+
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		Size mapped_size = _mapped_size(size);
+		VoidPtr base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (base == MAP_FAILED)
+			throw ::std::bad_alloc();
+
+		// The policy must be in place before the header touches the first page.
+		this->_bind(base, mapped_size);
+
+		new (base) Header{ mapped_size };
+
+		return static_cast<BytePtr>(base) + HEADER_SIZE;
+	}
+	FORGE_FORCE_INLINE VoidPtr NumaAllocationPolicy::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		Header* header = reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+		Size mapped_size = _mapped_size(size);
+
+		if (mapped_size == header->mapped_size)
+			return pointer;
+
+		VoidPtr base = ::mremap(header, header->mapped_size, mapped_size, MREMAP_MAYMOVE);
+
+		if (base == MAP_FAILED)
+			throw ::std::bad_alloc();
+
+		// A mapping keeps its policy when it moves or grows, binding it again only covers kernels
+		// that start the grown part with the default policy.
+		this->_bind(base, mapped_size);
+
+		header = static_cast<Header*>(base);
+		header->mapped_size = mapped_size;
+
+		return static_cast<BytePtr>(base) + HEADER_SIZE;
+	}
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		Header* header = reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+
+		::munmap(header, header->mapped_size);
+	}
+
+	FORGE_FORCE_INLINE const NumaAllocationPolicy::Topology& NumaAllocationPolicy::_topology()
+	{
+		static const Topology topology;
+
+		return topology;
+	}
+	FORGE_FORCE_INLINE Size NumaAllocationPolicy::_mapped_size(Size size)
+	{
+		static const Size page_size = static_cast<Size>(::sysconf(_SC_PAGESIZE));
+
+		return (HEADER_SIZE + size + page_size - 1) & ~(page_size - 1);
+	}
+	FORGE_FORCE_INLINE U64 NumaAllocationPolicy::_existing_nodes(U64 node_mask)
+	{
+		Size node_count = GetNodeCount();
+
+		// Kernels built for fewer nodes than the mask holds reject bits past their last node.
+		return node_count >= 64 ? node_mask : node_mask & ((U64(1) << node_count) - 1);
+	}
+
+	FORGE_FORCE_INLINE Void NumaAllocationPolicy::_bind(VoidPtr address, Size size) const
+	{
+		// A rejected policy leaves the default placement, which is still correct memory.
+		switch (this->m_placement)
+		{
+		case PLACEMENT_LOCAL:
+			::syscall(SYS_mbind, address, size, static_cast<long>(MODE_PREFERRED), nullptr, 0L, 0L);
+			break;
+		case PLACEMENT_INTERLEAVE:
+			::syscall(SYS_mbind, address, size, static_cast<long>(MODE_INTERLEAVE), &this->m_node_mask, MAXIMUM_NODE_COUNT + 1, 0L);
+			break;
+		default:
+			::syscall(SYS_mbind, address, size, static_cast<long>(MODE_BIND), &this->m_node_mask, MAXIMUM_NODE_COUNT + 1, 0L);
+			break;
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,173 @@
+#ifndef STACK_ALLOCATION_POLICY_INL_HPP
+#define STACK_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/StackAllocationPolicy.hpp"
+
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE StackAllocationPolicy::Marker::Marker(StackAllocationPolicy& stack)
+		: m_stack(&stack), m_top(stack.m_top), m_last(stack.m_last) {}
+
+	FORGE_FORCE_INLINE StackAllocationPolicy::Marker::~Marker()
+	{
+		this->m_stack->Rewind(*this);
+	}
+
+	FORGE_FORCE_INLINE StackAllocationPolicy::StackAllocationPolicy(Size capacity)
+		: m_buffer(static_cast<BytePtr>(::std::malloc(capacity))), m_capacity(capacity), m_top(0), m_last(NO_BLOCK)
+	{
+		if (!this->m_buffer && capacity > 0)
+			throw ::std::bad_alloc();
+	}
+
+	FORGE_FORCE_INLINE StackAllocationPolicy::~StackAllocationPolicy()
+	{
+		::std::free(this->m_buffer);
+	}
+
+	FORGE_FORCE_INLINE Size StackAllocationPolicy::GetCapacity() const
+	{
+		return this->m_capacity;
+	}
+	FORGE_FORCE_INLINE Size StackAllocationPolicy::GetUsedSize() const
+	{
+		return this->m_top;
+	}
+
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Rewind(const Marker& marker)
+	{
+		this->m_top = marker.m_top;
+		this->m_last = marker.m_last;
+
+		// Blocks below the marker may have been released while it was alive.
+		this->_pop_released();
+	}
+
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		alignment = _alignment(alignment);
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(this->m_buffer);
+		uintptr_t block = (base + this->m_top + HEADER_SIZE + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+		Size offset = static_cast<Size>(block - base);
+
+		if (size > this->m_capacity || offset > this->m_capacity - size)
+			return this->_allocate_heap(size, alignment);
+
+		new (this->m_buffer + offset - HEADER_SIZE) Header{ this->m_top, this->m_last, size, STACK_BLOCK };
+
+		this->m_last = offset - HEADER_SIZE;
+		this->m_top = offset + size;
+
+		return this->m_buffer + offset;
+	}
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		alignment = _alignment(alignment);
+
+		Header* header = _header(pointer);
+		Size offset = static_cast<Size>(reinterpret_cast<uintptr_t>(pointer) - reinterpret_cast<uintptr_t>(this->m_buffer));
+
+		Bool on_top = header->kind == STACK_BLOCK && offset - HEADER_SIZE == this->m_last;
+
+		if (on_top && reinterpret_cast<uintptr_t>(pointer) % alignment == 0 && size <= this->m_capacity - offset)
+		{
+			header->size = size;
+
+			this->m_top = offset + size;
+
+			return pointer;
+		}
+
+		VoidPtr result = this->Allocate(size, alignment);
+
+		::std::memcpy(result, pointer, header->size < size ? header->size : size);
+
+		this->Deallocate(pointer);
+
+		return result;
+	}
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		Header* header = _header(pointer);
+
+		if (header->kind == HEAP_BLOCK)
+		{
+			::std::free(static_cast<BytePtr>(pointer) - header->start);
+
+			return;
+		}
+
+		header->kind = RELEASED_BLOCK;
+
+		this->_pop_released();
+	}
+
+	FORGE_FORCE_INLINE Allocator<StackAllocationPolicy>* StackAllocationPolicy::GetThreadScratch()
+	{
+		thread_local Allocator<StackAllocationPolicy> scratch(SCRATCH_CAPACITY);
+
+		return &scratch;
+	}
+
+	template<>
+	FORGE_FORCE_INLINE Allocator<StackAllocationPolicy>* GetDefaultAllocator<Allocator<StackAllocationPolicy>>()
+	{
+		return StackAllocationPolicy::GetThreadScratch();
+	}
+
+	FORGE_FORCE_INLINE StackAllocationPolicy::Header* StackAllocationPolicy::_header(VoidPtr pointer)
+	{
+		return reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+	}
+	FORGE_FORCE_INLINE Size StackAllocationPolicy::_alignment(Size alignment)
+	{
+		// Headers sit right below their blocks, so blocks are at least aligned like a header.
+		return alignment > alignof(Header) ? alignment : alignof(Header);
+	}
+
+	FORGE_FORCE_INLINE VoidPtr StackAllocationPolicy::_allocate_heap(Size size, Size alignment)
+	{
+		if (size > SIZE_MAX - HEADER_SIZE - alignment)
+			throw ::std::bad_alloc();
+
+		BytePtr raw = static_cast<BytePtr>(::std::malloc(size + HEADER_SIZE + alignment));
+
+		if (!raw)
+			throw ::std::bad_alloc();
+
+		uintptr_t block = (reinterpret_cast<uintptr_t>(raw) + HEADER_SIZE + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+		BytePtr pointer = reinterpret_cast<BytePtr>(block);
+
+		// The start of a heap block is its distance from the address to free.
+		new (pointer - HEADER_SIZE) Header{ static_cast<Size>(pointer - raw), NO_BLOCK, size, HEAP_BLOCK };
+
+		return pointer;
+	}
+	FORGE_FORCE_INLINE Void StackAllocationPolicy::_pop_released()
+	{
+		while (this->m_last != NO_BLOCK)
+		{
+			Header* header = reinterpret_cast<Header*>(this->m_buffer + this->m_last);
+
+			if (header->kind != RELEASED_BLOCK)
+				break;
+
+			this->m_top = header->start;
+			this->m_last = header->previous;
+		}
+	}
+}
+
+#endif
\ No newline at end of file
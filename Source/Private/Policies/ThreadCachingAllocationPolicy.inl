@@ -0,0 +1,320 @@
+#ifndef THREAD_CACHING_ALLOCATION_POLICY_INL_HPP
+#define THREAD_CACHING_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/ThreadCachingAllocationPolicy.hpp"
+
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE ThreadCachingAllocationPolicy::ThreadCache::ThreadCache()
+		: lists{}
+	{
+		_cache_state() = CACHE_ALIVE;
+	}
+	FORGE_FORCE_INLINE ThreadCachingAllocationPolicy::ThreadCache::~ThreadCache()
+	{
+		for (Size size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+			_flush(this->lists[size_class], size_class, this->lists[size_class].count);
+
+		_cache_state() = CACHE_DESTROYED;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr ThreadCachingAllocationPolicy::Allocate(Size size, Size alignment)
+	{
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		Size size_class = _size_class(size);
+		BytePtr block;
+
+		if (size_class == LARGE_CLASS)
+		{
+			if (size > SIZE_MAX - HEADER_SIZE)
+				throw ::std::bad_alloc();
+
+			block = static_cast<BytePtr>(::std::malloc(HEADER_SIZE + size));
+
+			if (!block)
+				throw ::std::bad_alloc();
+		}
+		else if (ThreadCache* cache = _thread_cache())
+		{
+			block = static_cast<BytePtr>(_pop(cache->lists[size_class], size_class));
+		}
+		else
+		{
+			// The cache of this thread is already destroyed, so the block goes through the pool.
+			FreeList list{};
+
+			block = static_cast<BytePtr>(_pop(list, size_class));
+
+			_flush(list, size_class, list.count);
+		}
+
+		new (block) Header{ size_class, size };
+
+		return block + HEADER_SIZE;
+	}
+	FORGE_FORCE_INLINE VoidPtr ThreadCachingAllocationPolicy::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		if (alignment > HEADER_SIZE)
+			throw ::std::invalid_argument("The alignment must not exceed the header size");
+
+		Header* header = reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+		Size size_class = _size_class(size);
+
+		if (size_class == header->size_class && size_class != LARGE_CLASS)
+		{
+			header->size = size;
+
+			return pointer;
+		}
+
+		if (size_class == LARGE_CLASS && header->size_class == LARGE_CLASS)
+		{
+			if (size > SIZE_MAX - HEADER_SIZE)
+				throw ::std::bad_alloc();
+
+			BytePtr block = static_cast<BytePtr>(::std::realloc(header, HEADER_SIZE + size));
+
+			if (!block)
+				throw ::std::bad_alloc();
+
+			reinterpret_cast<Header*>(block)->size = size;
+
+			return block + HEADER_SIZE;
+		}
+
+		VoidPtr result = this->Allocate(size, alignment);
+
+		::std::memcpy(result, pointer, header->size < size ? header->size : size);
+
+		this->Deallocate(pointer);
+
+		return result;
+	}
+	FORGE_FORCE_INLINE Void ThreadCachingAllocationPolicy::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		BytePtr block = static_cast<BytePtr>(pointer) - HEADER_SIZE;
+		Size size_class = reinterpret_cast<Header*>(block)->size_class;
+
+		if (size_class == LARGE_CLASS)
+		{
+			::std::free(block);
+		}
+		else if (ThreadCache* cache = _thread_cache())
+		{
+			FreeList& list = cache->lists[size_class];
+
+			_push(list, block);
+
+			if (list.count >= 2 * _batch_count(size_class))
+				_flush(list, size_class, _batch_count(size_class));
+		}
+		else
+		{
+			FreeList list{};
+
+			_push(list, block);
+			_flush(list, size_class, 1);
+		}
+	}
+
+	FORGE_FORCE_INLINE Void ThreadCachingAllocationPolicy::Flush()
+	{
+		if (ThreadCache* cache = _thread_cache())
+		{
+			for (Size size_class = 0; size_class < SIZE_CLASS_COUNT; size_class++)
+				_flush(cache->lists[size_class], size_class, cache->lists[size_class].count);
+		}
+	}
+	FORGE_FORCE_INLINE Size ThreadCachingAllocationPolicy::GetPooledCount(Size size)
+	{
+		Size size_class = _size_class(size);
+
+		if (size_class == LARGE_CLASS)
+			return 0;
+
+		Pool& pool = _pools()[size_class];
+		::std::lock_guard<::std::mutex> lock(pool.mutex);
+
+		return pool.count;
+	}
+
+	FORGE_FORCE_INLINE Size ThreadCachingAllocationPolicy::_size_class(Size size)
+	{
+		if (size > MAXIMUM_CACHED_SIZE)
+			return LARGE_CLASS;
+
+		Size block_size = size + HEADER_SIZE;
+
+		if (block_size <= MINIMUM_BLOCK_SIZE)
+			return 0;
+
+		return BitWidth(block_size - 1) - BitWidth(MINIMUM_BLOCK_SIZE - 1);
+	}
+	FORGE_FORCE_INLINE Size ThreadCachingAllocationPolicy::_block_size(Size size_class)
+	{
+		return MINIMUM_BLOCK_SIZE << size_class;
+	}
+	FORGE_FORCE_INLINE Size ThreadCachingAllocationPolicy::_batch_count(Size size_class)
+	{
+		Size count = BATCH_BYTES / _block_size(size_class);
+
+		if (count < 2)
+			return 2;
+
+		return count < MAXIMUM_BATCH_COUNT ? count : MAXIMUM_BATCH_COUNT;
+	}
+
+	FORGE_FORCE_INLINE ThreadCachingAllocationPolicy::Pool* ThreadCachingAllocationPolicy::_pools()
+	{
+		// The pools are never destroyed, so that containers destroyed by static destructors can
+		// still release their blocks.
+		static Pool* pools = new Pool[SIZE_CLASS_COUNT]();
+
+		return pools;
+	}
+	FORGE_FORCE_INLINE U8& ThreadCachingAllocationPolicy::_cache_state()
+	{
+		// Trivially destructible, so it stays readable while other thread-local destructors run.
+		thread_local U8 state = CACHE_UNINITIALIZED;
+
+		return state;
+	}
+	FORGE_FORCE_INLINE ThreadCachingAllocationPolicy::ThreadCache* ThreadCachingAllocationPolicy::_thread_cache()
+	{
+		if (_cache_state() == CACHE_DESTROYED)
+			return nullptr;
+
+		thread_local ThreadCache cache;
+
+		return &cache;
+	}
+
+	FORGE_FORCE_INLINE VoidPtr ThreadCachingAllocationPolicy::_pop(FreeList& list, Size size_class)
+	{
+		if (list.count == 0)
+			_refill(list, size_class);
+
+		VoidPtr block = list.head;
+
+		list.head = *static_cast<VoidPtr*>(block);
+		list.count--;
+
+		if (!list.head)
+			list.tail = nullptr;
+
+		return block;
+	}
+	FORGE_FORCE_INLINE Void ThreadCachingAllocationPolicy::_push(FreeList& list, VoidPtr block)
+	{
+		*static_cast<VoidPtr*>(block) = list.head;
+
+		if (!list.head)
+			list.tail = block;
+
+		list.head = block;
+		list.count++;
+	}
+	FORGE_FORCE_INLINE Void ThreadCachingAllocationPolicy::_refill(FreeList& list, Size size_class)
+	{
+		Size batch_count = _batch_count(size_class);
+		Pool& pool = _pools()[size_class];
+
+		{
+			::std::lock_guard<::std::mutex> lock(pool.mutex);
+
+			if (pool.count > 0)
+			{
+				Size count = pool.count < batch_count ? pool.count : batch_count;
+				VoidPtr tail = pool.head;
+
+				for (Size index = 1; index < count; index++)
+					tail = *static_cast<VoidPtr*>(tail);
+
+				list.head = pool.head;
+				list.tail = tail;
+				list.count = count;
+
+				pool.head = *static_cast<VoidPtr*>(tail);
+				pool.count -= count;
+
+				*static_cast<VoidPtr*>(tail) = nullptr;
+
+				return;
+			}
+		}
+
+		// The pool is empty, so a new chunk is carved into a whole batch outside the lock.
+		Size block_size = _block_size(size_class);
+		BytePtr chunk = static_cast<BytePtr>(::std::malloc(batch_count * block_size));
+
+		if (!chunk)
+			throw ::std::bad_alloc();
+
+		for (Size index = 0; index + 1 < batch_count; index++)
+			*reinterpret_cast<VoidPtr*>(chunk + index * block_size) = chunk + (index + 1) * block_size;
+
+		*reinterpret_cast<VoidPtr*>(chunk + (batch_count - 1) * block_size) = nullptr;
+
+		list.head = chunk;
+		list.tail = chunk + (batch_count - 1) * block_size;
+		list.count = batch_count;
+	}
+	FORGE_FORCE_INLINE Void ThreadCachingAllocationPolicy::_flush(FreeList& list, Size size_class, Size count)
+	{
+		if (count == 0)
+			return;
+
+		// The most recently released blocks stay at the head of the list while they are still
+		// warm in the cache, so the coldest ones at the tail are flushed.
+		Size keep_count = list.count - count;
+		VoidPtr first;
+		VoidPtr last = list.tail;
+
+		if (keep_count == 0)
+		{
+			first = list.head;
+
+			list.head = nullptr;
+			list.tail = nullptr;
+		}
+		else
+		{
+			VoidPtr split = list.head;
+
+			for (Size index = 1; index < keep_count; index++)
+				split = *static_cast<VoidPtr*>(split);
+
+			first = *static_cast<VoidPtr*>(split);
+
+			*static_cast<VoidPtr*>(split) = nullptr;
+
+			list.tail = split;
+		}
+
+		list.count = keep_count;
+
+		Pool& pool = _pools()[size_class];
+		::std::lock_guard<::std::mutex> lock(pool.mutex);
+
+		*static_cast<VoidPtr*>(last) = pool.head;
+
+		pool.head = first;
+		pool.count += count;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,337 @@
+#ifndef TRACKING_ALLOCATION_POLICY_INL_HPP
+#define TRACKING_ALLOCATION_POLICY_INL_HPP
+
+#include "Policies/TrackingAllocationPolicy.hpp"
+
+#include <new>
+#include <cstring>
+#include <stdexcept>
+
+namespace Forge
+{
+	FORGE_FORCE_INLINE AllocationTracker::ThreadRecord::ThreadRecord()
+		: counters{}, previous(nullptr), next(nullptr)
+	{
+		Registry& registry = _registry();
+		::std::lock_guard<::std::mutex> lock(registry.mutex);
+
+		this->next = registry.threads;
+
+		if (registry.threads)
+			registry.threads->previous = this;
+
+		registry.threads = this;
+
+		_record_state() = RECORD_ALIVE;
+	}
+	FORGE_FORCE_INLINE AllocationTracker::ThreadRecord::~ThreadRecord()
+	{
+		Registry& registry = _registry();
+		::std::lock_guard<::std::mutex> lock(registry.mutex);
+
+		// The counts of an exiting thread move to its tags, so snapshots keep them.
+		for (Size tag = 0; tag < MAXIMUM_TAG_COUNT; tag++)
+		{
+			Counters& counters = this->counters[tag];
+			TagRecord& record = registry.tags[tag];
+
+			_publish(tag, counters.pending_bytes.load(::std::memory_order_relaxed));
+
+			record.allocation_count.fetch_add(counters.allocation_count.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+			record.reallocation_count.fetch_add(counters.reallocation_count.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+			record.deallocation_count.fetch_add(counters.deallocation_count.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+		}
+
+		if (this->previous)
+			this->previous->next = this->next;
+		else
+			registry.threads = this->next;
+
+		if (this->next)
+			this->next->previous = this->previous;
+
+		_record_state() = RECORD_DESTROYED;
+	}
+
+	FORGE_FORCE_INLINE Size AllocationTracker::RegisterTag(const Char* tag)
+	{
+		Size length = ::std::strlen(tag);
+
+		if (length > MAXIMUM_TAG_LENGTH)
+			throw ::std::length_error("The tag is too long");
+
+		Registry& registry = _registry();
+		::std::lock_guard<::std::mutex> lock(registry.mutex);
+
+		Size tag_count = registry.tag_count.load(::std::memory_order_relaxed);
+
+		for (Size index = 0; index < tag_count; index++)
+		{
+			if (::std::strcmp(registry.tags[index].name, tag) == 0)
+				return index;
+		}
+
+		if (tag_count == MAXIMUM_TAG_COUNT)
+			throw ::std::length_error("The tracker cannot register more tags");
+
+		::std::memcpy(registry.tags[tag_count].name, tag, length + 1);
+
+		registry.tag_count.store(tag_count + 1, ::std::memory_order_release);
+
+		return tag_count;
+	}
+
+	FORGE_FORCE_INLINE Void AllocationTracker::RecordAllocation(Size tag, Size size)
+	{
+		if (ThreadRecord* thread_record = _thread_record())
+		{
+			Counters& counters = thread_record->counters[tag];
+
+			_add(counters.allocation_count, 1);
+			_change(counters, tag, static_cast<I64>(size));
+		}
+		else
+		{
+			_registry().tags[tag].allocation_count.fetch_add(1, ::std::memory_order_relaxed);
+			_publish(tag, static_cast<I64>(size));
+		}
+	}
+	FORGE_FORCE_INLINE Void AllocationTracker::RecordReallocation(Size tag, Size old_size, Size new_size)
+	{
+		I64 delta = static_cast<I64>(new_size) - static_cast<I64>(old_size);
+
+		if (ThreadRecord* thread_record = _thread_record())
+		{
+			Counters& counters = thread_record->counters[tag];
+
+			_add(counters.reallocation_count, 1);
+			_change(counters, tag, delta);
+		}
+		else
+		{
+			_registry().tags[tag].reallocation_count.fetch_add(1, ::std::memory_order_relaxed);
+			_publish(tag, delta);
+		}
+	}
+	FORGE_FORCE_INLINE Void AllocationTracker::RecordDeallocation(Size tag, Size size)
+	{
+		if (ThreadRecord* thread_record = _thread_record())
+		{
+			Counters& counters = thread_record->counters[tag];
+
+			_add(counters.deallocation_count, 1);
+			_change(counters, tag, -static_cast<I64>(size));
+		}
+		else
+		{
+			_registry().tags[tag].deallocation_count.fetch_add(1, ::std::memory_order_relaxed);
+			_publish(tag, -static_cast<I64>(size));
+		}
+	}
+
+	FORGE_FORCE_INLINE Size AllocationTracker::Snapshot(AllocationStatistics* statistics, Size capacity)
+	{
+		Registry& registry = _registry();
+		::std::lock_guard<::std::mutex> lock(registry.mutex);
+
+		Size tag_count = registry.tag_count.load(::std::memory_order_relaxed);
+
+		for (Size tag = 0; tag < tag_count && tag < capacity; tag++)
+			statistics[tag] = _statistics(tag);
+
+		return tag_count;
+	}
+	FORGE_FORCE_INLINE AllocationStatistics AllocationTracker::GetStatistics(const Char* tag)
+	{
+		Registry& registry = _registry();
+		::std::lock_guard<::std::mutex> lock(registry.mutex);
+
+		Size tag_count = registry.tag_count.load(::std::memory_order_relaxed);
+
+		for (Size index = 0; index < tag_count; index++)
+		{
+			if (::std::strcmp(registry.tags[index].name, tag) == 0)
+				return _statistics(index);
+		}
+
+		throw ::std::out_of_range("The tag is not registered");
+	}
+
+	FORGE_FORCE_INLINE AllocationTracker::Registry& AllocationTracker::_registry()
+	{
+		// The registry is never destroyed, so that containers destroyed by static destructors can
+		// still report their releases.
+		static Registry* registry = new Registry();
+
+		return *registry;
+	}
+	FORGE_FORCE_INLINE U8& AllocationTracker::_record_state()
+	{
+		thread_local U8 state = RECORD_UNINITIALIZED;
+
+		return state;
+	}
+	FORGE_FORCE_INLINE AllocationTracker::ThreadRecord* AllocationTracker::_thread_record()
+	{
+		if (_record_state() == RECORD_DESTROYED)
+			return nullptr;
+
+		thread_local ThreadRecord record;
+
+		return &record;
+	}
+
+	FORGE_FORCE_INLINE Void AllocationTracker::_add(::std::atomic<U64>& counter, U64 value)
+	{
+		// Only the owning thread writes its counters, so a plain load and store suffice.
+		counter.store(counter.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+	}
+	FORGE_FORCE_INLINE Void AllocationTracker::_change(Counters& counters, Size tag, I64 delta)
+	{
+		I64 pending_bytes = counters.pending_bytes.load(::std::memory_order_relaxed) + delta;
+
+		if (pending_bytes >= PUBLISH_BYTES || pending_bytes <= -PUBLISH_BYTES)
+		{
+			_publish(tag, pending_bytes);
+
+			pending_bytes = 0;
+		}
+
+		counters.pending_bytes.store(pending_bytes, ::std::memory_order_relaxed);
+	}
+	FORGE_FORCE_INLINE Void AllocationTracker::_publish(Size tag, I64 delta)
+	{
+		TagRecord& record = _registry().tags[tag];
+
+		_raise_peak(record, record.live_bytes.fetch_add(delta, ::std::memory_order_relaxed) + delta);
+	}
+	FORGE_FORCE_INLINE Void AllocationTracker::_raise_peak(TagRecord& record, I64 live_bytes)
+	{
+		I64 peak_bytes = record.peak_bytes.load(::std::memory_order_relaxed);
+
+		while (live_bytes > peak_bytes && !record.peak_bytes.compare_exchange_weak(peak_bytes, live_bytes, ::std::memory_order_relaxed));
+	}
+	FORGE_FORCE_INLINE AllocationStatistics AllocationTracker::_statistics(Size tag)
+	{
+		Registry& registry = _registry();
+		TagRecord& record = registry.tags[tag];
+
+		AllocationStatistics statistics;
+
+		statistics.tag = record.name;
+		statistics.live_bytes = record.live_bytes.load(::std::memory_order_relaxed);
+		statistics.allocation_count = record.allocation_count.load(::std::memory_order_relaxed);
+		statistics.reallocation_count = record.reallocation_count.load(::std::memory_order_relaxed);
+		statistics.deallocation_count = record.deallocation_count.load(::std::memory_order_relaxed);
+
+		for (ThreadRecord* thread_record = registry.threads; thread_record; thread_record = thread_record->next)
+		{
+			Counters& counters = thread_record->counters[tag];
+
+			statistics.live_bytes += counters.pending_bytes.load(::std::memory_order_relaxed);
+			statistics.allocation_count += counters.allocation_count.load(::std::memory_order_relaxed);
+			statistics.reallocation_count += counters.reallocation_count.load(::std::memory_order_relaxed);
+			statistics.deallocation_count += counters.deallocation_count.load(::std::memory_order_relaxed);
+		}
+
+		_raise_peak(record, statistics.live_bytes);
+
+		statistics.peak_bytes = record.peak_bytes.load(::std::memory_order_relaxed);
+
+		return statistics;
+	}
+
+	template<typename InInnerPolicy>
+	TrackingAllocationPolicy<InInnerPolicy>::TrackingAllocationPolicy(const Char* tag)
+		: m_inner(), m_tag(AllocationTracker::RegisterTag(tag)) {}
+
+	template<typename InInnerPolicy>
+	template<typename InFirstArgument, typename... InArguments>
+	TrackingAllocationPolicy<InInnerPolicy>::TrackingAllocationPolicy(const Char* tag, InFirstArgument&& first_argument, InArguments&&... arguments)
+		: m_inner(::std::forward<InFirstArgument>(first_argument), ::std::forward<InArguments>(arguments)...), m_tag(AllocationTracker::RegisterTag(tag)) {}
+
+	template<typename InInnerPolicy>
+	FORGE_FORCE_INLINE Size TrackingAllocationPolicy<InInnerPolicy>::GetTag() const
+	{
+		return this->m_tag;
+	}
+	template<typename InInnerPolicy>
+	FORGE_FORCE_INLINE typename TrackingAllocationPolicy<InInnerPolicy>::InnerPolicyTypeLRef TrackingAllocationPolicy<InInnerPolicy>::GetInnerPolicy()
+	{
+		return this->m_inner;
+	}
+	template<typename InInnerPolicy>
+	FORGE_FORCE_INLINE typename TrackingAllocationPolicy<InInnerPolicy>::ConstInnerPolicyTypeLRef TrackingAllocationPolicy<InInnerPolicy>::GetInnerPolicy() const
+	{
+		return this->m_inner;
+	}
+
+	template<typename InInnerPolicy>
+	VoidPtr TrackingAllocationPolicy<InInnerPolicy>::Allocate(Size size, Size alignment)
+	{
+		Size offset = _offset(alignment);
+		BytePtr block = static_cast<BytePtr>(this->m_inner.Allocate(size + offset, alignment)) + offset;
+
+		new (block - HEADER_SIZE) Header{ size, offset };
+
+		AllocationTracker::RecordAllocation(this->m_tag, size);
+
+		return block;
+	}
+	template<typename InInnerPolicy>
+	VoidPtr TrackingAllocationPolicy<InInnerPolicy>::Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		if (!pointer)
+			return this->Allocate(size, alignment);
+
+		Header* header = _header(pointer);
+		Size old_size = header->size;
+		Size offset = header->offset;
+
+		if (offset != _offset(alignment))
+		{
+			// The header would move relative to the block, so the contents are copied instead.
+			VoidPtr result = this->Allocate(size, alignment);
+
+			::std::memcpy(result, pointer, old_size < size ? old_size : size);
+
+			this->Deallocate(pointer);
+
+			return result;
+		}
+
+		BytePtr block = static_cast<BytePtr>(this->m_inner.Reallocate(static_cast<BytePtr>(pointer) - offset, size + offset, alignment)) + offset;
+
+		_header(block)->size = size;
+
+		AllocationTracker::RecordReallocation(this->m_tag, old_size, size);
+
+		return block;
+	}
+	template<typename InInnerPolicy>
+	Void TrackingAllocationPolicy<InInnerPolicy>::Deallocate(VoidPtr pointer)
+	{
+		if (!pointer)
+			return;
+
+		Header* header = _header(pointer);
+
+		AllocationTracker::RecordDeallocation(this->m_tag, header->size);
+
+		this->m_inner.Deallocate(static_cast<BytePtr>(pointer) - header->offset);
+	}
+
+	template<typename InInnerPolicy>
+	FORGE_FORCE_INLINE Size TrackingAllocationPolicy<InInnerPolicy>::_offset(Size alignment)
+	{
+		// An offset that is a multiple of the alignment keeps the block aligned like the inner one.
+		return alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+	}
+	template<typename InInnerPolicy>
+	FORGE_FORCE_INLINE typename TrackingAllocationPolicy<InInnerPolicy>::Header* TrackingAllocationPolicy<InInnerPolicy>::_header(VoidPtr pointer)
+	{
+		return reinterpret_cast<Header*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+	}
+}
+
+#endif
\ No newline at end of file
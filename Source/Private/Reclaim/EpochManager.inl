@@ -0,0 +1,287 @@
+#ifndef EPOCH_MANAGER_INL_HPP
+#define EPOCH_MANAGER_INL_HPP
+
+#include "Reclaim/EpochManager.hpp"
+
+#include <stdexcept>
+
+namespace Forge::Reclaim
+{
+	FORGE_FORCE_INLINE EpochManager::ThreadCache::ThreadCache()
+		: count(0) {}
+	FORGE_FORCE_INLINE EpochManager::ThreadCache::~ThreadCache()
+	{
+		for (Size index = 0; index < this->count; index++)
+			_release_record(this->entries[index].record);
+	}
+
+	FORGE_FORCE_INLINE EpochManager::EpochManager()
+		: m_epoch(0), m_records(nullptr)
+	{
+		static ::std::atomic<U64> next_id(1);
+
+		// Identifiers are never reused, so a thread never mistakes a record of a destroyed manager
+		// for one of a manager allocated at the same address.
+		this->m_id = next_id.fetch_add(1, ::std::memory_order_relaxed);
+	}
+
+	FORGE_FORCE_INLINE EpochManager::~EpochManager()
+	{
+		ThreadRecord* record = this->m_records.load(::std::memory_order_acquire);
+
+		while (record)
+		{
+			ThreadRecord* next = record->next;
+
+			for (Size index = record->head; index < record->retired.GetCount(); index++)
+				record->retired[index].function(record->retired[index].pointer, record->retired[index].context);
+
+			record->retired.Clear();
+			record->head = 0;
+
+			// The threads that still cache the record release it when they exit.
+			if (record->references.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+				delete record;
+
+			record = next;
+		}
+	}
+
+	FORGE_FORCE_INLINE EpochManager::SelfTypeLRef EpochManager::GetDefault()
+	{
+		static EpochManager manager;
+
+		return manager;
+	}
+
+	FORGE_FORCE_INLINE U64 EpochManager::GetEpoch() const
+	{
+		return this->m_epoch.load(::std::memory_order_acquire);
+	}
+	FORGE_FORCE_INLINE Size EpochManager::GetPendingCount()
+	{
+		ThreadRecord* record = this->_acquire_record();
+
+		return record->retired.GetCount() - record->head;
+	}
+
+	FORGE_FORCE_INLINE Guard EpochManager::Pin()
+	{
+		return Guard(*this);
+	}
+
+	template<typename InType, typename InAllocationPolicy>
+	FORGE_FORCE_INLINE Void EpochManager::Retire(InType* object, Allocator<InAllocationPolicy>* allocator)
+	{
+		this->Retire(object, allocator, &_reclaim_object<InType, InAllocationPolicy>);
+	}
+	FORGE_FORCE_INLINE Void EpochManager::Retire(VoidPtr pointer, VoidPtr context, ReclaimFunction function)
+	{
+		ThreadRecord* record = this->_acquire_record();
+
+		// The epoch is read after the object was unlinked, so any thread that can still reach it
+		// is pinned to this epoch or an earlier one.
+		record->retired.PushBack(Retired{ pointer, context, function, this->m_epoch.load(::std::memory_order_seq_cst) });
+
+		if (++record->retire_count % COLLECT_INTERVAL == 0)
+		{
+			this->_try_advance();
+			this->_reclaim(record, RECLAIM_BATCH);
+		}
+	}
+
+	FORGE_FORCE_INLINE Size EpochManager::Collect(Size budget)
+	{
+		ThreadRecord* record = this->_acquire_record();
+
+		this->_try_advance();
+
+		return this->_reclaim(record, budget);
+	}
+
+	template<typename InType, typename InAllocationPolicy>
+	Void EpochManager::_reclaim_object(VoidPtr pointer, VoidPtr context)
+	{
+		static_cast<InType*>(pointer)->~InType();
+		static_cast<Allocator<InAllocationPolicy>*>(context)->Deallocate(pointer);
+	}
+
+	FORGE_FORCE_INLINE EpochManager::ThreadCache& EpochManager::_thread_cache()
+	{
+		static thread_local ThreadCache cache;
+
+		return cache;
+	}
+	FORGE_FORCE_INLINE Void EpochManager::_release_record(ThreadRecord* record)
+	{
+		record->in_use.store(false, ::std::memory_order_release);
+
+		// The last reference belongs to a destroyed manager, which already released the retire list.
+		if (record->references.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+			delete record;
+	}
+
+	FORGE_FORCE_INLINE EpochManager::ThreadRecord* EpochManager::_acquire_record()
+	{
+		ThreadCache& cache = _thread_cache();
+
+		for (Size index = 0; index < cache.count; index++)
+			if (cache.entries[index].manager_id == this->m_id)
+				return cache.entries[index].record;
+
+		if (cache.count == THREAD_CACHE_SIZE)
+		{
+			Size victim = 0;
+
+			// A pinned record must stay with its thread, so only an unpinned one is given up.
+			while (victim < THREAD_CACHE_SIZE && cache.entries[victim].record->nesting != 0)
+				victim++;
+
+			if (victim == THREAD_CACHE_SIZE)
+				throw ::std::length_error("The thread is pinned to too many epoch managers");
+
+			_release_record(cache.entries[victim].record);
+
+			for (Size index = victim + 1; index < cache.count; index++)
+				cache.entries[index - 1] = cache.entries[index];
+
+			cache.count--;
+		}
+
+		ThreadRecord* record = this->m_records.load(::std::memory_order_acquire);
+
+		// Adopts the record of an exited thread, along with whatever it left retired.
+		for (; record; record = record->next)
+		{
+			Bool expected = false;
+
+			if (!record->in_use.load(::std::memory_order_relaxed) && record->in_use.compare_exchange_strong(expected, true, ::std::memory_order_acquire))
+			{
+				record->references.fetch_add(1, ::std::memory_order_relaxed);
+				break;
+			}
+		}
+
+		if (!record)
+		{
+			record = new ThreadRecord();
+
+			record->epoch.store(0, ::std::memory_order_relaxed);
+			record->in_use.store(true, ::std::memory_order_relaxed);
+			record->references.store(2, ::std::memory_order_relaxed);
+			record->nesting = 0;
+			record->retire_count = 0;
+			record->head = 0;
+			record->next = this->m_records.load(::std::memory_order_relaxed);
+
+			while (!this->m_records.compare_exchange_weak(record->next, record, ::std::memory_order_release, ::std::memory_order_relaxed));
+		}
+
+		cache.entries[cache.count++] = ThreadCache::Entry{ this->m_id, record };
+
+		return record;
+	}
+
+	FORGE_FORCE_INLINE Void EpochManager::_enter(ThreadRecord* record)
+	{
+		if (record->nesting++ != 0)
+			return;
+
+		U64 epoch = this->m_epoch.load(::std::memory_order_relaxed);
+
+		// The epoch is read again after the record is published, so a thread that advanced the
+		// epoch in between either sees this record or is seen by it.
+		for (;;)
+		{
+			record->epoch.store((epoch << 1) | PINNED_BIT, ::std::memory_order_seq_cst);
+
+			U64 current = this->m_epoch.load(::std::memory_order_seq_cst);
+
+			if (current == epoch)
+				return;
+
+			epoch = current;
+		}
+	}
+	FORGE_FORCE_INLINE Void EpochManager::_leave(ThreadRecord* record)
+	{
+		if (--record->nesting == 0)
+			record->epoch.store(0, ::std::memory_order_release);
+	}
+
+	FORGE_FORCE_INLINE Bool EpochManager::_try_advance()
+	{
+		U64 epoch = this->m_epoch.load(::std::memory_order_seq_cst);
+
+		for (ThreadRecord* record = this->m_records.load(::std::memory_order_acquire); record; record = record->next)
+		{
+			U64 state = record->epoch.load(::std::memory_order_seq_cst);
+
+			if ((state & PINNED_BIT) && (state >> 1) != epoch)
+				return false;
+		}
+
+		return this->m_epoch.compare_exchange_strong(epoch, epoch + 1, ::std::memory_order_seq_cst);
+	}
+	FORGE_FORCE_INLINE Size EpochManager::_reclaim(ThreadRecord* record, Size budget)
+	{
+		U64 epoch = this->m_epoch.load(::std::memory_order_seq_cst);
+		Size released = 0;
+
+		// Retire lists are in epoch order, so the reclaimable objects form a prefix.
+		while (released < budget && record->head < record->retired.GetCount())
+		{
+			Retired retired = record->retired[record->head];
+
+			if (retired.epoch + 2 > epoch)
+				break;
+
+			record->head++;
+			released++;
+
+			retired.function(retired.pointer, retired.context);
+		}
+
+		Size count = record->retired.GetCount();
+
+		if (record->head == count)
+		{
+			record->retired.Clear();
+			record->head = 0;
+		}
+		else if (record->head * 2 >= count)
+		{
+			// Compacts the released prefix once it makes up half the list, which keeps the cost
+			// of the moves proportional to the releases.
+			for (Size index = record->head; index < count; index++)
+				record->retired[index - record->head] = record->retired[index];
+
+			for (Size index = 0; index < record->head; index++)
+				record->retired.PopBack();
+
+			record->head = 0;
+		}
+
+		return released;
+	}
+
+	FORGE_FORCE_INLINE Guard::Guard(EpochManager& manager)
+		: m_manager(&manager), m_record(manager._acquire_record())
+	{
+		this->m_manager->_enter(this->m_record);
+	}
+
+	FORGE_FORCE_INLINE Guard::Guard(SelfTypeRRef other)
+		: m_manager(other.m_manager), m_record(other.m_record)
+	{
+		other.m_record = nullptr;
+	}
+
+	FORGE_FORCE_INLINE Guard::~Guard()
+	{
+		if (this->m_record)
+			this->m_manager->_leave(this->m_record);
+	}
+}
+
+#endif
\ No newline at end of file
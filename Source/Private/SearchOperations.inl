@@ -0,0 +1,25 @@
+#ifndef SEARCH_OPERATIONS_INL_HPP
+#define SEARCH_OPERATIONS_INL_HPP
+
+#include "SearchOperations.hpp"
+
+namespace Forge
+{
+	template<typename InElementType>
+	FORGE_FORCE_INLINE Size BranchlessLowerBound(const InElementType* elements, Size count, const InElementType& key)
+	{
+		Size first = 0;
+
+		while (count > 1)
+		{
+			Size half = count / 2;
+
+			first = elements[first + half - 1] < key ? first + half : first;
+			count -= half;
+		}
+
+		return first + (count == 1 && elements[first] < key);
+	}
+}
+
+#endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "IIterable.hpp"
 #include "AbstractIterator.hpp"
+#include "DefaultAllocator.hpp"
 
 #include <forge-base/Core/Types.hpp>
 #include <forge-base/Core/System.hpp>
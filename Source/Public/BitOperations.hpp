@@ -0,0 +1,101 @@
+#ifndef BIT_OPERATIONS_HPP
+#define BIT_OPERATIONS_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief Gets the number of bits needed to represent a value.
+	 *
+	 * @param value The value to measure.
+	 * @return The position of the highest set bit plus one, or 0 if the value is 0.
+	 */
+	Size BitWidth(U64 value);
+
+	/**
+	 * @brief Counts the number of zero bits below the lowest set bit.
+	 *
+	 * @param value The value to scan, which must not be 0.
+	 * @return The index of the lowest set bit.
+	 */
+	Size CountTrailingZeros(U64 value);
+
+	/**
+	 * @brief Counts the number of zero bits above the highest set bit.
+	 *
+	 * @param value The value to scan, which must not be 0.
+	 * @return The number of leading zero bits.
+	 */
+	Size CountLeadingZeros(U64 value);
+
+	/**
+	 * @brief Counts the number of set bits.
+	 *
+	 * @param value The value to count.
+	 * @return The number of set bits.
+	 */
+	Size PopCount(U64 value);
+
+	/**
+	 * @brief Counts the number of set bits in an array of words.
+	 *
+	 * Uses AVX2 when the library is compiled with it enabled.
+	 *
+	 * @param words The words to count.
+	 * @param word_count The number of words.
+	 * @return The number of set bits.
+	 */
+	Size PopCount(const U64* words, Size word_count);
+
+	/**
+	 * @brief Finds the first set bit at or after the specified position in an array of words.
+	 *
+	 * @param words The words to scan.
+	 * @param word_count The number of words.
+	 * @param bit_index The position to start scanning from.
+	 * @return The position of the set bit, or word_count * 64 if there is none.
+	 */
+	Size FindNextSet(const U64* words, Size word_count, Size bit_index);
+
+	/**
+	 * @brief Computes target &= source word by word.
+	 *
+	 * @param target The words to update.
+	 * @param source The words to combine with.
+	 * @param word_count The number of words.
+	 */
+	Void BitwiseAnd(U64* target, const U64* source, Size word_count);
+
+	/**
+	 * @brief Computes target |= source word by word.
+	 *
+	 * @param target The words to update.
+	 * @param source The words to combine with.
+	 * @param word_count The number of words.
+	 */
+	Void BitwiseOr(U64* target, const U64* source, Size word_count);
+
+	/**
+	 * @brief Computes target ^= source word by word.
+	 *
+	 * @param target The words to update.
+	 * @param source The words to combine with.
+	 * @param word_count The number of words.
+	 */
+	Void BitwiseXor(U64* target, const U64* source, Size word_count);
+
+	/**
+	 * @brief Computes target &= ~source word by word.
+	 *
+	 * @param target The words to update.
+	 * @param source The words whose set bits are cleared from the target.
+	 * @param word_count The number of words.
+	 */
+	Void BitwiseAndNot(U64* target, const U64* source, Size word_count);
+}
+
+#include "../Private/BitOperations.inl"
+
+#endif
\ No newline at end of file
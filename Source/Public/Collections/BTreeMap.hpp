@@ -0,0 +1,427 @@
+#ifndef B_TREE_MAP_HPP
+#define B_TREE_MAP_HPP
+
+#include <new>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+#include "SearchOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An ordered map stored as a B+tree with cache-conscious nodes.
+	 *
+	 * The BTreeMap class template stores its entries in leaves of about NODE_SIZE bytes, with
+	 * the keys of each node packed in front of its values or children, so a lookup touches one
+	 * short run of cache lines per level instead of one cache line per key. Searches inside a
+	 * node use AVX2 comparisons for 32 and 64-bit integer keys when the library is compiled
+	 * with it enabled, and a branchless binary search otherwise. Leaves are linked in both
+	 * directions, so range scans walk the leaves sequentially without revisiting inner nodes.
+	 * Every node is drawn from the map's allocator.
+	 *
+	 * Keys are ordered with operator<. Iteration visits the values in key order.
+	 *
+	 * @tparam InKeyType The type of the keys.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class BTreeMap : public AbstractCollection<InValueType, InAllocationPolicy>
+	{
+	public:
+		using BaseType = AbstractCollection<InValueType, InAllocationPolicy>;
+
+	public:
+		using SelfType          = BTreeMap<InKeyType, InValueType, InAllocationPolicy>;
+		using SelfTypePtr       = BTreeMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using SelfTypeLRef      = BTreeMap<InKeyType, InValueType, InAllocationPolicy>&;
+		using SelfTypeRRef      = BTreeMap<InKeyType, InValueType, InAllocationPolicy>&&;
+		using ConstSelfType     = const BTreeMap<InKeyType, InValueType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const BTreeMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const BTreeMap<InKeyType, InValueType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using KeyTypePtr       = InKeyType*;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypePtr  = const InKeyType*;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypePtr       = InValueType*;
+		using ValueTypeLRef      = InValueType&;
+		using ValueTypeRRef      = InValueType&&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypePtr  = const InValueType*;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size NODE_SIZE = 512;
+
+		static constexpr Size LEAF_CAPACITY = (NODE_SIZE - 4 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(ValueType)) > 4 ?
+			(NODE_SIZE - 4 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(ValueType)) : 4;
+		static constexpr Size INNER_CAPACITY = (NODE_SIZE - 2 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(VoidPtr)) > 4 ?
+			(NODE_SIZE - 2 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(VoidPtr)) : 4;
+
+	private:
+		static constexpr Size LEAF_MINIMUM = LEAF_CAPACITY / 2;
+		static constexpr Size INNER_MINIMUM = (INNER_CAPACITY - 1) / 2;
+
+	private:
+		struct Node
+		{
+			U16 count;
+			Bool is_leaf;
+		};
+
+		struct LeafNode : Node
+		{
+			LeafNode* previous;
+			LeafNode* next;
+
+			alignas(KeyType) Byte key_storage[sizeof(KeyType) * LEAF_CAPACITY];
+			alignas(ValueType) Byte value_storage[sizeof(ValueType) * LEAF_CAPACITY];
+		};
+
+		struct InnerNode : Node
+		{
+			alignas(KeyType) Byte key_storage[sizeof(KeyType) * INNER_CAPACITY];
+
+			Node* children[INNER_CAPACITY + 1];
+		};
+
+	public:
+		class Iterator : public AbstractIterator<ValueType>
+		{
+		public:
+			using BaseType = AbstractIterator<ValueType>;
+
+		public:
+			using SelfType = Iterator;
+			using SelfTypePtr = Iterator*;
+			using SelfTypeLRef = Iterator&;
+			using SelfTypeRRef = Iterator&&;
+			using ConstSelfType = const Iterator;
+			using ConstSelfTypePtr = const Iterator*;
+			using ConstSelfTypeLRef = const Iterator&;
+
+		private:
+			const BTreeMap* m_map;
+			LeafNode* m_leaf;
+			Size m_index;
+
+		public:
+			Iterator()
+				: BaseType(), m_map(nullptr), m_leaf(nullptr), m_index(0) {}
+			Iterator(const BTreeMap* map, LeafNode* leaf, Size index)
+				: BaseType(leaf ? BTreeMap::_values(leaf) + index : nullptr), m_map(map), m_leaf(leaf), m_index(index) {}
+
+		public:
+			Iterator(SelfTypeRRef other)
+				: BaseType(other), m_map(other.m_map), m_leaf(other.m_leaf), m_index(other.m_index) {}
+			Iterator(ConstSelfTypeLRef other)
+				: BaseType(other), m_map(other.m_map), m_leaf(other.m_leaf), m_index(other.m_index) {}
+
+		public:
+			~Iterator() = default;
+
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
+		public:
+			ValueTypePtr operator->() override
+			{
+				return this->m_ptr;
+			}
+			ValueTypeLRef operator*() override
+			{
+				return *this->m_ptr;
+			}
+
+		public:
+			/**
+			 * @brief Retrieves the key of the entry the iterator points to.
+			 *
+			 * @return A const reference to the key.
+			 */
+			ConstKeyTypeLRef GetKey() const
+			{
+				return BTreeMap::_keys(this->m_leaf)[this->m_index];
+			}
+
+		public:
+			SelfTypeLRef operator++() override
+			{
+				if (++this->m_index == this->m_leaf->count)
+				{
+					this->m_leaf = this->m_leaf->next;
+					this->m_index = 0;
+				}
+
+				this->m_ptr = this->m_leaf ? BTreeMap::_values(this->m_leaf) + this->m_index : nullptr;
+
+				return *this;
+			}
+			SelfTypeLRef operator--() override
+			{
+				if (!this->m_leaf)
+				{
+					this->m_leaf = this->m_map->m_tail;
+					this->m_index = this->m_leaf->count;
+				}
+
+				if (this->m_index == 0)
+				{
+					this->m_leaf = this->m_leaf->previous;
+					this->m_index = this->m_leaf->count;
+				}
+
+				this->m_ptr = BTreeMap::_values(this->m_leaf) + --this->m_index;
+
+				return *this;
+			}
+			SelfTypeLRef operator++(I32) override
+			{
+				return ++(*this);
+			}
+			SelfTypeLRef operator--(I32) override
+			{
+				return --(*this);
+			}
+		};
+
+	private:
+		Node* m_root;
+
+	private:
+		LeafNode* m_head;
+		LeafNode* m_tail;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty B+tree map.
+		 */
+		BTreeMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Bulk Load Constructor.
+		 *
+		 * Initializes a B+tree map from keys sorted in strictly increasing order and their
+		 * values, building full leaves and the inner levels bottom-up in O(n).
+		 *
+		 * @throws std::invalid_argument if the arrays differ in length or the keys are not
+		 * strictly increasing.
+		 */
+		template<typename InKeysAllocationPolicy, typename InValuesAllocationPolicy>
+		BTreeMap(const DynamicArrayWithPolicy<KeyType, InKeysAllocationPolicy>& keys, const DynamicArrayWithPolicy<ValueType, InValuesAllocationPolicy>& values, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		BTreeMap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		BTreeMap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~BTreeMap() override;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the value of the smallest key.
+		 *
+		 * @return IIterator pointing to the first value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the value of the largest key.
+		 *
+		 * @return IIterator pointing to one past the last value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetFinalIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to the first entry whose key is not less than the specified key.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return Iterator pointing to the entry, or to one past the last entry if there is none.
+		 */
+		Iterator LowerBound(ConstKeyTypeLRef key) const;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a contained key.
+		 *
+		 * @param key The key whose value to retrieve.
+		 *
+		 * @return A reference to the value of the key.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ValueTypeLRef Get(ConstKeyTypeLRef key);
+
+		/**
+		 * @brief Retrieves the value of a contained key.
+		 *
+		 * @param key The key whose value to retrieve.
+		 *
+		 * @return A const reference to the value of the key.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ConstValueTypeLRef Get(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a key if it is contained.
+		 *
+		 * @return Pointer to the value, or nullptr if the key is not contained.
+		 */
+		ValueTypePtr TryGet(ConstKeyTypeLRef key);
+
+		/**
+		 * @brief Retrieves the value of a key if it is contained.
+		 *
+		 * @return Const pointer to the value, or nullptr if the key is not contained.
+		 */
+		ConstValueTypePtr TryGet(ConstKeyTypeLRef key) const;
+
+	public:
+		/**
+		 * @brief Invokes a callable with every entry whose key lies in the range [first, last],
+		 * in key order.
+		 *
+		 * @param first The smallest key of the range.
+		 * @param last The largest key of the range.
+		 * @param callable The callable, invoked with the key and the value of each entry.
+		 */
+		template<typename InCallable>
+		Void ForEachInRange(ConstKeyTypeLRef first, ConstKeyTypeLRef last, InCallable callable) const;
+
+	public:
+		/**
+		 * @brief Gets the number of levels of the tree.
+		 *
+		 * @return Size storing the height, which is 0 for an empty map.
+		 */
+		Size GetHeight() const;
+
+	public:
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be moved and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ValueTypeRRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Removes a key and its value from the map.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, false if it was not contained.
+		 */
+		Bool Remove(ConstKeyTypeLRef key);
+
+	public:
+		/**
+		 * @brief Removes all the entries from this collection.
+		 */
+		Void Clear() override;
+
+	private:
+		static KeyTypePtr _keys(LeafNode* node);
+		static KeyTypePtr _keys(InnerNode* node);
+		static ValueTypePtr _values(LeafNode* node);
+
+	private:
+		static Size _search(ConstKeyTypePtr keys, Size count, ConstKeyTypeLRef key);
+		static Size _child_index(InnerNode* node, ConstKeyTypeLRef key);
+
+	private:
+		template<typename InType>
+		static Void _open_gap(InType* array, Size count, Size index);
+		template<typename InType>
+		static Void _close_gap(InType* array, Size count, Size index);
+		template<typename InType>
+		static Void _relocate(InType* target, InType* source, Size count);
+
+	private:
+		LeafNode* _create_leaf();
+		InnerNode* _create_inner();
+		Void _release(Node* node);
+		Node* _clone(const Node* node, LeafNode*& previous);
+
+	private:
+		LeafNode* _find_leaf(ConstKeyTypeLRef key) const;
+		static Bool _is_full(const Node* node);
+
+	private:
+		ValueTypePtr _insert_slot(ConstKeyTypeLRef key);
+		Void _split_child(InnerNode* parent, Size index);
+
+	private:
+		Bool _remove(Node* node, ConstKeyTypeLRef key);
+		Void _rebalance(InnerNode* parent, Size index);
+		Void _merge_children(InnerNode* parent, Size index);
+	};
+}
+
+#include "../../Private/Collections/BTreeMap.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,231 @@
+#ifndef CONCURRENT_B_TREE_MAP_HPP
+#define CONCURRENT_B_TREE_MAP_HPP
+
+#include <new>
+#include <atomic>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+#include "OptimisticLock.hpp"
+#include "SearchOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An ordered map for many concurrent readers and writers, built as a B+tree with
+	 * optimistic lock coupling.
+	 *
+	 * Every node carries an OptimisticLock. Lookups and scans take no locks at all: they descend
+	 * by recording the version of each node, reading it and validating the version before they
+	 * act on what they read, and restart from the root when a writer got in the way. Writers
+	 * descend the same way and upgrade to a write lock only on the leaf they modify, plus the
+	 * parent when a full node has to be split, so writers on different leaves never contend.
+	 * Full nodes are split eagerly on the way down.
+	 *
+	 * Leaves are linked from left to right. A range scan copies the matching entries of one leaf
+	 * at a time, validates the leaf and only then hands the entries to the caller, remembering the
+	 * last key it returned; when a concurrent split invalidates the leaf, the scan restarts from
+	 * the root at that key, so every entry is returned once and in key order.
+	 *
+	 * Removals do not merge underfull nodes, so nodes are only released when the map is destroyed
+	 * and a reader can never touch freed memory. Keys and values must be trivially copyable, since
+	 * readers may copy them while a writer is modifying the same node.
+	 *
+	 * @tparam InKeyType The type of the keys.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class ConcurrentBTreeMap
+	{
+		static_assert(::std::is_trivially_copyable<InKeyType>::value, "The key type of a concurrent B-tree map must be trivially copyable");
+		static_assert(::std::is_trivially_copyable<InValueType>::value, "The value type of a concurrent B-tree map must be trivially copyable");
+
+	public:
+		using SelfType          = ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>;
+		using SelfTypePtr       = ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using SelfTypeLRef      = ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>&;
+		using ConstSelfType     = const ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const ConcurrentBTreeMap<InKeyType, InValueType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using KeyTypePtr       = InKeyType*;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypePtr  = const InKeyType*;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypePtr       = InValueType*;
+		using ValueTypeLRef      = InValueType&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypePtr  = const InValueType*;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size NODE_SIZE = 512;
+
+		static constexpr Size LEAF_CAPACITY = (NODE_SIZE - 4 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(ValueType)) > 4 ?
+			(NODE_SIZE - 4 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(ValueType)) : 4;
+		static constexpr Size INNER_CAPACITY = (NODE_SIZE - 3 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(VoidPtr)) > 4 ?
+			(NODE_SIZE - 3 * sizeof(VoidPtr)) / (sizeof(KeyType) + sizeof(VoidPtr)) : 4;
+
+	private:
+		struct Node
+		{
+			OptimisticLock lock;
+
+			U16 count;
+			Bool is_leaf;
+		};
+
+		struct LeafNode : Node
+		{
+			LeafNode* next;
+
+			KeyType keys[LEAF_CAPACITY];
+			ValueType values[LEAF_CAPACITY];
+		};
+
+		struct InnerNode : Node
+		{
+			KeyType keys[INNER_CAPACITY];
+			Node* children[INNER_CAPACITY + 1];
+		};
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		::std::atomic<Node*> m_root;
+		::std::atomic<Size> m_count;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty map holding a single empty leaf.
+		 */
+		ConcurrentBTreeMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		ConcurrentBTreeMap(const ConcurrentBTreeMap&) = delete;
+		ConcurrentBTreeMap& operator=(const ConcurrentBTreeMap&) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 *
+		 * Must not run concurrently with any other operation.
+		 */
+		~ConcurrentBTreeMap();
+
+	public:
+		/**
+		 * @brief Gets the number of entries in the map.
+		 *
+		 * @return Size storing the number of entries, which may be stale under concurrent writes.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Checks whether the map has no entries.
+		 *
+		 * @return True if the map is empty, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Copies the value of a key if it is contained.
+		 *
+		 * @param key The key whose value to retrieve.
+		 * @param value Receives a copy of the value if the key is contained.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool TryGet(ConstKeyTypeLRef key, ValueTypeLRef value) const;
+
+	public:
+		/**
+		 * @brief Invokes a callable with every entry whose key lies in the range [first, last],
+		 * in key order.
+		 *
+		 * Entries are handed out one validated leaf at a time, so each batch is a consistent
+		 * snapshot of its leaf, while entries written concurrently to leaves the scan has not
+		 * reached yet may or may not be visited.
+		 *
+		 * @param first The smallest key of the range.
+		 * @param last The largest key of the range.
+		 * @param callable The callable, invoked with the key and a copy of the value of each entry.
+		 *
+		 * @return The number of entries visited.
+		 */
+		template<typename InCallable>
+		Size Scan(ConstKeyTypeLRef first, ConstKeyTypeLRef last, InCallable callable) const;
+
+	public:
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key, or replaces the value of a contained key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and stored.
+		 *
+		 * @return True if the value was added, false if an existing value was replaced.
+		 */
+		Bool InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Removes a key and its value from the map.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, false if it was not contained.
+		 */
+		Bool Remove(ConstKeyTypeLRef key);
+
+	private:
+		static Size _lower_bound(ConstKeyTypePtr keys, Size count, ConstKeyTypeLRef key);
+
+	private:
+		LeafNode* _create_leaf();
+		InnerNode* _create_inner();
+		Void _release(Node* node);
+
+	private:
+		Bool _find_leaf(ConstKeyTypeLRef key, LeafNode*& leaf, U64& version) const;
+		Bool _split(InnerNode* parent, U64& parent_version, Node* node, U64& node_version);
+		Bool _write(ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool assign);
+	};
+}
+
+#include "../../Private/Collections/ConcurrentBTreeMap.inl"
+
+#endif
\ No newline at end of file
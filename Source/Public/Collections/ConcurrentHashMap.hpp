@@ -0,0 +1,244 @@
+#ifndef CONCURRENT_HASH_MAP_HPP
+#define CONCURRENT_HASH_MAP_HPP
+
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include "AbstractCollection.hpp"
+#include "OptimisticLock.hpp"
+#include "Reclaim/EpochManager.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A hash map for many concurrent readers and writers with lock-free reads and
+	 * incremental resizing.
+	 *
+	 * The ConcurrentHashMap class template chains its entries in power-of-two bucket tables. A
+	 * lookup takes no lock: it loads a bucket head and walks the immutable nodes of the chain.
+	 * Writers take a spin lock on the single bucket they modify, and replace a node instead of
+	 * writing to a value a reader may be copying.
+	 *
+	 * Once the table is three quarters full, a table of twice the capacity is attached to it and
+	 * the buckets are moved across in strides of TRANSFER_STRIDE buckets. Every writer that
+	 * observes a resize in progress moves one stride before returning, so no single insertion
+	 * pays for the whole rehash. The buckets of the new table are initialized by the stride that
+	 * fills them rather than when the table is attached, so attaching it costs one allocation
+	 * and no pass over its capacity. A moved bucket is marked, and readers and writers that
+	 * reach it continue in the new table.
+	 *
+	 * Removed nodes, moved chains and replaced tables are retired to an EpochManager owned by
+	 * the map. Every operation pins the current epoch for its duration, and a retired object is
+	 * only released once every operation that was running when it was retired has finished.
+	 *
+	 * @tparam InKeyType The type of the keys.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 * @tparam InHasherType The type of function object that hashes the keys.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy, typename InHasherType = ::std::hash<InKeyType>>
+	class ConcurrentHashMap
+	{
+	public:
+		using SelfType          = ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>;
+		using SelfTypePtr       = ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>*;
+		using SelfTypeLRef      = ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>&;
+		using ConstSelfType     = const ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>;
+		using ConstSelfTypePtr  = const ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>*;
+		using ConstSelfTypeLRef = const ConcurrentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypeLRef      = InValueType&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using HasherType = InHasherType;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size MINIMUM_CAPACITY = 16;
+		static constexpr Size TRANSFER_STRIDE = 64;
+
+	private:
+		struct Node
+		{
+			U64 hash;
+
+			KeyType key;
+			ValueType value;
+
+			::std::atomic<Node*> next;
+
+			Node(U64 in_hash, ConstKeyTypeLRef in_key, ConstValueTypeLRef in_value, Node* in_next)
+				: hash(in_hash), key(in_key), value(in_value), next(in_next) {}
+		};
+
+		struct Table
+		{
+			Size capacity;
+
+			::std::atomic<Node*>* buckets;
+			::std::atomic<U8>* locks;
+
+			::std::atomic<Table*> next;
+
+			::std::atomic<Size> transfer_index;
+			::std::atomic<Size> transfer_count;
+		};
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		::std::atomic<Table*> m_table;
+		::std::atomic<Size> m_count;
+
+	private:
+		mutable Reclaim::EpochManager m_reclaim;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty map with MINIMUM_CAPACITY buckets.
+		 */
+		ConcurrentHashMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Intial Capacity Constructor.
+		 *
+		 * Initializes an empty map with room for the specified number of entries before its
+		 * first resize.
+		 */
+		ConcurrentHashMap(Size capacity, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 *
+		 * Must not run concurrently with any other operation.
+		 */
+		~ConcurrentHashMap();
+
+	public:
+		/**
+		 * @brief Gets the number of entries in the map.
+		 *
+		 * @return Size storing the number of entries, which may be stale under concurrent writes.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Gets the number of buckets of the current table.
+		 *
+		 * @return Size storing the number of buckets.
+		 */
+		Size GetCapacity() const;
+
+		/**
+		 * @brief Checks whether the map has no entries.
+		 *
+		 * @return True if the map is empty, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Copies the value of a key if it is contained.
+		 *
+		 * @param key The key whose value to retrieve.
+		 * @param value Receives a copy of the value if the key is contained.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool TryGet(ConstKeyTypeLRef key, ValueTypeLRef value) const;
+
+	public:
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key, or replaces the value of a contained key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and stored.
+		 *
+		 * @return True if the value was added, false if an existing value was replaced.
+		 */
+		Bool InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Removes a key and its value from the map.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, false if it was not contained.
+		 */
+		Bool Remove(ConstKeyTypeLRef key);
+
+	private:
+		static U64 _hash(ConstKeyTypeLRef key);
+		static Node* _moved();
+
+	private:
+		static Void _lock(Table* table, Size index);
+		static Void _unlock(Table* table, Size index);
+
+	private:
+		Table* _create_table(Size capacity);
+		Void _initialize_buckets(Table* table, Size first, Size last);
+		Void _release_table(Table* table);
+		Void _release_chain(Node* node);
+		Node* _create_node(U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Node* next);
+
+	private:
+		Table* _lock_bucket(U64 hash, Size& index);
+		Bool _write(ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool assign);
+
+	private:
+		Void _start_resize(Table* table);
+		Void _help_transfer();
+		Void _transfer_bucket(Table* table, Table* next, Size index);
+
+	private:
+		static Void _reclaim_chain(VoidPtr pointer, VoidPtr context);
+	};
+}
+
+#include "../../Private/Collections/ConcurrentHashMap.inl"
+
+#endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <utility>
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
 #include <initializer_list>
 
 #include "AbstractSequencedCollection.hpp"
@@ -14,7 +15,7 @@ namespace Forge
 	template <typename InElementType, typename InAllocationPolicy>
 	class DynamicArrayWithPolicy : public AbstractSequencedCollection<InElementType, InAllocationPolicy>
 	{
-	DYNAMIC_COLLECTION_TYPEDEFS(AbstractSequencedCollection, DynamicArrayWithPolicy)
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractSequencedCollection, DynamicArrayWithPolicy, InAllocationPolicy)
 
 	public:
 		class Iterator : public AbstractIterator<ElementType>
@@ -46,6 +47,10 @@ namespace Forge
 		public:
 			~Iterator() = default;
 
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
 		public:
 			ElementTypePtr operator->() override
 			{
@@ -245,6 +250,21 @@ namespace Forge
 
 		Void Reserve(Size capacity);
 
+		/**
+		 * @brief Takes over a buffer allocated by the allocator of this array as its storage.
+		 *
+		 * The current elements are destroyed and their storage released. The buffer is used as
+		 * is, so its first count elements must already be valid, as they are in a mapped file of
+		 * trivially copyable elements.
+		 *
+		 * @param data The buffer to take over, allocated by the allocator of this array.
+		 * @param count The number of valid elements at the start of the buffer.
+		 * @param capacity The number of elements the buffer has room for.
+		 *
+		 * @throws std::invalid_argument if the count exceeds the capacity.
+		 */
+		Void Adopt(ElementTypePtr data, Size count, Size capacity);
+
 	public:
 		/**
 		 * @brief Removes the last element in the collection.
@@ -390,12 +410,16 @@ namespace Forge
 		 * @brief Removes all the elements from this collections.
 		 */
 		Void Clear() override;
+
+	private:
+		static Void _shift_elements_forward(ElementTypePtr data, Size to, Size steps, Size jumps = 0);
+		static Void _shift_elements_backward(ElementTypePtr data, Size to, Size steps, Size jumps = 0);
 	};
 
 	template <typename InElementType>
 	class DynamicArrayWithPolicy<InElementType, HeapAllocationPolicy> : public AbstractSequencedCollection<InElementType, HeapAllocationPolicy>
 	{
-	DYNAMIC_COLLECTION_TYPEDEFS(AbstractSequencedCollection, DynamicArrayWithPolicy)
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractSequencedCollection, DynamicArrayWithPolicy, HeapAllocationPolicy)
 
 	public:
 		class Iterator : public AbstractIterator<ElementType>
@@ -427,6 +451,10 @@ namespace Forge
 		public:
 			~Iterator() = default;
 
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
 		public:
 			ElementTypePtr operator->() override
 			{
@@ -481,35 +509,35 @@ namespace Forge
 		 *
 		 * Initializes an empty dynamic array with no capacity.
 		 */
-		DynamicArrayWithPolicy(AllocatorTypePtr allocator = new AllocatorType());
+		DynamicArrayWithPolicy(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
 
 		/**
 		 * @brief Intial Capacity Constructor.
 		 *
 		 * Initializes an empty dynamic array with the specified capacity.
 		 */
-		DynamicArrayWithPolicy(Size capacity, AllocatorTypePtr allocator = new AllocatorType());
+		DynamicArrayWithPolicy(Size capacity, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
 
 		/**
 		 * @brief Fill Constructor.
 		 *
 		 * Initializes a dynamic array and fills it with the specified value and count.
 		 */
-		DynamicArrayWithPolicy(ConstElementTypeLRef value, Size count, AllocatorTypePtr allocator = new AllocatorType());
+		DynamicArrayWithPolicy(ConstElementTypeLRef value, Size count, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
 
 		/**
 		 * @brief Buffer Constructor.
 		 *
 		 * Initializes a dynamic array and fills it with the specified buffer and count.
 		 */
-		DynamicArrayWithPolicy(ConstElementTypePtr buffer, Size count, AllocatorTypePtr allocator = new AllocatorType());
+		DynamicArrayWithPolicy(ConstElementTypePtr buffer, Size count, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
 
 		/**
 		 * @brief Initializer list Constructor.
 		 *
 		 * Initializes an empty dynamic array with the specified initializer list.
 		 */
-		DynamicArrayWithPolicy(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = new AllocatorType());
+		DynamicArrayWithPolicy(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
 
 	public:
 		/**
@@ -626,6 +654,21 @@ namespace Forge
 
 		Void Reserve(Size capacity);
 
+		/**
+		 * @brief Takes over a buffer allocated by the allocator of this array as its storage.
+		 *
+		 * The current elements are destroyed and their storage released. The buffer is used as
+		 * is, so its first count elements must already be valid, as they are in a mapped file of
+		 * trivially copyable elements.
+		 *
+		 * @param data The buffer to take over, allocated by the allocator of this array.
+		 * @param count The number of valid elements at the start of the buffer.
+		 * @param capacity The number of elements the buffer has room for.
+		 *
+		 * @throws std::invalid_argument if the count exceeds the capacity.
+		 */
+		Void Adopt(ElementTypePtr data, Size count, Size capacity);
+
 	public:
 		/**
 		 * @brief Removes the last element in the collection.
@@ -771,6 +814,10 @@ namespace Forge
 		 * @brief Removes all the elements from this collections.
 		 */
 		Void Clear() override;
+
+	private:
+		static Void _shift_elements_forward(ElementTypePtr data, Size to, Size steps, Size jumps = 0);
+		static Void _shift_elements_backward(ElementTypePtr data, Size to, Size steps, Size jumps = 0);
 	};
 
 	template <typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
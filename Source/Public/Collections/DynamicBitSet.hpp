@@ -0,0 +1,316 @@
+#ifndef DYNAMIC_BIT_SET_HPP
+#define DYNAMIC_BIT_SET_HPP
+
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A resizable set of bits packed 64 to a word.
+	 *
+	 * The DynamicBitSet class template stores its words in a DynamicArray drawn from its
+	 * allocator, using one bit per flag instead of the byte a DynamicArray<Bool> needs. Set
+	 * operations combine whole words at a time, PopCount and FindNextSet use hardware bit
+	 * counting and scanning, and bulk operations use AVX2 when the library is compiled with it
+	 * enabled. Bits past the bit count in the last word are always kept clear.
+	 *
+	 * @tparam InAllocationPolicy The type of allocator policy the bit set uses to manage its memory.
+	 */
+	template<typename InAllocationPolicy = HeapAllocationPolicy>
+	class DynamicBitSet
+	{
+	public:
+		using SelfType          = DynamicBitSet<InAllocationPolicy>;
+		using SelfTypePtr       = DynamicBitSet<InAllocationPolicy>*;
+		using SelfTypeLRef      = DynamicBitSet<InAllocationPolicy>&;
+		using SelfTypeRRef      = DynamicBitSet<InAllocationPolicy>&&;
+		using ConstSelfType     = const DynamicBitSet<InAllocationPolicy>;
+		using ConstSelfTypePtr  = const DynamicBitSet<InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const DynamicBitSet<InAllocationPolicy>&;
+
+	public:
+		using WordType = U64;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		Size m_bit_count;
+
+	private:
+		DynamicArrayWithPolicy<WordType, InAllocationPolicy> m_words;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty bit set.
+		 */
+		DynamicBitSet(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Bit Count Constructor.
+		 *
+		 * Initializes a bit set with the specified number of bits, all clear.
+		 */
+		DynamicBitSet(Size bit_count, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		DynamicBitSet(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		DynamicBitSet(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~DynamicBitSet() = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Equality Operator.
+		 */
+		Bool operator==(ConstSelfTypeLRef other) const;
+
+		/**
+		 * @brief Inequality Operator.
+		 */
+		Bool operator!=(ConstSelfTypeLRef other) const;
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the bit at the specified position without bounds checking.
+		 */
+		Bool operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Checks if the bit set has no bits.
+		 *
+		 * @return True if the bit count is 0, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+		/**
+		 * @brief Gets the number of bits in the set.
+		 *
+		 * @return Size storing the number of bits.
+		 */
+		Size GetBitCount() const;
+
+		/**
+		 * @brief Gets the number of words backing the set.
+		 *
+		 * @return Size storing the number of words.
+		 */
+		Size GetWordCount() const;
+
+		/**
+		 * @brief Gets a pointer to the words backing the set.
+		 *
+		 * @return Const pointer to the first word.
+		 */
+		const WordType* GetRawData() const;
+
+	public:
+		/**
+		 * @brief Retrieves the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 * @return True if the bit is set, otherwise false.
+		 */
+		Bool Test(Size index) const;
+
+		/**
+		 * @brief Checks if any bit is set.
+		 *
+		 * @return True if at least one bit is set, otherwise false.
+		 */
+		Bool Any() const;
+
+		/**
+		 * @brief Checks if every bit is set.
+		 *
+		 * @return True if every bit is set, otherwise false.
+		 */
+		Bool All() const;
+
+		/**
+		 * @brief Checks if no bit is set.
+		 *
+		 * @return True if no bit is set, otherwise false.
+		 */
+		Bool None() const;
+
+	public:
+		/**
+		 * @brief Counts the number of set bits.
+		 *
+		 * @return Size storing the number of set bits.
+		 */
+		Size PopCount() const;
+
+		/**
+		 * @brief Finds the first set bit.
+		 *
+		 * @return The position of the first set bit, or the bit count if no bit is set.
+		 */
+		Size FindFirstSet() const;
+
+		/**
+		 * @brief Finds the first set bit after the specified position.
+		 *
+		 * @param index The position to search after.
+		 * @return The position of the next set bit, or the bit count if there is none.
+		 */
+		Size FindNextSet(Size index) const;
+
+	public:
+		/**
+		 * @brief Reserves room for the specified number of bits.
+		 *
+		 * @param bit_count The number of bits to make room for.
+		 */
+		Void Reserve(Size bit_count);
+
+		/**
+		 * @brief Changes the number of bits in the set.
+		 *
+		 * @param bit_count The new number of bits.
+		 * @param value The value of any added bits.
+		 */
+		Void Resize(Size bit_count, Bool value = false);
+
+		/**
+		 * @brief Appends a bit to the end of the set.
+		 *
+		 * @param value The value of the added bit.
+		 */
+		Void PushBack(Bool value);
+
+	public:
+		/**
+		 * @brief Sets the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Set(Size index);
+
+		/**
+		 * @brief Clears the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Reset(Size index);
+
+		/**
+		 * @brief Flips the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Flip(Size index);
+
+		/**
+		 * @brief Assigns the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 * @param value The value to assign.
+		 */
+		Void Assign(Size index, Bool value);
+
+	public:
+		/**
+		 * @brief Sets every bit.
+		 */
+		Void SetAll();
+
+		/**
+		 * @brief Clears every bit.
+		 */
+		Void ResetAll();
+
+		/**
+		 * @brief Flips every bit.
+		 */
+		Void FlipAll();
+
+	public:
+		/**
+		 * @brief Keeps only the bits that are also set in the other bit set.
+		 *
+		 * @param other The bit set to intersect with, which must have the same bit count.
+		 *
+		 * @throws std::invalid_argument if the bit counts differ.
+		 */
+		Void And(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Sets every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set to unite with, which must have the same bit count.
+		 *
+		 * @throws std::invalid_argument if the bit counts differ.
+		 */
+		Void Or(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Flips every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set to combine with, which must have the same bit count.
+		 *
+		 * @throws std::invalid_argument if the bit counts differ.
+		 */
+		Void Xor(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Clears every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set whose bits to clear, which must have the same bit count.
+		 *
+		 * @throws std::invalid_argument if the bit counts differ.
+		 */
+		Void AndNot(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Removes every bit from the set.
+		 */
+		Void Clear();
+
+	private:
+		WordType* _words();
+		WordType _last_word_mask() const;
+
+	private:
+		Void _check_same_size(ConstSelfTypeLRef other) const;
+	};
+}
+
+#include "../../Private/Collections/DynamicBitSet.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "SearchOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An ordered map stored as a sorted DynamicArray of keys and a parallel DynamicArray
+	 * of values.
+	 *
+	 * The FlatMap class template keeps its keys and values in separate contiguous arrays, so a
+	 * lookup runs a branchless binary search over the keys alone and only touches the value it
+	 * finds. The map has no per-node overhead, which makes it a good fit for small or read-heavy
+	 * tables. Insertion and removal shift the following entries. InsertAll appends a whole batch,
+	 * sorts it and merges it with the existing entries in a single pass.
+	 *
+	 * Keys are ordered with operator<. Iteration visits the values in key order.
+	 *
+	 * @tparam InKeyType The type of the keys.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class FlatMap : public AbstractCollection<InValueType, InAllocationPolicy>
+	{
+	public:
+		using BaseType = AbstractCollection<InValueType, InAllocationPolicy>;
+
+	public:
+		using SelfType          = FlatMap<InKeyType, InValueType, InAllocationPolicy>;
+		using SelfTypePtr       = FlatMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using SelfTypeLRef      = FlatMap<InKeyType, InValueType, InAllocationPolicy>&;
+		using SelfTypeRRef      = FlatMap<InKeyType, InValueType, InAllocationPolicy>&&;
+		using ConstSelfType     = const FlatMap<InKeyType, InValueType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const FlatMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const FlatMap<InKeyType, InValueType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using KeyTypeRRef      = InKeyType&&;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypePtr  = const InKeyType*;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypePtr       = InValueType*;
+		using ValueTypeLRef      = InValueType&;
+		using ValueTypeRRef      = InValueType&&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypePtr  = const InValueType*;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		DynamicArrayWithPolicy<KeyType, InAllocationPolicy> m_keys;
+		DynamicArrayWithPolicy<ValueType, InAllocationPolicy> m_values;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty flat map.
+		 */
+		FlatMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		FlatMap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		FlatMap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~FlatMap() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the value of the smallest key.
+		 *
+		 * @return IIterator pointing to the first value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the value of the largest key.
+		 *
+		 * @return IIterator pointing to one past the last value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Finds the position of the first key that is not less than the specified key.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return The position of the key, or the count if every key is less than it.
+		 */
+		Size LowerBound(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a contained key.
+		 *
+		 * @param key The key whose value to retrieve.
+		 *
+		 * @return A reference to the value of the key.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ValueTypeLRef Get(ConstKeyTypeLRef key);
+
+		/**
+		 * @brief Retrieves the value of a contained key.
+		 *
+		 * @param key The key whose value to retrieve.
+		 *
+		 * @return A const reference to the value of the key.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ConstValueTypeLRef Get(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a key if it is contained.
+		 *
+		 * @return Pointer to the value, or nullptr if the key is not contained.
+		 */
+		ValueTypePtr TryGet(ConstKeyTypeLRef key);
+
+		/**
+		 * @brief Retrieves the value of a key if it is contained.
+		 *
+		 * @return Const pointer to the value, or nullptr if the key is not contained.
+		 */
+		ConstValueTypePtr TryGet(ConstKeyTypeLRef key) const;
+
+	public:
+		/**
+		 * @brief Gets a pointer to the sorted keys.
+		 *
+		 * @return Const pointer to the smallest key.
+		 */
+		ConstKeyTypePtr GetKeys() const;
+
+		/**
+		 * @brief Gets a pointer to the values, in the same order as the keys.
+		 *
+		 * @return Const pointer to the value of the smallest key.
+		 */
+		ConstValueTypePtr GetValues() const;
+
+	public:
+		/**
+		 * @brief Reserves room for the specified number of entries.
+		 *
+		 * @param capacity The number of entries to make room for.
+		 */
+		Void Reserve(Size capacity);
+
+	public:
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be moved and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ValueTypeRRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and added.
+		 *
+		 * @return True if the value was added, false if the key was already contained.
+		 */
+		Bool Insert(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+		/**
+		 * @brief Inserts a batch of entries, whose keys may be unsorted and contain duplicates.
+		 *
+		 * The entries are appended, sorted by key and merged with the existing entries in
+		 * O((n + m) + m log m). Keys that are already contained keep their value, and of several
+		 * equal keys in the batch only the first one is added.
+		 *
+		 * @param keys The keys to be copied and added.
+		 * @param values The values to be copied and added, in the same order as the keys.
+		 * @param count The number of entries.
+		 */
+		Void InsertAll(ConstKeyTypePtr keys, ConstValueTypePtr values, Size count);
+
+		/**
+		 * @brief Inserts every entry of another map with a single merge.
+		 *
+		 * @param other The map whose entries to add.
+		 */
+		Void InsertAll(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Removes a key and its value from the map.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, false if it was not contained.
+		 */
+		Bool Remove(ConstKeyTypeLRef key);
+
+	public:
+		/**
+		 * @brief Removes all the entries from this collection.
+		 */
+		Void Clear() override;
+
+	private:
+		Void _merge_tail(Size head_count);
+	};
+}
+
+#include "../../Private/Collections/FlatMap.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,197 @@
+#ifndef FLAT_SET_HPP
+#define FLAT_SET_HPP
+
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "SearchOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An ordered set stored as a sorted DynamicArray.
+	 *
+	 * The FlatSet class template keeps its keys contiguous and sorted, so lookups are a
+	 * branchless binary search over a single cache-friendly array, and the set has no per-node
+	 * overhead. Insertion and removal shift the following keys, which makes the set best suited
+	 * to small or read-heavy tables. InsertAll appends a whole batch, sorts it and merges it
+	 * with the existing keys in a single pass instead of inserting the keys one by one.
+	 *
+	 * Keys are ordered with operator<.
+	 *
+	 * @tparam InElementType The type of keys to be stored in the set.
+	 * @tparam InAllocationPolicy The type of allocator policy the set uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class FlatSet : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, FlatSet, InAllocationPolicy)
+
+	private:
+		DynamicArrayWithPolicy<ElementType, InAllocationPolicy> m_keys;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty flat set.
+		 */
+		FlatSet(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a flat set with the keys of the specified initializer list.
+		 */
+		FlatSet(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		FlatSet(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		FlatSet(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~FlatSet() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the key at the specified position in sorted order, without bounds checking.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the smallest key in the collection.
+		 *
+		 * The keys must not be modified through the iterator.
+		 *
+		 * @return IIterator pointing to the first key.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the largest key in the collection.
+		 *
+		 * @return IIterator pointing to one past the last key.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Gets a pointer to the sorted keys.
+		 *
+		 * @return Const pointer to the smallest key.
+		 */
+		ConstElementTypePtr GetRawData() const;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the set.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstElementTypeLRef key) const;
+
+		/**
+		 * @brief Finds the position of the first key that is not less than the specified key.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return The position of the key, or the count if every key is less than it.
+		 */
+		Size LowerBound(ConstElementTypeLRef key) const;
+
+	public:
+		/**
+		 * @brief Reserves room for the specified number of keys.
+		 *
+		 * @param capacity The number of keys to make room for.
+		 */
+		Void Reserve(Size capacity);
+
+	public:
+		/**
+		 * @brief Inserts a key into the set.
+		 *
+		 * @param key The key to be moved and added.
+		 *
+		 * @return True if the key was added, false if it was already contained.
+		 */
+		Bool Insert(ElementTypeRRef key);
+
+		/**
+		 * @brief Inserts a key into the set.
+		 *
+		 * @param key The key to be copied and added.
+		 *
+		 * @return True if the key was added, false if it was already contained.
+		 */
+		Bool Insert(ConstElementTypeLRef key);
+
+		/**
+		 * @brief Inserts a batch of keys, which may be unsorted and contain duplicates.
+		 *
+		 * The keys are appended, sorted and merged with the existing keys in O((n + m) + m log m).
+		 *
+		 * @param keys The keys to be copied and added.
+		 * @param count The number of keys.
+		 */
+		Void InsertAll(ConstElementTypePtr keys, Size count);
+
+		/**
+		 * @brief Inserts every key of another set with a single merge.
+		 *
+		 * @param other The set whose keys to add.
+		 */
+		Void InsertAll(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Removes a key from the set.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, false if it was not contained.
+		 */
+		Bool Remove(ConstElementTypeLRef key);
+
+	public:
+		/**
+		 * @brief Removes all the keys from this collection.
+		 */
+		Void Clear() override;
+
+	private:
+		Void _merge_tail(Size head_count);
+	};
+}
+
+#include "../../Private/Collections/FlatSet.inl"
+
+#endif
\ No newline at end of file
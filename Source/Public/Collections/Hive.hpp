@@ -0,0 +1,297 @@
+#ifndef HIVE_HPP
+#define HIVE_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <initializer_list>
+
+#include "AbstractCollection.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An unordered collection with O(1) insertion and removal that never moves its
+	 * elements.
+	 *
+	 * The Hive class template stores its elements in a linked list of blocks whose capacity grows
+	 * geometrically up to MAXIMUM_BLOCK_CAPACITY. Removing an element only destroys it and marks
+	 * its slot in a jump-counting skip field, where the first and last slot of every run of erased
+	 * slots store the length of the run, so iteration jumps over a whole run in O(1). The runs of
+	 * each block are kept in a free list and reused by later insertions before the hive grows, and
+	 * a block is released as soon as it becomes empty. Pointers and references to an element stay
+	 * valid until that element is removed.
+	 *
+	 * @tparam InElementType The type of elements to be stored in the hive.
+	 * @tparam InAllocationPolicy The type of allocator policy the hive uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class Hive : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, Hive, InAllocationPolicy)
+
+	private:
+		using SkipType = U16;
+
+	private:
+		struct Block
+		{
+			ElementTypePtr data;
+
+			SkipType* skip;
+			SkipType* links;
+
+			Size capacity;
+			Size size;
+			Size high_water;
+
+			SkipType free_head;
+
+			Block* prev;
+			Block* next;
+
+			Block* prev_free;
+			Block* next_free;
+		};
+
+	public:
+		class Iterator : public AbstractIterator<ElementType>
+		{
+		public:
+			using BaseType = AbstractIterator<ElementType>;
+
+		public:
+			using SelfType = Iterator;
+			using SelfTypePtr = Iterator*;
+			using SelfTypeLRef = Iterator&;
+			using SelfTypeRRef = Iterator&&;
+			using ConstSelfType = const Iterator;
+			using ConstSelfTypePtr = const Iterator*;
+			using ConstSelfTypeLRef = const Iterator&;
+
+		private:
+			friend class Hive;
+
+		private:
+			Hive* m_hive;
+			Block* m_block;
+			Size m_index;
+
+		public:
+			Iterator()
+				: BaseType(), m_hive(nullptr), m_block(nullptr), m_index(0) {}
+			Iterator(Hive* hive, Block* block, Size index)
+				: BaseType(block ? block->data + index : nullptr), m_hive(hive), m_block(block), m_index(index) {}
+
+		public:
+			Iterator(SelfTypeRRef other)
+				: BaseType(other), m_hive(other.m_hive), m_block(other.m_block), m_index(other.m_index) {}
+			Iterator(ConstSelfTypeLRef other)
+				: BaseType(other), m_hive(other.m_hive), m_block(other.m_block), m_index(other.m_index) {}
+
+		public:
+			~Iterator() = default;
+
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
+		public:
+			ElementTypePtr operator->() override
+			{
+				return this->m_ptr;
+			}
+			ElementTypeLRef operator*() override
+			{
+				return *this->m_ptr;
+			}
+
+		public:
+			SelfTypeLRef operator++() override
+			{
+				Hive::_advance(this->m_block, this->m_index);
+
+				this->m_ptr = this->m_block ? this->m_block->data + this->m_index : nullptr;
+
+				return *this;
+			}
+			SelfTypeLRef operator--() override
+			{
+				if (!this->m_block)
+				{
+					// The final iterator of an empty hive has no element to step back to.
+					if (!this->m_hive || !this->m_hive->m_tail)
+						return *this;
+
+					this->m_block = this->m_hive->m_tail;
+					this->m_index = this->m_block->high_water;
+				}
+
+				Hive::_retreat(this->m_block, this->m_index);
+
+				this->m_ptr = this->m_block ? this->m_block->data + this->m_index : nullptr;
+
+				return *this;
+			}
+			SelfTypeLRef operator++(I32) override
+			{
+				return ++(*this);
+			}
+			SelfTypeLRef operator--(I32) override
+			{
+				return --(*this);
+			}
+		};
+
+	public:
+		static constexpr Size MINIMUM_BLOCK_CAPACITY = 8;
+		static constexpr Size MAXIMUM_BLOCK_CAPACITY = 8192;
+
+	private:
+		static constexpr SkipType NO_RUN = ::std::numeric_limits<SkipType>::max();
+
+	private:
+		Block* m_head;
+		Block* m_tail;
+		Block* m_free_blocks;
+
+	private:
+		Size m_block_count;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty hive without allocating any block.
+		 */
+		Hive(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a hive with the specified initializer list.
+		 */
+		Hive(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		Hive(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		Hive(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~Hive() override;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * Elements are traversed in storage order, which is unrelated to insertion order.
+		 *
+		 * @return IIterator pointing to the first element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @return IIterator pointing to one past the last element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Gets the number of allocated blocks.
+		 *
+		 * @return Size storing the number of allocated blocks.
+		 */
+		Size GetBlockCount() const;
+
+	public:
+		/**
+		 * @brief Inserts an element into the collection, reusing an erased slot if there is one.
+		 *
+		 * @param element The element to be moved and added.
+		 * @return A reference to the added element, which remains valid until it is removed.
+		 */
+		ElementTypeLRef Insert(ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element into the collection, reusing an erased slot if there is one.
+		 *
+		 * @param element The element to be copied and added.
+		 * @return A reference to the added element, which remains valid until it is removed.
+		 */
+		ElementTypeLRef Insert(ConstElementTypeLRef element);
+
+	public:
+		/**
+		 * @brief Removes the element an iterator points to and advances the iterator to the
+		 * next element.
+		 *
+		 * @param iterator The iterator pointing to the element to remove.
+		 */
+		Void Remove(Iterator& iterator);
+
+		/**
+		 * @brief Removes the element at the specified address.
+		 *
+		 * The owning block is found by scanning the blocks, so this costs O(block count).
+		 *
+		 * @param element The address of the element to remove.
+		 *
+		 * @throws std::invalid_argument if the address does not refer to an element of the hive.
+		 */
+		Void Remove(ConstElementTypePtr element);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collection and releases every block.
+		 */
+		Void Clear() override;
+
+	private:
+		static Void _advance(Block*& block, Size& index);
+		static Void _retreat(Block*& block, Size& index);
+
+	private:
+		ElementTypePtr _acquire_slot();
+		Void _erase_slot(Block* block, Size index);
+
+	private:
+		Void _append_block();
+		Void _release_block(Block* block);
+
+	private:
+		Void _link_free_block(Block* block);
+		Void _unlink_free_block(Block* block);
+
+	private:
+		static Void _push_run(Block* block, Size start);
+		static Void _unlink_run(Block* block, Size start);
+		static Void _replace_run(Block* block, Size start, Size new_start);
+	};
+}
+
+#include "../../Private/Collections/Hive.inl"
+
+#endif
\ No newline at end of file
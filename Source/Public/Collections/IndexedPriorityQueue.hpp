@@ -0,0 +1,244 @@
+#ifndef INDEXED_PRIORITY_QUEUE_HPP
+#define INDEXED_PRIORITY_QUEUE_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A min-priority queue of integer keys that supports changing and removing the
+	 * priority of any queued key.
+	 *
+	 * The IndexedPriorityQueue class template is designed for graph searches such as Dijkstra
+	 * and A*, where keys are dense node identifiers. Keys and priorities are stored in a 4-ary
+	 * heap, and a dense position index maps every key to its slot in the heap, so DecreaseKey,
+	 * Update and Remove run in O(log n). All storage is allocated through the queue's allocator,
+	 * so per-query scratch queues can be drawn from an arena.
+	 *
+	 * @tparam InKeyType The unsigned integer type of the keys to be stored in the queue.
+	 * @tparam InPriorityType The type of priority ordering the keys, compared with operator<.
+	 * @tparam InAllocationPolicy The type of allocator policy the queue uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InPriorityType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class IndexedPriorityQueue : public AbstractCollection<InKeyType, InAllocationPolicy>
+	{
+	public:
+		using BaseType = AbstractCollection<InKeyType, InAllocationPolicy>;
+
+	public:
+		using SelfType          = IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>;
+		using SelfTypePtr       = IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>*;
+		using SelfTypeLRef      = IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>&;
+		using SelfTypeRRef      = IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>&&;
+		using ConstSelfType     = const IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const IndexedPriorityQueue<InKeyType, InPriorityType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using KeyTypeLRef      = InKeyType&;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using PriorityType          = InPriorityType;
+		using PriorityTypeLRef      = InPriorityType&;
+		using PriorityTypeRRef      = InPriorityType&&;
+		using ConstPriorityType     = const InPriorityType;
+		using ConstPriorityTypeLRef = const InPriorityType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		static constexpr Size HEAP_ARITY = 4;
+		static constexpr U32 INVALID_POSITION = ::std::numeric_limits<U32>::max();
+
+	private:
+		DynamicArrayWithPolicy<KeyType, InAllocationPolicy> m_heap_keys;
+		DynamicArrayWithPolicy<PriorityType, InAllocationPolicy> m_heap_priorities;
+
+	private:
+		DynamicArrayWithPolicy<U32, InAllocationPolicy> m_positions;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty indexed priority queue.
+		 */
+		IndexedPriorityQueue(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Intial Capacity Constructor.
+		 *
+		 * Initializes an empty indexed priority queue with room for keys in the range [0, key_count).
+		 */
+		IndexedPriorityQueue(Size key_count, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		IndexedPriorityQueue(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		IndexedPriorityQueue(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~IndexedPriorityQueue() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first key in the collection.
+		 *
+		 * Keys are traversed in heap order, not in priority order.
+		 *
+		 * @return IIterator pointing to the first key.
+		 */
+		typename AbstractIterator<KeyType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last key in the collection.
+		 *
+		 * @return IIterator pointing to one past the last key.
+		 */
+		typename AbstractIterator<KeyType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is currently queued.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is queued, otherwise false.
+		 */
+		Bool Contains(KeyType key) const;
+
+		/**
+		 * @brief Retrieves the priority of a queued key.
+		 *
+		 * @param key The key whose priority to retrieve.
+		 *
+		 * @return A const reference to the priority of the key.
+		 *
+		 * @throws std::out_of_range if the key is not queued.
+		 */
+		ConstPriorityTypeLRef GetPriority(KeyType key) const;
+
+	public:
+		/**
+		 * @brief Retrieves the key with the lowest priority.
+		 *
+		 * @return A const reference to the top key.
+		 */
+		ConstKeyTypeLRef Peek() const;
+
+		/**
+		 * @brief Retrieves the lowest priority in the collection.
+		 *
+		 * @return A const reference to the priority of the top key.
+		 */
+		ConstPriorityTypeLRef PeekPriority() const;
+
+	public:
+		/**
+		 * @brief Removes the key with the lowest priority.
+		 */
+		Void Pop();
+
+		/**
+		 * @brief Inserts a key with the specified priority.
+		 *
+		 * @param key The key to be added.
+		 * @param priority The priority of the key.
+		 *
+		 * @throws std::invalid_argument if the key is already queued.
+		 */
+		Void Push(KeyType key, ConstPriorityTypeLRef priority);
+
+	public:
+		/**
+		 * @brief Lowers the priority of a queued key, moving it towards the top.
+		 *
+		 * @param key The key whose priority to lower.
+		 * @param priority The new priority, which must not be greater than the current one.
+		 *
+		 * @throws std::out_of_range if the key is not queued.
+		 * @throws std::invalid_argument if the new priority is greater than the current one.
+		 */
+		Void DecreaseKey(KeyType key, ConstPriorityTypeLRef priority);
+
+		/**
+		 * @brief Changes the priority of a queued key in either direction.
+		 *
+		 * @param key The key whose priority to change.
+		 * @param priority The new priority.
+		 *
+		 * @throws std::out_of_range if the key is not queued.
+		 */
+		Void Update(KeyType key, ConstPriorityTypeLRef priority);
+
+		/**
+		 * @brief Removes a queued key regardless of its priority.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @throws std::out_of_range if the key is not queued.
+		 */
+		Void Remove(KeyType key);
+
+	public:
+		/**
+		 * @brief Grows the position index so keys in the range [0, key_count) can be queued
+		 * without further allocations.
+		 *
+		 * @param key_count The number of keys to make room for.
+		 */
+		Void Reserve(Size key_count);
+
+	public:
+		/**
+		 * @brief Removes all the keys from this collection.
+		 *
+		 * Only the positions of keys that are currently queued are reset, so clearing is
+		 * proportional to the number of queued keys and not to the size of the key range.
+		 */
+		Void Clear() override;
+
+	private:
+		Void _place(Size index, KeyType key, PriorityTypeRRef priority);
+		Void _remove_at(Size index);
+
+	private:
+		Void _sift_up(Size index);
+		Void _sift_down(Size index);
+	};
+}
+
+#include "../../Private/Collections/IndexedPriorityQueue.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,423 @@
+#ifndef PERSISTENT_HASH_MAP_HPP
+#define PERSISTENT_HASH_MAP_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+
+#include "AbstractCollection.hpp"
+#include "BitOperations.hpp"
+#include "Reclaim/EpochManager.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An immutable hash map whose versions share structure, implemented as a hash array
+	 * mapped trie.
+	 *
+	 * The PersistentHashMap class template consumes the hash of a key five bits per level. Each
+	 * node keeps two 32-bit maps, one for the slots that hold an entry inline and one for the
+	 * slots that point to a child node, and stores only the occupied slots, indexed by the
+	 * population count of the map below the slot. Keys whose 64-bit hashes are equal end up in a
+	 * collision node below the last level.
+	 *
+	 * InsertOrAssign and Remove leave the map untouched and return a new version that copies
+	 * only the O(log32 n) nodes on the path to the key. A child left with a single entry is
+	 * folded back into its parent, so the shape of the trie depends only on its keys. Nodes are
+	 * reference counted and each one keeps the number of entries below it, so taking a snapshot
+	 * is O(1) and the count of a version is read from its root.
+	 *
+	 * Load, Store and Exchange may be called concurrently on the same map, which makes it a
+	 * lock-free publication point for a single writer and many readers, with the same deferred
+	 * release through the default EpochManager as SharedArray, and every replacement collects the
+	 * nodes that no reader can reach anymore. Readers should take a snapshot with Load and query
+	 * the snapshot. A Transient applies a batch of updates in place on the
+	 * nodes it owns exclusively, for bulk loads.
+	 *
+	 * @tparam InKeyType The type of the keys.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 * @tparam InHasherType The type of function object that hashes the keys.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy, typename InHasherType = ::std::hash<InKeyType>>
+	class PersistentHashMap
+	{
+	public:
+		using SelfType          = PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>;
+		using SelfTypePtr       = PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>*;
+		using SelfTypeLRef      = PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>&;
+		using SelfTypeRRef      = PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>&&;
+		using ConstSelfType     = const PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>;
+		using ConstSelfTypePtr  = const PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>*;
+		using ConstSelfTypeLRef = const PersistentHashMap<InKeyType, InValueType, InAllocationPolicy, InHasherType>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypePtr  = const InKeyType*;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypePtr       = InValueType*;
+		using ValueTypeLRef      = InValueType&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypePtr  = const InValueType*;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using HasherType = InHasherType;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size BITS = 5;
+		static constexpr Size HASH_BITS = 64;
+
+	private:
+		static constexpr U64 MASK = (U64(1) << BITS) - 1;
+
+	private:
+		struct Entry
+		{
+			U64 hash;
+
+			KeyType key;
+			ValueType value;
+
+			Entry(U64 in_hash, ConstKeyTypeLRef in_key, ConstValueTypeLRef in_value)
+				: hash(in_hash), key(in_key), value(in_value) {}
+		};
+
+		/**
+		 * The entries follow the node header at ENTRIES_OFFSET and the children follow the
+		 * entries. A node at HASH_BITS or deeper is a collision node, whose entries all share
+		 * the same hash and whose maps are empty. A node remembers its allocator, since it may be
+		 * released by another version.
+		 */
+		struct Node
+		{
+			::std::atomic<Size> references;
+
+			AllocatorTypePtr allocator;
+
+			Size size;
+
+			U32 entry_map;
+			U32 child_map;
+			U32 count;
+		};
+
+	private:
+		static constexpr Size NODE_ALIGNMENT = alignof(Node) > alignof(Entry) ? alignof(Node) : alignof(Entry);
+		static constexpr Size ENTRIES_OFFSET = (sizeof(Node) + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+
+	public:
+		/**
+		 * @brief A mutable builder that owns a map exclusively and updates it in place.
+		 *
+		 * Nodes shared with other versions are copied the first time they are reached, after
+		 * which the copies belong to the transient alone and later updates along the same paths
+		 * no longer copy the nodes above them.
+		 */
+		class Transient
+		{
+		public:
+			using SelfType          = Transient;
+			using SelfTypePtr       = Transient*;
+			using SelfTypeLRef      = Transient&;
+			using SelfTypeRRef      = Transient&&;
+			using ConstSelfType     = const Transient;
+			using ConstSelfTypePtr  = const Transient*;
+			using ConstSelfTypeLRef = const Transient&;
+
+		private:
+			AllocatorTypePtr m_allocator;
+
+		private:
+			Node* m_root;
+
+		public:
+			/**
+			 * @brief Map Constructor.
+			 *
+			 * Initializes a transient holding the entries of the specified map.
+			 */
+			Transient(const PersistentHashMap& map);
+
+		public:
+			/**
+			 * @brief Move Constructor.
+			 */
+			Transient(SelfTypeRRef other);
+
+		public:
+			Transient(ConstSelfTypeLRef) = delete;
+			SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+
+		public:
+			/**
+			 * @brief Destructor.
+			 */
+			~Transient();
+
+		public:
+			/**
+			 * @brief Gets the number of entries.
+			 *
+			 * @return Size storing the number of entries.
+			 */
+			Size GetCount() const;
+
+			/**
+			 * @brief Checks if the specified key is contained in the transient.
+			 *
+			 * @param key The key to search for.
+			 *
+			 * @return True if the key is contained, otherwise false.
+			 */
+			Bool Contains(ConstKeyTypeLRef key) const;
+
+			/**
+			 * @brief Retrieves the value of a key if it is contained.
+			 *
+			 * @return Const pointer to the value, or nullptr if the key is not contained.
+			 */
+			ConstValueTypePtr TryGet(ConstKeyTypeLRef key) const;
+
+		public:
+			/**
+			 * @brief Inserts a value with the specified key, or replaces the value of a contained key.
+			 *
+			 * @param key The key of the value.
+			 * @param value The value to be copied and stored.
+			 *
+			 * @return True if the value was added, false if an existing value was replaced.
+			 */
+			Bool InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value);
+
+			/**
+			 * @brief Removes a key and its value.
+			 *
+			 * @param key The key to remove.
+			 *
+			 * @return True if the key was removed, false if it was not contained.
+			 */
+			Bool Remove(ConstKeyTypeLRef key);
+
+		public:
+			/**
+			 * @brief Turns the transient into a map in O(1), leaving the transient empty.
+			 *
+			 * @return The map holding the entries of the transient.
+			 */
+			PersistentHashMap Persistent();
+		};
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		::std::atomic<Node*> m_root;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty map.
+		 */
+		PersistentHashMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		PersistentHashMap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 *
+		 * Takes a snapshot of the other map in O(1).
+		 */
+		PersistentHashMap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~PersistentHashMap();
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 *
+		 * Shares the trie of the other map in O(1), as Store does.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Takes a snapshot of the map, safe to call while other threads Store to it.
+		 *
+		 * @return A map sharing the current trie.
+		 */
+		SelfType Load() const;
+
+		/**
+		 * @brief Replaces the trie of the map with the trie of another map, safe to call while
+		 * other threads Load from it.
+		 *
+		 * @param other The map to share the trie of.
+		 */
+		Void Store(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Replaces the trie of the map with the trie of another map and returns the
+		 * replaced version, safe to call while other threads Load from it.
+		 *
+		 * @param other The map to share the trie of.
+		 * @return A map holding the replaced trie.
+		 */
+		SelfType Exchange(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets the number of entries, safe to call while other threads Store to the map.
+		 *
+		 * @return Size storing the number of entries.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Checks whether the map has no entries, safe to call while other threads Store
+		 * to the map.
+		 *
+		 * @return True if the map is empty, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map, safe to call while other
+		 * threads Store to the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a contained key.
+		 *
+		 * Must not run concurrently with Store or Exchange on this map, since the value may be
+		 * released once the map no longer references it. Concurrent readers should query a
+		 * snapshot taken with Load.
+		 *
+		 * @param key The key whose value to retrieve.
+		 *
+		 * @return A const reference to the value of the key.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ConstValueTypeLRef Get(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Retrieves the value of a key if it is contained.
+		 *
+		 * Must not run concurrently with Store or Exchange on this map, since the value may be
+		 * released once the map no longer references it. Concurrent readers should query a
+		 * snapshot taken with Load.
+		 *
+		 * @return Const pointer to the value, or nullptr if the key is not contained.
+		 */
+		ConstValueTypePtr TryGet(ConstKeyTypeLRef key) const;
+
+		/**
+		 * @brief Invokes a callable with every entry of the map, in no particular order.
+		 *
+		 * Safe to call while other threads Store to the map, in which case the callable sees the
+		 * version that was current when the call started. The references it receives are only
+		 * valid during the call.
+		 *
+		 * @param callable The callable, invoked with the key and the value of each entry.
+		 */
+		template<typename InCallable>
+		Void ForEach(InCallable callable) const;
+
+	public:
+		/**
+		 * @brief Creates a version in which the specified key maps to the specified value.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and stored.
+		 *
+		 * @return The new version.
+		 */
+		SelfType InsertOrAssign(ConstKeyTypeLRef key, ConstValueTypeLRef value) const;
+
+		/**
+		 * @brief Creates a version without the specified key.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return The new version, sharing the trie of this map if the key is not contained.
+		 */
+		SelfType Remove(ConstKeyTypeLRef key) const;
+
+	public:
+		/**
+		 * @brief Creates a transient holding the entries of the map, for batch updates.
+		 *
+		 * @return The transient.
+		 */
+		Transient ToTransient() const;
+
+	private:
+		PersistentHashMap(AllocatorTypePtr allocator, Node* root);
+
+	private:
+		static U64 _hash(ConstKeyTypeLRef key);
+
+	private:
+		static Entry* _entries(Node* node);
+		static Node** _children(Node* node);
+		static Node* _create(AllocatorTypePtr allocator, U32 entry_map, U32 child_map, Size count, Size size);
+		static Node* _retain(Node* node);
+		static Void _release(Node* node);
+		static Void _release_retired(VoidPtr node, VoidPtr context);
+
+	private:
+		static Node* _copy(Node* node);
+		static Node* _rebuild(Node* node, U32 entry_map, U32 child_map, Size size, U64 hash, ConstKeyTypePtr key, ConstValueTypePtr value, Node* child);
+		static Node* _pair(AllocatorTypePtr allocator, const Entry& entry, U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Size shift);
+
+	private:
+		static ConstValueTypePtr _find(Node* root, U64 hash, ConstKeyTypeLRef key);
+		static Node* _insert(AllocatorTypePtr allocator, Node* node, Size shift, U64 hash, ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool mutate, Bool& added);
+		static Node* _remove(Node* node, Size shift, U64 hash, ConstKeyTypeLRef key, Bool mutate, Bool& removed);
+		static Bool _insert_root(AllocatorTypePtr allocator, Node*& root, ConstKeyTypeLRef key, ConstValueTypeLRef value, Bool mutate);
+		static Bool _remove_root(Node*& root, ConstKeyTypeLRef key, Bool mutate);
+
+		template<typename InCallable>
+		static Void _for_each(Node* node, InCallable& callable);
+
+	private:
+		Node* _acquire() const;
+		Void _retire(Node* node);
+	};
+}
+
+#include "../../Private/Collections/PersistentHashMap.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,360 @@
+#ifndef PERSISTENT_VECTOR_HPP
+#define PERSISTENT_VECTOR_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+#include "AbstractCollection.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An immutable vector whose versions share structure, implemented as a relaxed radix
+	 * balanced tree.
+	 *
+	 * The PersistentVector class template stores its elements in the leaves of a tree with 32
+	 * slots per node. PushBack, Set and Slice leave the vector untouched and return a new version
+	 * that copies only the O(log32 n) nodes on the affected paths, sharing every other node with
+	 * the original. Nodes are reference counted, so versions can be kept and released in any
+	 * order and read concurrently from any thread.
+	 *
+	 * Nodes are regular, indexed by radix, until a Slice or a Concatenate leaves some of them
+	 * partially filled. Those nodes are relaxed and keep the cumulative sizes of their children,
+	 * and concatenation rebalances the nodes along the seam so that each relaxed node holds at
+	 * most two more children than strictly needed, which keeps lookups at O(log32 n).
+	 *
+	 * A Transient applies a batch of updates in place wherever the nodes it reaches are not
+	 * shared with any other version, then turns back into a vector in O(1).
+	 *
+	 * @tparam InElementType The type of elements stored in the vector.
+	 * @tparam InAllocationPolicy The type of allocator policy the vector uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class PersistentVector
+	{
+	public:
+		using SelfType          = PersistentVector<InElementType, InAllocationPolicy>;
+		using SelfTypePtr       = PersistentVector<InElementType, InAllocationPolicy>*;
+		using SelfTypeLRef      = PersistentVector<InElementType, InAllocationPolicy>&;
+		using SelfTypeRRef      = PersistentVector<InElementType, InAllocationPolicy>&&;
+		using ConstSelfType     = const PersistentVector<InElementType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const PersistentVector<InElementType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const PersistentVector<InElementType, InAllocationPolicy>&;
+
+	public:
+		using ElementType          = InElementType;
+		using ElementTypePtr       = InElementType*;
+		using ElementTypeLRef      = InElementType&;
+		using ElementTypeRRef      = InElementType&&;
+		using ConstElementType     = const InElementType;
+		using ConstElementTypePtr  = const InElementType*;
+		using ConstElementTypeLRef = const InElementType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size BITS = 5;
+		static constexpr Size BRANCH = Size(1) << BITS;
+
+	private:
+		static constexpr Size EXTRA_SLOTS = 2;
+		static constexpr Size INVARIANT_SLOTS = 1;
+
+	private:
+		/**
+		 * Leaves keep their elements at LEAF_OFFSET. Inner nodes keep their children at
+		 * CHILDREN_OFFSET followed by the cumulative sizes of the children, which are only
+		 * maintained by relaxed nodes. Whether a node is a leaf follows from its depth. A node
+		 * remembers its allocator, since it may be released by another version.
+		 */
+		struct Node
+		{
+			::std::atomic<Size> references;
+
+			AllocatorTypePtr allocator;
+
+			U32 count;
+			Bool relaxed;
+		};
+
+	private:
+		static constexpr Size NODE_ALIGNMENT = alignof(Node) > alignof(InElementType) ? alignof(Node) : alignof(InElementType);
+		static constexpr Size LEAF_OFFSET = (sizeof(Node) + alignof(InElementType) - 1) & ~(alignof(InElementType) - 1);
+		static constexpr Size CHILDREN_OFFSET = (sizeof(Node) + alignof(Node*) - 1) & ~(alignof(Node*) - 1);
+		static constexpr Size SIZES_OFFSET = CHILDREN_OFFSET + BRANCH * sizeof(Node*);
+
+	public:
+		/**
+		 * @brief A mutable builder that owns a vector exclusively and updates it in place.
+		 *
+		 * Nodes shared with other versions are copied the first time they are reached, after
+		 * which the copies belong to the transient alone and later updates touch them directly.
+		 */
+		class Transient
+		{
+		public:
+			using SelfType          = Transient;
+			using SelfTypePtr       = Transient*;
+			using SelfTypeLRef      = Transient&;
+			using SelfTypeRRef      = Transient&&;
+			using ConstSelfType     = const Transient;
+			using ConstSelfTypePtr  = const Transient*;
+			using ConstSelfTypeLRef = const Transient&;
+
+		private:
+			AllocatorTypePtr m_allocator;
+
+		private:
+			Node* m_root;
+			Size m_shift;
+			Size m_count;
+
+		public:
+			/**
+			 * @brief Vector Constructor.
+			 *
+			 * Initializes a transient holding the elements of the specified vector.
+			 */
+			Transient(const PersistentVector& vector);
+
+		public:
+			/**
+			 * @brief Move Constructor.
+			 */
+			Transient(SelfTypeRRef other);
+
+		public:
+			Transient(ConstSelfTypeLRef) = delete;
+			SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+
+		public:
+			/**
+			 * @brief Destructor.
+			 */
+			~Transient();
+
+		public:
+			/**
+			 * @brief Gets the number of elements.
+			 *
+			 * @return Size storing the number of elements.
+			 */
+			Size GetCount() const;
+
+			/**
+			 * @brief Gets the element at the specified index.
+			 *
+			 * @param index The index of the element.
+			 * @return A const reference to the element.
+			 *
+			 * @throws std::out_of_range if the index is out of range.
+			 */
+			ConstElementTypeLRef Get(Size index) const;
+
+		public:
+			/**
+			 * @brief Appends an element.
+			 *
+			 * @param element The element to append.
+			 */
+			Void PushBack(ConstElementTypeLRef element);
+
+			/**
+			 * @brief Replaces the element at the specified index.
+			 *
+			 * @param index The index of the element.
+			 * @param element The new value.
+			 *
+			 * @throws std::out_of_range if the index is out of range.
+			 */
+			Void Set(Size index, ConstElementTypeLRef element);
+
+		public:
+			/**
+			 * @brief Turns the transient into a vector in O(1), leaving the transient empty.
+			 *
+			 * @return The vector holding the elements of the transient.
+			 */
+			PersistentVector Persistent();
+		};
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		Node* m_root;
+		Size m_shift;
+		Size m_count;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty vector.
+		 */
+		PersistentVector(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a vector with the values of the specified initializer list.
+		 */
+		PersistentVector(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		PersistentVector(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 *
+		 * Shares the tree of the other vector in O(1).
+		 */
+		PersistentVector(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~PersistentVector();
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets the number of elements.
+		 *
+		 * @return Size storing the number of elements.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Checks whether the vector is empty.
+		 *
+		 * @return True if the vector has no elements, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+	public:
+		/**
+		 * @brief Gets the element at the specified index without bounds checking.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+		/**
+		 * @brief Gets the element at the specified index.
+		 *
+		 * @param index The index of the element.
+		 * @return A const reference to the element.
+		 *
+		 * @throws std::out_of_range if the index is out of range.
+		 */
+		ConstElementTypeLRef Get(Size index) const;
+
+	public:
+		/**
+		 * @brief Creates a version with an element appended.
+		 *
+		 * @param element The element to append.
+		 * @return The new version.
+		 */
+		SelfType PushBack(ConstElementTypeLRef element) const;
+
+		/**
+		 * @brief Creates a version with the element at the specified index replaced.
+		 *
+		 * @param index The index of the element.
+		 * @param element The new value.
+		 * @return The new version.
+		 *
+		 * @throws std::out_of_range if the index is out of range.
+		 */
+		SelfType Set(Size index, ConstElementTypeLRef element) const;
+
+		/**
+		 * @brief Creates a version holding the elements in the specified range.
+		 *
+		 * @param first The index of the first element to keep.
+		 * @param last The index one past the last element to keep.
+		 * @return The new version.
+		 *
+		 * @throws std::out_of_range if the range is out of range.
+		 */
+		SelfType Slice(Size first, Size last) const;
+
+		/**
+		 * @brief Creates a version holding the elements of this vector followed by those of
+		 * another, in O(log32 n).
+		 *
+		 * @param other The vector to append.
+		 * @return The new version.
+		 */
+		SelfType Concatenate(ConstSelfTypeLRef other) const;
+
+	public:
+		/**
+		 * @brief Creates a transient holding the elements of the vector, for batch updates.
+		 *
+		 * @return The transient.
+		 */
+		Transient ToTransient() const;
+
+	private:
+		PersistentVector(AllocatorTypePtr allocator, Node* root, Size shift, Size count);
+
+	private:
+		static ElementTypePtr _elements(Node* node);
+		static Node** _children(Node* node);
+		static Size* _sizes(Node* node);
+
+	private:
+		static Node* _create(AllocatorTypePtr allocator, Bool leaf);
+		static Node* _acquire(Node* node);
+		static Void _release(Node* node, Size shift);
+
+	private:
+		static Size _size(Node* node, Size shift);
+		static Size _locate(Node* node, Size shift, Size index, Size& slot);
+		static Void _update_sizes(Node* node, Size shift);
+		static Node* _copy(Node* node, Size shift);
+		static Void _append_slots(Node* target, Node* source, Size first, Size count, Size shift);
+		static Void _collapse(Node*& root, Size& shift);
+		static ConstElementTypeLRef _get(Node* root, Size shift, Size index);
+
+	private:
+		static Node* _new_path(AllocatorTypePtr allocator, Size shift, ConstElementTypeLRef element);
+		static Node* _push(AllocatorTypePtr allocator, Node* node, Size shift, ConstElementTypeLRef element, Bool mutate);
+		static Void _push_root(AllocatorTypePtr allocator, Node*& root, Size& shift, ConstElementTypeLRef element, Bool mutate);
+		static Node* _set(Node* node, Size shift, Size index, ConstElementTypeLRef element, Bool mutate);
+		static Void _set_root(Node*& root, Size shift, Size index, ConstElementTypeLRef element, Bool mutate);
+
+	private:
+		static Node* _take(Node* node, Size shift, Size count);
+		static Node* _drop(Node* node, Size shift, Size count);
+
+	private:
+		static Node* _merge(AllocatorTypePtr allocator, Node* left, Size left_shift, Node* right, Size right_shift);
+		static Node* _rebalance(AllocatorTypePtr allocator, Node* const* left, Size left_count, Node* middle, Node* const* right, Size right_count, Size shift);
+	};
+}
+
+#include "../../Private/Collections/PersistentVector.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,202 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A monotone min-priority queue for unsigned integer keys.
+	 *
+	 * The RadixHeap class template is designed for workloads where the extracted minimum never
+	 * decreases, such as event simulation and shortest paths with non-negative weights. Entries
+	 * are distributed into buckets by the highest bit in which their key differs from the last
+	 * extracted key, so pushing is O(1) and popping is amortized O(log C), where C is the key
+	 * range, since every entry can only move to a lower bucket. Buckets are DynamicArrays drawn
+	 * from the heap's allocator.
+	 *
+	 * @tparam InKeyType The unsigned integer type of the keys, typically U32 or U64.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the heap uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class RadixHeap : public AbstractCollection<InValueType, InAllocationPolicy>
+	{
+		static_assert(::std::is_unsigned<InKeyType>::value, "The key type of a radix heap must be an unsigned integer");
+
+	public:
+		using BaseType = AbstractCollection<InValueType, InAllocationPolicy>;
+
+	public:
+		using SelfType          = RadixHeap<InKeyType, InValueType, InAllocationPolicy>;
+		using SelfTypePtr       = RadixHeap<InKeyType, InValueType, InAllocationPolicy>*;
+		using SelfTypeLRef      = RadixHeap<InKeyType, InValueType, InAllocationPolicy>&;
+		using SelfTypeRRef      = RadixHeap<InKeyType, InValueType, InAllocationPolicy>&&;
+		using ConstSelfType     = const RadixHeap<InKeyType, InValueType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const RadixHeap<InKeyType, InValueType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const RadixHeap<InKeyType, InValueType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypeLRef      = InValueType&;
+		using ValueTypeRRef      = InValueType&&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		struct Entry
+		{
+			KeyType key;
+			ValueType value;
+		};
+
+	private:
+		using BucketType = DynamicArrayWithPolicy<Entry, InAllocationPolicy>;
+
+	private:
+		static constexpr Size BUCKET_COUNT = sizeof(KeyType) * 8 + 1;
+
+	private:
+		KeyType m_last_key;
+
+	private:
+		DynamicArrayWithPolicy<BucketType, InAllocationPolicy> m_buckets;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty radix heap whose keys start at 0.
+		 */
+		RadixHeap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		RadixHeap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		RadixHeap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~RadixHeap() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	private:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * @throws std::logic_error if used, as it is illegal for a radix heap.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @throws std::logic_error if used, as it is illegal for a radix heap.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Retrieves the last key that was retrieved from the heap.
+		 *
+		 * Pushed keys must not be smaller than this key.
+		 *
+		 * @return The last retrieved key.
+		 */
+		KeyType GetLastKey() const;
+
+	public:
+		/**
+		 * @brief Retrieves the smallest key in the collection.
+		 *
+		 * @return A const reference to the smallest key.
+		 */
+		ConstKeyTypeLRef PeekKey();
+
+		/**
+		 * @brief Retrieves the value stored with the smallest key in the collection.
+		 *
+		 * @return A reference to the value of the smallest key.
+		 */
+		ValueTypeLRef PeekValue();
+
+	public:
+		/**
+		 * @brief Removes the entry with the smallest key.
+		 */
+		Void Pop();
+
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value, which must not be smaller than the last retrieved key.
+		 * @param value The value to be moved and added.
+		 *
+		 * @throws std::invalid_argument if the key is smaller than the last retrieved key.
+		 */
+		Void Push(KeyType key, ValueTypeRRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value, which must not be smaller than the last retrieved key.
+		 * @param value The value to be copied and added.
+		 *
+		 * @throws std::invalid_argument if the key is smaller than the last retrieved key.
+		 */
+		Void Push(KeyType key, ConstValueTypeLRef value);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collection and resets the last retrieved key to 0.
+		 */
+		Void Clear() override;
+
+	private:
+		Size _bucket_index(KeyType key) const;
+
+	private:
+		Void _create_buckets();
+		Void _refill();
+	};
+}
+
+#include "../../Private/Collections/RadixHeap.inl"
+
+#endif
\ No newline at end of file
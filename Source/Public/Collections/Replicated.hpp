@@ -0,0 +1,125 @@
+#ifndef REPLICATED_HPP
+#define REPLICATED_HPP
+
+#if defined(__linux__)
+
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "Policies/NumaAllocationPolicy.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief Keeps a read-only copy of a container on every NUMA node.
+	 *
+	 * Only Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>> is defined.
+	 */
+	template<typename InContainerType>
+	class Replicated;
+
+	/**
+	 * @brief Keeps a read-only copy of a dynamic array on every NUMA node, so that threads on
+	 * every socket scan memory of their own node.
+	 *
+	 * Each replica is allocated with a NumaAllocationPolicy bound to its node, so its pages are
+	 * placed on that node even though a single thread copies them. GetLocal returns the replica
+	 * of the node the calling thread runs on, which costs no system call. On a machine with a
+	 * single node there is a single replica.
+	 *
+	 * @tparam InElementType The type of elements stored in the array.
+	 * @tparam InAllocationPolicy The allocation policy of the source array.
+	 */
+	template<typename InElementType, typename InAllocationPolicy>
+	class Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>
+	{
+	public:
+		using SelfType          = Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>;
+		using SelfTypePtr       = Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>*;
+		using SelfTypeLRef      = Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>&;
+		using ConstSelfType     = const Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>;
+		using ConstSelfTypePtr  = const Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>*;
+		using ConstSelfTypeLRef = const Replicated<DynamicArrayWithPolicy<InElementType, InAllocationPolicy>>&;
+
+	public:
+		using SourceType          = DynamicArrayWithPolicy<InElementType, InAllocationPolicy>;
+		using ConstSourceTypeLRef = const DynamicArrayWithPolicy<InElementType, InAllocationPolicy>&;
+
+	public:
+		using ReplicaType          = DynamicArrayWithPolicy<InElementType, NumaAllocationPolicy>;
+		using ConstReplicaTypeLRef = const DynamicArrayWithPolicy<InElementType, NumaAllocationPolicy>&;
+
+	public:
+		using ReplicaAllocatorType = Allocator<NumaAllocationPolicy>;
+
+	private:
+		Size m_replica_count;
+
+	private:
+		ReplicaAllocatorType* m_allocators[NumaAllocationPolicy::MAXIMUM_NODE_COUNT];
+		ReplicaType* m_replicas[NumaAllocationPolicy::MAXIMUM_NODE_COUNT];
+
+	public:
+		/**
+		 * @brief Source Constructor.
+		 *
+		 * Initializes a replica of the specified array on every node.
+		 */
+		Replicated(ConstSourceTypeLRef source);
+
+	public:
+		Replicated(ConstSelfTypeLRef) = delete;
+		SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~Replicated();
+
+	public:
+		/**
+		 * @brief Gets the number of replicas, one per node.
+		 *
+		 * @return Size storing the number of replicas.
+		 */
+		Size GetReplicaCount() const;
+
+		/**
+		 * @brief Gets the replica on the node of the calling thread.
+		 *
+		 * @return A const reference to the local replica.
+		 */
+		ConstReplicaTypeLRef GetLocal() const;
+
+		/**
+		 * @brief Gets the replica on the specified node.
+		 *
+		 * @param node The node of the replica.
+		 * @return A const reference to the replica.
+		 *
+		 * @throws std::out_of_range if the node has no replica.
+		 */
+		ConstReplicaTypeLRef GetReplica(Size node) const;
+
+	public:
+		/**
+		 * @brief Replaces the contents of every replica with the specified array.
+		 *
+		 * Must not run concurrently with readers of the replicas. If a copy throws, the new
+		 * replicas built so far are released and the current ones are kept.
+		 *
+		 * @param source The array to copy.
+		 */
+		Void Update(ConstSourceTypeLRef source);
+
+	private:
+		Void _release();
+	};
+}
+
+#include "../../Private/Collections/Replicated.inl"
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,358 @@
+#ifndef ROARING_BITMAP_HPP
+#define ROARING_BITMAP_HPP
+
+#include <utility>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "BitOperations.hpp"
+#include "SearchOperations.hpp"
+#include "RoaringBitmapView.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A compressed set of 32-bit unsigned integers.
+	 *
+	 * The RoaringBitmap class template partitions its values by their high 16 bits into
+	 * containers kept in a sorted DynamicArray. Each container stores the low 16 bits in the
+	 * cheapest of three forms: a sorted array of up to 4096 values, a bitmap of 1024 words, or
+	 * a list of runs. Dense and sparse regions therefore both stay compact, membership is a
+	 * binary search followed by a single probe, and intersection, union and differences work
+	 * container by container with the bitmap kernels. It is intended to replace sorted
+	 * DynamicArray<U32> posting lists.
+	 *
+	 * The bitmap serializes to the portable format described by RoaringBitmapView, which can
+	 * be queried in place, for example from a memory-mapped file.
+	 *
+	 * @tparam InAllocationPolicy The type of allocator policy the bitmap uses to manage its memory.
+	 */
+	template<typename InAllocationPolicy = HeapAllocationPolicy>
+	class RoaringBitmap
+	{
+	public:
+		using SelfType          = RoaringBitmap<InAllocationPolicy>;
+		using SelfTypePtr       = RoaringBitmap<InAllocationPolicy>*;
+		using SelfTypeLRef      = RoaringBitmap<InAllocationPolicy>&;
+		using SelfTypeRRef      = RoaringBitmap<InAllocationPolicy>&&;
+		using ConstSelfType     = const RoaringBitmap<InAllocationPolicy>;
+		using ConstSelfTypePtr  = const RoaringBitmap<InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const RoaringBitmap<InAllocationPolicy>&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		static constexpr U8 ARRAY_CONTAINER = RoaringBitmapView::ARRAY_CONTAINER;
+		static constexpr U8 BITMAP_CONTAINER = RoaringBitmapView::BITMAP_CONTAINER;
+		static constexpr U8 RUN_CONTAINER = RoaringBitmapView::RUN_CONTAINER;
+
+		static constexpr Size ARRAY_MAXIMUM_COUNT = RoaringBitmapView::ARRAY_MAXIMUM_COUNT;
+		static constexpr Size BITMAP_WORD_COUNT = RoaringBitmapView::BITMAP_WORD_COUNT;
+
+	private:
+		/**
+		 * An array container keeps its sorted values in the values array, a run container keeps
+		 * pairs of run starts and lengths minus one in the values array, and a bitmap container
+		 * keeps its bits in the words array.
+		 */
+		struct Container
+		{
+			U8 type;
+			U32 cardinality;
+
+			DynamicArrayWithPolicy<U16, InAllocationPolicy> values;
+			DynamicArrayWithPolicy<U64, InAllocationPolicy> words;
+		};
+
+	private:
+		U64 m_cardinality;
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		DynamicArrayWithPolicy<U16, InAllocationPolicy> m_keys;
+		DynamicArrayWithPolicy<Container, InAllocationPolicy> m_containers;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty bitmap.
+		 */
+		RoaringBitmap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a bitmap with the values of the specified initializer list.
+		 */
+		RoaringBitmap(std::initializer_list<U32> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief View Constructor.
+		 *
+		 * Initializes a bitmap with a copy of the values of a serialized bitmap.
+		 */
+		RoaringBitmap(const RoaringBitmapView& view, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		RoaringBitmap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		RoaringBitmap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~RoaringBitmap() = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Equality Operator.
+		 */
+		Bool operator==(ConstSelfTypeLRef other) const;
+
+		/**
+		 * @brief Inequality Operator.
+		 */
+		Bool operator!=(ConstSelfTypeLRef other) const;
+
+	public:
+		/**
+		 * @brief Checks if the bitmap has no values.
+		 *
+		 * @return True if the bitmap is empty, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+		/**
+		 * @brief Gets the number of values in the bitmap.
+		 *
+		 * @return The number of values.
+		 */
+		U64 GetCardinality() const;
+
+		/**
+		 * @brief Gets the number of containers in the bitmap.
+		 *
+		 * @return Size storing the number of containers.
+		 */
+		Size GetContainerCount() const;
+
+	public:
+		/**
+		 * @brief Checks if the specified value is contained in the bitmap.
+		 *
+		 * @param value The value to search for.
+		 *
+		 * @return True if the value is contained, otherwise false.
+		 */
+		Bool Contains(U32 value) const;
+
+		/**
+		 * @brief Retrieves the smallest value in the bitmap.
+		 *
+		 * @return The smallest value.
+		 */
+		U32 GetMinimum() const;
+
+		/**
+		 * @brief Retrieves the largest value in the bitmap.
+		 *
+		 * @return The largest value.
+		 */
+		U32 GetMaximum() const;
+
+	public:
+		/**
+		 * @brief Adds a value to the bitmap.
+		 *
+		 * @param value The value to add.
+		 *
+		 * @return True if the value was added, false if it was already contained.
+		 */
+		Bool Add(U32 value);
+
+		/**
+		 * @brief Adds every value of a sorted or unsorted array to the bitmap.
+		 *
+		 * Runs of values that share their high 16 bits are added to the same container without
+		 * searching for it again, so sorted input is added in a single pass.
+		 *
+		 * @param values The values to add.
+		 * @param count The number of values.
+		 */
+		Void AddAll(const U32* values, Size count);
+
+		/**
+		 * @brief Adds every value in the range [first, last] to the bitmap.
+		 *
+		 * @param first The first value of the range.
+		 * @param last The last value of the range.
+		 *
+		 * @throws std::invalid_argument if first is greater than last.
+		 */
+		Void AddRange(U32 first, U32 last);
+
+		/**
+		 * @brief Removes a value from the bitmap.
+		 *
+		 * @param value The value to remove.
+		 *
+		 * @return True if the value was removed, false if it was not contained.
+		 */
+		Bool Remove(U32 value);
+
+	public:
+		/**
+		 * @brief Keeps only the values that are also contained in the other bitmap.
+		 *
+		 * @param other The bitmap to intersect with.
+		 */
+		Void And(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Adds every value that is contained in the other bitmap.
+		 *
+		 * @param other The bitmap to unite with.
+		 */
+		Void Or(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Removes every value that is contained in the other bitmap.
+		 *
+		 * @param other The bitmap whose values to remove.
+		 */
+		Void AndNot(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Keeps the values that are contained in exactly one of the two bitmaps.
+		 *
+		 * @param other The bitmap to take the symmetric difference with.
+		 */
+		Void Xor(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Counts the values contained in both bitmaps without materializing the intersection.
+		 *
+		 * @param other The bitmap to intersect with.
+		 *
+		 * @return The number of common values.
+		 */
+		U64 AndCardinality(ConstSelfTypeLRef other) const;
+
+	public:
+		/**
+		 * @brief Converts every container to runs where that takes less memory.
+		 *
+		 * Containers are never converted to runs by the other operations, so this should be
+		 * called once the bitmap is built, typically before serializing it. Adding or removing a
+		 * value in a run container converts it back to an array or a bitmap.
+		 *
+		 * @return True if any container was converted to runs, otherwise false.
+		 */
+		Bool RunOptimize();
+
+	public:
+		/**
+		 * @brief Invokes a callable with every value of the bitmap in ascending order.
+		 *
+		 * @param callable The callable, invoked with each value as a U32.
+		 */
+		template<typename InCallable>
+		Void ForEach(InCallable callable) const;
+
+		/**
+		 * @brief Appends every value of the bitmap in ascending order to a DynamicArray.
+		 *
+		 * @param values The array to append to.
+		 */
+		template<typename InValuesAllocationPolicy>
+		Void ToArray(DynamicArrayWithPolicy<U32, InValuesAllocationPolicy>& values) const;
+
+	public:
+		/**
+		 * @brief Gets the number of bytes the serialized bitmap occupies.
+		 *
+		 * @return Size storing the number of bytes.
+		 */
+		Size GetSerializedSize() const;
+
+		/**
+		 * @brief Writes the bitmap in the portable format described by RoaringBitmapView.
+		 *
+		 * @param buffer The buffer to write to, which must hold at least GetSerializedSize() bytes.
+		 *
+		 * @return The number of bytes written.
+		 */
+		Size Serialize(Byte* buffer) const;
+
+	public:
+		/**
+		 * @brief Removes every value from the bitmap.
+		 */
+		Void Clear();
+
+	private:
+		Size _lower_bound_key(U16 key) const;
+		Container& _container_for(U16 key);
+
+	private:
+		Container _make_container(U8 type) const;
+		Void _remove_container(Size index);
+
+	private:
+		static Bool _container_contains(const Container& container, U16 low);
+		static Bool _container_add(Container& container, U16 low);
+		static Bool _container_remove(Container& container, U16 low);
+
+	private:
+		static Void _to_bitmap(Container& container);
+		static Void _to_array(Container& container);
+		static Void _expand_runs(Container& container);
+		static Bool _to_runs(Container& container);
+
+	private:
+		Void _and_containers(Container& target, const Container& source) const;
+		Void _or_containers(Container& target, const Container& source) const;
+		Void _and_not_containers(Container& target, const Container& source) const;
+		Void _xor_containers(Container& target, const Container& source) const;
+		U64 _and_cardinality(const Container& first, const Container& second) const;
+		const Container& _expanded(const Container& container, Container& scratch) const;
+
+	private:
+		static Size _lower_bound_value(const U16* values, Size count, U16 value);
+		static Size _intersect_values(U16* target, Size target_count, const U16* source, Size source_count);
+		static Void _set_bit_range(U64* words, Size first, Size last);
+
+	private:
+		template<typename InCallable>
+		static Void _for_each(const Container& container, U32 high, InCallable& callable);
+	};
+}
+
+#include "../../Private/Collections/RoaringBitmap.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,130 @@
+#ifndef ROARING_BITMAP_VIEW_HPP
+#define ROARING_BITMAP_VIEW_HPP
+
+#include <stdexcept>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A read-only view over a serialized RoaringBitmap.
+	 *
+	 * The serialized format is little-endian on every platform and starts with an 8 byte header
+	 * holding the magic number and the container count, followed by one 16 byte descriptor per
+	 * container, in ascending key order, holding its key, type, cardinality, element count and
+	 * the offset of its payload. Payloads are 8 byte aligned: an array container stores its
+	 * sorted 16-bit values, a bitmap container stores 1024 64-bit words and a run container
+	 * stores pairs of 16-bit run starts and lengths minus one. The view answers queries directly
+	 * from the buffer, so a memory-mapped file can be queried without copying it.
+	 */
+	class RoaringBitmapView
+	{
+	public:
+		using SelfType          = RoaringBitmapView;
+		using SelfTypePtr       = RoaringBitmapView*;
+		using SelfTypeLRef      = RoaringBitmapView&;
+		using ConstSelfType     = const RoaringBitmapView;
+		using ConstSelfTypePtr  = const RoaringBitmapView*;
+		using ConstSelfTypeLRef = const RoaringBitmapView&;
+
+	public:
+		static constexpr U32 MAGIC = 0x31425246;
+
+		static constexpr Size HEADER_SIZE = 8;
+		static constexpr Size DESCRIPTOR_SIZE = 16;
+
+		static constexpr U8 ARRAY_CONTAINER = 0;
+		static constexpr U8 BITMAP_CONTAINER = 1;
+		static constexpr U8 RUN_CONTAINER = 2;
+
+		static constexpr Size ARRAY_MAXIMUM_COUNT = 4096;
+		static constexpr Size BITMAP_WORD_COUNT = 1024;
+
+	public:
+		/**
+		 * @brief Describes a single container of the serialized bitmap.
+		 */
+		struct Descriptor
+		{
+			U16 key;
+			U8 type;
+			U32 cardinality;
+			U32 element_count;
+			const Byte* payload;
+		};
+
+	private:
+		const Byte* m_data;
+		Size m_size;
+		Size m_container_count;
+
+	public:
+		/**
+		 * @brief Buffer Constructor.
+		 *
+		 * Validates the buffer and initializes a view over it. The buffer must outlive the view.
+		 *
+		 * @throws std::invalid_argument if the buffer does not hold a valid serialized bitmap.
+		 */
+		RoaringBitmapView(const Byte* data, Size size);
+
+	public:
+		/**
+		 * @brief Gets the number of containers in the bitmap.
+		 *
+		 * @return Size storing the number of containers.
+		 */
+		Size GetContainerCount() const;
+
+		/**
+		 * @brief Gets the descriptor of the container at the specified position.
+		 *
+		 * @param index The position of the container.
+		 * @return The descriptor of the container.
+		 */
+		Descriptor GetDescriptor(Size index) const;
+
+	public:
+		/**
+		 * @brief Counts the number of values in the bitmap.
+		 *
+		 * @return The number of values.
+		 */
+		U64 GetCardinality() const;
+
+		/**
+		 * @brief Checks if the specified value is contained in the bitmap.
+		 *
+		 * @param value The value to search for.
+		 *
+		 * @return True if the value is contained, otherwise false.
+		 */
+		Bool Contains(U32 value) const;
+
+	public:
+		/**
+		 * @brief Invokes a callable with every value of the bitmap in ascending order.
+		 *
+		 * @param callable The callable, invoked with each value as a U32.
+		 */
+		template<typename InCallable>
+		Void ForEach(InCallable callable) const;
+
+	public:
+		static U16 LoadU16(const Byte* data);
+		static U32 LoadU32(const Byte* data);
+		static U64 LoadU64(const Byte* data);
+
+		static Void StoreU16(Byte* data, U16 value);
+		static Void StoreU32(Byte* data, U32 value);
+		static Void StoreU64(Byte* data, U64 value);
+	};
+}
+
+#include "../../Private/Collections/RoaringBitmapView.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,317 @@
+#ifndef SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY_HPP
+
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+#include <initializer_list>
+
+#include "AbstractCollection.hpp"
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An append-only array whose elements never move once constructed.
+	 *
+	 * The SegmentedArray class template grows by allocating segments of increasing power-of-two
+	 * capacity instead of reallocating, so pointers and references to its elements remain valid
+	 * until the element is popped or the array is cleared. Segment k holds FIRST_SEGMENT_CAPACITY
+	 * * 2^k elements, which lets indexing compute the segment from the position of the highest set
+	 * bit of the index in O(1).
+	 *
+	 * A single writer may append while any number of readers access elements concurrently without
+	 * locking, provided that readers only access indices below a count they observed through
+	 * GetCount. Popping, clearing, copying and assignment are not safe with concurrent readers.
+	 *
+	 * @tparam InElementType The type of elements to be stored in the array.
+	 * @tparam InAllocationPolicy The type of allocator policy the array uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class SegmentedArray : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, SegmentedArray, InAllocationPolicy)
+
+	public:
+		class Iterator : public AbstractIterator<ElementType>
+		{
+		public:
+			using BaseType = AbstractIterator<ElementType>;
+
+		public:
+			using SelfType = Iterator;
+			using SelfTypePtr = Iterator*;
+			using SelfTypeLRef = Iterator&;
+			using SelfTypeRRef = Iterator&&;
+			using ConstSelfType = const Iterator;
+			using ConstSelfTypePtr = const Iterator*;
+			using ConstSelfTypeLRef = const Iterator&;
+
+		private:
+			SegmentedArray* m_array;
+			Size m_index;
+			Size m_count;
+
+		public:
+			Iterator()
+				: BaseType(), m_array(nullptr), m_index(0), m_count(0) {}
+			Iterator(SegmentedArray* array, Size index, Size count)
+				: BaseType(index < count ? array->_element_at(index) : nullptr), m_array(array), m_index(index), m_count(count) {}
+
+		public:
+			Iterator(SelfTypeRRef other)
+				: BaseType(other), m_array(other.m_array), m_index(other.m_index), m_count(other.m_count) {}
+			Iterator(ConstSelfTypeLRef other)
+				: BaseType(other), m_array(other.m_array), m_index(other.m_index), m_count(other.m_count) {}
+
+		public:
+			~Iterator() = default;
+
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
+		public:
+			ElementTypePtr operator->() override
+			{
+				return this->m_ptr;
+			}
+			ElementTypeLRef operator*() override
+			{
+				return *this->m_ptr;
+			}
+
+		public:
+			SelfTypeLRef operator++() override
+			{
+				this->m_index++;
+				this->m_ptr = this->m_index < this->m_count ? this->m_array->_element_at(this->m_index) : nullptr;
+
+				return *this;
+			}
+			SelfTypeLRef operator--() override
+			{
+				this->m_index--;
+				this->m_ptr = this->m_index < this->m_count ? this->m_array->_element_at(this->m_index) : nullptr;
+
+				return *this;
+			}
+			SelfTypeLRef operator++(I32) override
+			{
+				return ++(*this);
+			}
+			SelfTypeLRef operator--(I32) override
+			{
+				return --(*this);
+			}
+		};
+
+	public:
+		static constexpr Size FIRST_SEGMENT_SHIFT = 4;
+		static constexpr Size FIRST_SEGMENT_CAPACITY = Size(1) << FIRST_SEGMENT_SHIFT;
+		static constexpr Size MAXIMUM_SEGMENT_COUNT = sizeof(Size) * 8 - FIRST_SEGMENT_SHIFT;
+
+	private:
+		Size m_segment_count;
+
+	private:
+		::std::atomic<Size> m_published_count;
+		::std::atomic<ElementTypePtr> m_segments[MAXIMUM_SEGMENT_COUNT];
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty segmented array without allocating any segment.
+		 */
+		SegmentedArray(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a segmented array with the specified initializer list.
+		 */
+		SegmentedArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SegmentedArray(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		SegmentedArray(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SegmentedArray() override;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 */
+		ElementTypeLRef operator[](Size index);
+
+		/**
+		 * @brief Array Subscript Operator.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * @return IIterator pointing to the first element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @return IIterator pointing to one past the last element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if this collection is not storing any elements.
+		 *
+		 * Safe to call while the writer appends.
+		 *
+		 * @return True if not storing any elements, otherwise false.
+		 */
+		Bool IsEmpty() const override;
+
+		/**
+		 * @brief Gets the number of elements published to readers.
+		 *
+		 * Safe to call while the writer appends. Every index below the returned count can be
+		 * accessed without further synchronization.
+		 *
+		 * @return Size storing the number of elements stored.
+		 */
+		Size GetCount() const override;
+
+		/**
+		 * @brief Gets the number of allocated segments.
+		 *
+		 * @return Size storing the number of allocated segments.
+		 */
+		Size GetSegmentCount() const;
+
+	public:
+		/**
+		 * @brief Retrieves a reference to the element at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the element to retrieve.
+		 * @return A reference to the element at the specified position.
+		 */
+		ElementTypeLRef At(Size index);
+
+		/**
+		 * @brief Retrieves a const reference to the element at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the element to retrieve.
+		 * @return A const reference to the element at the specified position.
+		 */
+		ConstElementTypeLRef At(Size index) const;
+
+	public:
+		/**
+		 * @brief Retrieves the last element in the collection.
+		 *
+		 * @return A reference to the last element.
+		 */
+		ElementTypeLRef GetBack();
+
+		/**
+		 * @brief Retrieves the first element in the collection.
+		 *
+		 * @return A reference to the first element.
+		 */
+		ElementTypeLRef GetFront();
+
+		/**
+		 * @brief Retrieves the last element in the collection.
+		 *
+		 * @return A const reference to the last element.
+		 */
+		ConstElementTypeLRef GetBack() const;
+
+		/**
+		 * @brief Retrieves the first element in the collection.
+		 *
+		 * @return A const reference to the first element.
+		 */
+		ConstElementTypeLRef GetFront() const;
+
+	public:
+		/**
+		 * @brief Allocates segments until the array can hold at least the specified number of
+		 * elements.
+		 *
+		 * Existing elements are never moved.
+		 *
+		 * @param capacity The number of elements to make room for.
+		 */
+		Void Reserve(Size capacity);
+
+	public:
+		/**
+		 * @brief Removes the last element in the collection.
+		 *
+		 * The segments are kept, so later appends reuse them.
+		 */
+		Void PopBack();
+
+	public:
+		/**
+		 * @brief Inserts an element at the end of the collection and publishes it to readers.
+		 *
+		 * @param element The element to be moved and added.
+		 * @return A reference to the added element, which remains valid until it is removed.
+		 */
+		ElementTypeLRef PushBack(ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element at the end of the collection and publishes it to readers.
+		 *
+		 * @param element The element to be copied and added.
+		 * @return A reference to the added element, which remains valid until it is removed.
+		 */
+		ElementTypeLRef PushBack(ConstElementTypeLRef element);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collection and releases every segment.
+		 */
+		Void Clear() override;
+
+	private:
+		ElementTypePtr _element_at(Size index) const;
+		ElementTypePtr _next_slot();
+
+	private:
+		Void _append_segment();
+		Void _release_segments();
+	};
+}
+
+#include "../../Private/Collections/SegmentedArray.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,278 @@
+#ifndef SHARED_ARRAY_HPP
+#define SHARED_ARRAY_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+#include "DynamicArray.hpp"
+#include "Reclaim/EpochManager.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An array whose immutable storage is shared by reference counting, so that copies
+	 * are O(1) snapshots and elements are only copied when a shared array is modified.
+	 *
+	 * The SharedArray class template is meant for large read-mostly arrays published to many
+	 * readers, such as configuration tables. Copying an array takes a snapshot by incrementing
+	 * the reference count of its storage. Modifying an array whose storage is shared with other
+	 * snapshots first clones the storage, so snapshots never observe later changes, while
+	 * modifying an array that owns its storage alone happens in place.
+	 *
+	 * Load, Store and Exchange may be called concurrently on the same array, which makes it a
+	 * lock-free publication point: writers prepare a new version in a private array and swap it
+	 * in with a single atomic exchange, and readers take snapshots without locking. Releasing the
+	 * reference of a replaced storage is deferred through the default EpochManager, so a reader
+	 * that loaded the old pointer can still safely take its reference, and every replacement
+	 * collects the storages that no reader can reach anymore. The modifying functions
+	 * must not run concurrently with any other access to the same array.
+	 *
+	 * @tparam InElementType The type of elements stored in the array.
+	 * @tparam InAllocationPolicy The type of allocator policy the array uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class SharedArray
+	{
+	public:
+		using SelfType          = SharedArray<InElementType, InAllocationPolicy>;
+		using SelfTypePtr       = SharedArray<InElementType, InAllocationPolicy>*;
+		using SelfTypeLRef      = SharedArray<InElementType, InAllocationPolicy>&;
+		using SelfTypeRRef      = SharedArray<InElementType, InAllocationPolicy>&&;
+		using ConstSelfType     = const SharedArray<InElementType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const SharedArray<InElementType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const SharedArray<InElementType, InAllocationPolicy>&;
+
+	public:
+		using ElementType          = InElementType;
+		using ElementTypePtr       = InElementType*;
+		using ElementTypeLRef      = InElementType&;
+		using ElementTypeRRef      = InElementType&&;
+		using ConstElementType     = const InElementType;
+		using ConstElementTypePtr  = const InElementType*;
+		using ConstElementTypeLRef = const InElementType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		/**
+		 * The elements follow the storage header at ELEMENTS_OFFSET. The storage remembers the
+		 * allocator it came from, since the last reference may be released by another array.
+		 */
+		struct Storage
+		{
+			::std::atomic<Size> references;
+
+			Size count;
+			Size capacity;
+
+			AllocatorTypePtr allocator;
+		};
+
+	private:
+		static constexpr Size STORAGE_ALIGNMENT = alignof(Storage) > alignof(InElementType) ? alignof(Storage) : alignof(InElementType);
+		static constexpr Size ELEMENTS_OFFSET = (sizeof(Storage) + alignof(InElementType) - 1) & ~(alignof(InElementType) - 1);
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		::std::atomic<Storage*> m_storage;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty array.
+		 */
+		SharedArray(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Buffer Constructor.
+		 *
+		 * Initializes an array with a copy of the specified buffer and count.
+		 */
+		SharedArray(ConstElementTypePtr buffer, Size count, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes an array with the values of the specified initializer list.
+		 */
+		SharedArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Dynamic Array Constructor.
+		 *
+		 * Initializes an array with a copy of the elements of the specified dynamic array.
+		 */
+		template<typename InOtherAllocationPolicy>
+		SharedArray(const DynamicArrayWithPolicy<InElementType, InOtherAllocationPolicy>& array, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SharedArray(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 *
+		 * Takes a snapshot of the other array in O(1).
+		 */
+		SharedArray(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SharedArray();
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 *
+		 * Shares the storage of the other array in O(1), as Store does.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Takes a snapshot of the array, safe to call while other threads Store to it.
+		 *
+		 * @return An array sharing the current storage.
+		 */
+		SelfType Load() const;
+
+		/**
+		 * @brief Replaces the storage of the array with the storage of another array, safe to
+		 * call while other threads Load from it.
+		 *
+		 * @param other The array to share the storage of.
+		 */
+		Void Store(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Replaces the storage of the array with the storage of another array and returns
+		 * the replaced version, safe to call while other threads Load from it.
+		 *
+		 * @param other The array to share the storage of.
+		 * @return An array holding the replaced storage.
+		 */
+		SelfType Exchange(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets the number of elements.
+		 *
+		 * @return Size storing the number of elements.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Checks whether the array is empty.
+		 *
+		 * @return True if the array has no elements, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+		/**
+		 * @brief Checks whether the storage is shared with other arrays, in which case the next
+		 * modification copies it.
+		 *
+		 * @return True if the storage is shared, otherwise false.
+		 */
+		Bool IsShared() const;
+
+		/**
+		 * @brief Gets the elements.
+		 *
+		 * @return A const pointer to the first element, or nullptr if the array has no storage.
+		 */
+		ConstElementTypePtr GetRawData() const;
+
+	public:
+		/**
+		 * @brief Gets the element at the specified index without bounds checking.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+		/**
+		 * @brief Gets the element at the specified index.
+		 *
+		 * @param index The index of the element.
+		 * @return A const reference to the element.
+		 *
+		 * @throws std::out_of_range if the index is out of range.
+		 */
+		ConstElementTypeLRef Get(Size index) const;
+
+	public:
+		/**
+		 * @brief Gets a modifiable reference to the element at the specified index, copying the
+		 * storage first if it is shared.
+		 *
+		 * @param index The index of the element.
+		 * @return A reference to the element, valid until the next modification or snapshot.
+		 *
+		 * @throws std::out_of_range if the index is out of range.
+		 */
+		ElementTypeLRef GetMutable(Size index);
+
+		/**
+		 * @brief Replaces the element at the specified index, copying the storage first if it
+		 * is shared.
+		 *
+		 * @param index The index of the element.
+		 * @param element The new value.
+		 *
+		 * @throws std::out_of_range if the index is out of range.
+		 */
+		Void Set(Size index, ConstElementTypeLRef element);
+
+		/**
+		 * @brief Appends an element, copying the storage first if it is shared.
+		 *
+		 * @param element The element to append.
+		 */
+		Void PushBack(ConstElementTypeLRef element);
+
+		/**
+		 * @brief Removes the last element, copying the storage first if it is shared.
+		 *
+		 * @throws std::length_error if the array is empty.
+		 */
+		Void PopBack();
+
+		/**
+		 * @brief Removes all the elements, releasing the reference to the storage.
+		 */
+		Void Clear();
+
+	private:
+		static ElementTypePtr _elements(Storage* storage);
+		static Storage* _create(Size capacity, AllocatorTypePtr allocator);
+		static Void _release(Storage* storage);
+		static Void _release_retired(VoidPtr storage, VoidPtr context);
+
+	private:
+		Storage* _acquire() const;
+		Storage* _mutable(Size capacity);
+		Void _retire(Storage* storage);
+		Void _assign(ConstElementTypePtr buffer, Size count);
+	};
+}
+
+#include "../../Private/Collections/SharedArray.inl"
+
+#endif
\ No newline at end of file
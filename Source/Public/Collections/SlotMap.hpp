@@ -0,0 +1,258 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A container that refers to its elements through generational handles that stay
+	 * valid while other elements are inserted and removed.
+	 *
+	 * The SlotMap class template keeps its elements packed in a dense DynamicArray for fast
+	 * iteration, and resolves handles through a sparse array of slots that store the dense index
+	 * of each element. Removing an element moves the last dense element into the hole and patches
+	 * its slot, so insertion, removal and lookup are all O(1). Every slot carries a 32-bit
+	 * generation that is bumped on insertion and removal, so a handle to a removed element is
+	 * detected rather than silently resolving to whichever element reuses its slot.
+	 *
+	 * @tparam InElementType The type of elements to be stored in the slot map.
+	 * @tparam InAllocationPolicy The type of allocator policy the slot map uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class SlotMap : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, SlotMap, InAllocationPolicy)
+
+	public:
+		/**
+		 * @brief A stable reference to an element of a slot map.
+		 *
+		 * A default constructed handle never refers to an element.
+		 */
+		struct Handle
+		{
+			U32 index = 0;
+			U32 generation = 0;
+
+			Bool operator==(const Handle& other) const
+			{
+				return this->index == other.index && this->generation == other.generation;
+			}
+			Bool operator!=(const Handle& other) const
+			{
+				return !(*this == other);
+			}
+		};
+
+	private:
+		struct Slot
+		{
+			U32 index;
+			U32 generation;
+		};
+
+	private:
+		static constexpr U32 INVALID_INDEX = ::std::numeric_limits<U32>::max();
+
+	private:
+		U32 m_free_head;
+
+	private:
+		DynamicArrayWithPolicy<Slot, InAllocationPolicy> m_slots;
+
+	private:
+		DynamicArrayWithPolicy<ElementType, InAllocationPolicy> m_values;
+		DynamicArrayWithPolicy<U32, InAllocationPolicy> m_value_slots;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty slot map.
+		 */
+		SlotMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SlotMap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 *
+		 * Handles issued by the other slot map remain valid for the copy.
+		 */
+		SlotMap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SlotMap() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Handle Subscript Operator.
+		 *
+		 * The handle is not validated.
+		 */
+		ElementTypeLRef operator[](Handle handle);
+
+		/**
+		 * @brief Handle Subscript Operator.
+		 *
+		 * The handle is not validated.
+		 */
+		ConstElementTypeLRef operator[](Handle handle) const;
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * Elements are traversed in dense order, which changes as elements are removed.
+		 *
+		 * @return IIterator pointing to the first element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @return IIterator pointing to one past the last element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if the specified handle refers to an element of the slot map.
+		 *
+		 * @param handle The handle to check.
+		 *
+		 * @return True if the handle is valid, otherwise false.
+		 */
+		Bool Contains(Handle handle) const;
+
+	public:
+		/**
+		 * @brief Retrieves the element referred to by the specified handle.
+		 *
+		 * @param handle The handle of the element.
+		 * @return A reference to the element.
+		 *
+		 * @throws std::out_of_range if the handle is not valid.
+		 */
+		ElementTypeLRef Get(Handle handle);
+
+		/**
+		 * @brief Retrieves the element referred to by the specified handle.
+		 *
+		 * @param handle The handle of the element.
+		 * @return A const reference to the element.
+		 *
+		 * @throws std::out_of_range if the handle is not valid.
+		 */
+		ConstElementTypeLRef Get(Handle handle) const;
+
+		/**
+		 * @brief Retrieves the element referred to by the specified handle, if any.
+		 *
+		 * @param handle The handle of the element.
+		 * @return A pointer to the element, or nullptr if the handle is not valid.
+		 */
+		ElementTypePtr TryGet(Handle handle);
+
+		/**
+		 * @brief Retrieves the element referred to by the specified handle, if any.
+		 *
+		 * @param handle The handle of the element.
+		 * @return A const pointer to the element, or nullptr if the handle is not valid.
+		 */
+		ConstElementTypePtr TryGet(Handle handle) const;
+
+	public:
+		/**
+		 * @brief Retrieves the handle of the element at the specified dense position.
+		 *
+		 * @param index The dense position of the element, matching the iteration order.
+		 * @return The handle of the element.
+		 */
+		Handle GetHandle(Size index) const;
+
+		/**
+		 * @brief Gets a pointer to the densely packed elements.
+		 *
+		 * @return Const pointer to the first element.
+		 */
+		ConstElementTypePtr GetRawData() const;
+
+	public:
+		/**
+		 * @brief Reserves room for the specified number of elements.
+		 *
+		 * @param capacity The number of elements to make room for.
+		 */
+		Void Reserve(Size capacity);
+
+	public:
+		/**
+		 * @brief Inserts an element into the collection.
+		 *
+		 * @param element The element to be moved and added.
+		 * @return The handle referring to the added element.
+		 */
+		Handle Insert(ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element into the collection.
+		 *
+		 * @param element The element to be copied and added.
+		 * @return The handle referring to the added element.
+		 */
+		Handle Insert(ConstElementTypeLRef element);
+
+	public:
+		/**
+		 * @brief Removes the element referred to by the specified handle.
+		 *
+		 * The last element in dense order takes the place of the removed one; its handle is not
+		 * affected.
+		 *
+		 * @param handle The handle of the element to remove.
+		 *
+		 * @throws std::out_of_range if the handle is not valid.
+		 */
+		Void Remove(Handle handle);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collection, invalidating every handle.
+		 */
+		Void Clear() override;
+
+	private:
+		Void _reserve_slot();
+		U32 _acquire_slot();
+		Void _release_slot(U32 slot_index);
+	};
+}
+
+#include "../../Private/Collections/SlotMap.inl"
+
+#endif
\ No newline at end of file
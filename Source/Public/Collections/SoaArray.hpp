@@ -0,0 +1,391 @@
+#ifndef SOA_ARRAY_HPP
+#define SOA_ARRAY_HPP
+
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A dynamic array of records stored as one column per field.
+	 *
+	 * The SoaArrayWithPolicy class template keeps the fields of its rows in separate arrays
+	 * that share a count and a capacity, so a loop that only reads one field streams through
+	 * contiguous memory of that field instead of pulling whole records into cache. Every column
+	 * is aligned to COLUMN_ALIGNMENT bytes and exposed through GetRawData, so simple loops over
+	 * a column can be auto-vectorized. Rows are accessed as tuples of references, either by
+	 * index or through the view returned by Zip.
+	 *
+	 * @tparam InAllocationPolicy The type of allocator policy the array uses to manage its memory.
+	 * @tparam InFieldTypes The types of the fields of each row, one column per type.
+	 */
+	template<typename InAllocationPolicy, typename... InFieldTypes>
+	class SoaArrayWithPolicy
+	{
+		static_assert(sizeof...(InFieldTypes) > 0, "A struct-of-arrays container needs at least one field");
+		static_assert(((alignof(InFieldTypes) <= 64) && ...), "The fields of a struct-of-arrays container must not be over-aligned past a cache line");
+
+	public:
+		using SelfType          = SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>;
+		using SelfTypePtr       = SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>*;
+		using SelfTypeLRef      = SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>&;
+		using SelfTypeRRef      = SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>&&;
+		using ConstSelfType     = const SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>;
+		using ConstSelfTypePtr  = const SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>*;
+		using ConstSelfTypeLRef = const SoaArrayWithPolicy<InAllocationPolicy, InFieldTypes...>&;
+
+	public:
+		using RowType              = ::std::tuple<InFieldTypes...>;
+		using RowTypeLRef          = ::std::tuple<InFieldTypes&...>;
+		using ConstRowTypeLRef     = ::std::tuple<const InFieldTypes&...>;
+
+		template<Size InIndex>
+		using FieldType = ::std::tuple_element_t<InIndex, RowType>;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	public:
+		static constexpr Size FIELD_COUNT = sizeof...(InFieldTypes);
+		static constexpr Size COLUMN_ALIGNMENT = 64;
+
+	private:
+		using ColumnsType      = ::std::tuple<InFieldTypes*...>;
+		using IndexesType      = ::std::index_sequence_for<InFieldTypes...>;
+
+	public:
+		/**
+		 * @brief Iterates the rows of the array, yielding a tuple of references per row.
+		 */
+		template<typename InRowType, typename InColumnsType>
+		class ZipIterator
+		{
+		private:
+			InColumnsType m_columns;
+			Size m_index;
+
+		public:
+			ZipIterator(InColumnsType columns, Size index)
+				: m_columns(columns), m_index(index) {}
+
+		public:
+			InRowType operator*() const
+			{
+				return _row(::std::index_sequence_for<InFieldTypes...>());
+			}
+
+		public:
+			ZipIterator& operator++()
+			{
+				this->m_index++;
+
+				return *this;
+			}
+			ZipIterator& operator--()
+			{
+				this->m_index--;
+
+				return *this;
+			}
+
+		public:
+			Bool operator==(const ZipIterator& other) const
+			{
+				return this->m_index == other.m_index;
+			}
+			Bool operator!=(const ZipIterator& other) const
+			{
+				return this->m_index != other.m_index;
+			}
+
+		private:
+			template<Size... InIndexes>
+			InRowType _row(::std::index_sequence<InIndexes...>) const
+			{
+				return InRowType(::std::get<InIndexes>(this->m_columns)[this->m_index]...);
+			}
+		};
+
+		/**
+		 * @brief A range over the rows of the array, usable in range-based for loops.
+		 */
+		template<typename InIteratorType>
+		class ZipView
+		{
+		private:
+			InIteratorType m_begin;
+			InIteratorType m_end;
+
+		public:
+			ZipView(InIteratorType begin, InIteratorType end)
+				: m_begin(begin), m_end(end) {}
+
+		public:
+			InIteratorType begin() const
+			{
+				return this->m_begin;
+			}
+			InIteratorType end() const
+			{
+				return this->m_end;
+			}
+		};
+
+	public:
+		using Iterator      = ZipIterator<RowTypeLRef, ColumnsType>;
+		using ConstIterator = ZipIterator<ConstRowTypeLRef, ::std::tuple<const InFieldTypes*...>>;
+
+	private:
+		Size m_count;
+		Size m_capacity;
+
+	private:
+		AllocatorTypePtr m_allocator;
+
+	private:
+		ColumnsType m_columns;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty array.
+		 */
+		SoaArrayWithPolicy(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Intial Capacity Constructor.
+		 *
+		 * Initializes an empty array with room for the specified number of rows.
+		 */
+		SoaArrayWithPolicy(Size capacity, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SoaArrayWithPolicy(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		SoaArrayWithPolicy(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SoaArrayWithPolicy();
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the row at the specified position as a tuple of references, without bounds checking.
+		 */
+		RowTypeLRef operator[](Size index);
+
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the row at the specified position as a tuple of const references, without bounds checking.
+		 */
+		ConstRowTypeLRef operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Retrieves the row at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the row to retrieve.
+		 * @return A tuple of references to the fields of the row.
+		 */
+		RowTypeLRef At(Size index);
+
+		/**
+		 * @brief Retrieves the row at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the row to retrieve.
+		 * @return A tuple of const references to the fields of the row.
+		 */
+		ConstRowTypeLRef At(Size index) const;
+
+		/**
+		 * @brief Retrieves a single field of the row at a specified position, without bounds checking.
+		 *
+		 * @tparam InIndex The index of the field.
+		 * @param index The position of the row.
+		 * @return A reference to the field.
+		 */
+		template<Size InIndex>
+		FieldType<InIndex>& Get(Size index);
+
+		/**
+		 * @brief Retrieves a single field of the row at a specified position, without bounds checking.
+		 *
+		 * @tparam InIndex The index of the field.
+		 * @param index The position of the row.
+		 * @return A const reference to the field.
+		 */
+		template<Size InIndex>
+		const FieldType<InIndex>& Get(Size index) const;
+
+	public:
+		/**
+		 * @brief Gets a pointer to the column of a field.
+		 *
+		 * The column holds GetCount() contiguous values and is aligned to COLUMN_ALIGNMENT bytes.
+		 *
+		 * @tparam InIndex The index of the field.
+		 * @return Pointer to the first value of the column.
+		 */
+		template<Size InIndex>
+		FieldType<InIndex>* GetRawData();
+
+		/**
+		 * @brief Gets a pointer to the column of a field.
+		 *
+		 * The column holds GetCount() contiguous values and is aligned to COLUMN_ALIGNMENT bytes.
+		 *
+		 * @tparam InIndex The index of the field.
+		 * @return Const pointer to the first value of the column.
+		 */
+		template<Size InIndex>
+		const FieldType<InIndex>* GetRawData() const;
+
+	public:
+		/**
+		 * @brief Gets a view over the rows of the array, for use in range-based for loops.
+		 *
+		 * @return A view yielding a tuple of references per row.
+		 */
+		ZipView<Iterator> Zip();
+
+		/**
+		 * @brief Gets a view over the rows of the array, for use in range-based for loops.
+		 *
+		 * @return A view yielding a tuple of const references per row.
+		 */
+		ZipView<ConstIterator> Zip() const;
+
+	public:
+		/**
+		 * @brief Checks if the array has no rows.
+		 *
+		 * @return True if the array is empty, otherwise false.
+		 */
+		Bool IsEmpty() const;
+
+		/**
+		 * @brief Gets the number of rows in the array.
+		 *
+		 * @return Size storing the number of rows.
+		 */
+		Size GetCount() const;
+
+		/**
+		 * @brief Gets the number of rows the array can hold without reallocating.
+		 *
+		 * @return Size storing the capacity.
+		 */
+		Size GetCapacity() const;
+
+	public:
+		/**
+		 * @brief Grows every column so the specified number of rows fit without reallocating.
+		 *
+		 * The rows are moved into new columns, whose alignment is checked before the current
+		 * columns are released.
+		 *
+		 * @param capacity The number of rows to make room for.
+		 *
+		 * @throws std::logic_error if the allocation policy returns a column that is not aligned to
+		 * COLUMN_ALIGNMENT bytes.
+		 */
+		Void Reserve(Size capacity);
+
+	public:
+		/**
+		 * @brief Inserts a row at the end of the array.
+		 *
+		 * @param row The row whose fields are moved into the columns.
+		 */
+		Void PushBack(RowType&& row);
+
+		/**
+		 * @brief Inserts a row at the end of the array.
+		 *
+		 * @param row The row whose fields are copied into the columns.
+		 */
+		Void PushBack(const RowType& row);
+
+		/**
+		 * @brief Removes the last row in the array.
+		 */
+		Void PopBack();
+
+		/**
+		 * @brief Removes the row at the specified index, keeping the order of the others.
+		 *
+		 * @param index The position of the row to remove.
+		 */
+		Void Remove(Size index);
+
+		/**
+		 * @brief Removes the row at the specified index by moving the last row into its place.
+		 *
+		 * @param index The position of the row to remove.
+		 */
+		Void RemoveSwap(Size index);
+
+	public:
+		/**
+		 * @brief Removes all the rows from the array.
+		 */
+		Void Clear();
+
+	private:
+		template<Size... InIndexes>
+		RowTypeLRef _row(Size index, ::std::index_sequence<InIndexes...>);
+		template<Size... InIndexes>
+		ConstRowTypeLRef _row(Size index, ::std::index_sequence<InIndexes...>) const;
+
+	private:
+		template<Size... InIndexes>
+		Void _move_row(Size index, RowType& row, ::std::index_sequence<InIndexes...>);
+		template<Size... InIndexes>
+		Void _copy_row(Size index, const RowType& row, ::std::index_sequence<InIndexes...>);
+		template<Size... InIndexes>
+		Void _copy_columns(ConstSelfTypeLRef other, ::std::index_sequence<InIndexes...>);
+		template<Size... InIndexes>
+		Void _relocate_columns(ColumnsType columns, ::std::index_sequence<InIndexes...>);
+
+	private:
+		Void _grow();
+		Void _release();
+	};
+
+	template<typename... InFieldTypes>
+	using SoaArray = SoaArrayWithPolicy<HeapAllocationPolicy, InFieldTypes...>;
+}
+
+#include "../../Private/Collections/SoaArray.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,247 @@
+#ifndef SPARSE_MAP_HPP
+#define SPARSE_MAP_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A map from dense unsigned integer keys to values with O(1) insertion, removal and
+	 * lookup.
+	 *
+	 * The SparseMap class template pairs the layout of SparseSet with a parallel dense array of
+	 * values, so both keys and values are packed and iteration visits only the contained values.
+	 * Clear resets the key count without touching the sparse array; the values are destroyed,
+	 * which costs nothing for trivially destructible values.
+	 *
+	 * @tparam InKeyType The unsigned integer type of the keys, typically U32.
+	 * @tparam InValueType The type of value stored alongside each key.
+	 * @tparam InAllocationPolicy The type of allocator policy the map uses to manage its memory.
+	 */
+	template<typename InKeyType, typename InValueType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class SparseMap : public AbstractCollection<InValueType, InAllocationPolicy>
+	{
+		static_assert(::std::is_unsigned<InKeyType>::value, "The key type of a sparse map must be an unsigned integer");
+
+	public:
+		using BaseType = AbstractCollection<InValueType, InAllocationPolicy>;
+
+	public:
+		using SelfType          = SparseMap<InKeyType, InValueType, InAllocationPolicy>;
+		using SelfTypePtr       = SparseMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using SelfTypeLRef      = SparseMap<InKeyType, InValueType, InAllocationPolicy>&;
+		using SelfTypeRRef      = SparseMap<InKeyType, InValueType, InAllocationPolicy>&&;
+		using ConstSelfType     = const SparseMap<InKeyType, InValueType, InAllocationPolicy>;
+		using ConstSelfTypePtr  = const SparseMap<InKeyType, InValueType, InAllocationPolicy>*;
+		using ConstSelfTypeLRef = const SparseMap<InKeyType, InValueType, InAllocationPolicy>&;
+
+	public:
+		using KeyType          = InKeyType;
+		using ConstKeyType     = const InKeyType;
+		using ConstKeyTypePtr  = const InKeyType*;
+		using ConstKeyTypeLRef = const InKeyType&;
+
+	public:
+		using ValueType          = InValueType;
+		using ValueTypePtr       = InValueType*;
+		using ValueTypeLRef      = InValueType&;
+		using ValueTypeRRef      = InValueType&&;
+		using ConstValueType     = const InValueType;
+		using ConstValueTypePtr  = const InValueType*;
+		using ConstValueTypeLRef = const InValueType&;
+
+	public:
+		using AllocatorType          = Allocator<InAllocationPolicy>;
+		using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;
+		using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;
+		using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;
+
+	private:
+		DynamicArrayWithPolicy<KeyType, InAllocationPolicy> m_keys;
+		DynamicArrayWithPolicy<ValueType, InAllocationPolicy> m_values;
+
+	private:
+		DynamicArrayWithPolicy<U32, InAllocationPolicy> m_sparse;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty sparse map.
+		 */
+		SparseMap(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Intial Capacity Constructor.
+		 *
+		 * Initializes an empty sparse map with room for keys in the range [0, universe).
+		 */
+		SparseMap(Size universe, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SparseMap(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		SparseMap(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SparseMap() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first value in the collection.
+		 *
+		 * Values are traversed in dense order, which changes as keys are removed.
+		 *
+		 * @return IIterator pointing to the first value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last value in the collection.
+		 *
+		 * @return IIterator pointing to one past the last value.
+		 */
+		typename AbstractIterator<ValueType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if the specified key is contained in the map.
+		 *
+		 * @param key The key to search for.
+		 *
+		 * @return True if the key is contained, otherwise false.
+		 */
+		Bool Contains(KeyType key) const;
+
+	public:
+		/**
+		 * @brief Retrieves the value stored with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @return A reference to the value.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ValueTypeLRef Get(KeyType key);
+
+		/**
+		 * @brief Retrieves the value stored with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @return A const reference to the value.
+		 *
+		 * @throws std::out_of_range if the key is not contained.
+		 */
+		ConstValueTypeLRef Get(KeyType key) const;
+
+		/**
+		 * @brief Retrieves the value stored with the specified key, if any.
+		 *
+		 * @param key The key of the value.
+		 * @return A pointer to the value, or nullptr if the key is not contained.
+		 */
+		ValueTypePtr TryGet(KeyType key);
+
+		/**
+		 * @brief Retrieves the value stored with the specified key, if any.
+		 *
+		 * @param key The key of the value.
+		 * @return A const pointer to the value, or nullptr if the key is not contained.
+		 */
+		ConstValueTypePtr TryGet(KeyType key) const;
+
+	public:
+		/**
+		 * @brief Gets a pointer to the densely packed keys, parallel to the values.
+		 *
+		 * @return Const pointer to the first key.
+		 */
+		ConstKeyTypePtr GetKeys() const;
+
+		/**
+		 * @brief Gets a pointer to the densely packed values, parallel to the keys.
+		 *
+		 * @return Const pointer to the first value.
+		 */
+		ConstValueTypePtr GetValues() const;
+
+	public:
+		/**
+		 * @brief Reserves room for keys in the range [0, universe).
+		 *
+		 * @param universe One past the largest key to make room for.
+		 */
+		Void Reserve(Size universe);
+
+	public:
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be moved and added.
+		 *
+		 * @return True if the value was added, or false if the key was already contained.
+		 */
+		Bool Insert(KeyType key, ValueTypeRRef value);
+
+		/**
+		 * @brief Inserts a value with the specified key.
+		 *
+		 * @param key The key of the value.
+		 * @param value The value to be copied and added.
+		 *
+		 * @return True if the value was added, or false if the key was already contained.
+		 */
+		Bool Insert(KeyType key, ConstValueTypeLRef value);
+
+	public:
+		/**
+		 * @brief Removes the value stored with the specified key.
+		 *
+		 * The last entry in dense order takes the place of the removed one.
+		 *
+		 * @param key The key to remove.
+		 *
+		 * @return True if the key was removed, or false if it was not contained.
+		 */
+		Bool Remove(KeyType key);
+
+	public:
+		/**
+		 * @brief Removes all the entries from this collection.
+		 */
+		Void Clear() override;
+
+	private:
+		Void _push_key(KeyType key);
+	};
+}
+
+#include "../../Private/Collections/SparseMap.inl"
+
+#endif
\ No newline at end of file
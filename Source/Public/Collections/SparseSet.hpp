@@ -0,0 +1,196 @@
+#ifndef SPARSE_SET_HPP
+#define SPARSE_SET_HPP
+
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A set of dense unsigned integer identifiers with O(1) insertion, removal, lookup
+	 * and clearing.
+	 *
+	 * The SparseSet class template stores its elements packed in a dense DynamicArray, and keeps
+	 * a sparse array indexed by element that records each element's dense position. An element is
+	 * contained only if its sparse entry points inside the dense range and back at the element, so
+	 * stale sparse entries never need to be reset and Clear only resets the count. Iteration visits
+	 * only the contained elements, in dense order. The sparse array grows to the largest element
+	 * inserted, so elements should be drawn from a bounded range.
+	 *
+	 * @tparam InElementType The unsigned integer type of the elements, typically U32.
+	 * @tparam InAllocationPolicy The type of allocator policy the set uses to manage its memory.
+	 */
+	template<typename InElementType = U32, typename InAllocationPolicy = HeapAllocationPolicy>
+	class SparseSet : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+		static_assert(::std::is_unsigned<InElementType>::value, "The element type of a sparse set must be an unsigned integer");
+
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, SparseSet, InAllocationPolicy)
+
+	private:
+		using DenseArrayType = DynamicArrayWithPolicy<ElementType, InAllocationPolicy>;
+
+	private:
+		DenseArrayType m_dense;
+		DynamicArrayWithPolicy<U32, InAllocationPolicy> m_sparse;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty sparse set.
+		 */
+		SparseSet(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Intial Capacity Constructor.
+		 *
+		 * Initializes an empty sparse set with room for elements in the range [0, universe).
+		 */
+		SparseSet(Size universe, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		SparseSet(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		SparseSet(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~SparseSet() override = default;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the element at the specified dense position.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * Elements are traversed in dense order, which changes as elements are removed.
+		 *
+		 * @return IIterator pointing to the first element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @return IIterator pointing to one past the last element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Checks if the specified element is contained in the set.
+		 *
+		 * @param element The element to search for.
+		 *
+		 * @return True if the element is contained, otherwise false.
+		 */
+		Bool Contains(ElementType element) const;
+
+		/**
+		 * @brief Checks if every element of the specified set is contained in this set.
+		 *
+		 * @param other The set whose elements to search for.
+		 *
+		 * @return True if every element is contained, otherwise false.
+		 */
+		Bool ContainsAll(ConstSelfTypeLRef other) const;
+
+		/**
+		 * @brief Gets a pointer to the densely packed elements.
+		 *
+		 * @return Const pointer to the first element.
+		 */
+		ConstElementTypePtr GetRawData() const;
+
+	public:
+		/**
+		 * @brief Reserves room for elements in the range [0, universe).
+		 *
+		 * @param universe One past the largest element to make room for.
+		 */
+		Void Reserve(Size universe);
+
+	public:
+		/**
+		 * @brief Inserts an element into the set.
+		 *
+		 * @param element The element to add.
+		 *
+		 * @return True if the element was added, or false if it was already contained.
+		 */
+		Bool Insert(ElementType element);
+
+		/**
+		 * @brief Inserts every element of the specified set into this set.
+		 *
+		 * @param other The set whose elements to add.
+		 */
+		Void InsertAll(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Removes an element from the set.
+		 *
+		 * The last element in dense order takes the place of the removed one.
+		 *
+		 * @param element The element to remove.
+		 *
+		 * @return True if the element was removed, or false if it was not contained.
+		 */
+		Bool Remove(ElementType element);
+
+		/**
+		 * @brief Removes every element of the specified set from this set.
+		 *
+		 * @param other The set whose elements to remove.
+		 */
+		Void RemoveAll(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Removes every element that is not contained in the specified set.
+		 *
+		 * @param other The set whose elements to keep.
+		 */
+		Void RetainAll(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collection in O(1).
+		 */
+		Void Clear() override;
+	};
+}
+
+#include "../../Private/Collections/SparseSet.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,251 @@
+#ifndef STATIC_BIT_SET_HPP
+#define STATIC_BIT_SET_HPP
+
+#include <stdexcept>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include <forge-memory/MemoryUtilities.hpp>
+
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief A fixed-size set of bits packed 64 to a word.
+	 *
+	 * The StaticBitSet class template stores its bits inline without any dynamic allocation. Set
+	 * operations combine whole words at a time, PopCount and FindNextSet use hardware bit counting
+	 * and scanning, and bulk operations use AVX2 when the library is compiled with it enabled.
+	 * Bits past InBitCount in the last word are always kept clear.
+	 *
+	 * @tparam InBitCount The number of bits in the set.
+	 */
+	template<Size InBitCount>
+	class StaticBitSet
+	{
+		static_assert(InBitCount > 0, "The bit count of a static bit set must be greater than 0");
+
+	public:
+		using SelfType          = StaticBitSet<InBitCount>;
+		using SelfTypePtr       = StaticBitSet<InBitCount>*;
+		using SelfTypeLRef      = StaticBitSet<InBitCount>&;
+		using SelfTypeRRef      = StaticBitSet<InBitCount>&&;
+		using ConstSelfType     = const StaticBitSet<InBitCount>;
+		using ConstSelfTypePtr  = const StaticBitSet<InBitCount>*;
+		using ConstSelfTypeLRef = const StaticBitSet<InBitCount>&;
+
+	public:
+		using WordType = U64;
+
+	public:
+		static constexpr Size BIT_COUNT = InBitCount;
+		static constexpr Size WORD_COUNT = (InBitCount + 63) / 64;
+
+	private:
+		static constexpr WordType LAST_WORD_MASK = InBitCount % 64 == 0 ? ~WordType(0) : (WordType(1) << (InBitCount % 64)) - 1;
+
+	private:
+		WordType m_words[WORD_COUNT];
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a bit set with every bit clear.
+		 */
+		StaticBitSet();
+
+	public:
+		/**
+		 * @brief Copy Constructor.
+		 */
+		StaticBitSet(ConstSelfTypeLRef other) = default;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~StaticBitSet() = default;
+
+	public:
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
+	public:
+		/**
+		 * @brief Equality Operator.
+		 */
+		Bool operator==(ConstSelfTypeLRef other) const;
+
+		/**
+		 * @brief Inequality Operator.
+		 */
+		Bool operator!=(ConstSelfTypeLRef other) const;
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 *
+		 * Retrieves the bit at the specified position without bounds checking.
+		 */
+		Bool operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Gets the number of bits in the set.
+		 *
+		 * @return Size storing the number of bits.
+		 */
+		constexpr Size GetBitCount() const;
+
+		/**
+		 * @brief Gets the number of words backing the set.
+		 *
+		 * @return Size storing the number of words.
+		 */
+		constexpr Size GetWordCount() const;
+
+		/**
+		 * @brief Gets a pointer to the words backing the set.
+		 *
+		 * @return Const pointer to the first word.
+		 */
+		const WordType* GetRawData() const;
+
+	public:
+		/**
+		 * @brief Retrieves the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 * @return True if the bit is set, otherwise false.
+		 */
+		Bool Test(Size index) const;
+
+		/**
+		 * @brief Checks if any bit is set.
+		 *
+		 * @return True if at least one bit is set, otherwise false.
+		 */
+		Bool Any() const;
+
+		/**
+		 * @brief Checks if every bit is set.
+		 *
+		 * @return True if every bit is set, otherwise false.
+		 */
+		Bool All() const;
+
+		/**
+		 * @brief Checks if no bit is set.
+		 *
+		 * @return True if no bit is set, otherwise false.
+		 */
+		Bool None() const;
+
+	public:
+		/**
+		 * @brief Counts the number of set bits.
+		 *
+		 * @return Size storing the number of set bits.
+		 */
+		Size PopCount() const;
+
+		/**
+		 * @brief Finds the first set bit.
+		 *
+		 * @return The position of the first set bit, or the bit count if no bit is set.
+		 */
+		Size FindFirstSet() const;
+
+		/**
+		 * @brief Finds the first set bit after the specified position.
+		 *
+		 * @param index The position to search after.
+		 * @return The position of the next set bit, or the bit count if there is none.
+		 */
+		Size FindNextSet(Size index) const;
+
+	public:
+		/**
+		 * @brief Sets the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Set(Size index);
+
+		/**
+		 * @brief Clears the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Reset(Size index);
+
+		/**
+		 * @brief Flips the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 */
+		Void Flip(Size index);
+
+		/**
+		 * @brief Assigns the bit at the specified position, with bounds checking.
+		 *
+		 * @param index The position of the bit.
+		 * @param value The value to assign.
+		 */
+		Void Assign(Size index, Bool value);
+
+	public:
+		/**
+		 * @brief Sets every bit.
+		 */
+		Void SetAll();
+
+		/**
+		 * @brief Clears every bit.
+		 */
+		Void ResetAll();
+
+		/**
+		 * @brief Flips every bit.
+		 */
+		Void FlipAll();
+
+	public:
+		/**
+		 * @brief Keeps only the bits that are also set in the other bit set.
+		 *
+		 * @param other The bit set to intersect with.
+		 */
+		Void And(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Sets every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set to unite with.
+		 */
+		Void Or(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Flips every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set to combine with.
+		 */
+		Void Xor(ConstSelfTypeLRef other);
+
+		/**
+		 * @brief Clears every bit that is set in the other bit set.
+		 *
+		 * @param other The bit set whose bits to clear.
+		 */
+		Void AndNot(ConstSelfTypeLRef other);
+	};
+}
+
+#include "../../Private/Collections/StaticBitSet.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,331 @@
+#ifndef TIERED_ARRAY_HPP
+#define TIERED_ARRAY_HPP
+
+#include <utility>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An ordered array that supports insertion and removal in the middle in O(sqrt n).
+	 *
+	 * The TieredArray class template stores its elements in a sequence of fixed-capacity circular
+	 * blocks, where every block except the last is full. Indexing resolves the block and the slot
+	 * with shifts and masks in O(1). Inserting or removing in the middle only shifts elements
+	 * inside one block and then rotates a single element through each following block, so both
+	 * operations cost O(B + n / B). The block capacity B is a power of two that doubles whenever
+	 * the element count exceeds B * B, keeping B close to sqrt n.
+	 *
+	 * Unlike DynamicArray, the elements are not stored contiguously.
+	 *
+	 * @tparam InElementType The type of elements to be stored in the array.
+	 * @tparam InAllocationPolicy The type of allocator policy the array uses to manage its memory.
+	 */
+	template<typename InElementType, typename InAllocationPolicy = HeapAllocationPolicy>
+	class TieredArray : public AbstractCollection<InElementType, InAllocationPolicy>
+	{
+	DYNAMIC_COLLECTION_TYPEDEFS(AbstractCollection, TieredArray, InAllocationPolicy)
+
+	public:
+		class Iterator : public AbstractIterator<ElementType>
+		{
+		public:
+			using BaseType = AbstractIterator<ElementType>;
+
+		public:
+			using SelfType = Iterator;
+			using SelfTypePtr = Iterator*;
+			using SelfTypeLRef = Iterator&;
+			using SelfTypeRRef = Iterator&&;
+			using ConstSelfType = const Iterator;
+			using ConstSelfTypePtr = const Iterator*;
+			using ConstSelfTypeLRef = const Iterator&;
+
+		private:
+			TieredArray* m_array;
+			Size m_index;
+
+		public:
+			Iterator()
+				: BaseType(), m_array(nullptr), m_index(0) {}
+			Iterator(TieredArray* array, Size index)
+				: BaseType(array->_element_at(index)), m_array(array), m_index(index) {}
+
+		public:
+			Iterator(SelfTypeRRef other)
+				: BaseType(other), m_array(other.m_array), m_index(other.m_index) {}
+			Iterator(ConstSelfTypeLRef other)
+				: BaseType(other), m_array(other.m_array), m_index(other.m_index) {}
+
+		public:
+			~Iterator() = default;
+
+		public:
+			SelfTypeLRef operator=(SelfTypeRRef other) = default;
+			SelfTypeLRef operator=(ConstSelfTypeLRef other) = default;
+
+		public:
+			ElementTypePtr operator->() override
+			{
+				return this->m_ptr;
+			}
+			ElementTypeLRef operator*() override
+			{
+				return *this->m_ptr;
+			}
+
+		public:
+			SelfTypeLRef operator++() override
+			{
+				this->m_ptr = this->m_array->_element_at(++this->m_index);
+
+				return *this;
+			}
+			SelfTypeLRef operator--() override
+			{
+				this->m_ptr = this->m_array->_element_at(--this->m_index);
+
+				return *this;
+			}
+			SelfTypeLRef operator++(I32) override
+			{
+				return ++(*this);
+			}
+			SelfTypeLRef operator--(I32) override
+			{
+				return --(*this);
+			}
+		};
+
+	private:
+		struct Block
+		{
+			ElementTypePtr data;
+			Size head;
+			Size count;
+		};
+
+	private:
+		static constexpr Size MINIMUM_BLOCK_SHIFT = 4;
+
+	private:
+		Size m_block_shift;
+		Size m_block_mask;
+
+	private:
+		DynamicArrayWithPolicy<Block, InAllocationPolicy> m_blocks;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty tiered array.
+		 */
+		TieredArray(AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+		/**
+		 * @brief Initializer list Constructor.
+		 *
+		 * Initializes a tiered array with the specified initializer list.
+		 */
+		TieredArray(std::initializer_list<ElementType> init_list, AllocatorTypePtr allocator = GetDefaultAllocator<AllocatorType>());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		TieredArray(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Constructor.
+		 */
+		TieredArray(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~TieredArray() override;
+
+	public:
+		/**
+		 * @brief Move Assignment Operator.
+		 */
+		SelfTypeLRef operator=(SelfTypeRRef other);
+
+		/**
+		 * @brief Copy Assignment Operator.
+		 */
+		SelfTypeLRef operator=(ConstSelfTypeLRef other);
+
+	public:
+		/**
+		 * @brief Array Subscript Operator.
+		 */
+		ElementTypeLRef operator[](Size index);
+
+		/**
+		 * @brief Array Subscript Operator.
+		 */
+		ConstElementTypeLRef operator[](Size index) const;
+
+	public:
+		/**
+		 * @brief Gets an iterator pointing to the first element in the collection.
+		 *
+		 * @return IIterator pointing to the first element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetBeginIterator() override;
+
+		/**
+		 * @brief Gets an iterator pointing to one past the last element in the collection.
+		 *
+		 * @return IIterator pointing to one past the last element.
+		 */
+		typename AbstractIterator<ElementType>::SelfTypeLRef GetFinalIterator() override;
+
+	public:
+		/**
+		 * @brief Retrieves a reference to the element at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the element to retrieve.
+		 * @return A reference to the element at the specified position.
+		 */
+		ElementTypeLRef At(Size index);
+
+		/**
+		 * @brief Retrieves a const reference to the element at a specified position, with bounds checking.
+		 *
+		 * @param index The position of the element to retrieve.
+		 * @return A const reference to the element at the specified position.
+		 */
+		ConstElementTypeLRef At(Size index) const;
+
+	public:
+		/**
+		 * @brief Retrieves the last element in the collection.
+		 *
+		 * @return A reference to the last element.
+		 */
+		ElementTypeLRef GetBack();
+
+		/**
+		 * @brief Retrieves the first element in the collection.
+		 *
+		 * @return A reference to the first element.
+		 */
+		ElementTypeLRef GetFront();
+
+		/**
+		 * @brief Retrieves the last element in the collection.
+		 *
+		 * @return A const reference to the last element.
+		 */
+		ConstElementTypeLRef GetBack() const;
+
+		/**
+		 * @brief Retrieves the first element in the collection.
+		 *
+		 * @return A const reference to the first element.
+		 */
+		ConstElementTypeLRef GetFront() const;
+
+	public:
+		/**
+		 * @brief Gets the number of elements each block holds.
+		 *
+		 * @return Size storing the capacity of a single block.
+		 */
+		Size GetBlockCapacity() const;
+
+	public:
+		/**
+		 * @brief Removes the last element in the collection.
+		 */
+		Void PopBack();
+
+		/**
+		 * @brief Removes the first element in the collection.
+		 */
+		Void PopFront();
+
+	public:
+		/**
+		 * @brief Inserts an element at the end of the collection.
+		 *
+		 * @param element The element to be moved and added.
+		 */
+		Void PushBack(ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element at the start of the collection.
+		 *
+		 * @param element The element to be moved and added.
+		 */
+		Void PushFront(ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element at the end of the collection.
+		 *
+		 * @param element The element to be copied and added.
+		 */
+		Void PushBack(ConstElementTypeLRef element);
+
+		/**
+		 * @brief Inserts an element at the start of the collection.
+		 *
+		 * @param element The element to be copied and added.
+		 */
+		Void PushFront(ConstElementTypeLRef element);
+
+	public:
+		/**
+		 * @brief Removes the element at the specified index.
+		 *
+		 * @param index The position of the element to remove.
+		 */
+		Void Remove(Size index);
+
+	public:
+		/**
+		 * @brief Inserts an element at the specified index.
+		 *
+		 * @param index The position of the element to insert, which may be equal to the count.
+		 * @param element The element to be moved and inserted.
+		 */
+		Void Insert(Size index, ElementTypeRRef element);
+
+		/**
+		 * @brief Inserts an element at the specified index.
+		 *
+		 * @param index The position of the element to insert, which may be equal to the count.
+		 * @param element The element to be copied and inserted.
+		 */
+		Void Insert(Size index, ConstElementTypeLRef element);
+
+	public:
+		/**
+		 * @brief Removes all the elements from this collections.
+		 */
+		Void Clear() override;
+
+	private:
+		ElementTypePtr _element_at(Size index) const;
+		ElementTypePtr _slot(const Block& block, Size offset) const;
+
+	private:
+		Void _append_block();
+		Void _release_blocks();
+		Void _grow_block_capacity();
+
+	private:
+		ElementTypePtr _make_room(Size index);
+		Void _close_gap(Size index);
+	};
+}
+
+#include "../../Private/Collections/TieredArray.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef DEFAULT_ALLOCATOR_HPP
+#define DEFAULT_ALLOCATOR_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include <forge-memory/Allocator.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief Gets the process-wide allocator that containers borrow when none is specified.
+	 *
+	 * Containers never own their allocator, so every default-constructed container of the same
+	 * allocator type shares this instance instead of allocating its own. Stateless policies
+	 * such as HeapAllocationPolicy are served from a static object that costs no allocation at
+	 * all. Other policies are allocated once and never destroyed, so that containers destroyed
+	 * by static destructors can still release their memory.
+	 *
+	 * Stateful policies are handled as follows:
+	 * - MmapAllocationPolicy owns a single mapping, so it has no default and every container
+	 *   must be given its own allocator.
+	 * - StackAllocationPolicy is not thread-safe, so its default is the scratch stack of the
+	 *   calling thread instead.
+	 * - HugePageAllocationPolicy and NumaAllocationPolicy only hold configuration, so their
+	 *   default is shared and uses the default threshold and placement. Containers that need
+	 *   another configuration must be given an allocator explicitly.
+	 * - TrackingAllocationPolicy records under the "untagged" tag and is as safe to share as
+	 *   its inner policy, so it must not wrap MmapAllocationPolicy or StackAllocationPolicy
+	 *   when used as a default.
+	 *
+	 * @tparam InAllocatorType The allocator type of the container.
+	 * @return A pointer to the shared allocator, which is never null.
+	 */
+	template<typename InAllocatorType>
+	InAllocatorType* GetDefaultAllocator();
+}
+
+#include "../Private/DefaultAllocator.inl"
+
+#endif
\ No newline at end of file
@@ -43,17 +43,17 @@ public:																		\
 																			\
 	using ContainerType = COL_TYPE<InElementType, InCapacity>;
 
-#define DYNAMIC_COLLECTION_TYPEDEFS(BASE_TYPE, SUB_TYPE)							\
+#define DYNAMIC_COLLECTION_TYPEDEFS(BASE_TYPE, SUB_TYPE, POLICY_TYPE)				\
 public:																				\
-	using BaseType = BASE_TYPE<InElementType, InAllocationPolicy>;					\
+	using BaseType = BASE_TYPE<InElementType, POLICY_TYPE>;							\
 																					\
-	using SelfType          = SUB_TYPE<InElementType, InAllocationPolicy>;			\
-	using SelfTypePtr       = SUB_TYPE<InElementType, InAllocationPolicy>*;			\
-	using SelfTypeLRef      = SUB_TYPE<InElementType, InAllocationPolicy>&;			\
-	using SelfTypeRRef      = SUB_TYPE<InElementType, InAllocationPolicy>&&;		\
-	using ConstSelfType     = const SUB_TYPE<InElementType, InAllocationPolicy>;	\
-	using ConstSelfTypePtr  = const SUB_TYPE<InElementType, InAllocationPolicy>*;	\
-	using ConstSelfTypeLRef = const SUB_TYPE<InElementType, InAllocationPolicy>&;	\
+	using SelfType          = SUB_TYPE<InElementType, POLICY_TYPE>;					\
+	using SelfTypePtr       = SUB_TYPE<InElementType, POLICY_TYPE>*;				\
+	using SelfTypeLRef      = SUB_TYPE<InElementType, POLICY_TYPE>&;				\
+	using SelfTypeRRef      = SUB_TYPE<InElementType, POLICY_TYPE>&&;				\
+	using ConstSelfType     = const SUB_TYPE<InElementType, POLICY_TYPE>;			\
+	using ConstSelfTypePtr  = const SUB_TYPE<InElementType, POLICY_TYPE>*;			\
+	using ConstSelfTypeLRef = const SUB_TYPE<InElementType, POLICY_TYPE>&;			\
 																					\
 	using ElementType          = InElementType;										\
 	using ElementTypePtr       = InElementType*;									\
@@ -63,12 +63,12 @@ public:																				\
 	using ConstElementTypePtr  = const InElementType*;								\
 	using ConstElementTypeLRef = const InElementType&;								\
 																					\
-	using AllocatorType          = Allocator<InAllocationPolicy>;					\
-	using AllocatorTypePtr       = Allocator<InAllocationPolicy>*;					\
-	using AllocatorTypeLRef      = Allocator<InAllocationPolicy>&;					\
-	using AllocatorTypeRRef      = Allocator<InAllocationPolicy>&&;					\
-	using ConstAllocatorType     = const Allocator<InAllocationPolicy>;				\
-	using ConstAllocatorTypePtr  = const Allocator<InAllocationPolicy>*;			\
-	using ConstAllocatorTypeLRef = const Allocator<InAllocationPolicy>&;			\
+	using AllocatorType          = Allocator<POLICY_TYPE>;							\
+	using AllocatorTypePtr       = Allocator<POLICY_TYPE>*;							\
+	using AllocatorTypeLRef      = Allocator<POLICY_TYPE>&;							\
+	using AllocatorTypeRRef      = Allocator<POLICY_TYPE>&&;						\
+	using ConstAllocatorType     = const Allocator<POLICY_TYPE>;					\
+	using ConstAllocatorTypePtr  = const Allocator<POLICY_TYPE>*;					\
+	using ConstAllocatorTypeLRef = const Allocator<POLICY_TYPE>&;					\
 
 #endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef OPTIMISTIC_LOCK_HPP
+#define OPTIMISTIC_LOCK_HPP
+
+#include <atomic>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief A version lock for optimistic lock coupling.
+	 *
+	 * Readers never write to the lock: they record the version before reading the data it
+	 * protects and validate afterwards that the version is unchanged, restarting their operation
+	 * otherwise. Writers acquire the lock by upgrading a version they read, which fails if any
+	 * writer got there first, and every write unlock advances the version, so each completed
+	 * write invalidates the concurrent readers of the same data.
+	 *
+	 * Data read under an optimistic lock may be torn and must not be acted upon before it is
+	 * validated.
+	 */
+	class OptimisticLock
+	{
+	public:
+		using SelfType          = OptimisticLock;
+		using SelfTypePtr       = OptimisticLock*;
+		using SelfTypeLRef      = OptimisticLock&;
+		using ConstSelfType     = const OptimisticLock;
+		using ConstSelfTypePtr  = const OptimisticLock*;
+		using ConstSelfTypeLRef = const OptimisticLock&;
+
+	private:
+		static constexpr U64 LOCKED_BIT = 0b10;
+
+	private:
+		::std::atomic<U64> m_version;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an unlocked version lock.
+		 */
+		OptimisticLock();
+
+	public:
+		OptimisticLock(const OptimisticLock&) = delete;
+		OptimisticLock& operator=(const OptimisticLock&) = delete;
+
+	public:
+		/**
+		 * @brief Starts an optimistic read.
+		 *
+		 * @param version Receives the version to validate the read against.
+		 * @return True if the lock was free, or false if a writer holds it and the caller must restart.
+		 */
+		Bool TryBeginRead(U64& version) const;
+
+		/**
+		 * @brief Checks that no write happened since the specified version was read.
+		 *
+		 * Every load the caller made before the call is ordered before the check.
+		 *
+		 * @param version The version returned by TryBeginRead.
+		 * @return True if the data read since is consistent, or false if the caller must restart.
+		 */
+		Bool Validate(U64 version) const;
+
+	public:
+		/**
+		 * @brief Acquires the lock for writing if it still holds the specified version.
+		 *
+		 * @param version The version returned by TryBeginRead, updated to the locked version.
+		 * @return True if the lock was acquired, or false if the caller must restart.
+		 */
+		Bool TryUpgrade(U64& version);
+
+		/**
+		 * @brief Acquires the lock for writing, waiting for other writers to release it.
+		 */
+		Void WriteLock();
+
+		/**
+		 * @brief Releases the lock and advances the version.
+		 */
+		Void WriteUnlock();
+
+	public:
+		/**
+		 * @brief Waits briefly before an operation restarts, to let the holder of a lock progress.
+		 */
+		static Void Pause();
+	};
+}
+
+#include "../Private/OptimisticLock.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+#ifndef HUGE_PAGE_ALLOCATION_POLICY_HPP
+#define HUGE_PAGE_ALLOCATION_POLICY_HPP
+
+#if defined(__linux__)
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief An allocation policy that places large allocations on 2MB pages.
+	 *
+	 * The HugePageAllocationPolicy class serves allocations below its threshold from the heap.
+	 * Larger allocations are mapped directly, either from the reserved huge page pool with
+	 * MAP_HUGETLB when the policy is asked to, or as regular anonymous memory aligned to
+	 * HUGE_PAGE_SIZE and marked with MADV_HUGEPAGE so that transparent huge pages back it. A
+	 * mapping that cannot be obtained from the pool falls back to transparent huge pages, and a
+	 * kernel without them simply leaves the mapping on regular pages.
+	 *
+	 * A mapped allocation grows with mremap, which moves page table entries instead of copying
+	 * the contents, so arrays that grow past the threshold are never copied again. A mapping that
+	 * cannot grow in place is moved onto a fresh huge page boundary, and one that cannot be
+	 * remapped at all is copied into a new mapping. Every
+	 * allocation is preceded by a header of HEADER_SIZE bytes recording how it was obtained, so
+	 * alignments up to HEADER_SIZE are honoured.
+	 */
+	class HugePageAllocationPolicy
+	{
+	public:
+		using SelfType          = HugePageAllocationPolicy;
+		using SelfTypePtr       = HugePageAllocationPolicy*;
+		using SelfTypeLRef      = HugePageAllocationPolicy&;
+		using ConstSelfType     = const HugePageAllocationPolicy;
+		using ConstSelfTypePtr  = const HugePageAllocationPolicy*;
+		using ConstSelfTypeLRef = const HugePageAllocationPolicy&;
+
+	public:
+		static constexpr Size HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+		static constexpr Size DEFAULT_THRESHOLD = 4 * 1024 * 1024;
+
+	public:
+		static constexpr Size HEADER_SIZE = 64;
+
+	private:
+		static constexpr U8 HEAP_BLOCK = 0;
+		static constexpr U8 ALIGNED_HEAP_BLOCK = 1;
+		static constexpr U8 MAPPED_BLOCK = 2;
+		static constexpr U8 HUGE_TLB_BLOCK = 3;
+
+	private:
+		struct Header
+		{
+			Size size;
+			Size mapped_size;
+
+			U8 kind;
+		};
+
+	private:
+		Size m_threshold;
+		Bool m_use_huge_tlb;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a policy that maps allocations of at least the specified threshold, from
+		 * the reserved huge page pool if requested.
+		 */
+		HugePageAllocationPolicy(Size threshold = DEFAULT_THRESHOLD, Bool use_huge_tlb = false);
+
+	public:
+		/**
+		 * @brief Gets the size from which allocations are mapped.
+		 *
+		 * @return Size storing the threshold in bytes.
+		 */
+		Size GetThreshold() const;
+
+		/**
+		 * @brief Checks whether an allocation is mapped rather than taken from the heap.
+		 *
+		 * @param pointer An allocation of this policy.
+		 * @return True if the allocation is mapped, otherwise false.
+		 */
+		Bool IsMapped(VoidPtr pointer) const;
+
+	public:
+		/**
+		 * @brief Allocates a block of memory, mapping it if it reaches the threshold.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the memory cannot be obtained.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes a block of memory, remapping it once it is mapped.
+		 *
+		 * @param pointer The block to resize, or nullptr to allocate a new one.
+		 * @param size The new number of bytes.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the resized block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the memory cannot be obtained.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Releases a block of memory.
+		 *
+		 * @param pointer The block to release, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	private:
+		static Header* _header(VoidPtr pointer);
+		static Size _mapped_size(Size size);
+
+	private:
+		static VoidPtr _remap(Header* header, Size mapped_size);
+		static BytePtr _reserve(Size mapped_size);
+
+	private:
+		VoidPtr _map(Size size);
+		VoidPtr _allocate_heap(Size size, Size alignment);
+	};
+}
+
+#include "../../Private/Policies/HugePageAllocationPolicy.inl"
+
+#endif
+
+#endif
\ No newline at end of file
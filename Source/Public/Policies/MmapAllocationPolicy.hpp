@@ -0,0 +1,214 @@
+#ifndef MMAP_ALLOCATION_POLICY_HPP
+#define MMAP_ALLOCATION_POLICY_HPP
+
+#if defined(__linux__)
+
+#include <sys/mman.h>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include <forge-memory/Allocator.hpp>
+
+#include "DefaultAllocator.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An allocation policy that backs a single growable allocation with a memory mapping.
+	 *
+	 * The MmapAllocationPolicy class maps a file, so the elements of a container using it live
+	 * in the page cache rather than on the heap. Growing the allocation extends the file with
+	 * ftruncate and the mapping with mremap, which moves no data. A read-only policy maps the file
+	 * privately, so its contents are available without being read upfront and writes never reach
+	 * the file. A default constructed policy maps anonymous memory instead of a file.
+	 *
+	 * The policy holds at most one allocation at a time, so each container needs its own. MapFile
+	 * exposes the existing contents of the file, which DynamicArrayWithPolicy::Adopt turns into
+	 * the elements of an array without copying them; those elements must be trivially copyable.
+	 */
+	class MmapAllocationPolicy
+	{
+	public:
+		using SelfType          = MmapAllocationPolicy;
+		using SelfTypePtr       = MmapAllocationPolicy*;
+		using SelfTypeLRef      = MmapAllocationPolicy&;
+		using ConstSelfType     = const MmapAllocationPolicy;
+		using ConstSelfTypePtr  = const MmapAllocationPolicy*;
+		using ConstSelfTypeLRef = const MmapAllocationPolicy&;
+
+	public:
+		static constexpr I32 ADVICE_NORMAL = MADV_NORMAL;
+		static constexpr I32 ADVICE_RANDOM = MADV_RANDOM;
+		static constexpr I32 ADVICE_SEQUENTIAL = MADV_SEQUENTIAL;
+		static constexpr I32 ADVICE_WILL_NEED = MADV_WILLNEED;
+		static constexpr I32 ADVICE_DONT_NEED = MADV_DONTNEED;
+
+	private:
+		static constexpr Size NO_TRUNCATION = ~Size(0);
+
+	private:
+		I32 m_file;
+		Bool m_read_only;
+
+	private:
+		BytePtr m_data;
+		Size m_size;
+
+	private:
+		Size m_release_size;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a policy that maps anonymous memory.
+		 */
+		MmapAllocationPolicy();
+
+		/**
+		 * @brief File Constructor.
+		 *
+		 * Initializes a policy that maps the file at the specified path, creating it unless the
+		 * policy is read-only.
+		 *
+		 * @throws std::system_error if the file cannot be opened.
+		 */
+		MmapAllocationPolicy(const Char* path, Bool read_only = false);
+
+	public:
+		MmapAllocationPolicy(const MmapAllocationPolicy&) = delete;
+		MmapAllocationPolicy& operator=(const MmapAllocationPolicy&) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 *
+		 * Unmaps the allocation if it was not released and closes the file.
+		 */
+		~MmapAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Checks whether the policy maps its file privately.
+		 *
+		 * @return True if writes never reach the file, otherwise false.
+		 */
+		Bool IsReadOnly() const;
+
+		/**
+		 * @brief Gets the size of the current mapping.
+		 *
+		 * @return Size storing the number of bytes mapped, or 0 if nothing is mapped.
+		 */
+		Size GetMappedSize() const;
+
+		/**
+		 * @brief Gets the size of the file.
+		 *
+		 * @return Size storing the number of bytes in the file, or 0 for an anonymous policy.
+		 *
+		 * @throws std::system_error if the file cannot be queried.
+		 */
+		Size GetFileSize() const;
+
+	public:
+		/**
+		 * @brief Maps the whole file as the allocation of the policy.
+		 *
+		 * @param size Receives the number of bytes in the file.
+		 * @return A pointer to the contents of the file, or nullptr if the file is empty.
+		 *
+		 * @throws std::logic_error if the policy already holds an allocation.
+		 */
+		VoidPtr MapFile(Size& size);
+
+	public:
+		/**
+		 * @brief Maps a new allocation, extending the file to the specified size if it is shorter.
+		 *
+		 * @param size The number of bytes to map.
+		 * @param alignment The alignment of the allocation, which must not exceed the page size.
+		 * @return A pointer to the allocation.
+		 *
+		 * @throws std::logic_error if the policy already holds an allocation.
+		 * @throws std::invalid_argument if the alignment exceeds the page size.
+		 * @throws std::length_error if a read-only file is shorter than the specified size.
+		 * @throws std::bad_alloc if the mapping fails.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes the allocation in place or by moving its mapping, without copying.
+		 *
+		 * @param pointer The current allocation, or nullptr to map a new one.
+		 * @param size The new number of bytes to map.
+		 * @param alignment The alignment of the allocation, which must not exceed the page size.
+		 * @return A pointer to the resized allocation.
+		 *
+		 * @throws std::length_error if a read-only file is shorter than the specified size.
+		 * @throws std::bad_alloc if the mapping fails.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Unmaps the allocation, leaving the file in place.
+		 *
+		 * @param pointer The current allocation, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	public:
+		/**
+		 * @brief Writes the modified pages of a range of the allocation back to the file.
+		 *
+		 * @param offset The offset of the first byte of the range.
+		 * @param size The number of bytes in the range.
+		 * @param wait Whether to wait until the pages are written.
+		 *
+		 * @throws std::system_error if the pages cannot be written.
+		 */
+		Void Sync(Size offset, Size size, Bool wait = true);
+
+		/**
+		 * @brief Tells the kernel how a range of the allocation is going to be accessed.
+		 *
+		 * @param offset The offset of the first byte of the range.
+		 * @param size The number of bytes in the range.
+		 * @param advice One of the ADVICE constants.
+		 *
+		 * @throws std::system_error if the advice is rejected.
+		 */
+		Void Advise(Size offset, Size size, I32 advice);
+
+		/**
+		 * @brief Truncates the file to the specified size once the allocation is released.
+		 *
+		 * A growing container maps more than it stores, so this trims the file to the bytes of
+		 * its elements, such as GetCount() * sizeof(ElementType).
+		 *
+		 * @param size The size of the file after the allocation is released.
+		 */
+		Void TruncateOnRelease(Size size);
+
+	private:
+		static Size _page_size();
+
+	private:
+		Void _grow_file(Size size);
+		Void _page_range(Size offset, Size size, BytePtr& first, Size& length) const;
+	};
+
+	/**
+	 * @brief Refuses a default allocator, since a policy holds a single mapping and cannot be
+	 * shared between containers.
+	 */
+	template<>
+	Allocator<MmapAllocationPolicy>* GetDefaultAllocator<Allocator<MmapAllocationPolicy>>() = delete;
+}
+
+#include "../../Private/Policies/MmapAllocationPolicy.inl"
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+#ifndef NUMA_ALLOCATION_POLICY_HPP
+#define NUMA_ALLOCATION_POLICY_HPP
+
+#if defined(__linux__)
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief An allocation policy that controls on which NUMA nodes the pages of its allocations
+	 * are placed.
+	 *
+	 * The NumaAllocationPolicy class maps every allocation directly and binds the mapping with
+	 * mbind before any of its pages is touched, so the placement holds regardless of which thread
+	 * writes the contents:
+	 *
+	 * - PLACEMENT_LOCAL places each page on the node of the thread that first touches it.
+	 * - PLACEMENT_INTERLEAVE spreads the pages round-robin across the nodes of the mask, which
+	 *   evens out the bandwidth of data scanned by threads on every node.
+	 * - PLACEMENT_BIND restricts the pages to the nodes of the mask.
+	 *
+	 * Allocations grow with mremap, which keeps the placement of the mapping. On a kernel or in a
+	 * container that rejects memory policies, allocations silently keep the default placement.
+	 * Every allocation is preceded by a header of HEADER_SIZE bytes, so alignments up to
+	 * HEADER_SIZE are honoured.
+	 */
+	class NumaAllocationPolicy
+	{
+	public:
+		using SelfType          = NumaAllocationPolicy;
+		using SelfTypePtr       = NumaAllocationPolicy*;
+		using SelfTypeLRef      = NumaAllocationPolicy&;
+		using ConstSelfType     = const NumaAllocationPolicy;
+		using ConstSelfTypePtr  = const NumaAllocationPolicy*;
+		using ConstSelfTypeLRef = const NumaAllocationPolicy&;
+
+	public:
+		static constexpr U8 PLACEMENT_LOCAL = 0;
+		static constexpr U8 PLACEMENT_INTERLEAVE = 1;
+		static constexpr U8 PLACEMENT_BIND = 2;
+
+	public:
+		static constexpr U64 ALL_NODES = ~U64(0);
+		static constexpr Size MAXIMUM_NODE_COUNT = 64;
+		static constexpr Size MAXIMUM_CPU_COUNT = 4096;
+
+	public:
+		static constexpr Size HEADER_SIZE = 64;
+
+	private:
+		static constexpr I32 MODE_PREFERRED = 1;
+		static constexpr I32 MODE_BIND = 2;
+		static constexpr I32 MODE_INTERLEAVE = 3;
+
+	private:
+		struct Header
+		{
+			Size mapped_size;
+		};
+
+		struct Topology
+		{
+			Size node_count;
+			U16 cpu_nodes[MAXIMUM_CPU_COUNT];
+
+			Topology();
+		};
+
+	private:
+		U8 m_placement;
+		U64 m_node_mask;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a policy with the specified placement over the nodes of the mask, where
+		 * bit n of the mask stands for node n. The mask is ignored by PLACEMENT_LOCAL.
+		 *
+		 * @throws std::invalid_argument if the placement is unknown, or if the mask holds no
+		 * existing node for a placement that uses it.
+		 */
+		NumaAllocationPolicy(U8 placement = PLACEMENT_LOCAL, U64 node_mask = ALL_NODES);
+
+	public:
+		/**
+		 * @brief Gets the placement of the policy.
+		 *
+		 * @return U8 storing one of the PLACEMENT constants.
+		 */
+		U8 GetPlacement() const;
+
+		/**
+		 * @brief Gets the nodes the policy places pages on, limited to the existing nodes.
+		 *
+		 * @return U64 storing a mask where bit n stands for node n.
+		 */
+		U64 GetNodeMask() const;
+
+	public:
+		/**
+		 * @brief Gets the number of NUMA nodes of the machine.
+		 *
+		 * @return Size storing one past the highest online node, at least 1.
+		 */
+		static Size GetNodeCount();
+
+		/**
+		 * @brief Gets the node of the CPU the calling thread is running on.
+		 *
+		 * @return Size storing the node, which may be stale as soon as the thread migrates.
+		 */
+		static Size GetCurrentNode();
+
+		/**
+		 * @brief Sets the placement of every later allocation of the calling thread, including
+		 * those that do not go through this policy, with set_mempolicy.
+		 *
+		 * @param placement One of the PLACEMENT constants.
+		 * @param node_mask The nodes to place pages on, ignored by PLACEMENT_LOCAL.
+		 *
+		 * @return True if the kernel accepted the placement, otherwise false.
+		 */
+		static Bool SetThreadPlacement(U8 placement, U64 node_mask = ALL_NODES);
+
+	public:
+		/**
+		 * @brief Maps a block of memory on the nodes of the policy.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the mapping fails.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes a block of memory by remapping it, without copying.
+		 *
+		 * @param pointer The block to resize, or nullptr to allocate a new one.
+		 * @param size The new number of bytes.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the resized block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the mapping fails.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Unmaps a block of memory.
+		 *
+		 * @param pointer The block to release, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	private:
+		static const Topology& _topology();
+		static Size _mapped_size(Size size);
+		static U64 _existing_nodes(U64 node_mask);
+
+	private:
+		template<typename InCallable>
+		static Void _parse_list(const Char* path, InCallable callable);
+
+	private:
+		Void _bind(VoidPtr address, Size size) const;
+	};
+}
+
+#include "../../Private/Policies/NumaAllocationPolicy.inl"
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,227 @@
+#ifndef STACK_ALLOCATION_POLICY_HPP
+#define STACK_ALLOCATION_POLICY_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include <forge-memory/Allocator.hpp>
+
+#include "DefaultAllocator.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An allocation policy that carves allocations out of a single buffer in last-in,
+	 * first-out order, for short-lived scratch space such as sort buffers and the temporaries of
+	 * set operations.
+	 *
+	 * The StackAllocationPolicy class allocates by bumping the top of its buffer. Releasing the
+	 * block on top moves the top back down, past every block below it that was already released,
+	 * while releasing any other block only marks it, so its memory is reclaimed once the blocks
+	 * above it are gone. Resizing the block on top grows or shrinks it in place, so an array that
+	 * is the most recent allocation never copies its elements.
+	 *
+	 * A Marker records the top of the stack and rewinds to it when it goes out of scope,
+	 * releasing everything allocated since at once. Containers allocated after a marker must not
+	 * outlive it. An allocation that does not fit in the buffer falls back to the heap, so the
+	 * stack never fails for lack of room, only gets slower.
+	 *
+	 * A stack is not thread-safe. GetThreadScratch provides a stack per thread for algorithms
+	 * that need temporary storage, and it is also the default allocator of containers using this
+	 * policy, so such containers must be released on the thread that created them.
+	 */
+	class StackAllocationPolicy
+	{
+	public:
+		using SelfType          = StackAllocationPolicy;
+		using SelfTypePtr       = StackAllocationPolicy*;
+		using SelfTypeLRef      = StackAllocationPolicy&;
+		using ConstSelfType     = const StackAllocationPolicy;
+		using ConstSelfTypePtr  = const StackAllocationPolicy*;
+		using ConstSelfTypeLRef = const StackAllocationPolicy&;
+
+	public:
+		static constexpr Size DEFAULT_CAPACITY = 1024 * 1024;
+		static constexpr Size SCRATCH_CAPACITY = 4 * 1024 * 1024;
+
+	public:
+		static constexpr Size HEADER_SIZE = 32;
+
+	private:
+		static constexpr Size NO_BLOCK = ~Size(0);
+
+	private:
+		static constexpr Size STACK_BLOCK = 0;
+		static constexpr Size RELEASED_BLOCK = 1;
+		static constexpr Size HEAP_BLOCK = 2;
+
+	private:
+		struct Header
+		{
+			Size start;
+			Size previous;
+			Size size;
+			Size kind;
+		};
+
+	public:
+		/**
+		 * @brief Records the top of a stack and rewinds to it when destroyed.
+		 */
+		class Marker
+		{
+		public:
+			using SelfType          = Marker;
+			using SelfTypePtr       = Marker*;
+			using SelfTypeLRef      = Marker&;
+			using ConstSelfType     = const Marker;
+			using ConstSelfTypePtr  = const Marker*;
+			using ConstSelfTypeLRef = const Marker&;
+
+		private:
+			StackAllocationPolicy* m_stack;
+
+		private:
+			Size m_top;
+			Size m_last;
+
+		public:
+			/**
+			 * @brief Stack Constructor.
+			 *
+			 * Initializes a marker at the current top of the specified stack.
+			 */
+			Marker(StackAllocationPolicy& stack);
+
+		public:
+			Marker(ConstSelfTypeLRef) = delete;
+			SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+
+		public:
+			/**
+			 * @brief Destructor.
+			 *
+			 * Rewinds the stack to the marker.
+			 */
+			~Marker();
+
+			friend class StackAllocationPolicy;
+		};
+
+	private:
+		BytePtr m_buffer;
+		Size m_capacity;
+
+	private:
+		Size m_top;
+		Size m_last;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes an empty stack over a buffer of the specified capacity.
+		 *
+		 * @throws std::bad_alloc if the buffer cannot be allocated.
+		 */
+		StackAllocationPolicy(Size capacity = DEFAULT_CAPACITY);
+
+	public:
+		StackAllocationPolicy(ConstSelfTypeLRef) = delete;
+		SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 */
+		~StackAllocationPolicy();
+
+	public:
+		/**
+		 * @brief Gets the capacity of the buffer.
+		 *
+		 * @return Size storing the capacity in bytes.
+		 */
+		Size GetCapacity() const;
+
+		/**
+		 * @brief Gets the number of bytes of the buffer in use, headers and padding included.
+		 *
+		 * @return Size storing the offset of the top of the stack.
+		 */
+		Size GetUsedSize() const;
+
+	public:
+		/**
+		 * @brief Rewinds the stack to the specified marker, releasing every block allocated
+		 * since it was created.
+		 *
+		 * @param marker A marker of this stack.
+		 */
+		Void Rewind(const Marker& marker);
+
+	public:
+		/**
+		 * @brief Allocates a block of memory on top of the stack, or from the heap if it does
+		 * not fit.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment of the block, which must be a power of two.
+		 * @return A pointer to the block.
+		 *
+		 * @throws std::bad_alloc if the heap fallback fails.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes a block of memory, in place if it is on top of the stack and still fits.
+		 *
+		 * @param pointer The block to resize, or nullptr to allocate a new one.
+		 * @param size The new number of bytes.
+		 * @param alignment The alignment of the block, which must be a power of two.
+		 * @return A pointer to the resized block.
+		 *
+		 * @throws std::bad_alloc if the heap fallback fails.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Releases a block of memory, moving the top of the stack down if it is on top.
+		 *
+		 * @param pointer The block to release, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	public:
+		/**
+		 * @brief Gets the scratch stack of the calling thread, of SCRATCH_CAPACITY bytes.
+		 *
+		 * Callers should place a Marker on the stack before allocating from it, so that
+		 * temporaries are released together when their scope ends.
+		 *
+		 * @return A pointer to the allocator of the scratch stack.
+		 */
+		static Allocator<StackAllocationPolicy>* GetThreadScratch();
+
+	private:
+		static Header* _header(VoidPtr pointer);
+		static Size _alignment(Size alignment);
+
+	private:
+		VoidPtr _allocate_heap(Size size, Size alignment);
+		Void _pop_released();
+	};
+
+	/**
+	 * @brief Gets the scratch stack of the calling thread, since a stack cannot be shared
+	 * between threads.
+	 *
+	 * @return A pointer to the allocator of the scratch stack.
+	 */
+	template<>
+	Allocator<StackAllocationPolicy>* GetDefaultAllocator<Allocator<StackAllocationPolicy>>();
+}
+
+#include "../../Private/Policies/StackAllocationPolicy.inl"
+
+#endif
\ No newline at end of file
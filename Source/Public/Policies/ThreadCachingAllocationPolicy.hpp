@@ -0,0 +1,165 @@
+#ifndef THREAD_CACHING_ALLOCATION_POLICY_HPP
+#define THREAD_CACHING_ALLOCATION_POLICY_HPP
+
+#include <mutex>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include "BitOperations.hpp"
+
+namespace Forge
+{
+	/**
+	 * @brief An allocation policy that serves small allocations from per-thread caches, so that
+	 * containers created and destroyed at a high rate on many threads do not contend on the
+	 * locks of the heap.
+	 *
+	 * The ThreadCachingAllocationPolicy class rounds every allocation up to a power-of-two size
+	 * class between MINIMUM_BLOCK_SIZE and MAXIMUM_BLOCK_SIZE bytes, header included. Each thread
+	 * keeps a free list per size class that it allocates from and releases to without any
+	 * synchronization. An empty list is refilled with a whole batch of blocks from a global pool,
+	 * and a list that grows past two batches flushes its coldest batch back to the pool, so the
+	 * pool lock is taken once per batch rather than once per allocation. Blocks freed on another
+	 * thread than the one that allocated them simply move to the cache of the releasing thread,
+	 * and a thread flushes its whole cache to the pool when it exits.
+	 *
+	 * The pool carves new blocks out of chunks of one batch each and never returns them to the
+	 * heap, so the memory of the cached size classes stays at its high-water mark. Larger
+	 * allocations go directly to the heap. The policy holds no state, so every instance shares
+	 * the same caches and a block may be released through any of them. Every allocation is
+	 * preceded by a header of HEADER_SIZE bytes, so alignments up to HEADER_SIZE are honoured.
+	 */
+	class ThreadCachingAllocationPolicy
+	{
+	public:
+		using SelfType          = ThreadCachingAllocationPolicy;
+		using SelfTypePtr       = ThreadCachingAllocationPolicy*;
+		using SelfTypeLRef      = ThreadCachingAllocationPolicy&;
+		using ConstSelfType     = const ThreadCachingAllocationPolicy;
+		using ConstSelfTypePtr  = const ThreadCachingAllocationPolicy*;
+		using ConstSelfTypeLRef = const ThreadCachingAllocationPolicy&;
+
+	public:
+		static constexpr Size HEADER_SIZE = 16;
+
+	public:
+		static constexpr Size MINIMUM_BLOCK_SIZE = 32;
+		static constexpr Size SIZE_CLASS_COUNT = 11;
+		static constexpr Size MAXIMUM_BLOCK_SIZE = MINIMUM_BLOCK_SIZE << (SIZE_CLASS_COUNT - 1);
+		static constexpr Size MAXIMUM_CACHED_SIZE = MAXIMUM_BLOCK_SIZE - HEADER_SIZE;
+
+	public:
+		static constexpr Size BATCH_BYTES = 64 * 1024;
+		static constexpr Size MAXIMUM_BATCH_COUNT = 64;
+
+	private:
+		static constexpr Size LARGE_CLASS = SIZE_CLASS_COUNT;
+
+	private:
+		static constexpr U8 CACHE_UNINITIALIZED = 0;
+		static constexpr U8 CACHE_ALIVE = 1;
+		static constexpr U8 CACHE_DESTROYED = 2;
+
+	private:
+		struct Header
+		{
+			Size size_class;
+			Size size;
+		};
+
+		struct FreeList
+		{
+			VoidPtr head;
+			VoidPtr tail;
+
+			Size count;
+		};
+
+		struct Pool
+		{
+			::std::mutex mutex;
+
+			VoidPtr head;
+			Size count;
+		};
+
+		struct ThreadCache
+		{
+			FreeList lists[SIZE_CLASS_COUNT];
+
+			ThreadCache();
+			~ThreadCache();
+		};
+
+	public:
+		/**
+		 * @brief Allocates a block of memory, from the cache of the calling thread if it fits a
+		 * size class.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the memory cannot be obtained.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes a block of memory, in place while it stays within its size class.
+		 *
+		 * @param pointer The block to resize, or nullptr to allocate a new one.
+		 * @param size The new number of bytes.
+		 * @param alignment The alignment of the block, which must not exceed HEADER_SIZE.
+		 * @return A pointer to the resized block.
+		 *
+		 * @throws std::invalid_argument if the alignment exceeds HEADER_SIZE.
+		 * @throws std::bad_alloc if the memory cannot be obtained.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Releases a block of memory to the cache of the calling thread.
+		 *
+		 * @param pointer The block to release, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	public:
+		/**
+		 * @brief Flushes every block cached by the calling thread to the global pool, for
+		 * threads that are about to idle for a long time.
+		 */
+		static Void Flush();
+
+		/**
+		 * @brief Gets the number of blocks of a size class held by the global pool.
+		 *
+		 * @param size An allocation size served by the size class.
+		 * @return Size storing the number of pooled blocks, or 0 for sizes above
+		 * MAXIMUM_CACHED_SIZE.
+		 */
+		static Size GetPooledCount(Size size);
+
+	private:
+		static Size _size_class(Size size);
+		static Size _block_size(Size size_class);
+		static Size _batch_count(Size size_class);
+
+	private:
+		static Pool* _pools();
+		static U8& _cache_state();
+		static ThreadCache* _thread_cache();
+
+	private:
+		static VoidPtr _pop(FreeList& list, Size size_class);
+		static Void _push(FreeList& list, VoidPtr block);
+		static Void _refill(FreeList& list, Size size_class);
+		static Void _flush(FreeList& list, Size size_class, Size count);
+	};
+}
+
+#include "../../Private/Policies/ThreadCachingAllocationPolicy.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,296 @@
+#ifndef TRACKING_ALLOCATION_POLICY_HPP
+#define TRACKING_ALLOCATION_POLICY_HPP
+
+#include <mutex>
+#include <atomic>
+#include <utility>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief The allocation statistics of a single tag at the time of a snapshot.
+	 */
+	struct AllocationStatistics
+	{
+		const Char* tag;
+
+		I64 live_bytes;
+		I64 peak_bytes;
+
+		U64 allocation_count;
+		U64 reallocation_count;
+		U64 deallocation_count;
+	};
+
+	/**
+	 * @brief Records allocation statistics per tag for the TrackingAllocationPolicy class, or for
+	 * any policy that reports to it.
+	 *
+	 * Each thread counts into its own record without any read-modify-write instruction, so
+	 * recording an allocation costs a few plain loads and stores. The live bytes of a thread are
+	 * published to its tag once their change reaches PUBLISH_BYTES, which is also when the peak
+	 * is sampled, so the peak may miss short spikes smaller than PUBLISH_BYTES per thread. A
+	 * snapshot adds up the tags and the records of every running thread, so it is exact once the
+	 * threads are quiescent and approximate while they allocate.
+	 */
+	class AllocationTracker
+	{
+	public:
+		using SelfType          = AllocationTracker;
+		using SelfTypePtr       = AllocationTracker*;
+		using SelfTypeLRef      = AllocationTracker&;
+		using ConstSelfType     = const AllocationTracker;
+		using ConstSelfTypePtr  = const AllocationTracker*;
+		using ConstSelfTypeLRef = const AllocationTracker&;
+
+	public:
+		static constexpr Size MAXIMUM_TAG_COUNT = 64;
+		static constexpr Size MAXIMUM_TAG_LENGTH = 63;
+
+	public:
+		static constexpr I64 PUBLISH_BYTES = 64 * 1024;
+
+	private:
+		static constexpr U8 RECORD_UNINITIALIZED = 0;
+		static constexpr U8 RECORD_ALIVE = 1;
+		static constexpr U8 RECORD_DESTROYED = 2;
+
+	private:
+		struct Counters
+		{
+			::std::atomic<I64> pending_bytes;
+
+			::std::atomic<U64> allocation_count;
+			::std::atomic<U64> reallocation_count;
+			::std::atomic<U64> deallocation_count;
+		};
+
+		struct TagRecord
+		{
+			Char name[MAXIMUM_TAG_LENGTH + 1];
+
+			::std::atomic<I64> live_bytes;
+			::std::atomic<I64> peak_bytes;
+
+			::std::atomic<U64> allocation_count;
+			::std::atomic<U64> reallocation_count;
+			::std::atomic<U64> deallocation_count;
+		};
+
+		struct ThreadRecord
+		{
+			Counters counters[MAXIMUM_TAG_COUNT];
+
+			ThreadRecord* previous;
+			ThreadRecord* next;
+
+			ThreadRecord();
+			~ThreadRecord();
+		};
+
+		struct Registry
+		{
+			::std::mutex mutex;
+
+			TagRecord tags[MAXIMUM_TAG_COUNT];
+			::std::atomic<Size> tag_count;
+
+			ThreadRecord* threads;
+		};
+
+	public:
+		AllocationTracker() = delete;
+
+	public:
+		/**
+		 * @brief Registers a tag, or finds the tag registered under the same name.
+		 *
+		 * @param tag The name of the tag.
+		 * @return Size storing the index of the tag.
+		 *
+		 * @throws std::length_error if the name is longer than MAXIMUM_TAG_LENGTH, or if
+		 * MAXIMUM_TAG_COUNT tags are already registered.
+		 */
+		static Size RegisterTag(const Char* tag);
+
+	public:
+		/**
+		 * @brief Records an allocation of the specified number of bytes.
+		 *
+		 * @param tag The index of the tag.
+		 * @param size The number of bytes allocated.
+		 */
+		static Void RecordAllocation(Size tag, Size size);
+
+		/**
+		 * @brief Records the resizing of an allocation.
+		 *
+		 * @param tag The index of the tag.
+		 * @param old_size The number of bytes before the resizing.
+		 * @param new_size The number of bytes after the resizing.
+		 */
+		static Void RecordReallocation(Size tag, Size old_size, Size new_size);
+
+		/**
+		 * @brief Records the release of an allocation of the specified number of bytes.
+		 *
+		 * @param tag The index of the tag.
+		 * @param size The number of bytes released.
+		 */
+		static Void RecordDeallocation(Size tag, Size size);
+
+	public:
+		/**
+		 * @brief Copies the statistics of every registered tag, in registration order.
+		 *
+		 * @param statistics The array to write to.
+		 * @param capacity The number of elements of the array.
+		 * @return Size storing the number of registered tags, which may exceed the capacity.
+		 */
+		static Size Snapshot(AllocationStatistics* statistics, Size capacity);
+
+		/**
+		 * @brief Gets the statistics of a single tag.
+		 *
+		 * @param tag The name of the tag.
+		 * @return The statistics of the tag.
+		 *
+		 * @throws std::out_of_range if no tag is registered under the name.
+		 */
+		static AllocationStatistics GetStatistics(const Char* tag);
+
+	private:
+		static Registry& _registry();
+		static U8& _record_state();
+		static ThreadRecord* _thread_record();
+
+	private:
+		static Void _add(::std::atomic<U64>& counter, U64 value);
+		static Void _change(Counters& counters, Size tag, I64 delta);
+		static Void _publish(Size tag, I64 delta);
+		static Void _raise_peak(TagRecord& record, I64 live_bytes);
+		static AllocationStatistics _statistics(Size tag);
+	};
+
+	/**
+	 * @brief An allocation policy that forwards to an inner policy and records the allocations
+	 * of its containers under a tag.
+	 *
+	 * Every allocation is preceded by a header that remembers its size, so the live bytes count
+	 * the real allocated sizes rather than the elements in use. Policies constructed with the
+	 * same tag share their statistics, which are read through AllocationTracker::Snapshot.
+	 *
+	 * @tparam InInnerPolicy The allocation policy that provides the memory.
+	 */
+	template<typename InInnerPolicy>
+	class TrackingAllocationPolicy
+	{
+	public:
+		using SelfType          = TrackingAllocationPolicy<InInnerPolicy>;
+		using SelfTypePtr       = TrackingAllocationPolicy<InInnerPolicy>*;
+		using SelfTypeLRef      = TrackingAllocationPolicy<InInnerPolicy>&;
+		using ConstSelfType     = const TrackingAllocationPolicy<InInnerPolicy>;
+		using ConstSelfTypePtr  = const TrackingAllocationPolicy<InInnerPolicy>*;
+		using ConstSelfTypeLRef = const TrackingAllocationPolicy<InInnerPolicy>&;
+
+	public:
+		using InnerPolicyType          = InInnerPolicy;
+		using InnerPolicyTypeLRef      = InInnerPolicy&;
+		using ConstInnerPolicyTypeLRef = const InInnerPolicy&;
+
+	public:
+		static constexpr Size HEADER_SIZE = 16;
+
+	private:
+		struct Header
+		{
+			Size size;
+			Size offset;
+		};
+
+	private:
+		InInnerPolicy m_inner;
+		Size m_tag;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a policy that records under the specified tag.
+		 *
+		 * @throws std::length_error if the tag cannot be registered.
+		 */
+		TrackingAllocationPolicy(const Char* tag = "untagged");
+
+		/**
+		 * @brief Inner Policy Constructor.
+		 *
+		 * Initializes a policy that records under the specified tag, with an inner policy
+		 * constructed from the remaining arguments.
+		 *
+		 * @throws std::length_error if the tag cannot be registered.
+		 */
+		template<typename InFirstArgument, typename... InArguments>
+		TrackingAllocationPolicy(const Char* tag, InFirstArgument&& first_argument, InArguments&&... arguments);
+
+	public:
+		/**
+		 * @brief Gets the index of the tag the policy records under.
+		 *
+		 * @return Size storing the index of the tag.
+		 */
+		Size GetTag() const;
+
+		/**
+		 * @brief Gets the inner policy.
+		 *
+		 * @return A reference to the inner policy.
+		 */
+		InnerPolicyTypeLRef GetInnerPolicy();
+
+		/**
+		 * @brief Gets the inner policy.
+		 *
+		 * @return A const reference to the inner policy.
+		 */
+		ConstInnerPolicyTypeLRef GetInnerPolicy() const;
+
+	public:
+		/**
+		 * @brief Allocates a block of memory from the inner policy and records it.
+		 *
+		 * @param size The number of bytes to allocate.
+		 * @param alignment The alignment of the block.
+		 * @return A pointer to the block.
+		 */
+		VoidPtr Allocate(Size size, Size alignment);
+
+		/**
+		 * @brief Resizes a block of memory through the inner policy and records it.
+		 *
+		 * @param pointer The block to resize, or nullptr to allocate a new one.
+		 * @param size The new number of bytes.
+		 * @param alignment The alignment of the block.
+		 * @return A pointer to the resized block.
+		 */
+		VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment);
+
+		/**
+		 * @brief Releases a block of memory to the inner policy and records it.
+		 *
+		 * @param pointer The block to release, or nullptr.
+		 */
+		Void Deallocate(VoidPtr pointer);
+
+	private:
+		static Size _offset(Size alignment);
+		static Header* _header(VoidPtr pointer);
+	};
+}
+
+#include "../../Private/Policies/TrackingAllocationPolicy.inl"
+
+#endif
\ No newline at end of file
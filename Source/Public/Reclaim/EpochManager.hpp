@@ -0,0 +1,264 @@
+#ifndef EPOCH_MANAGER_HPP
+#define EPOCH_MANAGER_HPP
+
+#include <new>
+#include <atomic>
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+#include "../Collections/DynamicArray.hpp"
+
+namespace Forge::Reclaim
+{
+	class Guard;
+
+	/**
+	 * @brief Defers the release of memory that concurrent readers may still be using until no
+	 * reader can reach it anymore.
+	 *
+	 * The EpochManager class keeps a global epoch and one record per thread that uses it. A thread
+	 * pins itself with a Guard before it reads shared data, which publishes the epoch it observed,
+	 * and unpins when the guard is destroyed. The global epoch only advances once every pinned
+	 * thread has observed it, so an object unlinked and retired during epoch e is unreachable
+	 * once the epoch reaches e + 2 and is then released through the allocator it came from.
+	 *
+	 * Retired objects are appended to a retire list owned by the retiring thread, so retiring
+	 * takes no lock. Every COLLECT_INTERVAL retirements the thread tries to advance the epoch and
+	 * releases at most RECLAIM_BATCH of its own reclaimable objects, which bounds the work any
+	 * single retirement does however large the backlog grows.
+	 *
+	 * A thread keeps its record until it exits, when the record and whatever is left in its
+	 * retire list are handed to the next thread that uses the manager. The manager must outlive
+	 * every operation on it, and its destructor releases everything still retired.
+	 */
+	class EpochManager
+	{
+	public:
+		using SelfType          = EpochManager;
+		using SelfTypePtr       = EpochManager*;
+		using SelfTypeLRef      = EpochManager&;
+		using ConstSelfType     = const EpochManager;
+		using ConstSelfTypePtr  = const EpochManager*;
+		using ConstSelfTypeLRef = const EpochManager&;
+
+	public:
+		using ReclaimFunction = Void (*)(VoidPtr pointer, VoidPtr context);
+
+	public:
+		static constexpr Size COLLECT_INTERVAL = 64;
+		static constexpr Size RECLAIM_BATCH = 128;
+
+	private:
+		static constexpr U64 PINNED_BIT = 0b1;
+		static constexpr Size THREAD_CACHE_SIZE = 16;
+
+	private:
+		friend class Guard;
+
+	private:
+		struct Retired
+		{
+			VoidPtr pointer;
+			VoidPtr context;
+
+			ReclaimFunction function;
+
+			U64 epoch;
+		};
+
+		struct alignas(64) ThreadRecord
+		{
+			::std::atomic<U64> epoch;
+
+			::std::atomic<Bool> in_use;
+			::std::atomic<U32> references;
+
+			Size nesting;
+			Size retire_count;
+
+			Size head;
+			DynamicArray<Retired> retired;
+
+			ThreadRecord* next;
+		};
+
+		struct ThreadCache
+		{
+			struct Entry
+			{
+				U64 manager_id;
+				ThreadRecord* record;
+			};
+
+			Entry entries[THREAD_CACHE_SIZE];
+			Size count;
+
+			ThreadCache();
+			~ThreadCache();
+		};
+
+	private:
+		::std::atomic<U64> m_epoch;
+		::std::atomic<ThreadRecord*> m_records;
+
+	private:
+		U64 m_id;
+
+	public:
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * Initializes a manager without any thread record.
+		 */
+		EpochManager();
+
+	public:
+		EpochManager(const EpochManager&) = delete;
+		EpochManager& operator=(const EpochManager&) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 *
+		 * Releases every object still retired. Must not run concurrently with any other operation
+		 * on the manager.
+		 */
+		~EpochManager();
+
+	public:
+		/**
+		 * @brief Gets the manager shared by the whole process.
+		 *
+		 * @return A reference to the default manager.
+		 */
+		static SelfTypeLRef GetDefault();
+
+	public:
+		/**
+		 * @brief Gets the current global epoch.
+		 *
+		 * @return U64 storing the global epoch.
+		 */
+		U64 GetEpoch() const;
+
+		/**
+		 * @brief Gets the number of objects retired by the calling thread that are not released yet.
+		 *
+		 * @return Size storing the number of pending objects.
+		 */
+		Size GetPendingCount();
+
+	public:
+		/**
+		 * @brief Pins the calling thread until the returned guard is destroyed.
+		 *
+		 * @return Guard keeping the thread pinned.
+		 */
+		Guard Pin();
+
+	public:
+		/**
+		 * @brief Retires an object that has been unlinked from every shared structure.
+		 *
+		 * The object is destroyed and its memory deallocated once no pinned thread can reach it.
+		 *
+		 * @param object The object to retire.
+		 * @param allocator The allocator the object was allocated from.
+		 */
+		template<typename InType, typename InAllocationPolicy>
+		Void Retire(InType* object, Allocator<InAllocationPolicy>* allocator);
+
+		/**
+		 * @brief Retires memory that has been unlinked from every shared structure.
+		 *
+		 * @param pointer The memory to retire.
+		 * @param context The argument passed to the function alongside the memory.
+		 * @param function The function that releases the memory once no pinned thread can reach it.
+		 */
+		Void Retire(VoidPtr pointer, VoidPtr context, ReclaimFunction function);
+
+	public:
+		/**
+		 * @brief Tries to advance the epoch and releases reclaimable objects of the calling thread.
+		 *
+		 * @param budget The maximum number of objects to release.
+		 * @return Size storing the number of objects released.
+		 */
+		Size Collect(Size budget = RECLAIM_BATCH);
+
+	private:
+		template<typename InType, typename InAllocationPolicy>
+		static Void _reclaim_object(VoidPtr pointer, VoidPtr context);
+
+	private:
+		static ThreadCache& _thread_cache();
+		static Void _release_record(ThreadRecord* record);
+
+	private:
+		ThreadRecord* _acquire_record();
+
+	private:
+		Void _enter(ThreadRecord* record);
+		Void _leave(ThreadRecord* record);
+
+	private:
+		Bool _try_advance();
+		Size _reclaim(ThreadRecord* record, Size budget);
+	};
+
+	/**
+	 * @brief Keeps the calling thread pinned to an epoch manager for its lifetime.
+	 *
+	 * Memory read from a shared structure while a guard is alive stays valid until the guard is
+	 * destroyed, even if it is retired in the meantime. Guards nest, and a guard must be destroyed
+	 * by the thread that created it.
+	 */
+	class Guard
+	{
+	public:
+		using SelfType          = Guard;
+		using SelfTypePtr       = Guard*;
+		using SelfTypeLRef      = Guard&;
+		using SelfTypeRRef      = Guard&&;
+		using ConstSelfType     = const Guard;
+		using ConstSelfTypePtr  = const Guard*;
+		using ConstSelfTypeLRef = const Guard&;
+
+	private:
+		EpochManager* m_manager;
+		EpochManager::ThreadRecord* m_record;
+
+	public:
+		/**
+		 * @brief Manager Constructor.
+		 *
+		 * Pins the calling thread to the specified manager.
+		 */
+		Guard(EpochManager& manager = EpochManager::GetDefault());
+
+	public:
+		/**
+		 * @brief Move Constructor.
+		 */
+		Guard(SelfTypeRRef other);
+
+		Guard(ConstSelfTypeLRef) = delete;
+
+	public:
+		/**
+		 * @brief Destructor.
+		 *
+		 * Unpins the calling thread unless an enclosing guard still pins it.
+		 */
+		~Guard();
+
+	public:
+		SelfTypeLRef operator=(SelfTypeRRef) = delete;
+		SelfTypeLRef operator=(ConstSelfTypeLRef) = delete;
+	};
+}
+
+#include "../../Private/Reclaim/EpochManager.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,26 @@
+#ifndef SEARCH_OPERATIONS_HPP
+#define SEARCH_OPERATIONS_HPP
+
+#include <forge-base/Core/Types.hpp>
+#include <forge-base/Core/System.hpp>
+
+namespace Forge
+{
+	/**
+	 * @brief Finds the first element of a sorted array that is not less than a key.
+	 *
+	 * The binary search is branchless: the comparison only selects the next base, so the number
+	 * of iterations depends on the count alone and the loop never mispredicts on the elements.
+	 *
+	 * @param elements The elements to search, sorted in ascending order.
+	 * @param count The number of elements.
+	 * @param key The key to search for.
+	 * @return The position of the first element not less than the key, or count if there is none.
+	 */
+	template<typename InElementType>
+	Size BranchlessLowerBound(const InElementType* elements, Size count, const InElementType& key);
+}
+
+#include "../Private/SearchOperations.inl"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef B_TREE_MAP_TESTS_HPP
+#define B_TREE_MAP_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <Collections/BTreeMap.hpp>
+
+using namespace Forge;
+
+class BTreeMapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = I32;
+	using DEFAULT_VALUE_TYPE = I32;
+
+	using DEFAULT_MAP_TYPE = BTreeMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 10000;
+
+protected:
+	DEFAULT_MAP_TYPE fixture_empty_map;
+	DEFAULT_MAP_TYPE fixture_nonempty_map;
+
+protected:
+	Void SetUp() override
+	{
+		// Inserts the even keys in a scattered order so that leaves split on both sides.
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		{
+			DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE((counter * 7919) % DEFAULT_COUNT) * 2;
+
+			fixture_nonempty_map.Insert(key, key + 1);
+		}
+	}
+};
+
+constexpr Size BTreeMapTest::DEFAULT_COUNT;
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(BTreeMapTest, Insert_ScatteredKeys_IteratesInKeyOrder)
+{
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT);
+	EXPECT_GT(fixture_nonempty_map.GetHeight(), 1u);
+
+	DEFAULT_MAP_TYPE::Iterator it = fixture_nonempty_map.LowerBound(0);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++, ++it)
+	{
+		EXPECT_EQ(it.GetKey(), DEFAULT_KEY_TYPE(counter * 2));
+		EXPECT_EQ(*it, DEFAULT_VALUE_TYPE(counter * 2 + 1));
+	}
+
+	EXPECT_TRUE(it == fixture_nonempty_map.GetFinalIterator());
+}
+TEST_F(BTreeMapTest, Insert_ContainedKey_KeepsExistingValue)
+{
+	EXPECT_FALSE(fixture_nonempty_map.Insert(20, 99));
+
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(fixture_nonempty_map.Get(20), 21);
+}
+
+// -------------------------
+// Get Functions.
+// -------------------------
+TEST_F(BTreeMapTest, Get_MissingKey_ThrowsOutOfRangeException)
+{
+	EXPECT_THROW(fixture_empty_map.Get(10), std::out_of_range);
+	EXPECT_THROW(fixture_nonempty_map.Get(35), std::out_of_range);
+	EXPECT_EQ(fixture_nonempty_map.TryGet(-2), nullptr);
+	EXPECT_EQ(fixture_nonempty_map.TryGet(DEFAULT_COUNT * 2), nullptr);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(BTreeMapTest, Remove_AllKeys_ShrinksToEmpty)
+{
+	EXPECT_FALSE(fixture_nonempty_map.Remove(1));
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE((counter * 104729) % DEFAULT_COUNT) * 2;
+
+		EXPECT_TRUE(fixture_nonempty_map.Remove(key));
+		EXPECT_FALSE(fixture_nonempty_map.Contains(key));
+	}
+
+	EXPECT_TRUE(fixture_nonempty_map.IsEmpty());
+	EXPECT_EQ(fixture_nonempty_map.GetHeight(), 0u);
+	EXPECT_TRUE(fixture_nonempty_map.GetBeginIterator() == fixture_nonempty_map.GetFinalIterator());
+}
+
+// -------------------------
+// Range Functions.
+// -------------------------
+TEST_F(BTreeMapTest, ForEachInRange_SpanningLeaves_VisitsKeysInRange)
+{
+	DEFAULT_KEY_TYPE expected = 1000;
+
+	fixture_nonempty_map.ForEachInRange(999, 3001, [&expected](DEFAULT_KEY_TYPE key, DEFAULT_VALUE_TYPE& value)
+	{
+		EXPECT_EQ(key, expected);
+		EXPECT_EQ(value, key + 1);
+
+		expected += 2;
+	});
+
+	EXPECT_EQ(expected, 3002);
+	EXPECT_EQ(fixture_nonempty_map.LowerBound(999).GetKey(), 1000);
+}
+
+// -------------------------
+// Bulk Load Constructor.
+// -------------------------
+TEST_F(BTreeMapTest, BulkLoad_SortedArrays_MatchesInsertedMap)
+{
+	DynamicArray<DEFAULT_KEY_TYPE> keys;
+	DynamicArray<DEFAULT_VALUE_TYPE> values;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		keys.PushBack(DEFAULT_KEY_TYPE(counter * 2));
+		values.PushBack(DEFAULT_VALUE_TYPE(counter * 2 + 1));
+	}
+
+	DEFAULT_MAP_TYPE map(keys, values);
+
+	EXPECT_EQ(map.GetCount(), DEFAULT_COUNT);
+	EXPECT_LE(map.GetHeight(), fixture_nonempty_map.GetHeight());
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(map.Get(DEFAULT_KEY_TYPE(counter * 2)), DEFAULT_VALUE_TYPE(counter * 2 + 1));
+
+	EXPECT_TRUE(map.Insert(3, 0));
+	EXPECT_TRUE(map.Remove(4));
+	EXPECT_EQ(map.GetCount(), DEFAULT_COUNT);
+}
+TEST_F(BTreeMapTest, BulkLoad_UnsortedKeys_ThrowsInvalidArgumentException)
+{
+	DynamicArray<DEFAULT_KEY_TYPE> keys = { 1, 3, 3 };
+	DynamicArray<DEFAULT_VALUE_TYPE> values = { 1, 2, 3 };
+
+	EXPECT_THROW(DEFAULT_MAP_TYPE(keys, values), std::invalid_argument);
+}
+
+#endif
\ No newline at end of file
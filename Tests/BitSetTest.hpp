@@ -0,0 +1,167 @@
+#ifndef BIT_SET_TESTS_HPP
+#define BIT_SET_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <Collections/StaticBitSet.hpp>
+#include <Collections/DynamicBitSet.hpp>
+
+using namespace Forge;
+
+class BitSetTest : public testing::Test
+{
+public:
+	static constexpr Size DEFAULT_BIT_COUNT = 200;
+	static constexpr Size DEFAULT_COUNT = 6;
+
+public:
+	Size DEFAULT_INDICES[DEFAULT_COUNT] = { 0, 5, 63, 64, 130, 199 };
+
+protected:
+	StaticBitSet<DEFAULT_BIT_COUNT> fixture_static_set;
+	DynamicBitSet<> fixture_dynamic_set = DynamicBitSet<>(DEFAULT_BIT_COUNT);
+
+protected:
+	Void SetUp() override
+	{
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		{
+			fixture_static_set.Set(DEFAULT_INDICES[counter]);
+			fixture_dynamic_set.Set(DEFAULT_INDICES[counter]);
+		}
+	}
+};
+
+constexpr Size BitSetTest::DEFAULT_BIT_COUNT;
+constexpr Size BitSetTest::DEFAULT_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(BitSetTest, DefaultConstructor_StaticSet_HasNoSetBits)
+{
+	StaticBitSet<DEFAULT_BIT_COUNT> test_set;
+
+	EXPECT_TRUE(test_set.None());
+	EXPECT_EQ(test_set.PopCount(), 0);
+	EXPECT_EQ(test_set.FindFirstSet(), DEFAULT_BIT_COUNT);
+}
+TEST_F(BitSetTest, DefaultConstructor_DynamicSet_IsEmpty)
+{
+	DynamicBitSet<> test_set;
+
+	EXPECT_TRUE(test_set.IsEmpty());
+	EXPECT_EQ(test_set.GetWordCount(), 0);
+	EXPECT_EQ(test_set.FindFirstSet(), 0);
+}
+
+// -------------------------
+// Test Function.
+// -------------------------
+TEST_F(BitSetTest, Test_IndexOutOfRange_ThrowsOutOfRangeException)
+{
+	EXPECT_THROW(fixture_static_set.Test(DEFAULT_BIT_COUNT), std::out_of_range);
+	EXPECT_THROW(fixture_dynamic_set.Test(DEFAULT_BIT_COUNT), std::out_of_range);
+}
+
+// -------------------------
+// PopCount Function.
+// -------------------------
+TEST_F(BitSetTest, PopCount_NonEmptySet_CountsSetBits)
+{
+	EXPECT_EQ(fixture_static_set.PopCount(), DEFAULT_COUNT);
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), DEFAULT_COUNT);
+}
+
+// -------------------------
+// FindNextSet Function.
+// -------------------------
+TEST_F(BitSetTest, FindNextSet_NonEmptySet_VisitsSetBitsInOrder)
+{
+	Size counter = 0;
+
+	for (Size index = fixture_static_set.FindFirstSet(); index < DEFAULT_BIT_COUNT; index = fixture_static_set.FindNextSet(index))
+		EXPECT_EQ(index, DEFAULT_INDICES[counter++]);
+
+	EXPECT_EQ(counter, DEFAULT_COUNT);
+
+	counter = 0;
+
+	for (Size index = fixture_dynamic_set.FindFirstSet(); index < DEFAULT_BIT_COUNT; index = fixture_dynamic_set.FindNextSet(index))
+		EXPECT_EQ(index, DEFAULT_INDICES[counter++]);
+
+	EXPECT_EQ(counter, DEFAULT_COUNT);
+}
+
+// -------------------------
+// SetAll and FlipAll Functions.
+// -------------------------
+TEST_F(BitSetTest, FlipAll_NonEmptySet_KeepsTrailingBitsClear)
+{
+	fixture_static_set.FlipAll();
+	fixture_dynamic_set.FlipAll();
+
+	EXPECT_EQ(fixture_static_set.PopCount(), DEFAULT_BIT_COUNT - DEFAULT_COUNT);
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), DEFAULT_BIT_COUNT - DEFAULT_COUNT);
+
+	fixture_static_set.SetAll();
+	fixture_dynamic_set.SetAll();
+
+	EXPECT_TRUE(fixture_static_set.All());
+	EXPECT_TRUE(fixture_dynamic_set.All());
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), DEFAULT_BIT_COUNT);
+}
+
+// -------------------------
+// Bitwise Functions.
+// -------------------------
+TEST_F(BitSetTest, And_OverlappingSets_KeepsCommonBits)
+{
+	DynamicBitSet<> test_set(DEFAULT_BIT_COUNT);
+
+	test_set.Set(5);
+	test_set.Set(64);
+	test_set.Set(100);
+
+	fixture_dynamic_set.And(test_set);
+
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), 2);
+	EXPECT_TRUE(fixture_dynamic_set.Test(5));
+	EXPECT_TRUE(fixture_dynamic_set.Test(64));
+}
+TEST_F(BitSetTest, AndNot_OverlappingSets_ClearsOtherBits)
+{
+	StaticBitSet<DEFAULT_BIT_COUNT> test_set;
+
+	test_set.Set(0);
+	test_set.Set(199);
+
+	fixture_static_set.AndNot(test_set);
+
+	EXPECT_EQ(fixture_static_set.PopCount(), DEFAULT_COUNT - 2);
+	EXPECT_EQ(fixture_static_set.FindFirstSet(), 5);
+}
+TEST_F(BitSetTest, Or_DifferentBitCounts_ThrowsInvalidArgumentException)
+{
+	DynamicBitSet<> test_set(DEFAULT_BIT_COUNT + 1);
+
+	EXPECT_THROW(fixture_dynamic_set.Or(test_set), std::invalid_argument);
+}
+
+// -------------------------
+// Resize Function.
+// -------------------------
+TEST_F(BitSetTest, Resize_GrowWithSetBits_SetsOnlyAddedBits)
+{
+	fixture_dynamic_set.Resize(DEFAULT_BIT_COUNT + 100, true);
+
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), DEFAULT_COUNT + 100);
+	EXPECT_FALSE(fixture_dynamic_set.Test(DEFAULT_BIT_COUNT - 2));
+	EXPECT_TRUE(fixture_dynamic_set.Test(DEFAULT_BIT_COUNT));
+
+	fixture_dynamic_set.Resize(64);
+
+	EXPECT_EQ(fixture_dynamic_set.PopCount(), 3);
+}
+
+#endif
\ No newline at end of file
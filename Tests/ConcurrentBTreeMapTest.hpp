@@ -0,0 +1,140 @@
+#ifndef CONCURRENT_B_TREE_MAP_TESTS_HPP
+#define CONCURRENT_B_TREE_MAP_TESTS_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Collections/ConcurrentBTreeMap.hpp>
+
+using namespace Forge;
+
+class ConcurrentBTreeMapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = U32;
+	using DEFAULT_VALUE_TYPE = U32;
+
+	using DEFAULT_MAP_TYPE = ConcurrentBTreeMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_THREAD_COUNT = 4;
+	static constexpr Size DEFAULT_COUNT_PER_THREAD = 20000;
+
+protected:
+	DEFAULT_MAP_TYPE fixture_map;
+
+protected:
+	/**
+	 * @brief Inserts the keys of every thread concurrently, interleaving the threads' keys so
+	 * that they write to the same leaves.
+	 */
+	Void InsertConcurrently()
+	{
+		std::vector<std::thread> threads;
+
+		for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+		{
+			threads.emplace_back([this, thread_index]()
+			{
+				for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+				{
+					DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE(counter * DEFAULT_THREAD_COUNT + thread_index);
+
+					fixture_map.Insert(key, key + 1);
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+};
+
+constexpr Size ConcurrentBTreeMapTest::DEFAULT_THREAD_COUNT;
+constexpr Size ConcurrentBTreeMapTest::DEFAULT_COUNT_PER_THREAD;
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(ConcurrentBTreeMapTest, Insert_ConcurrentWriters_ContainsEveryKey)
+{
+	InsertConcurrently();
+
+	EXPECT_EQ(fixture_map.GetCount(), DEFAULT_THREAD_COUNT * DEFAULT_COUNT_PER_THREAD);
+
+	for (Size counter = 0; counter < DEFAULT_THREAD_COUNT * DEFAULT_COUNT_PER_THREAD; counter++)
+	{
+		DEFAULT_VALUE_TYPE value = 0;
+
+		EXPECT_TRUE(fixture_map.TryGet(DEFAULT_KEY_TYPE(counter), value));
+		EXPECT_EQ(value, DEFAULT_VALUE_TYPE(counter + 1));
+	}
+}
+TEST_F(ConcurrentBTreeMapTest, InsertOrAssign_ContainedKey_ReplacesValue)
+{
+	EXPECT_TRUE(fixture_map.InsertOrAssign(10, 1));
+	EXPECT_FALSE(fixture_map.InsertOrAssign(10, 2));
+	EXPECT_FALSE(fixture_map.Insert(10, 3));
+
+	DEFAULT_VALUE_TYPE value = 0;
+
+	EXPECT_TRUE(fixture_map.TryGet(10, value));
+	EXPECT_EQ(value, 2u);
+	EXPECT_EQ(fixture_map.GetCount(), 1u);
+}
+
+// -------------------------
+// Scan Function.
+// -------------------------
+TEST_F(ConcurrentBTreeMapTest, Scan_DuringConcurrentSplits_VisitsKeysInOrder)
+{
+	std::atomic<Bool> done(false);
+	std::atomic<Bool> ordered(true);
+
+	std::thread reader([this, &done, &ordered]()
+	{
+		while (!done.load())
+		{
+			DEFAULT_KEY_TYPE previous = 0;
+			Bool any = false;
+
+			fixture_map.Scan(0, DEFAULT_KEY_TYPE(-1), [&](DEFAULT_KEY_TYPE key, DEFAULT_VALUE_TYPE value)
+			{
+				if ((any && key <= previous) || value != key + 1)
+					ordered.store(false);
+
+				previous = key;
+				any = true;
+			});
+		}
+	});
+
+	InsertConcurrently();
+
+	done.store(true);
+	reader.join();
+
+	EXPECT_TRUE(ordered.load());
+	EXPECT_EQ(fixture_map.Scan(100, 199, [](DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE) {}), 100u);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(ConcurrentBTreeMapTest, Remove_ContainedKeys_RemovesOnlyThoseKeys)
+{
+	InsertConcurrently();
+
+	for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter += 2)
+		EXPECT_TRUE(fixture_map.Remove(DEFAULT_KEY_TYPE(counter)));
+
+	EXPECT_FALSE(fixture_map.Remove(0));
+	EXPECT_FALSE(fixture_map.Contains(0));
+	EXPECT_TRUE(fixture_map.Contains(1));
+	EXPECT_EQ(fixture_map.GetCount(), DEFAULT_THREAD_COUNT * DEFAULT_COUNT_PER_THREAD - DEFAULT_COUNT_PER_THREAD / 2);
+}
+
+#endif
\ No newline at end of file
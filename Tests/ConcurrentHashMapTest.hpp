@@ -0,0 +1,274 @@
+#ifndef CONCURRENT_HASH_MAP_TESTS_HPP
+#define CONCURRENT_HASH_MAP_TESTS_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Collections/ConcurrentHashMap.hpp>
+
+using namespace Forge;
+
+class ConcurrentHashMapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = U64;
+	using DEFAULT_VALUE_TYPE = U64;
+
+	using DEFAULT_MAP_TYPE = ConcurrentHashMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size DEFAULT_THREAD_COUNT = 4;
+	static constexpr Size DEFAULT_READER_COUNT = 2;
+	static constexpr Size DEFAULT_COUNT_PER_THREAD = 20000;
+
+	static constexpr Size TRANSFER_STRIDE = DEFAULT_MAP_TYPE::TRANSFER_STRIDE;
+
+protected:
+	DEFAULT_MAP_TYPE fixture_map;
+};
+
+constexpr Size ConcurrentHashMapTest::DEFAULT_COUNT;
+constexpr Size ConcurrentHashMapTest::DEFAULT_THREAD_COUNT;
+constexpr Size ConcurrentHashMapTest::DEFAULT_READER_COUNT;
+constexpr Size ConcurrentHashMapTest::DEFAULT_COUNT_PER_THREAD;
+constexpr Size ConcurrentHashMapTest::TRANSFER_STRIDE;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, DefaultConstructor_NewMap_IsEmpty)
+{
+	DEFAULT_VALUE_TYPE value = 0;
+
+	EXPECT_TRUE(fixture_map.IsEmpty());
+	EXPECT_EQ(fixture_map.GetCount(), 0u);
+	EXPECT_EQ(fixture_map.GetCapacity(), DEFAULT_MAP_TYPE::MINIMUM_CAPACITY);
+	EXPECT_FALSE(fixture_map.Contains(0));
+	EXPECT_FALSE(fixture_map.TryGet(0, value));
+}
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, Insert_NewKeys_AreContained)
+{
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_TRUE(fixture_map.Insert(counter, counter * 2));
+
+	EXPECT_EQ(fixture_map.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		DEFAULT_VALUE_TYPE value = 0;
+
+		EXPECT_TRUE(fixture_map.TryGet(counter, value));
+		EXPECT_EQ(value, counter * 2);
+	}
+
+	EXPECT_FALSE(fixture_map.Contains(DEFAULT_COUNT));
+}
+
+TEST_F(ConcurrentHashMapTest, Insert_ContainedKey_KeepsValue)
+{
+	EXPECT_TRUE(fixture_map.Insert(7, 1));
+	EXPECT_FALSE(fixture_map.Insert(7, 2));
+
+	DEFAULT_VALUE_TYPE value = 0;
+
+	EXPECT_TRUE(fixture_map.TryGet(7, value));
+	EXPECT_EQ(value, 1u);
+	EXPECT_EQ(fixture_map.GetCount(), 1u);
+}
+
+// -------------------------
+// InsertOrAssign Function.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, InsertOrAssign_ContainedKey_ReplacesValue)
+{
+	EXPECT_TRUE(fixture_map.InsertOrAssign(7, 1));
+	EXPECT_FALSE(fixture_map.InsertOrAssign(7, 2));
+
+	DEFAULT_VALUE_TYPE value = 0;
+
+	EXPECT_TRUE(fixture_map.TryGet(7, value));
+	EXPECT_EQ(value, 2u);
+	EXPECT_EQ(fixture_map.GetCount(), 1u);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, Remove_ContainedKeys_RemovesOnlyThoseKeys)
+{
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		fixture_map.Insert(counter, counter);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter += 2)
+		EXPECT_TRUE(fixture_map.Remove(counter));
+
+	EXPECT_FALSE(fixture_map.Remove(0));
+	EXPECT_FALSE(fixture_map.Remove(DEFAULT_COUNT));
+	EXPECT_EQ(fixture_map.GetCount(), DEFAULT_COUNT / 2);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(fixture_map.Contains(counter), counter % 2 == 1);
+}
+
+// -------------------------
+// Resize.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, Insert_ResizeSpanningSeveralStrides_KeepsEveryKeyReachable)
+{
+	const Size capacity = TRANSFER_STRIDE * 8;
+
+	DEFAULT_MAP_TYPE map(capacity / 4 * 3);
+
+	ASSERT_EQ(map.GetCapacity(), capacity);
+
+	Size count = 0;
+
+	for (; count < capacity / 4 * 3; count++)
+		map.Insert(count, count);
+
+	EXPECT_EQ(map.GetCapacity(), capacity);
+
+	// Every write moves one stride, so the transfer stays in progress for several writes.
+	for (Size stride = 0; stride < capacity / TRANSFER_STRIDE; stride++, count++)
+	{
+		map.Insert(count, count);
+
+		EXPECT_TRUE(map.Remove(stride));
+		EXPECT_TRUE(map.Insert(stride, stride));
+
+		for (Size key = 0; key <= count; key++)
+		{
+			DEFAULT_VALUE_TYPE value = 0;
+
+			ASSERT_TRUE(map.TryGet(key, value));
+			EXPECT_EQ(value, key);
+		}
+	}
+
+	EXPECT_EQ(map.GetCapacity(), capacity * 2);
+	EXPECT_EQ(map.GetCount(), count);
+}
+
+TEST_F(ConcurrentHashMapTest, Destructor_DuringResize_ReleasesBothTables)
+{
+	const Size capacity = TRANSFER_STRIDE * 8;
+
+	DEFAULT_MAP_TYPE map(capacity / 4 * 3);
+
+	for (Size counter = 0; counter <= capacity / 4 * 3; counter++)
+		map.Insert(counter, counter);
+
+	// Only the first stride has been moved, so the new table is still mostly uninitialized.
+	EXPECT_EQ(map.GetCapacity(), capacity);
+
+	for (Size counter = 0; counter <= capacity / 4 * 3; counter++)
+		EXPECT_TRUE(map.Contains(counter));
+}
+
+TEST_F(ConcurrentHashMapTest, Insert_RepeatedResizes_GrowsCapacity)
+{
+	for (Size counter = 0; counter < DEFAULT_COUNT * 10; counter++)
+		fixture_map.Insert(counter, counter);
+
+	EXPECT_GE(fixture_map.GetCapacity(), DEFAULT_COUNT * 10 / 3 * 4);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT * 10; counter++)
+		EXPECT_TRUE(fixture_map.Contains(counter));
+}
+
+// -------------------------
+// Concurrency.
+// -------------------------
+TEST_F(ConcurrentHashMapTest, Operations_ConcurrentWritersAndReaders_LeaveExpectedContents)
+{
+	std::atomic<Bool> writing{ true };
+	std::atomic<Size> mismatch_count{ 0 };
+
+	std::vector<std::thread> writers;
+	std::vector<std::thread> readers;
+
+	for (Size thread_index = 0; thread_index < DEFAULT_READER_COUNT; thread_index++)
+	{
+		readers.emplace_back([this, &writing, &mismatch_count]()
+		{
+			while (writing.load(std::memory_order_acquire))
+			{
+				for (Size key = 0; key < DEFAULT_COUNT_PER_THREAD * DEFAULT_THREAD_COUNT; key += 97)
+				{
+					DEFAULT_VALUE_TYPE value = 0;
+
+					// A key is only ever mapped to itself or to its double.
+					if (fixture_map.TryGet(key, value) && value != key && value != key * 2)
+						mismatch_count.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+	}
+
+	for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+	{
+		writers.emplace_back([this, thread_index]()
+		{
+			for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+			{
+				DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE(counter * DEFAULT_THREAD_COUNT + thread_index);
+
+				fixture_map.Insert(key, key);
+			}
+
+			for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+			{
+				DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE(counter * DEFAULT_THREAD_COUNT + thread_index);
+
+				if (counter % 3 == 0)
+					fixture_map.Remove(key);
+				else if (counter % 3 == 1)
+					fixture_map.InsertOrAssign(key, key * 2);
+			}
+		});
+	}
+
+	for (std::thread& thread : writers)
+		thread.join();
+
+	writing.store(false, std::memory_order_release);
+
+	for (std::thread& thread : readers)
+		thread.join();
+
+	EXPECT_EQ(mismatch_count.load(), 0u);
+
+	Size expected_count = 0;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+	{
+		for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+		{
+			DEFAULT_KEY_TYPE key = DEFAULT_KEY_TYPE(counter * DEFAULT_THREAD_COUNT + thread_index);
+			DEFAULT_VALUE_TYPE value = 0;
+
+			if (counter % 3 == 0)
+			{
+				EXPECT_FALSE(fixture_map.TryGet(key, value));
+				continue;
+			}
+
+			expected_count++;
+
+			ASSERT_TRUE(fixture_map.TryGet(key, value));
+			EXPECT_EQ(value, counter % 3 == 1 ? key * 2 : key);
+		}
+	}
+
+	EXPECT_EQ(fixture_map.GetCount(), expected_count);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,203 @@
+#ifndef DEFAULT_ALLOCATOR_TESTS_HPP
+#define DEFAULT_ALLOCATOR_TESTS_HPP
+
+#include <new>
+#include <thread>
+#include <cstdlib>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <DefaultAllocator.hpp>
+#include <Collections/SharedArray.hpp>
+#include <Policies/StackAllocationPolicy.hpp>
+
+using namespace Forge;
+
+/**
+ * A stateless policy that counts how often it is allocated with new.
+ */
+struct EmptyAllocationPolicy
+{
+	static Size& GetNewCount()
+	{
+		static Size count = 0;
+
+		return count;
+	}
+
+	static VoidPtr operator new(::std::size_t size)
+	{
+		GetNewCount()++;
+
+		return ::operator new(size);
+	}
+
+	static Void operator delete(VoidPtr pointer)
+	{
+		::operator delete(pointer);
+	}
+
+	VoidPtr Allocate(Size size, Size)
+	{
+		return ::std::malloc(size);
+	}
+
+	VoidPtr Reallocate(VoidPtr pointer, Size size, Size)
+	{
+		return ::std::realloc(pointer, size);
+	}
+
+	Void Deallocate(VoidPtr pointer)
+	{
+		::std::free(pointer);
+	}
+};
+
+/**
+ * A stateful policy that counts its allocations and how often it is allocated with new.
+ */
+struct CountingAllocationPolicy
+{
+	Size allocation_count = 0;
+
+	static Size& GetNewCount()
+	{
+		static Size count = 0;
+
+		return count;
+	}
+
+	static VoidPtr operator new(::std::size_t size)
+	{
+		GetNewCount()++;
+
+		return ::operator new(size);
+	}
+
+	static Void operator delete(VoidPtr pointer)
+	{
+		::operator delete(pointer);
+	}
+
+	VoidPtr Allocate(Size size, Size)
+	{
+		allocation_count++;
+
+		return ::std::malloc(size);
+	}
+
+	VoidPtr Reallocate(VoidPtr pointer, Size size, Size)
+	{
+		if (pointer == nullptr)
+			allocation_count++;
+
+		return ::std::realloc(pointer, size);
+	}
+
+	Void Deallocate(VoidPtr pointer)
+	{
+		::std::free(pointer);
+	}
+};
+
+class DefaultAllocatorTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using EMPTY_ALLOCATOR_TYPE = Allocator<EmptyAllocationPolicy>;
+	using COUNTING_ALLOCATOR_TYPE = Allocator<CountingAllocationPolicy>;
+	using STACK_ALLOCATOR_TYPE = Allocator<StackAllocationPolicy>;
+
+	using EMPTY_ARRAY_TYPE = SharedArray<DEFAULT_ELEMENT_TYPE, EmptyAllocationPolicy>;
+	using COUNTING_ARRAY_TYPE = SharedArray<DEFAULT_ELEMENT_TYPE, CountingAllocationPolicy>;
+
+public:
+	static constexpr Size DEFAULT_CALL_COUNT = 10;
+};
+
+constexpr Size DefaultAllocatorTest::DEFAULT_CALL_COUNT;
+
+// -------------------------
+// GetDefaultAllocator Function.
+// -------------------------
+TEST_F(DefaultAllocatorTest, GetDefaultAllocator_RepeatedCalls_ReturnSameInstance)
+{
+	COUNTING_ALLOCATOR_TYPE* allocator = GetDefaultAllocator<COUNTING_ALLOCATOR_TYPE>();
+
+	ASSERT_NE(allocator, nullptr);
+
+	for (Size counter = 0; counter < DEFAULT_CALL_COUNT; counter++)
+		EXPECT_EQ(GetDefaultAllocator<COUNTING_ALLOCATOR_TYPE>(), allocator);
+
+	EXPECT_EQ(GetDefaultAllocator<EMPTY_ALLOCATOR_TYPE>(), GetDefaultAllocator<EMPTY_ALLOCATOR_TYPE>());
+}
+
+TEST_F(DefaultAllocatorTest, GetDefaultAllocator_TwoContainers_ShareTheAllocator)
+{
+	COUNTING_ALLOCATOR_TYPE* allocator = GetDefaultAllocator<COUNTING_ALLOCATOR_TYPE>();
+
+	Size allocation_count = allocator->allocation_count;
+
+	{
+		COUNTING_ARRAY_TYPE first = { 1, 2, 3 };
+		COUNTING_ARRAY_TYPE second = { 4, 5, 6 };
+
+		EXPECT_EQ(allocator->allocation_count, allocation_count + 2);
+		EXPECT_EQ(first[2], 3u);
+		EXPECT_EQ(second[2], 6u);
+	}
+
+	EXPECT_EQ(GetDefaultAllocator<COUNTING_ALLOCATOR_TYPE>(), allocator);
+}
+
+TEST_F(DefaultAllocatorTest, GetDefaultAllocator_EmptyPolicy_UsesStaticObject)
+{
+	static_assert(::std::is_empty<EMPTY_ALLOCATOR_TYPE>::value, "The policy must be empty");
+	static_assert(::std::is_trivially_destructible<EMPTY_ALLOCATOR_TYPE>::value, "The policy must be trivially destructible");
+
+	{
+		EMPTY_ARRAY_TYPE first = { 1, 2, 3 };
+		EMPTY_ARRAY_TYPE second = { 4, 5, 6 };
+
+		EXPECT_EQ(first[0], 1u);
+		EXPECT_EQ(second[0], 4u);
+	}
+
+	EXPECT_NE(GetDefaultAllocator<EMPTY_ALLOCATOR_TYPE>(), nullptr);
+	EXPECT_EQ(EmptyAllocationPolicy::GetNewCount(), 0u);
+}
+
+TEST_F(DefaultAllocatorTest, GetDefaultAllocator_StatefulPolicy_IsAllocatedOnce)
+{
+	static_assert(!::std::is_empty<COUNTING_ALLOCATOR_TYPE>::value, "The policy must hold state");
+
+	for (Size counter = 0; counter < DEFAULT_CALL_COUNT; counter++)
+	{
+		COUNTING_ARRAY_TYPE array = { DEFAULT_ELEMENT_TYPE(counter) };
+
+		EXPECT_EQ(array[0], DEFAULT_ELEMENT_TYPE(counter));
+	}
+
+	EXPECT_EQ(CountingAllocationPolicy::GetNewCount(), 1u);
+}
+
+TEST_F(DefaultAllocatorTest, GetDefaultAllocator_StackPolicy_IsPerThread)
+{
+	STACK_ALLOCATOR_TYPE* allocator = GetDefaultAllocator<STACK_ALLOCATOR_TYPE>();
+	STACK_ALLOCATOR_TYPE* thread_allocator = nullptr;
+
+	std::thread thread([&thread_allocator]()
+	{
+		thread_allocator = GetDefaultAllocator<STACK_ALLOCATOR_TYPE>();
+	});
+
+	thread.join();
+
+	EXPECT_EQ(GetDefaultAllocator<STACK_ALLOCATOR_TYPE>(), allocator);
+	EXPECT_EQ(allocator, StackAllocationPolicy::GetThreadScratch());
+	EXPECT_NE(thread_allocator, allocator);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,418 @@
+#ifndef DYNAMIC_ARRAY_TESTS_HPP
+#define DYNAMIC_ARRAY_TESTS_HPP
+
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/TrackingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+/**
+ * An element that counts its live instances, to check that removed elements are destroyed.
+ */
+struct LiveElement
+{
+	U64 value;
+
+	static Size& GetLiveCount()
+	{
+		static Size count = 0;
+
+		return count;
+	}
+
+	LiveElement(U64 in_value = 0)
+		: value(in_value)
+	{
+		GetLiveCount()++;
+	}
+
+	LiveElement(const LiveElement& other)
+		: value(other.value)
+	{
+		GetLiveCount()++;
+	}
+
+	LiveElement& operator=(const LiveElement& other) = default;
+
+	~LiveElement()
+	{
+		GetLiveCount()--;
+	}
+};
+
+class DynamicArrayTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ARRAY_TYPE = DynamicArray<DEFAULT_ELEMENT_TYPE>;
+	using LIVE_ARRAY_TYPE = DynamicArray<LiveElement>;
+	using STRING_ARRAY_TYPE = DynamicArray<std::string>;
+
+	using TRACKING_POLICY_TYPE = TrackingAllocationPolicy<HeapAllocationPolicy>;
+	using TRACKING_ARRAY_TYPE = DynamicArrayWithPolicy<LiveElement, TRACKING_POLICY_TYPE>;
+	using TRACKING_STRING_ARRAY_TYPE = DynamicArrayWithPolicy<std::string, TRACKING_POLICY_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+};
+
+constexpr Size DynamicArrayTest::DEFAULT_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(DynamicArrayTest, DefaultConstructor_NewArray_IsEmpty)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetCount(), 0u);
+}
+
+// -------------------------
+// PushBack Function.
+// -------------------------
+TEST_F(DynamicArrayTest, PushBack_EmptyArray_GrowsOnDemand)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		array.PushBack(DEFAULT_ELEMENT_TYPE(counter));
+
+		EXPECT_GE(array.GetCapacity(), array.GetCount());
+	}
+
+	EXPECT_EQ(array.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter));
+}
+
+TEST_F(DynamicArrayTest, PushFront_EmptyArray_KeepsReverseOrder)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushFront(DEFAULT_ELEMENT_TYPE(counter));
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(DEFAULT_COUNT - 1 - counter));
+}
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(DynamicArrayTest, Insert_MiddleIndex_ShiftsFollowingElements)
+{
+	DEFAULT_ARRAY_TYPE array = { 0, 1, 3, 4 };
+
+	array.Insert(2, DEFAULT_ELEMENT_TYPE(2));
+
+	ASSERT_EQ(array.GetCount(), 5u);
+
+	for (Size counter = 0; counter < array.GetCount(); counter++)
+		EXPECT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter));
+
+	EXPECT_THROW(array.Insert(array.GetCount(), DEFAULT_ELEMENT_TYPE(0)), std::out_of_range);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(DynamicArrayTest, Remove_MiddleIndex_DestroysRemovedElement)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE array;
+
+		for (Size counter = 0; counter < 10; counter++)
+			array.PushBack(LiveElement(counter));
+
+		array.Remove(4);
+
+		ASSERT_EQ(array.GetCount(), 9u);
+
+		for (Size counter = 0; counter < array.GetCount(); counter++)
+			EXPECT_EQ(array[counter].value, counter < 4 ? counter : counter + 1);
+
+		EXPECT_THROW(array.Remove(array.GetCount()), std::out_of_range);
+	}
+
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+TEST_F(DynamicArrayTest, Remove_MiddleRange_DestroysRangeAndShiftsTail)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE array;
+
+		for (Size counter = 0; counter < 10; counter++)
+			array.PushBack(LiveElement(counter));
+
+		LIVE_ARRAY_TYPE::Iterator first(&array[2]);
+		LIVE_ARRAY_TYPE::Iterator last(&array[5]);
+
+		array.Remove(first, last);
+
+		ASSERT_EQ(array.GetCount(), 7u);
+		EXPECT_EQ(LiveElement::GetLiveCount(), live_count + 7);
+
+		for (Size counter = 0; counter < array.GetCount(); counter++)
+			EXPECT_EQ(array[counter].value, counter < 2 ? counter : counter + 3);
+
+		LIVE_ARRAY_TYPE::Iterator tail_first(&array[4]);
+		LIVE_ARRAY_TYPE::Iterator tail_last(&array[0] + array.GetCount());
+
+		array.Remove(tail_first, tail_last);
+
+		ASSERT_EQ(array.GetCount(), 4u);
+		EXPECT_EQ(array[3].value, 6u);
+		EXPECT_EQ(LiveElement::GetLiveCount(), live_count + 4);
+	}
+
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Assign Function.
+// -------------------------
+TEST_F(DynamicArrayTest, Assign_ExistingIndex_ReplacesWithoutLeaking)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE array;
+
+		for (Size counter = 0; counter < 10; counter++)
+			array.PushBack(LiveElement(counter));
+
+		LiveElement element(100);
+
+		array.Assign(3, element);
+		array.Assign(4, LiveElement(200));
+
+		EXPECT_EQ(array[3].value, 100u);
+		EXPECT_EQ(array[4].value, 200u);
+		EXPECT_EQ(LiveElement::GetLiveCount(), live_count + 11);
+
+		EXPECT_THROW(array.Assign(array.GetCount(), element), std::out_of_range);
+	}
+
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+TEST_F(DynamicArrayTest, Assign_StringElements_ReleasesPreviousValue)
+{
+	STRING_ARRAY_TYPE array;
+
+	array.PushBack(std::string(100, 'a'));
+	array.PushBack(std::string(100, 'b'));
+
+	array.Assign(0, std::string(100, 'c'));
+	array.Assign(1, std::string("short"));
+
+	EXPECT_EQ(array[0], std::string(100, 'c'));
+	EXPECT_EQ(array[1], "short");
+}
+
+// -------------------------
+// PopBack and PopFront Functions.
+// -------------------------
+TEST_F(DynamicArrayTest, PopBackAndPopFront_NonEmptyArray_DestroyElements)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	LIVE_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 10; counter++)
+		array.PushBack(LiveElement(counter));
+
+	array.PopBack();
+	array.PopFront();
+
+	ASSERT_EQ(array.GetCount(), 8u);
+	EXPECT_EQ(array[0].value, 1u);
+	EXPECT_EQ(array[7].value, 8u);
+
+	array.Clear();
+
+	EXPECT_THROW(array.PopBack(), std::length_error);
+	EXPECT_THROW(array.PopFront(), std::length_error);
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Reserve Function.
+// -------------------------
+TEST_F(DynamicArrayTest, Reserve_BelowCount_DestroysTrailingElements)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	LIVE_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 10; counter++)
+		array.PushBack(LiveElement(counter));
+
+	array.Reserve(4);
+
+	EXPECT_EQ(array.GetCount(), 4u);
+	EXPECT_EQ(array.GetCapacity(), 4u);
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count + 4);
+
+	array.Reserve(0);
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetRawData(), nullptr);
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+TEST_F(DynamicArrayTest, Reserve_ShortStrings_RelocatesElements)
+{
+	STRING_ARRAY_TYPE array;
+
+	// Short strings keep their characters inside the object, so copying their bytes to a new
+	// block would leave them pointing into the old one.
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(std::to_string(counter));
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		ASSERT_EQ(array[counter], std::to_string(counter));
+
+	array.Reserve(DEFAULT_COUNT * 4);
+	array.Compact();
+
+	ASSERT_EQ(array.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		ASSERT_EQ(array[counter], std::to_string(counter));
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(DynamicArrayTest, CopyConstructor_NonEmptyArray_CopiesElements)
+{
+	DEFAULT_ARRAY_TYPE array = { 1, 2, 3 };
+	DEFAULT_ARRAY_TYPE copy(array);
+
+	array[0] = 10;
+
+	ASSERT_EQ(copy.GetCount(), 3u);
+	EXPECT_EQ(copy[0], 1u);
+	EXPECT_EQ(copy[2], 3u);
+	EXPECT_NE(copy.GetRawData(), array.GetRawData());
+}
+
+TEST_F(DynamicArrayTest, MoveConstructor_NonEmptyArray_TakesStorage)
+{
+	DEFAULT_ARRAY_TYPE array = { 1, 2, 3 };
+
+	const DEFAULT_ELEMENT_TYPE* data = array.GetRawData();
+
+	DEFAULT_ARRAY_TYPE moved(std::move(array));
+
+	EXPECT_EQ(moved.GetRawData(), data);
+	EXPECT_EQ(moved.GetCount(), 3u);
+	EXPECT_TRUE(array.IsEmpty());
+
+	array.PushBack(4);
+
+	EXPECT_EQ(array[0], 4u);
+}
+
+TEST_F(DynamicArrayTest, Assignment_ExistingArrays_ReleasePreviousElements)
+{
+	Size live_count = LiveElement::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE first;
+		LIVE_ARRAY_TYPE second;
+
+		for (Size counter = 0; counter < 10; counter++)
+		{
+			first.PushBack(LiveElement(counter));
+			second.PushBack(LiveElement(counter * 2));
+		}
+
+		first = second;
+
+		EXPECT_EQ(first.GetCount(), 10u);
+		EXPECT_EQ(first[9].value, 18u);
+
+		first = first;
+
+		EXPECT_EQ(first.GetCount(), 10u);
+
+		second = std::move(first);
+
+		EXPECT_EQ(second.GetCount(), 10u);
+		EXPECT_TRUE(first.IsEmpty());
+	}
+
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+}
+
+TEST_F(DynamicArrayTest, CopyAssignment_OtherAllocator_ReleasesThroughOwningAllocator)
+{
+	Allocator<TRACKING_POLICY_TYPE> first_allocator("DynamicArrayTest.CopyFirst");
+	Allocator<TRACKING_POLICY_TYPE> second_allocator("DynamicArrayTest.CopySecond");
+
+	{
+		TRACKING_STRING_ARRAY_TYPE first(&first_allocator);
+		TRACKING_STRING_ARRAY_TYPE second(&second_allocator);
+
+		for (Size counter = 0; counter < 10; counter++)
+		{
+			first.PushBack(std::to_string(counter));
+			second.PushBack(std::to_string(counter * 2));
+		}
+
+		first = second;
+
+		EXPECT_EQ(AllocationTracker::GetStatistics("DynamicArrayTest.CopyFirst").live_bytes, 0);
+		ASSERT_EQ(first.GetCount(), 10u);
+		EXPECT_EQ(first[9], "18");
+	}
+
+	EXPECT_EQ(AllocationTracker::GetStatistics("DynamicArrayTest.CopyFirst").live_bytes, 0);
+	EXPECT_EQ(AllocationTracker::GetStatistics("DynamicArrayTest.CopySecond").live_bytes, 0);
+}
+
+// -------------------------
+// Allocator Policy.
+// -------------------------
+TEST_F(DynamicArrayTest, Destructor_PolicyArray_ReleasesEverything)
+{
+	Allocator<TRACKING_POLICY_TYPE> allocator("DynamicArrayTest.Policy");
+
+	Size live_count = LiveElement::GetLiveCount();
+
+	{
+		TRACKING_ARRAY_TYPE array(&allocator);
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			array.PushBack(LiveElement(counter));
+
+		array.Remove(0);
+		array.PopFront();
+		array.PopBack();
+
+		EXPECT_EQ(array.GetCount(), DEFAULT_COUNT - 3);
+		EXPECT_EQ(array[0].value, 2u);
+	}
+
+	EXPECT_EQ(LiveElement::GetLiveCount(), live_count);
+	EXPECT_EQ(AllocationTracker::GetStatistics("DynamicArrayTest.Policy").live_bytes, 0);
+}
+
+#endif
\ No newline at end of file
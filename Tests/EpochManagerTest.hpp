@@ -0,0 +1,177 @@
+#ifndef EPOCH_MANAGER_TESTS_HPP
+#define EPOCH_MANAGER_TESTS_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Reclaim/EpochManager.hpp>
+
+using namespace Forge;
+
+class EpochManagerTest : public testing::Test
+{
+public:
+	struct Tracked
+	{
+		std::atomic<Size>* released;
+
+		~Tracked()
+		{
+			released->fetch_add(1);
+		}
+	};
+
+public:
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<HeapAllocationPolicy>;
+
+public:
+	static constexpr Size DEFAULT_THREAD_COUNT = 4;
+	static constexpr Size DEFAULT_COUNT_PER_THREAD = 5000;
+
+protected:
+	DEFAULT_ALLOCATOR_TYPE fixture_allocator;
+	std::atomic<Size> fixture_released{ 0 };
+
+protected:
+	/**
+	 * @brief Allocates a tracked object from the fixture allocator and retires it immediately.
+	 */
+	Void RetireTracked(Reclaim::EpochManager& manager)
+	{
+		Tracked* object = new (fixture_allocator.Allocate(sizeof(Tracked), alignof(Tracked))) Tracked{ &fixture_released };
+
+		manager.Retire(object, &fixture_allocator);
+	}
+
+	/**
+	 * @brief Collects until the calling thread has nothing left pending, or gives up.
+	 */
+	Void CollectAll(Reclaim::EpochManager& manager)
+	{
+		for (Size attempt = 0; attempt < 16 && manager.GetPendingCount() > 0; attempt++)
+			manager.Collect(~Size(0));
+	}
+};
+
+constexpr Size EpochManagerTest::DEFAULT_THREAD_COUNT;
+constexpr Size EpochManagerTest::DEFAULT_COUNT_PER_THREAD;
+
+// -------------------------
+// Guard Class.
+// -------------------------
+TEST_F(EpochManagerTest, Guard_PinnedReader_DefersReleaseUntilUnpinned)
+{
+	Reclaim::EpochManager manager;
+
+	std::atomic<Bool> pinned(false);
+	std::atomic<Bool> retired(false);
+
+	std::thread reader([&]()
+	{
+		Reclaim::Guard guard(manager);
+
+		pinned.store(true);
+
+		while (!retired.load())
+			std::this_thread::yield();
+	});
+
+	while (!pinned.load())
+		std::this_thread::yield();
+
+	for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+		RetireTracked(manager);
+
+	CollectAll(manager);
+
+	EXPECT_EQ(fixture_released.load(), 0u);
+	EXPECT_LE(manager.GetEpoch(), 1u);
+
+	retired.store(true);
+	reader.join();
+
+	CollectAll(manager);
+
+	EXPECT_EQ(fixture_released.load(), DEFAULT_COUNT_PER_THREAD);
+	EXPECT_EQ(manager.GetPendingCount(), 0u);
+}
+TEST_F(EpochManagerTest, Guard_Nested_StaysPinnedUntilOutermost)
+{
+	Reclaim::EpochManager manager;
+
+	{
+		Reclaim::Guard outer(manager);
+
+		{
+			Reclaim::Guard inner = manager.Pin();
+
+			RetireTracked(manager);
+		}
+
+		CollectAll(manager);
+
+		EXPECT_EQ(fixture_released.load(), 0u);
+	}
+
+	CollectAll(manager);
+
+	EXPECT_EQ(fixture_released.load(), 1u);
+}
+
+// -------------------------
+// Retire Function.
+// -------------------------
+TEST_F(EpochManagerTest, Retire_Unpinned_ReleasesInBoundedBatches)
+{
+	Reclaim::EpochManager manager;
+
+	Size pending = 0;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+	{
+		Size released = fixture_released.load();
+
+		RetireTracked(manager);
+
+		EXPECT_LE(fixture_released.load() - released, Reclaim::EpochManager::RECLAIM_BATCH);
+
+		pending = manager.GetPendingCount();
+	}
+
+	// Retirement keeps up with itself, so the backlog stays within a few collection intervals.
+	EXPECT_LT(pending, 4 * Reclaim::EpochManager::COLLECT_INTERVAL);
+	EXPECT_EQ(manager.Collect(8), pending < 8 ? pending : 8u);
+}
+TEST_F(EpochManagerTest, Retire_ConcurrentThreads_ReleasesEverythingOnDestruction)
+{
+	{
+		Reclaim::EpochManager manager;
+
+		std::vector<std::thread> threads;
+
+		for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+		{
+			threads.emplace_back([this, &manager]()
+			{
+				for (Size counter = 0; counter < DEFAULT_COUNT_PER_THREAD; counter++)
+				{
+					Reclaim::Guard guard(manager);
+
+					RetireTracked(manager);
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		EXPECT_LE(fixture_released.load(), DEFAULT_THREAD_COUNT * DEFAULT_COUNT_PER_THREAD);
+	}
+
+	EXPECT_EQ(fixture_released.load(), DEFAULT_THREAD_COUNT * DEFAULT_COUNT_PER_THREAD);
+}
+
+#endif
\ No newline at end of file
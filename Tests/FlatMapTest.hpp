@@ -0,0 +1,145 @@
+#ifndef FLAT_MAP_TESTS_HPP
+#define FLAT_MAP_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <Collections/FlatMap.hpp>
+#include <Collections/FlatSet.hpp>
+
+using namespace Forge;
+
+class FlatMapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = I32;
+	using DEFAULT_VALUE_TYPE = I32;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 5;
+
+public:
+	DEFAULT_KEY_TYPE DEFAULT_KEYS[DEFAULT_COUNT] = { 40, 10, 50, 20, 30 };
+	DEFAULT_VALUE_TYPE DEFAULT_VALUES[DEFAULT_COUNT] = { 4, 1, 5, 2, 3 };
+
+protected:
+	FlatMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE> fixture_empty_map;
+	FlatMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE> fixture_nonempty_map;
+
+protected:
+	Void SetUp() override
+	{
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			fixture_nonempty_map.Insert(DEFAULT_KEYS[counter], DEFAULT_VALUES[counter]);
+	}
+};
+
+constexpr Size FlatMapTest::DEFAULT_COUNT;
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(FlatMapTest, Insert_UnsortedKeys_KeepsKeysSorted)
+{
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		EXPECT_EQ(fixture_nonempty_map.GetKeys()[counter], DEFAULT_KEY_TYPE((counter + 1) * 10));
+		EXPECT_EQ(fixture_nonempty_map.GetValues()[counter], DEFAULT_VALUE_TYPE(counter + 1));
+	}
+}
+TEST_F(FlatMapTest, Insert_ContainedKey_KeepsExistingValue)
+{
+	EXPECT_FALSE(fixture_nonempty_map.Insert(20, 99));
+
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(fixture_nonempty_map.Get(20), 2);
+}
+
+// -------------------------
+// Get Functions.
+// -------------------------
+TEST_F(FlatMapTest, Get_MissingKey_ThrowsOutOfRangeException)
+{
+	EXPECT_THROW(fixture_empty_map.Get(10), std::out_of_range);
+	EXPECT_THROW(fixture_nonempty_map.Get(35), std::out_of_range);
+	EXPECT_EQ(fixture_nonempty_map.TryGet(5), nullptr);
+	EXPECT_EQ(fixture_nonempty_map.TryGet(55), nullptr);
+}
+TEST_F(FlatMapTest, Get_ContainedKey_ReturnsValue)
+{
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		EXPECT_TRUE(fixture_nonempty_map.Contains(DEFAULT_KEYS[counter]));
+		EXPECT_EQ(fixture_nonempty_map.Get(DEFAULT_KEYS[counter]), DEFAULT_VALUES[counter]);
+	}
+}
+
+// -------------------------
+// InsertAll Function.
+// -------------------------
+TEST_F(FlatMapTest, InsertAll_OverlappingBatch_MergesAndKeepsExistingValues)
+{
+	DEFAULT_KEY_TYPE keys[] = { 35, 10, 5, 35, 60 };
+	DEFAULT_VALUE_TYPE values[] = { 7, 99, 6, 98, 8 };
+
+	fixture_nonempty_map.InsertAll(keys, values, 5);
+
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT + 3);
+
+	for (Size counter = 1; counter < fixture_nonempty_map.GetCount(); counter++)
+		EXPECT_LT(fixture_nonempty_map.GetKeys()[counter - 1], fixture_nonempty_map.GetKeys()[counter]);
+
+	EXPECT_EQ(fixture_nonempty_map.Get(10), 1);
+	EXPECT_EQ(fixture_nonempty_map.Get(35), 7);
+	EXPECT_EQ(fixture_nonempty_map.Get(5), 6);
+	EXPECT_EQ(fixture_nonempty_map.Get(60), 8);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(FlatMapTest, Remove_ContainedKey_KeepsOtherEntries)
+{
+	EXPECT_TRUE(fixture_nonempty_map.Remove(30));
+	EXPECT_FALSE(fixture_nonempty_map.Remove(30));
+
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT - 1);
+	EXPECT_FALSE(fixture_nonempty_map.Contains(30));
+	EXPECT_EQ(fixture_nonempty_map.Get(40), 4);
+}
+
+// -------------------------
+// Flat Set.
+// -------------------------
+TEST_F(FlatMapTest, FlatSet_InsertAll_SortsAndDeduplicates)
+{
+	FlatSet<DEFAULT_KEY_TYPE> test_set = { 30, 10, 20 };
+
+	DEFAULT_KEY_TYPE keys[] = { 25, 10, 5, 25, 40 };
+
+	test_set.InsertAll(keys, 5);
+
+	DEFAULT_KEY_TYPE expected[] = { 5, 10, 20, 25, 30, 40 };
+
+	ASSERT_EQ(test_set.GetCount(), 6);
+
+	for (Size counter = 0; counter < test_set.GetCount(); counter++)
+		EXPECT_EQ(test_set[counter], expected[counter]);
+}
+TEST_F(FlatMapTest, FlatSet_InsertRemove_UpdatesMembership)
+{
+	FlatSet<DEFAULT_KEY_TYPE> test_set;
+
+	EXPECT_TRUE(test_set.Insert(3));
+	EXPECT_TRUE(test_set.Insert(1));
+	EXPECT_FALSE(test_set.Insert(3));
+	EXPECT_TRUE(test_set.Contains(1));
+	EXPECT_EQ(test_set.LowerBound(2), 1);
+
+	EXPECT_TRUE(test_set.Remove(1));
+	EXPECT_FALSE(test_set.Contains(1));
+	EXPECT_EQ(test_set.GetCount(), 1);
+}
+
+#endif
\ No newline at end of file
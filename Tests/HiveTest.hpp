@@ -0,0 +1,327 @@
+#ifndef HIVE_TESTS_HPP
+#define HIVE_TESTS_HPP
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Collections/Hive.hpp>
+#include <Policies/TrackingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class HiveTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_HIVE_TYPE = Hive<DEFAULT_ELEMENT_TYPE>;
+	using DEFAULT_ITERATOR_TYPE = DEFAULT_HIVE_TYPE::Iterator;
+
+	using TRACKING_POLICY_TYPE = TrackingAllocationPolicy<HeapAllocationPolicy>;
+	using TRACKING_HIVE_TYPE = Hive<DEFAULT_ELEMENT_TYPE, TRACKING_POLICY_TYPE>;
+
+public:
+	static constexpr Size MINIMUM_BLOCK_CAPACITY = DEFAULT_HIVE_TYPE::MINIMUM_BLOCK_CAPACITY;
+	static constexpr Size DEFAULT_OPERATION_COUNT = 20000;
+
+protected:
+	static std::vector<DEFAULT_ELEMENT_TYPE> CollectForward(DEFAULT_HIVE_TYPE& hive)
+	{
+		std::vector<DEFAULT_ELEMENT_TYPE> elements;
+
+		DEFAULT_ITERATOR_TYPE it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetBeginIterator());
+
+		for (; it != hive.GetFinalIterator(); ++it)
+			elements.push_back(*it);
+
+		return elements;
+	}
+
+	static std::vector<DEFAULT_ELEMENT_TYPE> CollectBackward(DEFAULT_HIVE_TYPE& hive)
+	{
+		std::vector<DEFAULT_ELEMENT_TYPE> elements;
+
+		DEFAULT_ITERATOR_TYPE it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetFinalIterator());
+
+		for (Size counter = 0; counter < hive.GetCount(); counter++)
+			elements.insert(elements.begin(), *--it);
+
+		return elements;
+	}
+};
+
+constexpr Size HiveTest::MINIMUM_BLOCK_CAPACITY;
+constexpr Size HiveTest::DEFAULT_OPERATION_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(HiveTest, DefaultConstructor_NewHive_HasNoBlocks)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	EXPECT_TRUE(hive.IsEmpty());
+	EXPECT_EQ(hive.GetBlockCount(), 0u);
+	EXPECT_EQ(hive.GetCapacity(), 0u);
+	EXPECT_TRUE(hive.GetBeginIterator() == hive.GetFinalIterator());
+}
+
+// -------------------------
+// Iterator.
+// -------------------------
+TEST_F(HiveTest, IteratorDecrement_FinalIteratorOfEmptyHive_StaysFinal)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	DEFAULT_ITERATOR_TYPE it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetFinalIterator());
+
+	--it;
+
+	EXPECT_TRUE(it == hive.GetFinalIterator());
+
+	// A hive whose last block was released is empty again.
+	DEFAULT_ELEMENT_TYPE* element = &hive.Insert(1);
+
+	hive.Remove(element);
+
+	it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetFinalIterator());
+
+	it--;
+
+	EXPECT_TRUE(it == hive.GetFinalIterator());
+}
+
+TEST_F(HiveTest, IteratorDecrement_FinalIterator_SkipsTrailingRuns)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	std::vector<DEFAULT_ELEMENT_TYPE*> elements;
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY + 2; value++)
+		elements.push_back(&hive.Insert(value));
+
+	// Empty the second block except its first slot, and open a run at the end of the first.
+	hive.Remove(elements[MINIMUM_BLOCK_CAPACITY + 1]);
+	hive.Remove(elements[MINIMUM_BLOCK_CAPACITY - 1]);
+	hive.Remove(elements[MINIMUM_BLOCK_CAPACITY - 2]);
+
+	DEFAULT_ITERATOR_TYPE it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetFinalIterator());
+
+	EXPECT_EQ(*--it, MINIMUM_BLOCK_CAPACITY);
+	EXPECT_EQ(*--it, MINIMUM_BLOCK_CAPACITY - 3);
+
+	hive.Remove(elements[MINIMUM_BLOCK_CAPACITY]);
+
+	EXPECT_EQ(hive.GetBlockCount(), 1u);
+
+	it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetFinalIterator());
+
+	EXPECT_EQ(*--it, MINIMUM_BLOCK_CAPACITY - 3);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(HiveTest, Remove_AdjacentSlots_MergesRunsInTheSkipField)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	std::vector<DEFAULT_ELEMENT_TYPE*> elements;
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY; value++)
+		elements.push_back(&hive.Insert(value));
+
+	// Two single runs, joined into one by removing the slot between them.
+	hive.Remove(elements[2]);
+	hive.Remove(elements[4]);
+	hive.Remove(elements[3]);
+
+	// Runs growing to the left and to the right of an existing run.
+	hive.Remove(elements[6]);
+	hive.Remove(elements[7]);
+	hive.Remove(elements[0]);
+
+	EXPECT_EQ(CollectForward(hive), (std::vector<DEFAULT_ELEMENT_TYPE>{ 1, 5 }));
+	EXPECT_EQ(CollectBackward(hive), (std::vector<DEFAULT_ELEMENT_TYPE>{ 1, 5 }));
+
+	EXPECT_EQ(*dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetBeginIterator()), 1u);
+	EXPECT_THROW(hive.Remove(elements[3]), std::invalid_argument);
+}
+
+TEST_F(HiveTest, Insert_AfterRemovals_ReusesFreeRunsBeforeGrowing)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	std::vector<DEFAULT_ELEMENT_TYPE*> elements;
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY; value++)
+		elements.push_back(&hive.Insert(value));
+
+	hive.Remove(elements[2]);
+	hive.Remove(elements[4]);
+	hive.Remove(elements[3]);
+	hive.Remove(elements[6]);
+
+	Size capacity = hive.GetCapacity();
+
+	// The merged run [2, 5) is taken slot by slot from its start, then the run at 6 is reused.
+	EXPECT_EQ(&hive.Insert(12), elements[6]);
+	EXPECT_EQ(&hive.Insert(10), elements[2]);
+	EXPECT_EQ(&hive.Insert(11), elements[3]);
+	EXPECT_EQ(&hive.Insert(14), elements[4]);
+
+	EXPECT_EQ(hive.GetCapacity(), capacity);
+	EXPECT_EQ(hive.GetBlockCount(), 1u);
+	EXPECT_EQ(hive.GetCount(), MINIMUM_BLOCK_CAPACITY);
+
+	EXPECT_EQ(CollectForward(hive), (std::vector<DEFAULT_ELEMENT_TYPE>{ 0, 1, 10, 11, 14, 5, 12, 7 }));
+
+	hive.Insert(8);
+
+	EXPECT_EQ(hive.GetBlockCount(), 2u);
+}
+
+TEST_F(HiveTest, Remove_LastElementOfBlock_ReleasesTheBlock)
+{
+	Allocator<TRACKING_POLICY_TYPE> allocator("HiveTest.Release");
+
+	{
+		TRACKING_HIVE_TYPE hive(&allocator);
+
+		std::vector<DEFAULT_ELEMENT_TYPE*> elements;
+
+		for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY * 3; value++)
+			elements.push_back(&hive.Insert(value));
+
+		ASSERT_EQ(hive.GetBlockCount(), 2u);
+
+		// The first block sits on the free list with a run before it is released.
+		for (Size index = 0; index < MINIMUM_BLOCK_CAPACITY; index++)
+			hive.Remove(elements[index]);
+
+		EXPECT_EQ(hive.GetBlockCount(), 1u);
+		EXPECT_EQ(hive.GetCapacity(), MINIMUM_BLOCK_CAPACITY * 2);
+
+		// The remaining elements have not moved.
+		for (Size index = MINIMUM_BLOCK_CAPACITY; index < elements.size(); index++)
+			EXPECT_EQ(*elements[index], DEFAULT_ELEMENT_TYPE(index));
+
+		// The released block is gone from the free list, so this appends a new block.
+		hive.Insert(100);
+
+		EXPECT_EQ(hive.GetBlockCount(), 2u);
+
+		hive.Clear();
+
+		EXPECT_EQ(hive.GetBlockCount(), 0u);
+		EXPECT_EQ(AllocationTracker::GetStatistics("HiveTest.Release").live_bytes, 0);
+
+		hive.Insert(1);
+	}
+
+	EXPECT_EQ(AllocationTracker::GetStatistics("HiveTest.Release").live_bytes, 0);
+}
+
+TEST_F(HiveTest, RemoveIterator_WhileIterating_AdvancesToNextElement)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY * 3; value++)
+		hive.Insert(value);
+
+	DEFAULT_ITERATOR_TYPE it = dynamic_cast<DEFAULT_ITERATOR_TYPE&>(hive.GetBeginIterator());
+
+	while (it != hive.GetFinalIterator())
+	{
+		if (*it % 2 == 0)
+			hive.Remove(it);
+		else
+			++it;
+	}
+
+	EXPECT_EQ(hive.GetCount(), MINIMUM_BLOCK_CAPACITY * 3 / 2);
+
+	for (DEFAULT_ELEMENT_TYPE value : CollectForward(hive))
+		EXPECT_EQ(value % 2, 1u);
+
+	EXPECT_THROW(hive.Remove(it), std::out_of_range);
+}
+
+TEST_F(HiveTest, Operations_RandomSequence_KeepAddressesAndMatchReference)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	std::map<DEFAULT_ELEMENT_TYPE, DEFAULT_ELEMENT_TYPE*> reference;
+	std::mt19937 generator(42);
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < DEFAULT_OPERATION_COUNT; value++)
+	{
+		if (!reference.empty() && generator() % 5 < 2)
+		{
+			auto iterator = reference.lower_bound(DEFAULT_ELEMENT_TYPE(generator() % value));
+
+			if (iterator == reference.end())
+				iterator = reference.begin();
+
+			hive.Remove(iterator->second);
+			reference.erase(iterator);
+		}
+
+		reference[value] = &hive.Insert(value);
+	}
+
+	ASSERT_EQ(hive.GetCount(), reference.size());
+
+	for (const auto& entry : reference)
+		EXPECT_EQ(*entry.second, entry.first);
+
+	std::vector<DEFAULT_ELEMENT_TYPE> forward = CollectForward(hive);
+	std::vector<DEFAULT_ELEMENT_TYPE> backward = CollectBackward(hive);
+
+	EXPECT_EQ(forward, backward);
+	ASSERT_EQ(forward.size(), reference.size());
+
+	std::sort(forward.begin(), forward.end());
+
+	Size index = 0;
+
+	for (const auto& entry : reference)
+		EXPECT_EQ(forward[index++], entry.first);
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(HiveTest, CopyAndMove_HiveWithRuns_KeepElements)
+{
+	DEFAULT_HIVE_TYPE hive;
+
+	std::vector<DEFAULT_ELEMENT_TYPE*> elements;
+
+	for (DEFAULT_ELEMENT_TYPE value = 0; value < MINIMUM_BLOCK_CAPACITY * 3; value++)
+		elements.push_back(&hive.Insert(value));
+
+	for (Size index = 0; index < elements.size(); index += 3)
+		hive.Remove(elements[index]);
+
+	DEFAULT_HIVE_TYPE copy(hive);
+
+	EXPECT_EQ(copy.GetCount(), hive.GetCount());
+	EXPECT_EQ(CollectForward(copy), CollectForward(hive));
+
+	DEFAULT_HIVE_TYPE moved(std::move(copy));
+
+	EXPECT_TRUE(copy.IsEmpty());
+	EXPECT_EQ(copy.GetBlockCount(), 0u);
+	EXPECT_EQ(CollectForward(moved), CollectForward(hive));
+
+	copy.Insert(1);
+
+	EXPECT_EQ(CollectForward(copy), (std::vector<DEFAULT_ELEMENT_TYPE>{ 1 }));
+}
+
+#endif
\ No newline at end of file
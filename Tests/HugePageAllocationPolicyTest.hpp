@@ -0,0 +1,221 @@
+#ifndef HUGE_PAGE_ALLOCATION_POLICY_TESTS_HPP
+#define HUGE_PAGE_ALLOCATION_POLICY_TESTS_HPP
+
+#if defined(__linux__)
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/HugePageAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class HugePageAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<HugePageAllocationPolicy>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, HugePageAllocationPolicy>;
+
+public:
+	static constexpr Size HUGE_PAGE_SIZE = HugePageAllocationPolicy::HUGE_PAGE_SIZE;
+	static constexpr Size HEADER_SIZE = HugePageAllocationPolicy::HEADER_SIZE;
+	static constexpr Size DEFAULT_THRESHOLD = 1024 * 1024;
+
+protected:
+	static Void Fill(VoidPtr pointer, Size size)
+	{
+		BytePtr bytes = static_cast<BytePtr>(pointer);
+
+		for (Size index = 0; index < size; index += 4096)
+			bytes[index] = Byte(index / 4096 + 1);
+
+		bytes[size - 1] = 0xAB;
+	}
+
+	static Void ExpectFilled(VoidPtr pointer, Size size)
+	{
+		BytePtr bytes = static_cast<BytePtr>(pointer);
+
+		for (Size index = 0; index + 1 < size; index += 4096)
+			ASSERT_EQ(bytes[index], Byte(index / 4096 + 1)) << "at offset " << index;
+
+		EXPECT_EQ(bytes[size - 1], 0xAB);
+	}
+
+	// A mapped block starts one header before the returned pointer.
+	static Bool IsHugePageAligned(VoidPtr pointer)
+	{
+		return (reinterpret_cast<uintptr_t>(pointer) - HEADER_SIZE) % HUGE_PAGE_SIZE == 0;
+	}
+
+	static Size GetMappedSize(Size size)
+	{
+		return (HEADER_SIZE + size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+	}
+};
+
+constexpr Size HugePageAllocationPolicyTest::HUGE_PAGE_SIZE;
+constexpr Size HugePageAllocationPolicyTest::HEADER_SIZE;
+constexpr Size HugePageAllocationPolicyTest::DEFAULT_THRESHOLD;
+
+// -------------------------
+// Allocate Function.
+// -------------------------
+TEST_F(HugePageAllocationPolicyTest, Allocate_AroundThreshold_SwitchesFromHeapToMapping)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	VoidPtr small = allocator.Allocate(DEFAULT_THRESHOLD - 1, 8);
+	VoidPtr large = allocator.Allocate(DEFAULT_THRESHOLD, 8);
+
+	EXPECT_FALSE(allocator.IsMapped(small));
+	EXPECT_TRUE(allocator.IsMapped(large));
+	EXPECT_TRUE(IsHugePageAligned(large));
+
+	Fill(small, DEFAULT_THRESHOLD - 1);
+	Fill(large, DEFAULT_THRESHOLD);
+
+	allocator.Deallocate(small);
+	allocator.Deallocate(large);
+	allocator.Deallocate(nullptr);
+}
+
+TEST_F(HugePageAllocationPolicyTest, Allocate_OverAlignedHeapBlock_HonoursAlignment)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	VoidPtr block = allocator.Allocate(100, HEADER_SIZE);
+
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % HEADER_SIZE, 0u);
+
+	Fill(block, 100);
+
+	block = allocator.Reallocate(block, 5000, HEADER_SIZE);
+
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % HEADER_SIZE, 0u);
+	EXPECT_EQ(static_cast<BytePtr>(block)[0], 1u);
+	EXPECT_EQ(static_cast<BytePtr>(block)[99], 0xAB);
+
+	allocator.Deallocate(block);
+
+	EXPECT_THROW(allocator.Allocate(100, HEADER_SIZE * 2), std::invalid_argument);
+}
+
+// -------------------------
+// Reallocate Function.
+// -------------------------
+TEST_F(HugePageAllocationPolicyTest, Reallocate_HeapBlockPastThreshold_MovesToMapping)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	VoidPtr block = allocator.Allocate(DEFAULT_THRESHOLD / 2, 8);
+
+	Fill(block, DEFAULT_THRESHOLD / 2);
+
+	block = allocator.Reallocate(block, DEFAULT_THRESHOLD * 3, 8);
+
+	EXPECT_TRUE(allocator.IsMapped(block));
+	EXPECT_TRUE(IsHugePageAligned(block));
+
+	ExpectFilled(block, DEFAULT_THRESHOLD / 2);
+
+	// Shrinking below the threshold keeps the block mapped.
+	block = allocator.Reallocate(block, DEFAULT_THRESHOLD / 4, 8);
+
+	EXPECT_TRUE(allocator.IsMapped(block));
+	EXPECT_EQ(static_cast<BytePtr>(block)[0], 1u);
+
+	allocator.Deallocate(block);
+}
+
+TEST_F(HugePageAllocationPolicyTest, Reallocate_MappingBlockedInPlace_MovesOntoHugePageBoundary)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	for (Size counter = 0; counter < 8; counter++)
+	{
+		Size size = HUGE_PAGE_SIZE * 2;
+
+		VoidPtr block = allocator.Allocate(size, 8);
+
+		Fill(block, size);
+
+		// A mapping right behind the block stops mremap from growing it in place.
+		BytePtr end = static_cast<BytePtr>(block) - HEADER_SIZE + GetMappedSize(size);
+		VoidPtr blocker = mmap(end, getpagesize(), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+		ASSERT_EQ(blocker, static_cast<VoidPtr>(end));
+
+		VoidPtr grown = allocator.Reallocate(block, size * 2, 8);
+
+		EXPECT_NE(grown, block);
+		EXPECT_TRUE(allocator.IsMapped(grown));
+		EXPECT_TRUE(IsHugePageAligned(grown));
+
+		ExpectFilled(grown, size);
+		Fill(grown, size * 2);
+
+		munmap(blocker, getpagesize());
+
+		allocator.Deallocate(grown);
+	}
+}
+
+TEST_F(HugePageAllocationPolicyTest, Reallocate_SplitMapping_FallsBackToCopy)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	Size size = HUGE_PAGE_SIZE * 2;
+
+	VoidPtr block = allocator.Allocate(size, 8);
+
+	Fill(block, size);
+
+	// Changing the protection of the last page splits the mapping, which mremap refuses to move.
+	BytePtr last_page = static_cast<BytePtr>(block) - HEADER_SIZE + GetMappedSize(size) - getpagesize();
+
+	ASSERT_EQ(mprotect(last_page, getpagesize(), PROT_READ), 0);
+
+	VoidPtr grown = allocator.Reallocate(block, size * 2, 8);
+
+	EXPECT_NE(grown, block);
+	EXPECT_TRUE(allocator.IsMapped(grown));
+	EXPECT_TRUE(IsHugePageAligned(grown));
+
+	ExpectFilled(grown, size);
+	Fill(grown, size * 2);
+
+	allocator.Deallocate(grown);
+}
+
+// -------------------------
+// Allocator Policy.
+// -------------------------
+TEST_F(HugePageAllocationPolicyTest, PushBack_GrowingArray_CrossesThresholdAndKeepsElements)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(DEFAULT_THRESHOLD);
+
+	DEFAULT_ARRAY_TYPE array(&allocator);
+
+	const Size count = DEFAULT_THRESHOLD / sizeof(DEFAULT_ELEMENT_TYPE) * 4;
+
+	for (Size counter = 0; counter < count; counter++)
+		array.PushBack(DEFAULT_ELEMENT_TYPE(counter * 3));
+
+	EXPECT_TRUE(allocator.IsMapped(const_cast<DEFAULT_ELEMENT_TYPE*>(array.GetRawData())));
+
+	for (Size counter = 0; counter < count; counter++)
+		ASSERT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter * 3));
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+#ifndef INDEXED_PRIORITY_QUEUE_TESTS_HPP
+#define INDEXED_PRIORITY_QUEUE_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <Collections/IndexedPriorityQueue.hpp>
+#include <Policies/TrackingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class IndexedPriorityQueueTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = U32;
+	using DEFAULT_PRIORITY_TYPE = I32;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 5;
+	static constexpr Size DEFAULT_KEY_COUNT = 10;
+	static constexpr Size DEFAULT_GROWTH_COUNT = 4096;
+
+public:
+	DEFAULT_KEY_TYPE DEFAULT_KEYS[DEFAULT_COUNT] = { 7, 2, 9, 4, 0 };
+	DEFAULT_PRIORITY_TYPE DEFAULT_PRIORITIES[DEFAULT_COUNT] = { 50, 30, 10, 40, 20 };
+
+protected:
+	IndexedPriorityQueue<DEFAULT_KEY_TYPE, DEFAULT_PRIORITY_TYPE> fixture_empty_queue;
+	IndexedPriorityQueue<DEFAULT_KEY_TYPE, DEFAULT_PRIORITY_TYPE> fixture_nonempty_queue;
+
+protected:
+	Void SetUp() override
+	{
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			fixture_nonempty_queue.Push(DEFAULT_KEYS[counter], DEFAULT_PRIORITIES[counter]);
+	}
+};
+
+constexpr Size IndexedPriorityQueueTest::DEFAULT_COUNT;
+constexpr Size IndexedPriorityQueueTest::DEFAULT_KEY_COUNT;
+constexpr Size IndexedPriorityQueueTest::DEFAULT_GROWTH_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, DefaultConstructor_EmptyQueue_HasNoKeys)
+{
+	IndexedPriorityQueue<DEFAULT_KEY_TYPE, DEFAULT_PRIORITY_TYPE> test_queue;
+
+	EXPECT_TRUE(test_queue.IsEmpty());
+	EXPECT_EQ(test_queue.GetCount(), 0);
+
+	for (DEFAULT_KEY_TYPE key = 0; key < DEFAULT_KEY_COUNT; key++)
+		EXPECT_FALSE(test_queue.Contains(key));
+}
+
+// -------------------------
+// Copy Constructor.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, CopyConstructor_NonEmptyQueue_CopiesKeysAndPriorities)
+{
+	IndexedPriorityQueue<DEFAULT_KEY_TYPE, DEFAULT_PRIORITY_TYPE> test_queue = fixture_nonempty_queue;
+
+	EXPECT_EQ(test_queue.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(fixture_nonempty_queue.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(test_queue.GetPriority(DEFAULT_KEYS[counter]), DEFAULT_PRIORITIES[counter]);
+}
+
+// -------------------------
+// Peek and Pop Functions.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, Peek_EmptyQueue_ThrowsLengthErrorException)
+{
+	EXPECT_THROW(fixture_empty_queue.Peek(), std::length_error);
+	EXPECT_THROW(fixture_empty_queue.Pop(), std::length_error);
+}
+TEST_F(IndexedPriorityQueueTest, Pop_NonEmptyQueue_RemovesKeysInPriorityOrder)
+{
+	DEFAULT_KEY_TYPE expected_keys[DEFAULT_COUNT] = { 9, 0, 2, 4, 7 };
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		EXPECT_EQ(fixture_nonempty_queue.Peek(), expected_keys[counter]);
+
+		fixture_nonempty_queue.Pop();
+
+		EXPECT_FALSE(fixture_nonempty_queue.Contains(expected_keys[counter]));
+	}
+
+	EXPECT_TRUE(fixture_nonempty_queue.IsEmpty());
+}
+
+// -------------------------
+// Push Function.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, Push_ContainedKey_ThrowsInvalidArgumentException)
+{
+	EXPECT_THROW(fixture_nonempty_queue.Push(DEFAULT_KEYS[0], 0), std::invalid_argument);
+}
+TEST_F(IndexedPriorityQueueTest, Push_KeyOutsideReservedRange_GrowsPositionIndex)
+{
+	fixture_empty_queue.Push(1000, 5);
+
+	EXPECT_TRUE(fixture_empty_queue.Contains(1000));
+	EXPECT_EQ(fixture_empty_queue.Peek(), 1000);
+	EXPECT_EQ(fixture_empty_queue.PeekPriority(), 5);
+}
+
+TEST_F(IndexedPriorityQueueTest, Push_AscendingKeys_GrowsPositionIndexGeometrically)
+{
+	using TRACKING_POLICY_TYPE = TrackingAllocationPolicy<HeapAllocationPolicy>;
+
+	Allocator<TRACKING_POLICY_TYPE> allocator("IndexedPriorityQueueTest.Growth");
+
+	{
+		IndexedPriorityQueue<DEFAULT_KEY_TYPE, DEFAULT_PRIORITY_TYPE, TRACKING_POLICY_TYPE> queue(&allocator);
+
+		for (Size counter = 0; counter < DEFAULT_GROWTH_COUNT; counter++)
+			queue.Push(DEFAULT_KEY_TYPE(counter), DEFAULT_PRIORITY_TYPE(counter));
+
+		EXPECT_EQ(queue.GetCount(), DEFAULT_GROWTH_COUNT);
+	}
+
+	AllocationStatistics statistics = AllocationTracker::GetStatistics("IndexedPriorityQueueTest.Growth");
+
+	// Growing by one key at a time would reallocate the position index on every push.
+	EXPECT_LT(statistics.allocation_count + statistics.reallocation_count, DEFAULT_GROWTH_COUNT / 16);
+	EXPECT_EQ(statistics.live_bytes, 0);
+}
+
+// -------------------------
+// DecreaseKey Function.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, DecreaseKey_MissingKey_ThrowsOutOfRangeException)
+{
+	EXPECT_THROW(fixture_nonempty_queue.DecreaseKey(1, 0), std::out_of_range);
+}
+TEST_F(IndexedPriorityQueueTest, DecreaseKey_GreaterPriority_ThrowsInvalidArgumentException)
+{
+	EXPECT_THROW(fixture_nonempty_queue.DecreaseKey(DEFAULT_KEYS[0], 100), std::invalid_argument);
+}
+TEST_F(IndexedPriorityQueueTest, DecreaseKey_ContainedKey_MovesKeyToTop)
+{
+	fixture_nonempty_queue.DecreaseKey(7, 5);
+
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), 7);
+	EXPECT_EQ(fixture_nonempty_queue.PeekPriority(), 5);
+	EXPECT_EQ(fixture_nonempty_queue.GetCount(), DEFAULT_COUNT);
+}
+
+// -------------------------
+// Update Function.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, Update_TopKey_MovesKeyDown)
+{
+	fixture_nonempty_queue.Update(9, 45);
+
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), 0);
+	EXPECT_EQ(fixture_nonempty_queue.GetPriority(9), 45);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, Remove_ContainedKey_KeepsRemainingOrder)
+{
+	fixture_nonempty_queue.Remove(0);
+	fixture_nonempty_queue.Remove(9);
+
+	EXPECT_FALSE(fixture_nonempty_queue.Contains(0));
+	EXPECT_FALSE(fixture_nonempty_queue.Contains(9));
+	EXPECT_EQ(fixture_nonempty_queue.GetCount(), DEFAULT_COUNT - 2);
+
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), 2);
+	fixture_nonempty_queue.Pop();
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), 4);
+	fixture_nonempty_queue.Pop();
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), 7);
+}
+
+// -------------------------
+// Clear Function.
+// -------------------------
+TEST_F(IndexedPriorityQueueTest, Clear_NonEmptyQueue_ResetsPositions)
+{
+	fixture_nonempty_queue.Clear();
+
+	EXPECT_TRUE(fixture_nonempty_queue.IsEmpty());
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_FALSE(fixture_nonempty_queue.Contains(DEFAULT_KEYS[counter]));
+
+	fixture_nonempty_queue.Push(DEFAULT_KEYS[0], DEFAULT_PRIORITIES[0]);
+
+	EXPECT_EQ(fixture_nonempty_queue.Peek(), DEFAULT_KEYS[0]);
+}
+
+#endif
\ No newline at end of file
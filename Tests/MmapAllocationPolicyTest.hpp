@@ -0,0 +1,147 @@
+#ifndef MMAP_ALLOCATION_POLICY_TESTS_HPP
+#define MMAP_ALLOCATION_POLICY_TESTS_HPP
+
+#if defined(__linux__)
+
+#include <string>
+#include <cstdio>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/MmapAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class MmapAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<MmapAllocationPolicy>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, MmapAllocationPolicy>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 100000;
+
+protected:
+	std::string fixture_path;
+
+protected:
+	Void SetUp() override
+	{
+		Char path[] = "/tmp/forge-mmap-XXXXXX";
+		I32 file = mkstemp(path);
+
+		ASSERT_GE(file, 0);
+
+		close(file);
+
+		fixture_path = path;
+	}
+
+	Void TearDown() override
+	{
+		std::remove(fixture_path.c_str());
+	}
+
+protected:
+	/**
+	 * @brief Writes DEFAULT_COUNT elements through a growing array backed by the fixture file.
+	 */
+	Void WriteElements()
+	{
+		DEFAULT_ALLOCATOR_TYPE allocator(fixture_path.c_str());
+
+		{
+			DEFAULT_ARRAY_TYPE array(&allocator);
+
+			for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+				array.PushBack(DEFAULT_ELEMENT_TYPE(counter * 3));
+
+			allocator.TruncateOnRelease(array.GetCount() * sizeof(DEFAULT_ELEMENT_TYPE));
+		}
+
+		EXPECT_EQ(allocator.GetFileSize(), DEFAULT_COUNT * sizeof(DEFAULT_ELEMENT_TYPE));
+	}
+};
+
+constexpr Size MmapAllocationPolicyTest::DEFAULT_COUNT;
+
+// -------------------------
+// Reallocate Function.
+// -------------------------
+TEST_F(MmapAllocationPolicyTest, Reallocate_GrowingArray_PersistsElementsToFile)
+{
+	WriteElements();
+
+	DEFAULT_ALLOCATOR_TYPE allocator(fixture_path.c_str(), true);
+	DEFAULT_ARRAY_TYPE array(&allocator);
+
+	Size size = 0;
+	VoidPtr data = allocator.MapFile(size);
+
+	array.Adopt(static_cast<DEFAULT_ELEMENT_TYPE*>(data), size / sizeof(DEFAULT_ELEMENT_TYPE), size / sizeof(DEFAULT_ELEMENT_TYPE));
+
+	ASSERT_EQ(array.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(array.GetRawData(), data);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter * 3));
+}
+
+// -------------------------
+// MapFile Function.
+// -------------------------
+TEST_F(MmapAllocationPolicyTest, MapFile_ReadOnly_WritesStayPrivate)
+{
+	WriteElements();
+
+	{
+		DEFAULT_ALLOCATOR_TYPE allocator(fixture_path.c_str(), true);
+		DEFAULT_ARRAY_TYPE array(&allocator);
+
+		Size size = 0;
+		VoidPtr data = allocator.MapFile(size);
+
+		array.Adopt(static_cast<DEFAULT_ELEMENT_TYPE*>(data), size / sizeof(DEFAULT_ELEMENT_TYPE), size / sizeof(DEFAULT_ELEMENT_TYPE));
+		array[0] = 42;
+
+		allocator.Advise(0, size, MmapAllocationPolicy::ADVICE_SEQUENTIAL);
+
+		EXPECT_EQ(array[0], 42u);
+		EXPECT_THROW(array.Reserve(DEFAULT_COUNT * 2), std::length_error);
+	}
+
+	DEFAULT_ALLOCATOR_TYPE allocator(fixture_path.c_str(), true);
+
+	Size size = 0;
+	const DEFAULT_ELEMENT_TYPE* data = static_cast<const DEFAULT_ELEMENT_TYPE*>(allocator.MapFile(size));
+
+	EXPECT_EQ(data[0], 0u);
+	EXPECT_EQ(data[1], 3u);
+
+	allocator.Deallocate(const_cast<DEFAULT_ELEMENT_TYPE*>(data));
+}
+
+// -------------------------
+// Allocate Function.
+// -------------------------
+TEST_F(MmapAllocationPolicyTest, Allocate_SecondAllocation_ThrowsLogicError)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator;
+
+	VoidPtr data = allocator.Allocate(4096, 8);
+
+	EXPECT_EQ(allocator.GetMappedSize(), 4096u);
+	EXPECT_THROW(allocator.Allocate(4096, 8), std::logic_error);
+
+	allocator.Deallocate(data);
+}
+
+#endif
+
+#endif
\ No newline at end of file
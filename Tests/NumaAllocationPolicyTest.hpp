@@ -0,0 +1,321 @@
+#ifndef NUMA_ALLOCATION_POLICY_TESTS_HPP
+#define NUMA_ALLOCATION_POLICY_TESTS_HPP
+
+#if defined(__linux__)
+
+#include <new>
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Collections/Replicated.hpp>
+#include <Policies/NumaAllocationPolicy.hpp>
+
+using namespace Forge;
+
+/**
+ * An element whose copy throws once a shared budget of copies runs out, to check that a failed
+ * update keeps the previous replicas.
+ */
+struct ThrowingElement
+{
+	U64 value;
+
+	static Size& GetCopyBudget()
+	{
+		static Size budget = ~Size(0);
+
+		return budget;
+	}
+
+	ThrowingElement(U64 in_value = 0)
+		: value(in_value) {}
+
+	ThrowingElement(const ThrowingElement& other)
+		: value(other.value)
+	{
+		if (GetCopyBudget() == 0)
+			throw ::std::runtime_error("The copy budget is exhausted");
+
+		GetCopyBudget()--;
+	}
+
+	ThrowingElement& operator=(const ThrowingElement& other) = default;
+};
+
+class NumaAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<NumaAllocationPolicy>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, NumaAllocationPolicy>;
+
+	using SOURCE_ARRAY_TYPE = DynamicArray<DEFAULT_ELEMENT_TYPE>;
+	using REPLICATED_TYPE = Replicated<SOURCE_ARRAY_TYPE>;
+
+	using THROWING_ARRAY_TYPE = DynamicArray<ThrowingElement>;
+	using THROWING_REPLICATED_TYPE = Replicated<THROWING_ARRAY_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size HEADER_SIZE = NumaAllocationPolicy::HEADER_SIZE;
+
+protected:
+	static Void Fill(VoidPtr pointer, Size size)
+	{
+		BytePtr bytes = static_cast<BytePtr>(pointer);
+
+		for (Size index = 0; index < size; index++)
+			bytes[index] = Byte(index * 7);
+	}
+
+	static Void ExpectFilled(VoidPtr pointer, Size size)
+	{
+		BytePtr bytes = static_cast<BytePtr>(pointer);
+
+		for (Size index = 0; index < size; index++)
+			ASSERT_EQ(bytes[index], Byte(index * 7)) << "at offset " << index;
+	}
+
+	static SOURCE_ARRAY_TYPE MakeSource(Size count, U64 offset)
+	{
+		SOURCE_ARRAY_TYPE source;
+
+		for (Size counter = 0; counter < count; counter++)
+			source.PushBack(DEFAULT_ELEMENT_TYPE(counter + offset));
+
+		return source;
+	}
+};
+
+constexpr Size NumaAllocationPolicyTest::DEFAULT_COUNT;
+constexpr Size NumaAllocationPolicyTest::HEADER_SIZE;
+
+// -------------------------
+// Constructor.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, Constructor_InvalidPlacement_Throws)
+{
+	EXPECT_THROW(DEFAULT_ALLOCATOR_TYPE(U8(3)), std::invalid_argument);
+	EXPECT_THROW(DEFAULT_ALLOCATOR_TYPE(NumaAllocationPolicy::PLACEMENT_BIND, 0), std::invalid_argument);
+
+	// Bit 63 only names a node on machines with 64 of them.
+	if (NumaAllocationPolicy::GetNodeCount() < NumaAllocationPolicy::MAXIMUM_NODE_COUNT)
+	{
+		EXPECT_THROW(DEFAULT_ALLOCATOR_TYPE(NumaAllocationPolicy::PLACEMENT_BIND, U64(1) << 63), std::invalid_argument);
+	}
+
+	DEFAULT_ALLOCATOR_TYPE allocator(NumaAllocationPolicy::PLACEMENT_BIND, 1);
+
+	EXPECT_EQ(allocator.GetPlacement(), NumaAllocationPolicy::PLACEMENT_BIND);
+	EXPECT_EQ(allocator.GetNodeMask(), 1u);
+}
+
+// -------------------------
+// GetNodeCount and GetCurrentNode Functions.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, GetCurrentNode_AnyThread_IsBelowNodeCount)
+{
+	Size node_count = NumaAllocationPolicy::GetNodeCount();
+
+	EXPECT_GE(node_count, 1u);
+	EXPECT_LE(node_count, NumaAllocationPolicy::MAXIMUM_NODE_COUNT);
+	EXPECT_LT(NumaAllocationPolicy::GetCurrentNode(), node_count);
+}
+
+// -------------------------
+// Allocate, Reallocate and Deallocate Functions.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, Reallocate_EveryPlacement_KeepsContents)
+{
+	const U8 placements[] = { NumaAllocationPolicy::PLACEMENT_LOCAL, NumaAllocationPolicy::PLACEMENT_INTERLEAVE, NumaAllocationPolicy::PLACEMENT_BIND };
+
+	for (U8 placement : placements)
+	{
+		DEFAULT_ALLOCATOR_TYPE allocator(placement, 1);
+
+		VoidPtr pointer = allocator.Allocate(100, 8);
+
+		ASSERT_NE(pointer, nullptr);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % HEADER_SIZE, 0u);
+
+		Fill(pointer, 100);
+
+		pointer = allocator.Reallocate(pointer, 1024 * 1024, 8);
+
+		ASSERT_NE(pointer, nullptr);
+		ExpectFilled(pointer, 100);
+
+		Fill(pointer, 1024 * 1024);
+
+		pointer = allocator.Reallocate(pointer, 5000, 8);
+
+		ASSERT_NE(pointer, nullptr);
+		ExpectFilled(pointer, 5000);
+
+		allocator.Deallocate(pointer);
+	}
+}
+
+TEST_F(NumaAllocationPolicyTest, Reallocate_NullPointer_Allocates)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator;
+
+	VoidPtr pointer = allocator.Reallocate(nullptr, 4096, 16);
+
+	ASSERT_NE(pointer, nullptr);
+
+	Fill(pointer, 4096);
+	ExpectFilled(pointer, 4096);
+
+	allocator.Deallocate(pointer);
+	allocator.Deallocate(nullptr);
+}
+
+TEST_F(NumaAllocationPolicyTest, Allocate_AlignmentAboveHeader_Throws)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator;
+
+	EXPECT_THROW(allocator.Allocate(64, HEADER_SIZE * 2), std::invalid_argument);
+
+	VoidPtr pointer = allocator.Allocate(64, HEADER_SIZE);
+
+	EXPECT_THROW(allocator.Reallocate(pointer, 128, HEADER_SIZE * 2), std::invalid_argument);
+
+	allocator.Deallocate(pointer);
+}
+
+// -------------------------
+// Allocator Policy.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, PushBack_PolicyArray_GrowsOnDemand)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator(NumaAllocationPolicy::PLACEMENT_BIND, 1);
+
+	DEFAULT_ARRAY_TYPE array(&allocator);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT * 100; counter++)
+		array.PushBack(DEFAULT_ELEMENT_TYPE(counter));
+
+	ASSERT_EQ(array.GetCount(), DEFAULT_COUNT * 100);
+
+	for (Size counter = 0; counter < array.GetCount(); counter++)
+		ASSERT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter));
+}
+
+// -------------------------
+// Replicated Constructor.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, ReplicatedConstructor_NonEmptySource_CopiesOnEveryNode)
+{
+	SOURCE_ARRAY_TYPE source = MakeSource(DEFAULT_COUNT, 0);
+
+	REPLICATED_TYPE replicated(source);
+
+	ASSERT_EQ(replicated.GetReplicaCount(), NumaAllocationPolicy::GetNodeCount());
+
+	for (Size node = 0; node < replicated.GetReplicaCount(); node++)
+	{
+		const DEFAULT_ARRAY_TYPE& replica = replicated.GetReplica(node);
+
+		ASSERT_EQ(replica.GetCount(), DEFAULT_COUNT);
+		EXPECT_NE(replica.GetRawData(), source.GetRawData());
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			ASSERT_EQ(replica[counter], DEFAULT_ELEMENT_TYPE(counter));
+	}
+
+	EXPECT_THROW(replicated.GetReplica(replicated.GetReplicaCount()), std::out_of_range);
+}
+
+// -------------------------
+// Replicated GetLocal Function.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, GetLocal_AnyThread_ReturnsReplicaOfCurrentNode)
+{
+	SOURCE_ARRAY_TYPE source = MakeSource(DEFAULT_COUNT, 0);
+
+	REPLICATED_TYPE replicated(source);
+
+	const DEFAULT_ARRAY_TYPE& local = replicated.GetLocal();
+
+	ASSERT_EQ(local.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(local[DEFAULT_COUNT - 1], DEFAULT_ELEMENT_TYPE(DEFAULT_COUNT - 1));
+
+	if (NumaAllocationPolicy::GetNodeCount() == 1)
+	{
+		EXPECT_EQ(&local, &replicated.GetReplica(0));
+	}
+}
+
+// -------------------------
+// Replicated Update Function.
+// -------------------------
+TEST_F(NumaAllocationPolicyTest, Update_NewSource_ReplacesEveryReplica)
+{
+	SOURCE_ARRAY_TYPE source = MakeSource(DEFAULT_COUNT, 0);
+
+	REPLICATED_TYPE replicated(source);
+
+	replicated.Update(MakeSource(DEFAULT_COUNT * 2, 5));
+
+	ASSERT_EQ(replicated.GetReplicaCount(), NumaAllocationPolicy::GetNodeCount());
+
+	for (Size node = 0; node < replicated.GetReplicaCount(); node++)
+	{
+		const DEFAULT_ARRAY_TYPE& replica = replicated.GetReplica(node);
+
+		ASSERT_EQ(replica.GetCount(), DEFAULT_COUNT * 2);
+
+		for (Size counter = 0; counter < replica.GetCount(); counter++)
+			ASSERT_EQ(replica[counter], DEFAULT_ELEMENT_TYPE(counter + 5));
+	}
+
+	EXPECT_EQ(replicated.GetLocal()[0], DEFAULT_ELEMENT_TYPE(5));
+
+	replicated.Update(SOURCE_ARRAY_TYPE());
+
+	ASSERT_EQ(replicated.GetReplicaCount(), NumaAllocationPolicy::GetNodeCount());
+	EXPECT_TRUE(replicated.GetLocal().IsEmpty());
+}
+
+TEST_F(NumaAllocationPolicyTest, Update_ThrowingCopy_KeepsPreviousReplicas)
+{
+	THROWING_ARRAY_TYPE source;
+
+	for (Size counter = 0; counter < 10; counter++)
+		source.PushBack(ThrowingElement(counter));
+
+	THROWING_REPLICATED_TYPE replicated(source);
+
+	for (Size counter = 0; counter < 10; counter++)
+		source[counter].value = counter + 100;
+
+	// The copy of the sixth element of the first replica throws.
+	ThrowingElement::GetCopyBudget() = 5;
+
+	EXPECT_THROW(replicated.Update(source), std::runtime_error);
+
+	ThrowingElement::GetCopyBudget() = ~Size(0);
+
+	ASSERT_EQ(replicated.GetReplicaCount(), NumaAllocationPolicy::GetNodeCount());
+
+	for (Size node = 0; node < replicated.GetReplicaCount(); node++)
+	{
+		ASSERT_EQ(replicated.GetReplica(node).GetCount(), 10u);
+
+		for (Size counter = 0; counter < 10; counter++)
+			EXPECT_EQ(replicated.GetReplica(node)[counter].value, counter);
+	}
+
+	replicated.Update(source);
+
+	EXPECT_EQ(replicated.GetLocal()[9].value, 109u);
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,185 @@
+#ifndef PERSISTENT_HASH_MAP_TESTS_HPP
+#define PERSISTENT_HASH_MAP_TESTS_HPP
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/PersistentHashMap.hpp>
+
+using namespace Forge;
+
+class PersistentHashMapTest : public testing::Test
+{
+public:
+	/**
+	 * @brief A hasher that sends every key to one of a few hashes, to fill collision nodes.
+	 */
+	struct CollidingHasher
+	{
+		Size operator()(U64 key) const
+		{
+			return key % 3;
+		}
+	};
+
+	/**
+	 * @brief A value that counts its live instances.
+	 */
+	struct CountedValue
+	{
+		static Size& GetLiveCount()
+		{
+			static Size live_count = 0;
+
+			return live_count;
+		}
+
+		CountedValue()
+		{
+			GetLiveCount()++;
+		}
+
+		CountedValue(const CountedValue&)
+		{
+			GetLiveCount()++;
+		}
+
+		CountedValue& operator=(const CountedValue&) = default;
+
+		~CountedValue()
+		{
+			GetLiveCount()--;
+		}
+	};
+
+public:
+	using DEFAULT_KEY_TYPE = U64;
+	using DEFAULT_VALUE_TYPE = U64;
+
+	using DEFAULT_MAP_TYPE = PersistentHashMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+	using COUNTED_MAP_TYPE = PersistentHashMap<DEFAULT_KEY_TYPE, CountedValue>;
+	using COLLIDING_MAP_TYPE = PersistentHashMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE, HeapAllocationPolicy, CollidingHasher>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 10000;
+	static constexpr Size COLLIDING_COUNT = 30;
+	static constexpr Size VERSION_COUNT = 20;
+};
+
+constexpr Size PersistentHashMapTest::DEFAULT_COUNT;
+constexpr Size PersistentHashMapTest::COLLIDING_COUNT;
+constexpr Size PersistentHashMapTest::VERSION_COUNT;
+
+// -------------------------
+// InsertOrAssign Function.
+// -------------------------
+TEST_F(PersistentHashMapTest, InsertOrAssign_KeepsPreviousVersions)
+{
+	DEFAULT_MAP_TYPE empty;
+	DEFAULT_MAP_TYPE map = empty;
+
+	for (Size key = 0; key < DEFAULT_COUNT; key++)
+		map = map.InsertOrAssign(key, key * 2);
+
+	DEFAULT_MAP_TYPE updated = map.InsertOrAssign(7, 0);
+
+	EXPECT_TRUE(empty.IsEmpty());
+	EXPECT_EQ(map.GetCount(), DEFAULT_COUNT);
+	EXPECT_EQ(updated.GetCount(), DEFAULT_COUNT);
+
+	for (Size key = 0; key < DEFAULT_COUNT; key++)
+		ASSERT_EQ(map.Get(key), key * 2);
+
+	EXPECT_EQ(updated.Get(7), 0u);
+	EXPECT_FALSE(map.Contains(DEFAULT_COUNT));
+	EXPECT_THROW(map.Get(DEFAULT_COUNT), std::out_of_range);
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(PersistentHashMapTest, Remove_CollidingKeys_KeepsRemainingKeys)
+{
+	COLLIDING_MAP_TYPE map;
+
+	for (Size key = 0; key < COLLIDING_COUNT; key++)
+		map = map.InsertOrAssign(key, key);
+
+	COLLIDING_MAP_TYPE removed = map;
+
+	for (Size key = 0; key < COLLIDING_COUNT; key += 2)
+		removed = removed.Remove(key);
+
+	EXPECT_EQ(map.GetCount(), COLLIDING_COUNT);
+	EXPECT_EQ(removed.GetCount(), COLLIDING_COUNT / 2);
+
+	for (Size key = 0; key < COLLIDING_COUNT; key++)
+	{
+		ASSERT_EQ(map.Get(key), key);
+		ASSERT_EQ(removed.Contains(key), key % 2 == 1);
+	}
+
+	EXPECT_EQ(removed.Remove(0).GetCount(), COLLIDING_COUNT / 2);
+}
+
+// -------------------------
+// Store Function.
+// -------------------------
+TEST_F(PersistentHashMapTest, Store_ThenCollect_ReleasesReplacedVersions)
+{
+	Size live_count = CountedValue::GetLiveCount();
+
+	{
+		COUNTED_MAP_TYPE published;
+
+		for (Size version = 0; version < VERSION_COUNT; version++)
+		{
+			COUNTED_MAP_TYPE::Transient next = COUNTED_MAP_TYPE().ToTransient();
+
+			for (Size key = 0; key < DEFAULT_COUNT; key++)
+				next.InsertOrAssign(key, CountedValue());
+
+			published.Store(next.Persistent());
+		}
+
+		Reclaim::EpochManager::GetDefault().Collect();
+
+		EXPECT_EQ(published.GetCount(), DEFAULT_COUNT);
+		EXPECT_EQ(CountedValue::GetLiveCount(), live_count + DEFAULT_COUNT);
+	}
+
+	EXPECT_EQ(CountedValue::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Transient Class.
+// -------------------------
+TEST_F(PersistentHashMapTest, Transient_BulkLoad_DoesNotAffectSource)
+{
+	DEFAULT_MAP_TYPE source = DEFAULT_MAP_TYPE().InsertOrAssign(0, 1);
+	DEFAULT_MAP_TYPE::Transient transient = source.ToTransient();
+
+	for (Size key = 0; key < DEFAULT_COUNT; key++)
+		EXPECT_EQ(transient.InsertOrAssign(key, key), key != 0);
+
+	EXPECT_TRUE(transient.Remove(1));
+	EXPECT_FALSE(transient.Remove(1));
+
+	DEFAULT_MAP_TYPE loaded = transient.Persistent();
+	Size visited = 0;
+
+	loaded.ForEach([&](const DEFAULT_KEY_TYPE& key, const DEFAULT_VALUE_TYPE& value)
+	{
+		EXPECT_EQ(key, value);
+
+		visited++;
+	});
+
+	EXPECT_EQ(visited, DEFAULT_COUNT - 1);
+	EXPECT_EQ(transient.GetCount(), 0u);
+	EXPECT_EQ(source.GetCount(), 1u);
+	EXPECT_EQ(source.Get(0), 1u);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#ifndef PERSISTENT_VECTOR_TESTS_HPP
+#define PERSISTENT_VECTOR_TESTS_HPP
+
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/PersistentVector.hpp>
+
+using namespace Forge;
+
+class PersistentVectorTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_VECTOR_TYPE = PersistentVector<DEFAULT_ELEMENT_TYPE>;
+	using DEFAULT_REFERENCE_TYPE = std::vector<DEFAULT_ELEMENT_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 5000;
+	static constexpr Size DEFAULT_CHUNK_COUNT = 300;
+	static constexpr Size DEFAULT_SEED = 42;
+
+protected:
+	/**
+	 * @brief Creates a vector holding the values from first to first + count - 1.
+	 */
+	static DEFAULT_VECTOR_TYPE CreateRange(DEFAULT_ELEMENT_TYPE first, Size count)
+	{
+		DEFAULT_VECTOR_TYPE::Transient transient = DEFAULT_VECTOR_TYPE().ToTransient();
+
+		for (Size counter = 0; counter < count; counter++)
+			transient.PushBack(first + counter);
+
+		return transient.Persistent();
+	}
+
+	/**
+	 * @brief Checks that a vector holds the same elements as a reference vector.
+	 */
+	static Void ExpectEqual(const DEFAULT_VECTOR_TYPE& vector, const DEFAULT_REFERENCE_TYPE& reference)
+	{
+		ASSERT_EQ(vector.GetCount(), reference.size());
+
+		for (Size index = 0; index < reference.size(); index++)
+			ASSERT_EQ(vector[index], reference[index]);
+	}
+};
+
+constexpr Size PersistentVectorTest::DEFAULT_COUNT;
+constexpr Size PersistentVectorTest::DEFAULT_CHUNK_COUNT;
+constexpr Size PersistentVectorTest::DEFAULT_SEED;
+
+// -------------------------
+// PushBack Function.
+// -------------------------
+TEST_F(PersistentVectorTest, PushBack_KeepsPreviousVersions)
+{
+	DEFAULT_VECTOR_TYPE empty;
+	DEFAULT_VECTOR_TYPE vector = empty;
+	DEFAULT_VECTOR_TYPE half;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		vector = vector.PushBack(counter);
+
+		if (counter == DEFAULT_COUNT / 2 - 1)
+			half = vector;
+	}
+
+	EXPECT_TRUE(empty.IsEmpty());
+	EXPECT_EQ(half.GetCount(), DEFAULT_COUNT / 2);
+	EXPECT_EQ(vector.GetCount(), DEFAULT_COUNT);
+
+	for (Size index = 0; index < DEFAULT_COUNT; index++)
+		ASSERT_EQ(vector[index], index);
+
+	EXPECT_EQ(half[DEFAULT_COUNT / 2 - 1], DEFAULT_COUNT / 2 - 1);
+	EXPECT_THROW(half.Get(DEFAULT_COUNT / 2), std::out_of_range);
+}
+
+// -------------------------
+// Set Function.
+// -------------------------
+TEST_F(PersistentVectorTest, Set_LeavesOriginalUnchanged)
+{
+	DEFAULT_VECTOR_TYPE vector = CreateRange(0, DEFAULT_COUNT);
+	DEFAULT_VECTOR_TYPE updated = vector.Set(DEFAULT_COUNT - 1, 7).Set(0, 9);
+
+	EXPECT_EQ(vector[0], 0u);
+	EXPECT_EQ(vector[DEFAULT_COUNT - 1], DEFAULT_COUNT - 1);
+
+	EXPECT_EQ(updated[0], 9u);
+	EXPECT_EQ(updated[1], 1u);
+	EXPECT_EQ(updated[DEFAULT_COUNT - 1], 7u);
+
+	EXPECT_THROW(vector.Set(DEFAULT_COUNT, 0), std::out_of_range);
+}
+
+// -------------------------
+// Slice Function.
+// -------------------------
+TEST_F(PersistentVectorTest, Slice_ReturnsRange)
+{
+	DEFAULT_VECTOR_TYPE vector = CreateRange(0, DEFAULT_COUNT);
+	DEFAULT_VECTOR_TYPE slice = vector.Slice(100, DEFAULT_COUNT - 100);
+
+	ASSERT_EQ(slice.GetCount(), DEFAULT_COUNT - 200);
+
+	for (Size index = 0; index < slice.GetCount(); index++)
+		ASSERT_EQ(slice[index], index + 100);
+
+	DEFAULT_VECTOR_TYPE extended = slice.PushBack(0);
+
+	EXPECT_EQ(extended[slice.GetCount()], 0u);
+	EXPECT_TRUE(vector.Slice(10, 10).IsEmpty());
+	EXPECT_THROW(vector.Slice(10, DEFAULT_COUNT + 1), std::out_of_range);
+}
+
+// -------------------------
+// Concatenate Function.
+// -------------------------
+TEST_F(PersistentVectorTest, Concatenate_RandomChunks_MatchesReference)
+{
+	std::mt19937_64 random(DEFAULT_SEED);
+
+	DEFAULT_VECTOR_TYPE vector;
+	DEFAULT_REFERENCE_TYPE reference;
+
+	for (Size chunk = 0; chunk < DEFAULT_CHUNK_COUNT; chunk++)
+	{
+		Size count = 1 + random() % 100;
+		DEFAULT_VECTOR_TYPE part = CreateRange(reference.size(), count);
+
+		// Slicing the result from time to time leaves relaxed nodes on both sides of later seams.
+		if (chunk % 7 == 6)
+		{
+			Size first = random() % (reference.size() / 2);
+
+			vector = vector.Slice(first, reference.size());
+			reference.erase(reference.begin(), reference.begin() + first);
+		}
+
+		vector = chunk % 2 ? vector.Concatenate(part) : vector.Concatenate(part).Slice(0, reference.size() + count);
+
+		for (Size counter = 0; counter < count; counter++)
+			reference.push_back(part[counter]);
+	}
+
+	ExpectEqual(vector, reference);
+	ExpectEqual(vector.Concatenate(vector).Slice(reference.size(), 2 * reference.size()), reference);
+}
+
+// -------------------------
+// Transient Class.
+// -------------------------
+TEST_F(PersistentVectorTest, Transient_BatchUpdates_DoNotAffectSource)
+{
+	DEFAULT_VECTOR_TYPE vector = CreateRange(0, DEFAULT_COUNT);
+	DEFAULT_VECTOR_TYPE::Transient transient = vector.ToTransient();
+
+	for (Size index = 0; index < DEFAULT_COUNT; index += 2)
+		transient.Set(index, 0);
+
+	transient.PushBack(DEFAULT_COUNT);
+
+	DEFAULT_VECTOR_TYPE updated = transient.Persistent();
+
+	EXPECT_EQ(transient.GetCount(), 0u);
+	ASSERT_EQ(updated.GetCount(), DEFAULT_COUNT + 1);
+
+	for (Size index = 0; index < DEFAULT_COUNT; index++)
+	{
+		ASSERT_EQ(vector[index], index);
+		ASSERT_EQ(updated[index], index % 2 ? index : 0);
+	}
+
+	EXPECT_EQ(updated[DEFAULT_COUNT], DEFAULT_COUNT);
+}
+
+#endif
\ No newline at end of file
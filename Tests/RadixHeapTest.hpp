@@ -0,0 +1,256 @@
+#ifndef RADIX_HEAP_TESTS_HPP
+#define RADIX_HEAP_TESTS_HPP
+
+#include <algorithm>
+#include <queue>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include <Collections/RadixHeap.hpp>
+
+using namespace Forge;
+
+class RadixHeapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = U32;
+	using DEFAULT_VALUE_TYPE = std::string;
+
+	using DEFAULT_HEAP_TYPE = RadixHeap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+
+	using REFERENCE_ENTRY_TYPE = std::pair<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+	using REFERENCE_HEAP_TYPE = std::priority_queue<REFERENCE_ENTRY_TYPE, std::vector<REFERENCE_ENTRY_TYPE>, std::greater<REFERENCE_ENTRY_TYPE>>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size DEFAULT_OPERATION_COUNT = 20000;
+
+protected:
+	static DEFAULT_VALUE_TYPE MakeValue(Size key)
+	{
+		return DEFAULT_VALUE_TYPE("value-with-a-heap-allocated-buffer-") + std::to_string(key);
+	}
+};
+
+constexpr Size RadixHeapTest::DEFAULT_COUNT;
+constexpr Size RadixHeapTest::DEFAULT_OPERATION_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(RadixHeapTest, DefaultConstructor_NewHeap_IsEmpty)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	EXPECT_TRUE(heap.IsEmpty());
+	EXPECT_EQ(heap.GetLastKey(), 0u);
+	EXPECT_THROW(heap.PeekKey(), std::length_error);
+	EXPECT_THROW(heap.PeekValue(), std::length_error);
+	EXPECT_THROW(heap.Pop(), std::length_error);
+}
+
+// -------------------------
+// Push and Pop Functions.
+// -------------------------
+TEST_F(RadixHeapTest, Pop_ShuffledKeys_ReturnsKeysInAscendingOrder)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	std::vector<DEFAULT_KEY_TYPE> keys;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < DEFAULT_COUNT; key++)
+		keys.push_back(key * 7919);
+
+	std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+	for (DEFAULT_KEY_TYPE key : keys)
+		heap.Push(key, MakeValue(key));
+
+	EXPECT_EQ(heap.GetCount(), DEFAULT_COUNT);
+
+	for (DEFAULT_KEY_TYPE key = 0; key < DEFAULT_COUNT; key++)
+	{
+		ASSERT_EQ(heap.PeekKey(), key * 7919);
+		EXPECT_EQ(heap.PeekValue(), MakeValue(key * 7919));
+		EXPECT_EQ(heap.GetLastKey(), key * 7919);
+
+		heap.Pop();
+	}
+
+	EXPECT_TRUE(heap.IsEmpty());
+}
+
+TEST_F(RadixHeapTest, Push_KeyBelowLastKey_ThrowsInvalidArgument)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	heap.Push(10, MakeValue(10));
+	heap.Push(20, MakeValue(20));
+
+	EXPECT_EQ(heap.PeekKey(), 10u);
+
+	heap.Pop();
+
+	EXPECT_THROW(heap.Push(9, MakeValue(9)), std::invalid_argument);
+
+	// Keys equal to the last retrieved key are still allowed.
+	heap.Push(10, MakeValue(11));
+
+	EXPECT_EQ(heap.PeekValue(), MakeValue(11));
+	EXPECT_EQ(heap.GetCount(), 2u);
+}
+
+TEST_F(RadixHeapTest, Push_ExtremeKeys_UseTheHighestBucket)
+{
+	RadixHeap<U64, U64> heap;
+
+	heap.Push(std::numeric_limits<U64>::max(), 1);
+	heap.Push(0, 2);
+	heap.Push(U64(1) << 63, 3);
+
+	EXPECT_EQ(heap.PeekValue(), 2u);
+	heap.Pop();
+	EXPECT_EQ(heap.PeekValue(), 3u);
+	heap.Pop();
+	EXPECT_EQ(heap.PeekValue(), 1u);
+	heap.Pop();
+
+	EXPECT_TRUE(heap.IsEmpty());
+}
+
+TEST_F(RadixHeapTest, Operations_MonotoneRandomSequence_MatchReference)
+{
+	DEFAULT_HEAP_TYPE heap;
+	REFERENCE_HEAP_TYPE reference;
+
+	std::mt19937 generator(42);
+
+	for (Size counter = 0; counter < DEFAULT_OPERATION_COUNT; counter++)
+	{
+		if (!reference.empty() && generator() % 3 == 0)
+		{
+			ASSERT_EQ(heap.PeekKey(), reference.top().first);
+
+			heap.Pop();
+			reference.pop();
+
+			continue;
+		}
+
+		DEFAULT_KEY_TYPE key = heap.GetLastKey() + DEFAULT_KEY_TYPE(generator() % 100000);
+
+		heap.Push(key, MakeValue(key));
+		reference.emplace(key, MakeValue(key));
+	}
+
+	ASSERT_EQ(heap.GetCount(), reference.size());
+
+	for (; !reference.empty(); reference.pop())
+	{
+		ASSERT_EQ(heap.PeekKey(), reference.top().first);
+		EXPECT_EQ(heap.PeekValue(), reference.top().second);
+
+		heap.Pop();
+	}
+}
+
+// -------------------------
+// Clear Function.
+// -------------------------
+TEST_F(RadixHeapTest, Clear_NonEmptyHeap_ResetsLastKey)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	for (DEFAULT_KEY_TYPE key = 100; key < 200; key++)
+		heap.Push(key, MakeValue(key));
+
+	heap.Pop();
+	heap.Clear();
+
+	EXPECT_TRUE(heap.IsEmpty());
+	EXPECT_EQ(heap.GetLastKey(), 0u);
+
+	heap.Push(1, MakeValue(1));
+
+	EXPECT_EQ(heap.PeekKey(), 1u);
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(RadixHeapTest, CopyConstructor_NonEmptyHeap_IsIndependent)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 100; key++)
+		heap.Push(key * 3, MakeValue(key));
+
+	heap.Pop();
+
+	DEFAULT_HEAP_TYPE copy(heap);
+
+	heap.Clear();
+
+	EXPECT_EQ(copy.GetCount(), 99u);
+	EXPECT_EQ(copy.GetLastKey(), 0u);
+	EXPECT_EQ(copy.PeekKey(), 3u);
+
+	heap = copy;
+
+	EXPECT_EQ(heap.GetCount(), 99u);
+	EXPECT_EQ(heap.PeekValue(), MakeValue(1));
+}
+
+TEST_F(RadixHeapTest, MoveConstructor_NonEmptyHeap_LeavesUsableHeap)
+{
+	DEFAULT_HEAP_TYPE heap;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 100; key++)
+		heap.Push(key, MakeValue(key));
+
+	DEFAULT_HEAP_TYPE moved(std::move(heap));
+
+	EXPECT_EQ(moved.GetCount(), 100u);
+	EXPECT_EQ(moved.PeekKey(), 0u);
+	EXPECT_TRUE(heap.IsEmpty());
+
+	heap.Push(5, MakeValue(5));
+	heap.Push(3, MakeValue(3));
+
+	EXPECT_EQ(heap.PeekKey(), 3u);
+
+	heap.Clear();
+
+	EXPECT_TRUE(heap.IsEmpty());
+}
+
+TEST_F(RadixHeapTest, MoveAssignment_NonEmptyHeap_LeavesUsableHeap)
+{
+	DEFAULT_HEAP_TYPE heap;
+	DEFAULT_HEAP_TYPE other;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 100; key++)
+	{
+		heap.Push(key, MakeValue(key));
+		other.Push(key + 1000, MakeValue(key + 1000));
+	}
+
+	other = std::move(heap);
+
+	EXPECT_EQ(other.GetCount(), 100u);
+	EXPECT_EQ(other.PeekKey(), 0u);
+	EXPECT_TRUE(heap.IsEmpty());
+
+	heap.Clear();
+	heap.Push(7, MakeValue(7));
+
+	EXPECT_EQ(heap.PeekValue(), MakeValue(7));
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,479 @@
+#ifndef ROARING_BITMAP_TESTS_HPP
+#define ROARING_BITMAP_TESTS_HPP
+
+#include <set>
+#include <random>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/RoaringBitmap.hpp>
+
+using namespace Forge;
+
+class RoaringBitmapTest : public testing::Test
+{
+public:
+	using DEFAULT_BITMAP_TYPE = RoaringBitmap<>;
+	using DEFAULT_REFERENCE_TYPE = std::set<U32>;
+
+public:
+	static constexpr Size ARRAY_MAXIMUM_COUNT = RoaringBitmapView::ARRAY_MAXIMUM_COUNT;
+	static constexpr Size CHUNK_SIZE = 65536;
+	static constexpr Size DEFAULT_SEED_COUNT = 8;
+
+public:
+	/**
+	 * Builds a reference with one chunk per container shape: sparse, exactly at the array limit,
+	 * one past it, dense, a full chunk and a few long runs.
+	 */
+	static DEFAULT_REFERENCE_TYPE MakeReference(U32 seed)
+	{
+		std::mt19937 generator(seed);
+		DEFAULT_REFERENCE_TYPE reference;
+
+		for (U32 chunk = 0; chunk < 8; chunk++)
+		{
+			U32 high = (chunk * (1 + seed % 2)) << 16;
+
+			switch ((chunk + seed) % 6)
+			{
+			case 0:
+				for (Size counter = 0; counter < 100; counter++)
+					reference.insert(high | (generator() & 0xFFFF));
+				break;
+			case 1:
+				for (U32 counter = 0; counter < ARRAY_MAXIMUM_COUNT; counter++)
+					reference.insert(high | (counter * 13));
+				break;
+			case 2:
+				for (U32 low = 0; low < (ARRAY_MAXIMUM_COUNT + 1) * 2; low += 2)
+					reference.insert(high | low);
+				break;
+			case 3:
+				for (U32 low = 0; low < CHUNK_SIZE; low++)
+					if (generator() % 4 != 0)
+						reference.insert(high | low);
+				break;
+			case 4:
+				for (U32 low = 0; low < CHUNK_SIZE; low++)
+					reference.insert(high | low);
+				break;
+			default:
+				for (U32 start = generator() % 1000; start < CHUNK_SIZE - 3000; start += 5000 + generator() % 1000)
+					for (U32 low = start; low < start + 3000; low++)
+						reference.insert(high | low);
+				break;
+			}
+		}
+
+		return reference;
+	}
+
+	static DEFAULT_BITMAP_TYPE MakeBitmap(const DEFAULT_REFERENCE_TYPE& reference)
+	{
+		std::vector<U32> values(reference.begin(), reference.end());
+
+		DEFAULT_BITMAP_TYPE bitmap;
+
+		bitmap.AddAll(values.data(), values.size());
+
+		return bitmap;
+	}
+
+	static DEFAULT_REFERENCE_TYPE ToReference(const DEFAULT_BITMAP_TYPE& bitmap)
+	{
+		DEFAULT_REFERENCE_TYPE values;
+
+		bitmap.ForEach([&values](U32 value) { values.insert(value); });
+
+		return values;
+	}
+
+	static std::vector<Byte> Serialize(const DEFAULT_BITMAP_TYPE& bitmap)
+	{
+		std::vector<Byte> buffer(bitmap.GetSerializedSize());
+
+		EXPECT_EQ(bitmap.Serialize(buffer.data()), buffer.size());
+
+		return buffer;
+	}
+
+	static U8 GetContainerType(const DEFAULT_BITMAP_TYPE& bitmap, Size index)
+	{
+		std::vector<Byte> buffer = Serialize(bitmap);
+
+		return RoaringBitmapView(buffer.data(), buffer.size()).GetDescriptor(index).type;
+	}
+
+	static Void ExpectEqual(const DEFAULT_BITMAP_TYPE& bitmap, const DEFAULT_REFERENCE_TYPE& reference)
+	{
+		EXPECT_EQ(bitmap.GetCardinality(), reference.size());
+		EXPECT_TRUE(ToReference(bitmap) == reference);
+	}
+};
+
+constexpr Size RoaringBitmapTest::ARRAY_MAXIMUM_COUNT;
+constexpr Size RoaringBitmapTest::CHUNK_SIZE;
+constexpr Size RoaringBitmapTest::DEFAULT_SEED_COUNT;
+
+// -------------------------
+// Add Function.
+// -------------------------
+TEST_F(RoaringBitmapTest, Add_PastArrayLimit_ConvertsToBitmapAndBack)
+{
+	DEFAULT_BITMAP_TYPE bitmap;
+
+	for (U32 counter = 0; counter < ARRAY_MAXIMUM_COUNT; counter++)
+		EXPECT_TRUE(bitmap.Add(counter * 2));
+
+	EXPECT_EQ(GetContainerType(bitmap, 0), RoaringBitmapView::ARRAY_CONTAINER);
+
+	EXPECT_TRUE(bitmap.Add(1));
+	EXPECT_FALSE(bitmap.Add(1));
+
+	EXPECT_EQ(bitmap.GetCardinality(), ARRAY_MAXIMUM_COUNT + 1);
+	EXPECT_EQ(GetContainerType(bitmap, 0), RoaringBitmapView::BITMAP_CONTAINER);
+
+	EXPECT_TRUE(bitmap.Remove(1));
+	EXPECT_FALSE(bitmap.Remove(1));
+
+	EXPECT_EQ(GetContainerType(bitmap, 0), RoaringBitmapView::ARRAY_CONTAINER);
+
+	for (U32 counter = 0; counter < ARRAY_MAXIMUM_COUNT * 2; counter++)
+		EXPECT_EQ(bitmap.Contains(counter), counter % 2 == 0);
+}
+
+// -------------------------
+// AddRange Function.
+// -------------------------
+TEST_F(RoaringBitmapTest, AddRange_FullChunk_FillsOneContainer)
+{
+	DEFAULT_BITMAP_TYPE bitmap;
+
+	bitmap.AddRange(CHUNK_SIZE, CHUNK_SIZE * 2 - 1);
+
+	EXPECT_EQ(bitmap.GetContainerCount(), 1u);
+	EXPECT_EQ(bitmap.GetCardinality(), CHUNK_SIZE);
+	EXPECT_FALSE(bitmap.Contains(CHUNK_SIZE - 1));
+	EXPECT_TRUE(bitmap.Contains(CHUNK_SIZE));
+	EXPECT_TRUE(bitmap.Contains(CHUNK_SIZE * 2 - 1));
+	EXPECT_FALSE(bitmap.Contains(CHUNK_SIZE * 2));
+}
+
+TEST_F(RoaringBitmapTest, AddRange_ReversedRange_Throws)
+{
+	DEFAULT_BITMAP_TYPE bitmap;
+
+	EXPECT_THROW(bitmap.AddRange(10, 9), std::invalid_argument);
+}
+
+// -------------------------
+// RunOptimize Function.
+// -------------------------
+TEST_F(RoaringBitmapTest, RunOptimize_FullChunk_ConvertsToSingleRun)
+{
+	DEFAULT_BITMAP_TYPE bitmap;
+
+	bitmap.AddRange(0, CHUNK_SIZE - 1);
+
+	EXPECT_TRUE(bitmap.RunOptimize());
+	EXPECT_FALSE(bitmap.RunOptimize());
+
+	std::vector<Byte> buffer = Serialize(bitmap);
+	RoaringBitmapView view(buffer.data(), buffer.size());
+
+	EXPECT_EQ(view.GetDescriptor(0).type, RoaringBitmapView::RUN_CONTAINER);
+	EXPECT_EQ(view.GetDescriptor(0).element_count, 1u);
+	EXPECT_EQ(view.GetCardinality(), CHUNK_SIZE);
+}
+
+TEST_F(RoaringBitmapTest, RunOptimize_ThenModify_KeepsContents)
+{
+	for (U32 seed = 0; seed < DEFAULT_SEED_COUNT; seed++)
+	{
+		DEFAULT_REFERENCE_TYPE reference = MakeReference(seed);
+		DEFAULT_BITMAP_TYPE bitmap = MakeBitmap(reference);
+
+		bitmap.RunOptimize();
+
+		ExpectEqual(bitmap, reference);
+
+		for (U32 value : { 0u, 1u, 4096u, 65535u, 65536u, 3u << 16, (5u << 16) | 2999u })
+		{
+			EXPECT_EQ(bitmap.Add(value), reference.insert(value).second);
+			EXPECT_TRUE(bitmap.Contains(value));
+		}
+
+		for (U32 value : { 2u, 4095u, (4u << 16) | 100u, (6u << 16) | 65535u })
+		{
+			EXPECT_EQ(bitmap.Remove(value), reference.erase(value) == 1);
+			EXPECT_FALSE(bitmap.Contains(value));
+		}
+
+		ExpectEqual(bitmap, reference);
+	}
+}
+
+// -------------------------
+// Set Operations.
+// -------------------------
+TEST_F(RoaringBitmapTest, Operations_BoundaryContainers_MatchSetReference)
+{
+	for (U32 seed = 0; seed < DEFAULT_SEED_COUNT; seed++)
+	{
+		for (Size optimized = 0; optimized < 4; optimized++)
+		{
+			DEFAULT_REFERENCE_TYPE first_reference = MakeReference(seed);
+			DEFAULT_REFERENCE_TYPE second_reference = MakeReference(seed + 1);
+
+			DEFAULT_BITMAP_TYPE first = MakeBitmap(first_reference);
+			DEFAULT_BITMAP_TYPE second = MakeBitmap(second_reference);
+
+			if (optimized & 1)
+				first.RunOptimize();
+
+			if (optimized & 2)
+				second.RunOptimize();
+
+			DEFAULT_REFERENCE_TYPE expected;
+
+			std::set_intersection(first_reference.begin(), first_reference.end(), second_reference.begin(), second_reference.end(), std::inserter(expected, expected.end()));
+
+			EXPECT_EQ(first.AndCardinality(second), expected.size());
+
+			DEFAULT_BITMAP_TYPE result(first);
+			result.And(second);
+			ExpectEqual(result, expected);
+
+			expected.clear();
+			std::set_union(first_reference.begin(), first_reference.end(), second_reference.begin(), second_reference.end(), std::inserter(expected, expected.end()));
+
+			result = first;
+			result.Or(second);
+			ExpectEqual(result, expected);
+
+			expected.clear();
+			std::set_symmetric_difference(first_reference.begin(), first_reference.end(), second_reference.begin(), second_reference.end(), std::inserter(expected, expected.end()));
+
+			result = first;
+			result.Xor(second);
+			ExpectEqual(result, expected);
+
+			expected.clear();
+			std::set_difference(first_reference.begin(), first_reference.end(), second_reference.begin(), second_reference.end(), std::inserter(expected, expected.end()));
+
+			result = first;
+			result.AndNot(second);
+			ExpectEqual(result, expected);
+		}
+	}
+}
+
+TEST_F(RoaringBitmapTest, Operations_WithItself_AreIdempotentOrEmpty)
+{
+	DEFAULT_REFERENCE_TYPE reference = MakeReference(0);
+	DEFAULT_BITMAP_TYPE bitmap = MakeBitmap(reference);
+
+	bitmap.And(bitmap);
+	bitmap.Or(bitmap);
+
+	ExpectEqual(bitmap, reference);
+
+	DEFAULT_BITMAP_TYPE copy(bitmap);
+
+	copy.Xor(bitmap);
+
+	EXPECT_TRUE(copy.IsEmpty());
+	EXPECT_EQ(copy.GetContainerCount(), 0u);
+
+	bitmap.AndNot(bitmap);
+
+	EXPECT_TRUE(bitmap.IsEmpty());
+}
+
+TEST_F(RoaringBitmapTest, Xor_ArraysPastLimit_ConvertsToBitmap)
+{
+	DEFAULT_BITMAP_TYPE even;
+	DEFAULT_BITMAP_TYPE odd;
+
+	for (U32 counter = 0; counter < ARRAY_MAXIMUM_COUNT; counter++)
+	{
+		even.Add(counter * 2);
+		odd.Add(counter * 2 + 1);
+	}
+
+	even.Xor(odd);
+
+	EXPECT_EQ(even.GetCardinality(), ARRAY_MAXIMUM_COUNT * 2);
+	EXPECT_EQ(GetContainerType(even, 0), RoaringBitmapView::BITMAP_CONTAINER);
+
+	even.Xor(odd);
+
+	EXPECT_EQ(even.GetCardinality(), ARRAY_MAXIMUM_COUNT);
+	EXPECT_EQ(GetContainerType(even, 0), RoaringBitmapView::ARRAY_CONTAINER);
+}
+
+// -------------------------
+// Serialize Function.
+// -------------------------
+TEST_F(RoaringBitmapTest, Serialize_ThenView_RoundTrips)
+{
+	for (U32 seed = 0; seed < DEFAULT_SEED_COUNT; seed++)
+	{
+		DEFAULT_REFERENCE_TYPE reference = MakeReference(seed);
+		DEFAULT_BITMAP_TYPE bitmap = MakeBitmap(reference);
+
+		if (seed % 2 == 1)
+			bitmap.RunOptimize();
+
+		std::vector<Byte> buffer = Serialize(bitmap);
+		RoaringBitmapView view(buffer.data(), buffer.size());
+
+		EXPECT_EQ(view.GetContainerCount(), bitmap.GetContainerCount());
+		EXPECT_EQ(view.GetCardinality(), reference.size());
+
+		DEFAULT_REFERENCE_TYPE values;
+
+		view.ForEach([&values](U32 value) { values.insert(value); });
+
+		EXPECT_TRUE(values == reference);
+
+		for (U32 value = 0; value < CHUNK_SIZE * 4; value += 97)
+			EXPECT_EQ(view.Contains(value), reference.count(value) == 1);
+
+		ExpectEqual(DEFAULT_BITMAP_TYPE(view), reference);
+	}
+}
+
+// -------------------------
+// RoaringBitmapView Constructor.
+// -------------------------
+TEST_F(RoaringBitmapTest, ViewConstructor_TruncatedBuffer_Throws)
+{
+	DEFAULT_BITMAP_TYPE bitmap = { 1, 2, 3, (2u << 16) | 7 };
+
+	bitmap.AddRange(1u << 16, (1u << 16) | 5000);
+	bitmap.Add((1u << 16) | 6000);
+
+	std::vector<Byte> buffer = Serialize(bitmap);
+
+	ASSERT_EQ(GetContainerType(bitmap, 1), RoaringBitmapView::BITMAP_CONTAINER);
+
+	for (Size size = 0; size < buffer.size(); size++)
+		EXPECT_THROW(RoaringBitmapView(buffer.data(), size), std::invalid_argument);
+
+	EXPECT_THROW(RoaringBitmapView(nullptr, 0), std::invalid_argument);
+	EXPECT_NO_THROW(RoaringBitmapView(buffer.data(), buffer.size()));
+}
+
+TEST_F(RoaringBitmapTest, ViewConstructor_MalformedBuffer_Throws)
+{
+	DEFAULT_BITMAP_TYPE bitmap = { 1, 2, 3, (1u << 16) | 7 };
+
+	bitmap.AddRange(2u << 16, (2u << 16) | 5000);
+	bitmap.RunOptimize();
+
+	const std::vector<Byte> buffer = Serialize(bitmap);
+
+	Byte* first = nullptr;
+	Byte* second = nullptr;
+	Byte* third = nullptr;
+
+	auto corrupt = [&buffer, &first, &second, &third](auto modify)
+	{
+		std::vector<Byte> corrupted(buffer);
+
+		first = corrupted.data() + RoaringBitmapView::HEADER_SIZE;
+		second = first + RoaringBitmapView::DESCRIPTOR_SIZE;
+		third = second + RoaringBitmapView::DESCRIPTOR_SIZE;
+
+		modify(corrupted);
+
+		EXPECT_THROW(RoaringBitmapView(corrupted.data(), corrupted.size()), std::invalid_argument);
+	};
+
+	ASSERT_NO_THROW(RoaringBitmapView(buffer.data(), buffer.size()));
+	ASSERT_EQ(GetContainerType(bitmap, 2), RoaringBitmapView::RUN_CONTAINER);
+
+	// Wrong magic number.
+	corrupt([](std::vector<Byte>& data) { data[0] ^= 1; });
+
+	// More containers than descriptors fit.
+	corrupt([](std::vector<Byte>& data) { RoaringBitmapView::StoreU32(data.data() + 4, 1000); });
+
+	// Unknown container type.
+	corrupt([&first](std::vector<Byte>&) { first[2] = 3; });
+
+	// Array container above the array limit.
+	corrupt([&first](std::vector<Byte>&) { RoaringBitmapView::StoreU32(first + 8, ARRAY_MAXIMUM_COUNT + 1); });
+
+	// Bitmap container without exactly 1024 words.
+	corrupt([&first](std::vector<Byte>&) { first[2] = RoaringBitmapView::BITMAP_CONTAINER; });
+
+	// Misaligned payload.
+	corrupt([&second](std::vector<Byte>&) { RoaringBitmapView::StoreU32(second + 12, RoaringBitmapView::LoadU32(second + 12) + 2); });
+
+	// Payload past the end of the buffer.
+	corrupt([&third](std::vector<Byte>&) { RoaringBitmapView::StoreU32(third + 8, 1000000); });
+
+	// Unsorted keys.
+	corrupt([&second](std::vector<Byte>&) { RoaringBitmapView::StoreU16(second, 0); });
+
+	// Run reaching past the 16-bit range of its container.
+	corrupt([&third](std::vector<Byte>& data) { RoaringBitmapView::StoreU16(data.data() + RoaringBitmapView::LoadU32(third + 12), 0xFFFF); });
+}
+
+TEST_F(RoaringBitmapTest, ViewConstructor_InconsistentPayload_Throws)
+{
+	DEFAULT_BITMAP_TYPE bitmap = { 1, 5, 9, 13 };
+
+	for (U32 low = 0; low < 10000; low += 2)
+		bitmap.Add((1u << 16) | low);
+
+	bitmap.AddRange(2u << 16, (2u << 16) | 100);
+	bitmap.AddRange((2u << 16) | 200, (2u << 16) | 300);
+	bitmap.RunOptimize();
+
+	const std::vector<Byte> buffer = Serialize(bitmap);
+
+	ASSERT_EQ(GetContainerType(bitmap, 0), RoaringBitmapView::ARRAY_CONTAINER);
+	ASSERT_EQ(GetContainerType(bitmap, 1), RoaringBitmapView::BITMAP_CONTAINER);
+	ASSERT_EQ(GetContainerType(bitmap, 2), RoaringBitmapView::RUN_CONTAINER);
+	ASSERT_NO_THROW(RoaringBitmapView(buffer.data(), buffer.size()));
+
+	auto corrupt = [&buffer](Size container, auto modify)
+	{
+		std::vector<Byte> corrupted(buffer);
+
+		Byte* descriptor = corrupted.data() + RoaringBitmapView::HEADER_SIZE + container * RoaringBitmapView::DESCRIPTOR_SIZE;
+
+		modify(descriptor, corrupted.data() + RoaringBitmapView::LoadU32(descriptor + 12));
+
+		EXPECT_THROW(RoaringBitmapView(corrupted.data(), corrupted.size()), std::invalid_argument);
+	};
+
+	// Array values out of order.
+	corrupt(0, [](Byte*, Byte* payload) { RoaringBitmapView::StoreU16(payload, 7); });
+
+	// Duplicated array value.
+	corrupt(0, [](Byte*, Byte* payload) { RoaringBitmapView::StoreU16(payload + 2, 1); });
+
+	// Overlapping runs.
+	corrupt(2, [](Byte*, Byte* payload) { RoaringBitmapView::StoreU16(payload + 4, 50); });
+
+	// Runs out of order.
+	corrupt(2, [](Byte*, Byte* payload) { RoaringBitmapView::StoreU16(payload, 400); });
+
+	// Cardinality that disagrees with each kind of payload.
+	for (Size container = 0; container < 3; container++)
+		corrupt(container, [](Byte* descriptor, Byte*) { RoaringBitmapView::StoreU32(descriptor + 4, RoaringBitmapView::LoadU32(descriptor + 4) + 1); });
+
+	// Bit set in a bitmap without updating the cardinality.
+	corrupt(1, [](Byte*, Byte* payload) { payload[0] |= 2; });
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+#ifndef SEGMENTED_ARRAY_TESTS_HPP
+#define SEGMENTED_ARRAY_TESTS_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Collections/SegmentedArray.hpp>
+
+using namespace Forge;
+
+class SegmentedArrayTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ARRAY_TYPE = SegmentedArray<DEFAULT_ELEMENT_TYPE>;
+
+public:
+	static constexpr Size FIRST_SEGMENT_CAPACITY = DEFAULT_ARRAY_TYPE::FIRST_SEGMENT_CAPACITY;
+	static constexpr Size DEFAULT_COUNT = 100000;
+	static constexpr Size DEFAULT_READER_COUNT = 3;
+
+protected:
+	// The elements are derived from their index, so a reader can check what it sees.
+	static DEFAULT_ELEMENT_TYPE MakeElement(Size index)
+	{
+		return DEFAULT_ELEMENT_TYPE(index) * 2654435761u + 1;
+	}
+};
+
+constexpr Size SegmentedArrayTest::FIRST_SEGMENT_CAPACITY;
+constexpr Size SegmentedArrayTest::DEFAULT_COUNT;
+constexpr Size SegmentedArrayTest::DEFAULT_READER_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(SegmentedArrayTest, DefaultConstructor_NewArray_HasNoSegments)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetSegmentCount(), 0u);
+	EXPECT_THROW(array.At(0), std::out_of_range);
+	EXPECT_THROW(array.GetBack(), std::length_error);
+	EXPECT_THROW(array.PopBack(), std::length_error);
+}
+
+// -------------------------
+// PushBack Function.
+// -------------------------
+TEST_F(SegmentedArrayTest, PushBack_AcrossSegmentGrowth_KeepsElementAddresses)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	std::vector<DEFAULT_ELEMENT_TYPE*> addresses;
+
+	Size segment_count = 0;
+	Size capacity = 0;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		addresses.push_back(&array.PushBack(MakeElement(counter)));
+
+		// Every new segment is twice as large as the previous one.
+		if (array.GetSegmentCount() != segment_count)
+		{
+			EXPECT_EQ(array.GetSegmentCount(), segment_count + 1);
+			EXPECT_EQ(array.GetCapacity(), capacity * 2 + FIRST_SEGMENT_CAPACITY);
+
+			segment_count = array.GetSegmentCount();
+			capacity = array.GetCapacity();
+
+			// Nothing pushed before the growth has moved.
+			for (Size index = 0; index < counter; index++)
+				ASSERT_EQ(&array[index], addresses[index]);
+		}
+	}
+
+	EXPECT_GE(segment_count, 12u);
+
+	for (Size index = 0; index < DEFAULT_COUNT; index++)
+	{
+		ASSERT_EQ(&array[index], addresses[index]);
+		EXPECT_EQ(*addresses[index], MakeElement(index));
+	}
+
+	EXPECT_EQ(array.GetBack(), MakeElement(DEFAULT_COUNT - 1));
+	EXPECT_EQ(array.GetFront(), MakeElement(0));
+}
+
+TEST_F(SegmentedArrayTest, PopBack_ThenPushBack_ReusesTheSameSlot)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < FIRST_SEGMENT_CAPACITY + 1; counter++)
+		array.PushBack(MakeElement(counter));
+
+	DEFAULT_ELEMENT_TYPE* last = &array.GetBack();
+	DEFAULT_ELEMENT_TYPE* first = &array.GetFront();
+
+	array.PopBack();
+
+	EXPECT_EQ(array.GetCount(), FIRST_SEGMENT_CAPACITY);
+	EXPECT_EQ(&array.PushBack(7), last);
+	EXPECT_EQ(&array.GetFront(), first);
+	EXPECT_EQ(array.GetSegmentCount(), 2u);
+}
+
+// -------------------------
+// Reserve Function.
+// -------------------------
+TEST_F(SegmentedArrayTest, Reserve_LargeCapacity_AllocatesSegmentsUpFront)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	array.Reserve(DEFAULT_COUNT);
+
+	Size segment_count = array.GetSegmentCount();
+
+	EXPECT_GE(array.GetCapacity(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(MakeElement(counter));
+
+	EXPECT_EQ(array.GetSegmentCount(), segment_count);
+}
+
+// -------------------------
+// Concurrency.
+// -------------------------
+TEST_F(SegmentedArrayTest, Read_OneWriterManyReaders_SeesEveryPublishedElement)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	std::atomic<Bool> writing{ true };
+	std::atomic<Size> mismatch_count{ 0 };
+
+	std::vector<std::thread> readers;
+
+	for (Size thread_index = 0; thread_index < DEFAULT_READER_COUNT; thread_index++)
+	{
+		readers.emplace_back([&array, &writing, &mismatch_count]()
+		{
+			Size previous_count = 0;
+
+			while (writing.load(std::memory_order_acquire))
+			{
+				Size count = array.GetCount();
+
+				// The count only grows, and everything below it is fully constructed.
+				if (count < previous_count)
+					mismatch_count.fetch_add(1, std::memory_order_relaxed);
+
+				for (Size index = previous_count; index < count; index++)
+					if (array[index] != MakeElement(index))
+						mismatch_count.fetch_add(1, std::memory_order_relaxed);
+
+				if (count > 0 && array.At(count - 1) != MakeElement(count - 1))
+					mismatch_count.fetch_add(1, std::memory_order_relaxed);
+
+				previous_count = count;
+			}
+		});
+	}
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(MakeElement(counter));
+
+	writing.store(false, std::memory_order_release);
+
+	for (std::thread& thread : readers)
+		thread.join();
+
+	EXPECT_EQ(mismatch_count.load(), 0u);
+	EXPECT_EQ(array.GetCount(), DEFAULT_COUNT);
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(SegmentedArrayTest, CopyAndMove_NonEmptyArray_KeepElements)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 1000; counter++)
+		array.PushBack(MakeElement(counter));
+
+	DEFAULT_ELEMENT_TYPE* first = &array[0];
+
+	DEFAULT_ARRAY_TYPE copy(array);
+
+	EXPECT_NE(&copy[0], first);
+	EXPECT_EQ(copy.GetCount(), 1000u);
+	EXPECT_EQ(copy[999], MakeElement(999));
+
+	DEFAULT_ARRAY_TYPE moved(std::move(array));
+
+	EXPECT_EQ(&moved[0], first);
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetSegmentCount(), 0u);
+
+	array.PushBack(1);
+
+	EXPECT_EQ(array.GetFront(), 1u);
+}
+
+#endif
\ No newline at end of file
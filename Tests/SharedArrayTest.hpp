@@ -0,0 +1,214 @@
+#ifndef SHARED_ARRAY_TESTS_HPP
+#define SHARED_ARRAY_TESTS_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/SharedArray.hpp>
+
+using namespace Forge;
+
+class SharedArrayTest : public testing::Test
+{
+public:
+	/**
+	 * @brief An element that counts its live instances.
+	 */
+	struct CountedElement
+	{
+		static Size& GetLiveCount()
+		{
+			static Size live_count = 0;
+
+			return live_count;
+		}
+
+		CountedElement()
+		{
+			GetLiveCount()++;
+		}
+
+		CountedElement(const CountedElement&)
+		{
+			GetLiveCount()++;
+		}
+
+		~CountedElement()
+		{
+			GetLiveCount()--;
+		}
+	};
+
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ARRAY_TYPE = SharedArray<DEFAULT_ELEMENT_TYPE>;
+	using COUNTED_ARRAY_TYPE = SharedArray<CountedElement>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size DEFAULT_READER_COUNT = 4;
+	static constexpr Size DEFAULT_VERSION_COUNT = 200;
+
+protected:
+	/**
+	 * @brief Creates an array whose every element holds the specified version.
+	 */
+	static DEFAULT_ARRAY_TYPE CreateVersion(DEFAULT_ELEMENT_TYPE version)
+	{
+		DEFAULT_ARRAY_TYPE array;
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			array.PushBack(version);
+
+		return array;
+	}
+};
+
+constexpr Size SharedArrayTest::DEFAULT_COUNT;
+constexpr Size SharedArrayTest::DEFAULT_READER_COUNT;
+constexpr Size SharedArrayTest::DEFAULT_VERSION_COUNT;
+
+// -------------------------
+// Copy Constructor.
+// -------------------------
+TEST_F(SharedArrayTest, CopyConstructor_ThenModify_LeavesSnapshotUnchanged)
+{
+	DEFAULT_ARRAY_TYPE array = { 1, 2, 3 };
+	DEFAULT_ARRAY_TYPE snapshot(array);
+
+	EXPECT_TRUE(array.IsShared());
+	EXPECT_EQ(snapshot.GetRawData(), array.GetRawData());
+
+	array.Set(0, 10);
+	array.PushBack(4);
+
+	EXPECT_FALSE(array.IsShared());
+	EXPECT_FALSE(snapshot.IsShared());
+
+	ASSERT_EQ(snapshot.GetCount(), 3u);
+	EXPECT_EQ(snapshot[0], 1u);
+
+	ASSERT_EQ(array.GetCount(), 4u);
+	EXPECT_EQ(array[0], 10u);
+	EXPECT_EQ(array[3], 4u);
+}
+
+// -------------------------
+// PushBack Function.
+// -------------------------
+TEST_F(SharedArrayTest, PushBack_UniqueStorage_ModifiesInPlace)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	array.PushBack(0);
+	array.PushBack(1);
+	array.PushBack(2);
+
+	const DEFAULT_ELEMENT_TYPE* data = array.GetRawData();
+
+	array.Set(0, 5);
+	array.PushBack(array[1]);
+
+	EXPECT_EQ(array.GetRawData(), data);
+	EXPECT_EQ(array[3], 1u);
+
+	array.PopBack();
+	array.PopBack();
+	array.PopBack();
+	array.PopBack();
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_THROW(array.PopBack(), std::length_error);
+	EXPECT_THROW(array.Get(0), std::out_of_range);
+}
+
+// -------------------------
+// Store Function.
+// -------------------------
+TEST_F(SharedArrayTest, Store_ConcurrentReaders_SeeCompleteVersions)
+{
+	DEFAULT_ARRAY_TYPE published = CreateVersion(0);
+
+	std::atomic<Bool> done(false);
+	std::vector<std::thread> readers;
+
+	for (Size reader = 0; reader < DEFAULT_READER_COUNT; reader++)
+	{
+		readers.emplace_back([&]()
+		{
+			DEFAULT_ELEMENT_TYPE last_version = 0;
+
+			while (!done.load())
+			{
+				DEFAULT_ARRAY_TYPE snapshot = published.Load();
+
+				ASSERT_EQ(snapshot.GetCount(), DEFAULT_COUNT);
+				ASSERT_EQ(snapshot[0], snapshot[DEFAULT_COUNT - 1]);
+				ASSERT_GE(snapshot[0], last_version);
+
+				last_version = snapshot[0];
+			}
+		});
+	}
+
+	for (DEFAULT_ELEMENT_TYPE version = 1; version <= DEFAULT_VERSION_COUNT; version++)
+	{
+		DEFAULT_ARRAY_TYPE next = published.Load();
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			next.Set(counter, version);
+
+		published.Store(next);
+	}
+
+	done.store(true);
+
+	for (std::thread& reader : readers)
+		reader.join();
+
+	EXPECT_EQ(published.Load()[0], DEFAULT_VERSION_COUNT);
+}
+
+TEST_F(SharedArrayTest, Store_ThenCollect_ReleasesReplacedStorages)
+{
+	Size live_count = CountedElement::GetLiveCount();
+
+	{
+		COUNTED_ARRAY_TYPE published;
+
+		for (Size version = 0; version < DEFAULT_VERSION_COUNT; version++)
+		{
+			COUNTED_ARRAY_TYPE next;
+
+			for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+				next.PushBack(CountedElement());
+
+			published.Store(next);
+		}
+
+		Reclaim::EpochManager::GetDefault().Collect();
+
+		EXPECT_EQ(CountedElement::GetLiveCount(), live_count + DEFAULT_COUNT);
+	}
+
+	EXPECT_EQ(CountedElement::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Exchange Function.
+// -------------------------
+TEST_F(SharedArrayTest, Exchange_ReturnsReplacedVersion)
+{
+	DEFAULT_ARRAY_TYPE published = CreateVersion(1);
+	DEFAULT_ARRAY_TYPE previous = published.Exchange(CreateVersion(2));
+
+	EXPECT_EQ(previous[0], 1u);
+	EXPECT_EQ(published[0], 2u);
+}
+
+#endif
\ No newline at end of file
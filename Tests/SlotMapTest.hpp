@@ -0,0 +1,138 @@
+#ifndef SLOT_MAP_TESTS_HPP
+#define SLOT_MAP_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <Collections/SlotMap.hpp>
+
+using namespace Forge;
+
+class SlotMapTest : public testing::Test
+{
+public:
+	using DEFAULT_TYPE = I32;
+	using DEFAULT_HANDLE_TYPE = SlotMap<DEFAULT_TYPE>::Handle;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 5;
+
+public:
+	DEFAULT_TYPE DEFAULT_BUFFER[DEFAULT_COUNT] = { 10, 20, 30, 40, 50 };
+	DEFAULT_HANDLE_TYPE fixture_handles[DEFAULT_COUNT];
+
+protected:
+	SlotMap<DEFAULT_TYPE> fixture_empty_map;
+	SlotMap<DEFAULT_TYPE> fixture_nonempty_map;
+
+protected:
+	Void SetUp() override
+	{
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			fixture_handles[counter] = fixture_nonempty_map.Insert(DEFAULT_BUFFER[counter]);
+	}
+};
+
+constexpr Size SlotMapTest::DEFAULT_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(SlotMapTest, DefaultConstructor_EmptyMap_DoesNotContainDefaultHandle)
+{
+	SlotMap<DEFAULT_TYPE> test_map;
+
+	EXPECT_TRUE(test_map.IsEmpty());
+	EXPECT_FALSE(test_map.Contains(DEFAULT_HANDLE_TYPE()));
+}
+
+// -------------------------
+// Copy Constructor.
+// -------------------------
+TEST_F(SlotMapTest, CopyConstructor_NonEmptyMap_KeepsHandlesValid)
+{
+	SlotMap<DEFAULT_TYPE> test_map = fixture_nonempty_map;
+
+	EXPECT_EQ(test_map.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(test_map.Get(fixture_handles[counter]), DEFAULT_BUFFER[counter]);
+}
+
+// -------------------------
+// Get Functions.
+// -------------------------
+TEST_F(SlotMapTest, Get_InvalidHandle_ThrowsOutOfRangeException)
+{
+	EXPECT_THROW(fixture_empty_map.Get(fixture_handles[0]), std::out_of_range);
+	EXPECT_EQ(fixture_empty_map.TryGet(fixture_handles[0]), nullptr);
+}
+TEST_F(SlotMapTest, Get_ValidHandle_ReturnsElement)
+{
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		EXPECT_EQ(fixture_nonempty_map.Get(fixture_handles[counter]), DEFAULT_BUFFER[counter]);
+		EXPECT_EQ(*fixture_nonempty_map.TryGet(fixture_handles[counter]), DEFAULT_BUFFER[counter]);
+	}
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(SlotMapTest, Remove_ValidHandle_KeepsOtherHandlesValid)
+{
+	fixture_nonempty_map.Remove(fixture_handles[1]);
+
+	EXPECT_EQ(fixture_nonempty_map.GetCount(), DEFAULT_COUNT - 1);
+	EXPECT_FALSE(fixture_nonempty_map.Contains(fixture_handles[1]));
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		if (counter == 1)
+			continue;
+
+		EXPECT_EQ(fixture_nonempty_map.Get(fixture_handles[counter]), DEFAULT_BUFFER[counter]);
+	}
+}
+TEST_F(SlotMapTest, Remove_ValidHandle_KeepsElementsPacked)
+{
+	fixture_nonempty_map.Remove(fixture_handles[0]);
+
+	for (Size counter = 0; counter < fixture_nonempty_map.GetCount(); counter++)
+		EXPECT_EQ(fixture_nonempty_map.Get(fixture_nonempty_map.GetHandle(counter)), fixture_nonempty_map.GetRawData()[counter]);
+}
+TEST_F(SlotMapTest, Remove_InvalidHandle_ThrowsOutOfRangeException)
+{
+	fixture_nonempty_map.Remove(fixture_handles[2]);
+
+	EXPECT_THROW(fixture_nonempty_map.Remove(fixture_handles[2]), std::out_of_range);
+}
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(SlotMapTest, Insert_AfterRemove_ReusesSlotWithNewGeneration)
+{
+	fixture_nonempty_map.Remove(fixture_handles[3]);
+
+	DEFAULT_HANDLE_TYPE handle = fixture_nonempty_map.Insert(DEFAULT_TYPE(99));
+
+	EXPECT_EQ(handle.index, fixture_handles[3].index);
+	EXPECT_NE(handle, fixture_handles[3]);
+	EXPECT_FALSE(fixture_nonempty_map.Contains(fixture_handles[3]));
+	EXPECT_EQ(fixture_nonempty_map.Get(handle), 99);
+}
+
+// -------------------------
+// Clear Function.
+// -------------------------
+TEST_F(SlotMapTest, Clear_NonEmptyMap_InvalidatesAllHandles)
+{
+	fixture_nonempty_map.Clear();
+
+	EXPECT_TRUE(fixture_nonempty_map.IsEmpty());
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_FALSE(fixture_nonempty_map.Contains(fixture_handles[counter]));
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,409 @@
+#ifndef SOA_ARRAY_TESTS_HPP
+#define SOA_ARRAY_TESTS_HPP
+
+#include <tuple>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <Collections/SoaArray.hpp>
+
+using namespace Forge;
+
+/**
+ * A field that counts its live instances, to check that removed rows are destroyed.
+ */
+struct LiveField
+{
+	U32 value;
+
+	static Size& GetLiveCount()
+	{
+		static Size count = 0;
+
+		return count;
+	}
+
+	LiveField(U32 in_value = 0)
+		: value(in_value)
+	{
+		GetLiveCount()++;
+	}
+
+	LiveField(const LiveField& other)
+		: value(other.value)
+	{
+		GetLiveCount()++;
+	}
+
+	LiveField& operator=(const LiveField& other) = default;
+
+	~LiveField()
+	{
+		GetLiveCount()--;
+	}
+};
+
+/**
+ * A policy that ignores the requested alignment and always returns blocks 16 bytes past a cache line.
+ */
+struct MisalignedAllocationPolicy
+{
+	static constexpr Size HEADER_SIZE = 16;
+	static constexpr Size OFFSET = 80;
+
+	VoidPtr Allocate(Size size, Size)
+	{
+		BytePtr base = static_cast<BytePtr>(::std::aligned_alloc(64, (size + OFFSET + 63) / 64 * 64));
+
+		*reinterpret_cast<Size*>(base + OFFSET - HEADER_SIZE) = size;
+
+		return base + OFFSET;
+	}
+
+	VoidPtr Reallocate(VoidPtr pointer, Size size, Size alignment)
+	{
+		VoidPtr block = this->Allocate(size, alignment);
+
+		if (pointer)
+		{
+			Size old_size = *reinterpret_cast<Size*>(static_cast<BytePtr>(pointer) - HEADER_SIZE);
+
+			::std::memcpy(block, pointer, old_size < size ? old_size : size);
+
+			this->Deallocate(pointer);
+		}
+
+		return block;
+	}
+
+	Void Deallocate(VoidPtr pointer)
+	{
+		if (pointer)
+			::std::free(static_cast<BytePtr>(pointer) - OFFSET);
+	}
+};
+
+class SoaArrayTest : public testing::Test
+{
+public:
+	using DEFAULT_ARRAY_TYPE = SoaArray<U64, F32, U8>;
+	using LIVE_ARRAY_TYPE = SoaArray<U32, LiveField>;
+	using MISALIGNED_ARRAY_TYPE = SoaArrayWithPolicy<MisalignedAllocationPolicy, U64>;
+	using STRING_ARRAY_TYPE = SoaArray<I32, std::string, LiveField>;
+
+	using DEFAULT_ROW_TYPE = DEFAULT_ARRAY_TYPE::RowType;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size COLUMN_ALIGNMENT = DEFAULT_ARRAY_TYPE::COLUMN_ALIGNMENT;
+
+protected:
+	static DEFAULT_ROW_TYPE MakeRow(Size index)
+	{
+		return DEFAULT_ROW_TYPE(U64(index), F32(index) / 2, U8(index % 256));
+	}
+
+	static Bool IsAligned(const Void* pointer)
+	{
+		return reinterpret_cast<uintptr_t>(pointer) % COLUMN_ALIGNMENT == 0;
+	}
+
+	static Void ExpectRow(const DEFAULT_ARRAY_TYPE& array, Size index, Size value)
+	{
+		EXPECT_EQ(std::get<0>(array[index]), U64(value));
+		EXPECT_EQ(std::get<1>(array[index]), F32(value) / 2);
+		EXPECT_EQ(std::get<2>(array[index]), U8(value % 256));
+	}
+};
+
+constexpr Size SoaArrayTest::DEFAULT_COUNT;
+constexpr Size SoaArrayTest::COLUMN_ALIGNMENT;
+constexpr Size MisalignedAllocationPolicy::HEADER_SIZE;
+constexpr Size MisalignedAllocationPolicy::OFFSET;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(SoaArrayTest, DefaultConstructor_NewArray_IsEmpty)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetCapacity(), 0u);
+	EXPECT_THROW(array.PopBack(), std::length_error);
+	EXPECT_THROW(array.At(0), std::out_of_range);
+}
+
+// -------------------------
+// PushBack Function.
+// -------------------------
+TEST_F(SoaArrayTest, PushBack_ManyRows_KeepsColumnsAlignedAfterEveryGrowth)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		Size capacity = array.GetCapacity();
+
+		if (counter % 2 == 0)
+			array.PushBack(MakeRow(counter));
+		else
+		{
+			const DEFAULT_ROW_TYPE row = MakeRow(counter);
+
+			array.PushBack(row);
+		}
+
+		if (array.GetCapacity() == capacity)
+			continue;
+
+		EXPECT_TRUE(IsAligned(array.GetRawData<0>()));
+		EXPECT_TRUE(IsAligned(array.GetRawData<1>()));
+		EXPECT_TRUE(IsAligned(array.GetRawData<2>()));
+	}
+
+	ASSERT_EQ(array.GetCount(), DEFAULT_COUNT);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		ExpectRow(array, counter, counter);
+
+	U64 sum = 0;
+
+	for (Size counter = 0; counter < array.GetCount(); counter++)
+		sum += array.GetRawData<0>()[counter];
+
+	EXPECT_EQ(sum, U64(DEFAULT_COUNT * (DEFAULT_COUNT - 1) / 2));
+}
+
+TEST_F(SoaArrayTest, Reserve_MisalignedPolicy_ThrowsLogicError)
+{
+	Allocator<MisalignedAllocationPolicy> allocator;
+
+	MISALIGNED_ARRAY_TYPE reserved(&allocator);
+	MISALIGNED_ARRAY_TYPE grown(&allocator);
+
+	EXPECT_THROW(reserved.Reserve(16), std::logic_error);
+	EXPECT_THROW(grown.PushBack(std::make_tuple(U64(1))), std::logic_error);
+
+	EXPECT_EQ(reserved.GetCapacity(), 0u);
+	EXPECT_EQ(reserved.GetRawData<0>(), nullptr);
+	EXPECT_EQ(grown.GetCapacity(), 0u);
+	EXPECT_TRUE(grown.IsEmpty());
+}
+
+TEST_F(SoaArrayTest, Reserve_StringColumn_RelocatesRows)
+{
+	Size live_count = LiveField::GetLiveCount();
+
+	{
+		STRING_ARRAY_TYPE array;
+
+		// Short strings keep their characters inside the object, so copying their bytes to a
+		// new column would leave them pointing into the old one.
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			array.PushBack(STRING_ARRAY_TYPE::RowType(I32(counter), std::to_string(counter), LiveField(U32(counter))));
+
+		array.Reserve(DEFAULT_COUNT * 4);
+
+		ASSERT_EQ(array.GetCount(), DEFAULT_COUNT);
+		EXPECT_EQ(LiveField::GetLiveCount(), live_count + DEFAULT_COUNT);
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		{
+			ASSERT_EQ(array.Get<0>(counter), I32(counter));
+			ASSERT_EQ(array.Get<1>(counter), std::to_string(counter));
+			ASSERT_EQ(array.Get<2>(counter).value, U32(counter));
+		}
+	}
+
+	EXPECT_EQ(LiveField::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Access Functions.
+// -------------------------
+TEST_F(SoaArrayTest, Get_ModifiedField_ChangesOnlyThatColumn)
+{
+	DEFAULT_ARRAY_TYPE array(4);
+
+	for (Size counter = 0; counter < 4; counter++)
+		array.PushBack(MakeRow(counter));
+
+	array.Get<0>(2) = 100;
+	std::get<2>(array.At(1)) = 200;
+
+	EXPECT_EQ(array.Get<0>(2), 100u);
+	EXPECT_EQ(array.Get<1>(2), 1.0f);
+	EXPECT_EQ(array.Get<2>(1), 200u);
+	EXPECT_EQ(array.Get<0>(1), 1u);
+	EXPECT_EQ(array.GetCapacity(), 4u);
+}
+
+// -------------------------
+// Remove Functions.
+// -------------------------
+TEST_F(SoaArrayTest, Remove_MiddleRow_KeepsOrder)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 10; counter++)
+		array.PushBack(MakeRow(counter));
+
+	array.Remove(4);
+	array.Remove(8);
+
+	ASSERT_EQ(array.GetCount(), 8u);
+
+	for (Size counter = 0; counter < 8; counter++)
+		ExpectRow(array, counter, counter < 4 ? counter : counter + 1);
+
+	EXPECT_THROW(array.Remove(8), std::out_of_range);
+}
+
+TEST_F(SoaArrayTest, RemoveSwap_MiddleRow_MovesLastRowIntoItsPlace)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 10; counter++)
+		array.PushBack(MakeRow(counter));
+
+	array.RemoveSwap(3);
+	array.RemoveSwap(8);
+
+	ASSERT_EQ(array.GetCount(), 8u);
+
+	ExpectRow(array, 3, 9);
+	ExpectRow(array, 7, 7);
+
+	EXPECT_THROW(array.RemoveSwap(8), std::out_of_range);
+}
+
+TEST_F(SoaArrayTest, RemoveFunctions_LiveFields_DestroyRemovedRows)
+{
+	Size live_count = LiveField::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE array;
+
+		for (U32 counter = 0; counter < 10; counter++)
+			array.PushBack(std::make_tuple(counter, LiveField(counter)));
+
+		EXPECT_EQ(LiveField::GetLiveCount(), live_count + 10);
+
+		array.Remove(0);
+		array.RemoveSwap(0);
+		array.PopBack();
+
+		EXPECT_EQ(LiveField::GetLiveCount(), live_count + 7);
+		EXPECT_EQ(array.Get<1>(0).value, 9u);
+		EXPECT_EQ(array.Get<1>(6).value, 7u);
+
+		array.Clear();
+
+		EXPECT_EQ(LiveField::GetLiveCount(), live_count);
+
+		array.PushBack(std::make_tuple(U32(1), LiveField(1)));
+	}
+
+	EXPECT_EQ(LiveField::GetLiveCount(), live_count);
+}
+
+// -------------------------
+// Zip Function.
+// -------------------------
+TEST_F(SoaArrayTest, Zip_RangeBasedLoop_VisitsAndModifiesEveryRow)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(MakeRow(counter));
+
+	for (auto row : array.Zip())
+		std::get<0>(row) *= 2;
+
+	Size index = 0;
+
+	const DEFAULT_ARRAY_TYPE& const_array = array;
+
+	for (auto row : const_array.Zip())
+	{
+		EXPECT_EQ(std::get<0>(row), U64(index * 2));
+		EXPECT_EQ(std::get<2>(row), U8(index % 256));
+
+		index++;
+	}
+
+	EXPECT_EQ(index, DEFAULT_COUNT);
+
+	DEFAULT_ARRAY_TYPE empty;
+
+	EXPECT_TRUE(empty.Zip().begin() == empty.Zip().end());
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(SoaArrayTest, CopyConstructor_NonEmptyArray_CopiesAlignedColumns)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	for (Size counter = 0; counter < 100; counter++)
+		array.PushBack(MakeRow(counter));
+
+	DEFAULT_ARRAY_TYPE copy(array);
+
+	array.Get<0>(0) = 1000;
+
+	ASSERT_EQ(copy.GetCount(), 100u);
+	EXPECT_NE(copy.GetRawData<0>(), array.GetRawData<0>());
+	EXPECT_TRUE(IsAligned(copy.GetRawData<0>()));
+	EXPECT_TRUE(IsAligned(copy.GetRawData<2>()));
+
+	for (Size counter = 0; counter < 100; counter++)
+		ExpectRow(copy, counter, counter);
+
+	copy = array;
+
+	EXPECT_EQ(copy.Get<0>(0), 1000u);
+
+	copy = copy;
+
+	EXPECT_EQ(copy.GetCount(), 100u);
+}
+
+TEST_F(SoaArrayTest, MoveConstructor_NonEmptyArray_TakesColumns)
+{
+	Size live_count = LiveField::GetLiveCount();
+
+	{
+		LIVE_ARRAY_TYPE array;
+
+		for (U32 counter = 0; counter < 10; counter++)
+			array.PushBack(std::make_tuple(counter, LiveField(counter)));
+
+		const LiveField* column = array.GetRawData<1>();
+
+		LIVE_ARRAY_TYPE moved(std::move(array));
+
+		EXPECT_EQ(moved.GetRawData<1>(), column);
+		EXPECT_EQ(moved.GetCount(), 10u);
+		EXPECT_TRUE(array.IsEmpty());
+		EXPECT_EQ(array.GetCapacity(), 0u);
+
+		array.PushBack(std::make_tuple(U32(1), LiveField(1)));
+
+		array = std::move(moved);
+
+		EXPECT_EQ(array.GetCount(), 10u);
+		EXPECT_TRUE(moved.IsEmpty());
+		EXPECT_EQ(LiveField::GetLiveCount(), live_count + 10);
+	}
+
+	EXPECT_EQ(LiveField::GetLiveCount(), live_count);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,219 @@
+#ifndef SPARSE_MAP_TESTS_HPP
+#define SPARSE_MAP_TESTS_HPP
+
+#include <map>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Collections/SparseMap.hpp>
+
+using namespace Forge;
+
+class SparseMapTest : public testing::Test
+{
+public:
+	using DEFAULT_KEY_TYPE = U32;
+	using DEFAULT_VALUE_TYPE = std::string;
+
+	using DEFAULT_MAP_TYPE = SparseMap<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+	using REFERENCE_MAP_TYPE = std::map<DEFAULT_KEY_TYPE, DEFAULT_VALUE_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_UNIVERSE = 1000;
+	static constexpr Size DEFAULT_OPERATION_COUNT = 20000;
+
+protected:
+	// Long enough to live on the heap, so a value left behind by a removal shows up as a leak.
+	static DEFAULT_VALUE_TYPE MakeValue(Size key)
+	{
+		return DEFAULT_VALUE_TYPE("value-with-a-heap-allocated-buffer-") + std::to_string(key);
+	}
+
+	static Void ExpectEqual(const DEFAULT_MAP_TYPE& map, const REFERENCE_MAP_TYPE& reference)
+	{
+		ASSERT_EQ(map.GetCount(), reference.size());
+
+		for (Size counter = 0; counter < map.GetCount(); counter++)
+		{
+			auto iterator = reference.find(map.GetKeys()[counter]);
+
+			ASSERT_NE(iterator, reference.end());
+			EXPECT_EQ(map.GetValues()[counter], iterator->second);
+		}
+
+		for (Size key = 0; key < DEFAULT_UNIVERSE; key++)
+		{
+			auto iterator = reference.find(DEFAULT_KEY_TYPE(key));
+
+			const DEFAULT_VALUE_TYPE* value = map.TryGet(DEFAULT_KEY_TYPE(key));
+
+			if (iterator == reference.end())
+			{
+				EXPECT_EQ(value, nullptr);
+				continue;
+			}
+
+			ASSERT_NE(value, nullptr);
+			EXPECT_EQ(*value, iterator->second);
+		}
+	}
+};
+
+constexpr Size SparseMapTest::DEFAULT_UNIVERSE;
+constexpr Size SparseMapTest::DEFAULT_OPERATION_COUNT;
+
+// -------------------------
+// Constructors.
+// -------------------------
+TEST_F(SparseMapTest, DefaultConstructor_NewMap_IsEmpty)
+{
+	DEFAULT_MAP_TYPE map;
+
+	EXPECT_TRUE(map.IsEmpty());
+	EXPECT_FALSE(map.Contains(0));
+	EXPECT_EQ(map.TryGet(0), nullptr);
+	EXPECT_THROW(map.Get(0), std::out_of_range);
+	EXPECT_THROW(DEFAULT_MAP_TYPE(Size(0)), std::invalid_argument);
+}
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(SparseMapTest, Insert_ContainedKey_KeepsValue)
+{
+	DEFAULT_MAP_TYPE map;
+
+	EXPECT_TRUE(map.Insert(5, MakeValue(1)));
+	EXPECT_FALSE(map.Insert(5, MakeValue(2)));
+
+	EXPECT_EQ(map.GetCount(), 1u);
+	EXPECT_EQ(map.Get(5), MakeValue(1));
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(SparseMapTest, Remove_MiddleKey_KeepsValuesParallelToKeys)
+{
+	DEFAULT_MAP_TYPE map;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 10; key++)
+		map.Insert(key, MakeValue(key));
+
+	EXPECT_TRUE(map.Remove(3));
+	EXPECT_FALSE(map.Remove(3));
+
+	ASSERT_EQ(map.GetCount(), 9u);
+	EXPECT_EQ(map.GetKeys()[3], 9u);
+	EXPECT_EQ(map.GetValues()[3], MakeValue(9));
+
+	EXPECT_EQ(map.TryGet(3), nullptr);
+	EXPECT_THROW(map.Get(3), std::out_of_range);
+	EXPECT_EQ(map.Get(9), MakeValue(9));
+
+	// Removing the last element needs no swap.
+	EXPECT_TRUE(map.Remove(8));
+	EXPECT_EQ(map.GetCount(), 8u);
+	EXPECT_EQ(map.Get(9), MakeValue(9));
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 10; key++)
+		EXPECT_EQ(map.Contains(key), key != 3 && key != 8);
+}
+
+// -------------------------
+// Clear Function.
+// -------------------------
+TEST_F(SparseMapTest, Clear_NonEmptyMap_IgnoresStaleSparseEntries)
+{
+	DEFAULT_MAP_TYPE map;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 10; key++)
+		map.Insert(key, MakeValue(key));
+
+	map.Clear();
+
+	EXPECT_TRUE(map.IsEmpty());
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 10; key++)
+	{
+		EXPECT_FALSE(map.Contains(key));
+		EXPECT_EQ(map.TryGet(key), nullptr);
+	}
+
+	// The stale dense keys are overwritten in place, and the old keys stay absent.
+	EXPECT_TRUE(map.Insert(7, MakeValue(70)));
+	EXPECT_FALSE(map.Contains(0));
+	EXPECT_FALSE(map.Remove(0));
+
+	EXPECT_TRUE(map.Insert(0, MakeValue(0)));
+	EXPECT_EQ(map.GetCount(), 2u);
+	EXPECT_EQ(map.Get(7), MakeValue(70));
+	EXPECT_EQ(map.Get(0), MakeValue(0));
+	EXPECT_EQ(map.GetKeys()[0], 7u);
+	EXPECT_EQ(map.GetKeys()[1], 0u);
+}
+
+TEST_F(SparseMapTest, Operations_RandomSequence_MatchReference)
+{
+	DEFAULT_MAP_TYPE map;
+	REFERENCE_MAP_TYPE reference;
+
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<DEFAULT_KEY_TYPE> distribution(0, DEFAULT_UNIVERSE - 1);
+
+	for (Size counter = 0; counter < DEFAULT_OPERATION_COUNT; counter++)
+	{
+		DEFAULT_KEY_TYPE key = distribution(generator);
+
+		switch (generator() % 16)
+		{
+			case 0:
+				map.Clear();
+				reference.clear();
+				break;
+			case 1: case 2: case 3: case 4: case 5: case 6:
+				EXPECT_EQ(map.Remove(key), reference.erase(key) == 1);
+				break;
+			default:
+				EXPECT_EQ(map.Insert(key, MakeValue(counter)), reference.emplace(key, MakeValue(counter)).second);
+				break;
+		}
+	}
+
+	ExpectEqual(map, reference);
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(SparseMapTest, CopyAndMove_NonEmptyMap_KeepContents)
+{
+	DEFAULT_MAP_TYPE map;
+
+	for (DEFAULT_KEY_TYPE key = 0; key < 10; key++)
+		map.Insert(key * 3, MakeValue(key));
+
+	DEFAULT_MAP_TYPE copy(map);
+
+	map.Remove(0);
+	map.Get(3) = MakeValue(100);
+
+	EXPECT_EQ(copy.GetCount(), 10u);
+	EXPECT_EQ(copy.Get(0), MakeValue(0));
+	EXPECT_EQ(copy.Get(3), MakeValue(1));
+
+	DEFAULT_MAP_TYPE moved(std::move(copy));
+
+	EXPECT_TRUE(copy.IsEmpty());
+	EXPECT_EQ(copy.TryGet(0), nullptr);
+	EXPECT_EQ(moved.Get(27), MakeValue(9));
+
+	map = moved;
+
+	EXPECT_EQ(map.Get(0), MakeValue(0));
+	EXPECT_EQ(map.GetCount(), 10u);
+}
+
+#endif
\ No newline at end of file
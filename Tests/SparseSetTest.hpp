@@ -0,0 +1,251 @@
+#ifndef SPARSE_SET_TESTS_HPP
+#define SPARSE_SET_TESTS_HPP
+
+#include <set>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <Collections/SparseSet.hpp>
+
+using namespace Forge;
+
+class SparseSetTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U32;
+
+	using DEFAULT_SET_TYPE = SparseSet<DEFAULT_ELEMENT_TYPE>;
+	using REFERENCE_SET_TYPE = std::set<DEFAULT_ELEMENT_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_UNIVERSE = 1000;
+	static constexpr Size DEFAULT_OPERATION_COUNT = 20000;
+
+protected:
+	static Void ExpectEqual(const DEFAULT_SET_TYPE& set, const REFERENCE_SET_TYPE& reference)
+	{
+		ASSERT_EQ(set.GetCount(), reference.size());
+
+		REFERENCE_SET_TYPE elements;
+
+		for (Size counter = 0; counter < set.GetCount(); counter++)
+			elements.insert(set[counter]);
+
+		EXPECT_EQ(elements, reference);
+
+		for (Size element = 0; element < DEFAULT_UNIVERSE; element++)
+			EXPECT_EQ(set.Contains(DEFAULT_ELEMENT_TYPE(element)), reference.count(DEFAULT_ELEMENT_TYPE(element)) == 1);
+	}
+};
+
+constexpr Size SparseSetTest::DEFAULT_UNIVERSE;
+constexpr Size SparseSetTest::DEFAULT_OPERATION_COUNT;
+
+// -------------------------
+// Constructors.
+// -------------------------
+TEST_F(SparseSetTest, DefaultConstructor_NewSet_IsEmpty)
+{
+	DEFAULT_SET_TYPE set;
+
+	EXPECT_TRUE(set.IsEmpty());
+	EXPECT_FALSE(set.Contains(0));
+	EXPECT_FALSE(set.Remove(0));
+	EXPECT_THROW(DEFAULT_SET_TYPE(Size(0)), std::invalid_argument);
+}
+
+// -------------------------
+// Insert Function.
+// -------------------------
+TEST_F(SparseSetTest, Insert_ContainedElement_ReturnsFalse)
+{
+	DEFAULT_SET_TYPE set;
+
+	EXPECT_TRUE(set.Insert(5));
+	EXPECT_FALSE(set.Insert(5));
+	EXPECT_TRUE(set.Insert(DEFAULT_UNIVERSE));
+
+	EXPECT_EQ(set.GetCount(), 2u);
+	EXPECT_TRUE(set.Contains(DEFAULT_UNIVERSE));
+	EXPECT_FALSE(set.Contains(DEFAULT_UNIVERSE + 1));
+}
+
+// -------------------------
+// Remove Function.
+// -------------------------
+TEST_F(SparseSetTest, Remove_MiddleElement_SwapsLastElementIntoItsSlot)
+{
+	DEFAULT_SET_TYPE set;
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < 10; element++)
+		set.Insert(element);
+
+	EXPECT_TRUE(set.Remove(3));
+	EXPECT_FALSE(set.Remove(3));
+
+	ASSERT_EQ(set.GetCount(), 9u);
+	EXPECT_EQ(set[3], 9u);
+	EXPECT_FALSE(set.Contains(3));
+
+	// The moved element must still be found, and removable, through its updated sparse entry.
+	EXPECT_TRUE(set.Contains(9));
+	EXPECT_TRUE(set.Remove(9));
+	EXPECT_EQ(set[3], 8u);
+
+	EXPECT_TRUE(set.Remove(8));
+	EXPECT_EQ(set.GetCount(), 7u);
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < 10; element++)
+		EXPECT_EQ(set.Contains(element), element != 3 && element < 8);
+}
+
+// -------------------------
+// Clear Function.
+// -------------------------
+TEST_F(SparseSetTest, Clear_NonEmptySet_IgnoresStaleSparseEntries)
+{
+	DEFAULT_SET_TYPE set;
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < 10; element++)
+		set.Insert(element);
+
+	set.Clear();
+
+	EXPECT_TRUE(set.IsEmpty());
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < 10; element++)
+		EXPECT_FALSE(set.Contains(element));
+
+	// The stale dense slots still hold the old elements, so a new element lands where 0 was.
+	EXPECT_TRUE(set.Insert(7));
+	EXPECT_TRUE(set.Contains(7));
+	EXPECT_FALSE(set.Contains(0));
+	EXPECT_FALSE(set.Remove(0));
+
+	EXPECT_TRUE(set.Insert(0));
+	EXPECT_EQ(set.GetCount(), 2u);
+	EXPECT_EQ(set[0], 7u);
+	EXPECT_EQ(set[1], 0u);
+}
+
+// -------------------------
+// Set Operations.
+// -------------------------
+TEST_F(SparseSetTest, RetainAll_OverlappingSet_KeepsIntersection)
+{
+	DEFAULT_SET_TYPE set;
+	DEFAULT_SET_TYPE other;
+
+	REFERENCE_SET_TYPE reference;
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < DEFAULT_UNIVERSE; element++)
+	{
+		if (element % 2 == 0)
+			set.Insert(element);
+
+		if (element % 3 == 0)
+			other.Insert(element);
+
+		if (element % 6 == 0)
+			reference.insert(element);
+	}
+
+	set.RetainAll(other);
+
+	ExpectEqual(set, reference);
+	EXPECT_TRUE(other.ContainsAll(set));
+
+	set.RetainAll(DEFAULT_SET_TYPE());
+
+	EXPECT_TRUE(set.IsEmpty());
+}
+
+TEST_F(SparseSetTest, InsertAllAndRemoveAll_OverlappingSets_MatchReference)
+{
+	DEFAULT_SET_TYPE set;
+	DEFAULT_SET_TYPE other;
+
+	REFERENCE_SET_TYPE reference;
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < DEFAULT_UNIVERSE / 2; element++)
+	{
+		set.Insert(element);
+		other.Insert(element * 2);
+	}
+
+	set.InsertAll(other);
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < DEFAULT_UNIVERSE; element++)
+		if (element < DEFAULT_UNIVERSE / 2 || element % 2 == 0)
+			reference.insert(element);
+
+	ExpectEqual(set, reference);
+
+	set.RemoveAll(other);
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < DEFAULT_UNIVERSE; element += 2)
+		reference.erase(element);
+
+	ExpectEqual(set, reference);
+}
+
+TEST_F(SparseSetTest, Operations_RandomSequence_MatchReference)
+{
+	DEFAULT_SET_TYPE set;
+	REFERENCE_SET_TYPE reference;
+
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<DEFAULT_ELEMENT_TYPE> distribution(0, DEFAULT_UNIVERSE - 1);
+
+	for (Size counter = 0; counter < DEFAULT_OPERATION_COUNT; counter++)
+	{
+		DEFAULT_ELEMENT_TYPE element = distribution(generator);
+
+		switch (generator() % 16)
+		{
+			case 0:
+				set.Clear();
+				reference.clear();
+				break;
+			case 1: case 2: case 3: case 4: case 5: case 6:
+				EXPECT_EQ(set.Remove(element), reference.erase(element) == 1);
+				break;
+			default:
+				EXPECT_EQ(set.Insert(element), reference.insert(element).second);
+				break;
+		}
+	}
+
+	ExpectEqual(set, reference);
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(SparseSetTest, CopyAndMove_NonEmptySet_KeepMembership)
+{
+	DEFAULT_SET_TYPE set;
+
+	for (DEFAULT_ELEMENT_TYPE element = 0; element < 10; element++)
+		set.Insert(element * 3);
+
+	DEFAULT_SET_TYPE copy(set);
+
+	set.Remove(0);
+
+	EXPECT_TRUE(copy.Contains(0));
+	EXPECT_EQ(copy.GetCount(), 10u);
+
+	DEFAULT_SET_TYPE moved(std::move(copy));
+
+	EXPECT_TRUE(copy.IsEmpty());
+	EXPECT_FALSE(copy.Contains(0));
+	EXPECT_TRUE(moved.Contains(27));
+	EXPECT_EQ(moved.GetCount(), 10u);
+
+	EXPECT_TRUE(copy.Insert(4));
+	EXPECT_TRUE(copy.Contains(4));
+}
+
+#endif
\ No newline at end of file
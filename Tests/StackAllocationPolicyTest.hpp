@@ -0,0 +1,171 @@
+#ifndef STACK_ALLOCATION_POLICY_TESTS_HPP
+#define STACK_ALLOCATION_POLICY_TESTS_HPP
+
+#include <thread>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Collections/SharedArray.hpp>
+#include <Policies/StackAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class StackAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<StackAllocationPolicy>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, StackAllocationPolicy>;
+	using DEFAULT_SHARED_ARRAY_TYPE = SharedArray<DEFAULT_ELEMENT_TYPE, StackAllocationPolicy>;
+
+public:
+	static constexpr Size DEFAULT_CAPACITY = 64 * 1024;
+	static constexpr Size DEFAULT_COUNT = 1000;
+	static constexpr Size DEFAULT_ROUND_COUNT = 200;
+
+protected:
+	DEFAULT_ALLOCATOR_TYPE allocator{ DEFAULT_CAPACITY };
+};
+
+constexpr Size StackAllocationPolicyTest::DEFAULT_CAPACITY;
+constexpr Size StackAllocationPolicyTest::DEFAULT_COUNT;
+constexpr Size StackAllocationPolicyTest::DEFAULT_ROUND_COUNT;
+
+// -------------------------
+// Reallocate Function.
+// -------------------------
+TEST_F(StackAllocationPolicyTest, Reallocate_BlockOnTop_GrowsInPlace)
+{
+	StackAllocationPolicy::Marker marker(allocator);
+
+	DEFAULT_ARRAY_TYPE array(&allocator);
+
+	array.PushBack(0);
+
+	const DEFAULT_ELEMENT_TYPE* data = array.GetRawData();
+
+	for (Size counter = 1; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(DEFAULT_ELEMENT_TYPE(counter));
+
+	EXPECT_EQ(array.GetRawData(), data);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		EXPECT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(counter));
+}
+
+TEST_F(StackAllocationPolicyTest, Reallocate_BeyondCapacity_FallsBackToHeap)
+{
+	StackAllocationPolicy::Marker marker(allocator);
+
+	VoidPtr block = allocator.Allocate(DEFAULT_CAPACITY / 2, 8);
+
+	std::memset(block, 7, DEFAULT_CAPACITY / 2);
+
+	VoidPtr grown = allocator.Reallocate(block, DEFAULT_CAPACITY * 2, 8);
+
+	EXPECT_EQ(static_cast<BytePtr>(grown)[DEFAULT_CAPACITY / 2 - 1], 7);
+	EXPECT_EQ(allocator.GetUsedSize(), 0u);
+
+	allocator.Deallocate(grown);
+}
+
+// -------------------------
+// Deallocate Function.
+// -------------------------
+TEST_F(StackAllocationPolicyTest, Deallocate_OutOfOrder_ReclaimsOnceTopIsReleased)
+{
+	VoidPtr first = allocator.Allocate(100, 8);
+	VoidPtr second = allocator.Allocate(100, 8);
+
+	allocator.Deallocate(first);
+
+	EXPECT_GT(allocator.GetUsedSize(), 0u);
+
+	allocator.Deallocate(second);
+
+	EXPECT_EQ(allocator.GetUsedSize(), 0u);
+}
+
+// -------------------------
+// Rewind Function.
+// -------------------------
+TEST_F(StackAllocationPolicyTest, Rewind_MarkerScope_ReleasesEverythingAllocatedSince)
+{
+	VoidPtr kept = allocator.Allocate(64, 64);
+
+	EXPECT_EQ(reinterpret_cast<Size>(kept) % 64, 0u);
+
+	Size used_size = allocator.GetUsedSize();
+
+	{
+		StackAllocationPolicy::Marker marker(allocator);
+
+		allocator.Allocate(1000, 8);
+		allocator.Allocate(2000, 16);
+
+		EXPECT_GT(allocator.GetUsedSize(), used_size);
+	}
+
+	EXPECT_EQ(allocator.GetUsedSize(), used_size);
+
+	allocator.Deallocate(kept);
+
+	EXPECT_EQ(allocator.GetUsedSize(), 0u);
+}
+
+TEST_F(StackAllocationPolicyTest, GetThreadScratch_SameThread_ReturnsSameStack)
+{
+	Allocator<StackAllocationPolicy>* scratch = StackAllocationPolicy::GetThreadScratch();
+
+	EXPECT_EQ(scratch, StackAllocationPolicy::GetThreadScratch());
+	EXPECT_EQ(scratch->GetCapacity(), StackAllocationPolicy::SCRATCH_CAPACITY);
+
+	StackAllocationPolicy::Marker marker(*scratch);
+
+	DEFAULT_ARRAY_TYPE array(scratch);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+		array.PushBack(DEFAULT_ELEMENT_TYPE(counter));
+
+	EXPECT_EQ(array[DEFAULT_COUNT - 1], DEFAULT_ELEMENT_TYPE(DEFAULT_COUNT - 1));
+}
+
+// -------------------------
+// GetDefaultAllocator Function.
+// -------------------------
+TEST_F(StackAllocationPolicyTest, GetDefaultAllocator_TwoThreads_UseTheirOwnScratchStacks)
+{
+	DEFAULT_ALLOCATOR_TYPE* defaults[2] = {};
+
+	auto fill = [&](Size thread, DEFAULT_ELEMENT_TYPE offset)
+	{
+		defaults[thread] = GetDefaultAllocator<DEFAULT_ALLOCATOR_TYPE>();
+
+		for (Size round = 0; round < DEFAULT_ROUND_COUNT; round++)
+		{
+			DEFAULT_SHARED_ARRAY_TYPE array;
+
+			for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+				array.PushBack(offset + counter);
+
+			for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+				ASSERT_EQ(array[counter], offset + counter);
+		}
+
+		EXPECT_EQ(defaults[thread]->GetUsedSize(), 0u);
+	};
+
+	std::thread first(fill, 0, 0);
+	std::thread second(fill, 1, DEFAULT_COUNT);
+
+	first.join();
+	second.join();
+
+	EXPECT_NE(defaults[0], defaults[1]);
+	EXPECT_EQ(GetDefaultAllocator<DEFAULT_ALLOCATOR_TYPE>(), StackAllocationPolicy::GetThreadScratch());
+}
+
+#endif
\ No newline at end of file
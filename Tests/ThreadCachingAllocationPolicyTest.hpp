@@ -0,0 +1,107 @@
+#ifndef THREAD_CACHING_ALLOCATION_POLICY_TESTS_HPP
+#define THREAD_CACHING_ALLOCATION_POLICY_TESTS_HPP
+
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/ThreadCachingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class ThreadCachingAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<ThreadCachingAllocationPolicy>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, ThreadCachingAllocationPolicy>;
+
+public:
+	static constexpr Size DEFAULT_THREAD_COUNT = 8;
+	static constexpr Size DEFAULT_ITERATION_COUNT = 2000;
+
+protected:
+	DEFAULT_ALLOCATOR_TYPE allocator;
+};
+
+constexpr Size ThreadCachingAllocationPolicyTest::DEFAULT_THREAD_COUNT;
+constexpr Size ThreadCachingAllocationPolicyTest::DEFAULT_ITERATION_COUNT;
+
+// -------------------------
+// Allocate Function.
+// -------------------------
+TEST_F(ThreadCachingAllocationPolicyTest, Allocate_ManyThreads_ArraysKeepTheirElements)
+{
+	std::vector<std::thread> threads;
+
+	for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+	{
+		threads.emplace_back([this, thread_index]()
+		{
+			for (Size iteration = 0; iteration < DEFAULT_ITERATION_COUNT; iteration++)
+			{
+				DEFAULT_ARRAY_TYPE array(&allocator);
+				Size count = 1 + (iteration * 7 + thread_index) % 300;
+
+				for (Size counter = 0; counter < count; counter++)
+					array.PushBack(DEFAULT_ELEMENT_TYPE(thread_index * 1000000 + counter));
+
+				for (Size counter = 0; counter < count; counter++)
+					ASSERT_EQ(array[counter], DEFAULT_ELEMENT_TYPE(thread_index * 1000000 + counter));
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+TEST_F(ThreadCachingAllocationPolicyTest, Allocate_ExcessiveAlignment_ThrowsInvalidArgument)
+{
+	EXPECT_THROW(allocator.Allocate(64, 64), std::invalid_argument);
+}
+
+// -------------------------
+// Reallocate Function.
+// -------------------------
+TEST_F(ThreadCachingAllocationPolicyTest, Reallocate_WithinSizeClass_KeepsBlock)
+{
+	VoidPtr block = allocator.Allocate(40, 8);
+
+	EXPECT_EQ(allocator.Reallocate(block, 48, 8), block);
+
+	VoidPtr large = allocator.Reallocate(block, ThreadCachingAllocationPolicy::MAXIMUM_CACHED_SIZE + 1, 8);
+
+	EXPECT_NE(large, block);
+
+	allocator.Deallocate(large);
+}
+
+// -------------------------
+// Deallocate Function.
+// -------------------------
+TEST_F(ThreadCachingAllocationPolicyTest, Deallocate_OtherThread_FlushesToPool)
+{
+	constexpr Size BLOCK_COUNT = 1000;
+
+	std::vector<VoidPtr> blocks;
+
+	for (Size counter = 0; counter < BLOCK_COUNT; counter++)
+		blocks.push_back(allocator.Allocate(100, 8));
+
+	Size pooled_count = ThreadCachingAllocationPolicy::GetPooledCount(100);
+
+	std::thread([this, &blocks]()
+	{
+		for (VoidPtr block : blocks)
+			allocator.Deallocate(block);
+	}).join();
+
+	EXPECT_GE(ThreadCachingAllocationPolicy::GetPooledCount(100), pooled_count + BLOCK_COUNT);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,279 @@
+#ifndef TIERED_ARRAY_TESTS_HPP
+#define TIERED_ARRAY_TESTS_HPP
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Collections/TieredArray.hpp>
+#include <Policies/TrackingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class TieredArrayTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = std::string;
+
+	using DEFAULT_ARRAY_TYPE = TieredArray<DEFAULT_ELEMENT_TYPE>;
+	using REFERENCE_ARRAY_TYPE = std::vector<DEFAULT_ELEMENT_TYPE>;
+
+	using TRACKING_POLICY_TYPE = TrackingAllocationPolicy<HeapAllocationPolicy>;
+	using TRACKING_ARRAY_TYPE = TieredArray<DEFAULT_ELEMENT_TYPE, TRACKING_POLICY_TYPE>;
+
+public:
+	static constexpr Size MINIMUM_BLOCK_CAPACITY = 16;
+	static constexpr Size DEFAULT_COUNT = 5000;
+	static constexpr Size DEFAULT_OPERATION_COUNT = 20000;
+
+protected:
+	// Long enough to live on the heap, so a bad relocation shows up as a use after free or a leak.
+	static DEFAULT_ELEMENT_TYPE MakeElement(Size value)
+	{
+		return DEFAULT_ELEMENT_TYPE("element-with-a-heap-allocated-buffer-") + std::to_string(value);
+	}
+
+	template<typename InArrayType>
+	static Void ExpectEqual(InArrayType& array, const REFERENCE_ARRAY_TYPE& reference)
+	{
+		ASSERT_EQ(array.GetCount(), reference.size());
+
+		for (Size index = 0; index < reference.size(); index++)
+			ASSERT_EQ(array[index], reference[index]) << "at index " << index;
+
+		// Every block but the last is full, so the blocks hold at most one block of slack.
+		EXPECT_LT(array.GetCapacity(), array.GetCount() + array.GetBlockCapacity() + 1);
+	}
+};
+
+constexpr Size TieredArrayTest::MINIMUM_BLOCK_CAPACITY;
+constexpr Size TieredArrayTest::DEFAULT_COUNT;
+constexpr Size TieredArrayTest::DEFAULT_OPERATION_COUNT;
+
+// -------------------------
+// Default Constructor.
+// -------------------------
+TEST_F(TieredArrayTest, DefaultConstructor_NewArray_IsEmpty)
+{
+	DEFAULT_ARRAY_TYPE array;
+
+	EXPECT_TRUE(array.IsEmpty());
+	EXPECT_EQ(array.GetCapacity(), 0u);
+	EXPECT_EQ(array.GetBlockCapacity(), MINIMUM_BLOCK_CAPACITY);
+	EXPECT_THROW(array.At(0), std::out_of_range);
+	EXPECT_THROW(array.Remove(0), std::length_error);
+	EXPECT_THROW(array.PopFront(), std::length_error);
+	EXPECT_THROW(array.Insert(1, MakeElement(0)), std::out_of_range);
+}
+
+// -------------------------
+// PushBack and PushFront Functions.
+// -------------------------
+TEST_F(TieredArrayTest, PushBack_ManyElements_GrowsBlockCapacity)
+{
+	DEFAULT_ARRAY_TYPE array;
+	REFERENCE_ARRAY_TYPE reference;
+
+	Size block_capacity = array.GetBlockCapacity();
+
+	for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+	{
+		array.PushBack(MakeElement(counter));
+		reference.push_back(MakeElement(counter));
+
+		// The blocks are merged pairwise once there are as many blocks as slots per block.
+		if (array.GetBlockCapacity() != block_capacity)
+		{
+			EXPECT_EQ(array.GetBlockCapacity(), block_capacity * 2);
+
+			block_capacity = array.GetBlockCapacity();
+
+			ExpectEqual(array, reference);
+		}
+
+		EXPECT_LE(array.GetCount(), block_capacity * block_capacity);
+	}
+
+	EXPECT_GE(block_capacity, MINIMUM_BLOCK_CAPACITY * 4);
+
+	ExpectEqual(array, reference);
+}
+
+TEST_F(TieredArrayTest, PushFront_ManyElements_RotatesThroughEveryBlock)
+{
+	DEFAULT_ARRAY_TYPE array;
+	REFERENCE_ARRAY_TYPE reference;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT / 4; counter++)
+	{
+		array.PushFront(MakeElement(counter));
+		reference.insert(reference.begin(), MakeElement(counter));
+	}
+
+	ExpectEqual(array, reference);
+
+	for (Size counter = 0; counter < DEFAULT_COUNT / 8; counter++)
+	{
+		array.PopFront();
+		reference.erase(reference.begin());
+	}
+
+	ExpectEqual(array, reference);
+}
+
+// -------------------------
+// Insert and Remove Functions.
+// -------------------------
+TEST_F(TieredArrayTest, Insert_BlockBoundaries_MatchReference)
+{
+	DEFAULT_ARRAY_TYPE array;
+	REFERENCE_ARRAY_TYPE reference;
+
+	for (Size counter = 0; counter < MINIMUM_BLOCK_CAPACITY * 4; counter++)
+	{
+		array.PushBack(MakeElement(counter));
+		reference.push_back(MakeElement(counter));
+	}
+
+	auto insert = [&array, &reference](Size index)
+	{
+		array.Insert(index, MakeElement(1000 + index));
+		reference.insert(reference.begin() + index, MakeElement(1000 + index));
+
+		ExpectEqual(array, reference);
+	};
+	auto remove = [&array, &reference](Size index)
+	{
+		array.Remove(index);
+		reference.erase(reference.begin() + index);
+
+		ExpectEqual(array, reference);
+	};
+
+	// The last slot of a block, the first slot of the next one, and both ends of the array.
+	insert(MINIMUM_BLOCK_CAPACITY - 1);
+	insert(MINIMUM_BLOCK_CAPACITY);
+	insert(MINIMUM_BLOCK_CAPACITY * 2 - 1);
+	insert(0);
+	insert(reference.size());
+
+	remove(MINIMUM_BLOCK_CAPACITY - 1);
+	remove(MINIMUM_BLOCK_CAPACITY);
+	remove(0);
+	remove(reference.size() - 1);
+}
+
+TEST_F(TieredArrayTest, RemoveAll_FromFront_ReleasesTrailingBlocks)
+{
+	Allocator<TRACKING_POLICY_TYPE> allocator("TieredArrayTest.Release");
+
+	{
+		TRACKING_ARRAY_TYPE array(&allocator);
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			array.PushBack(MakeElement(counter));
+
+		while (!array.IsEmpty())
+		{
+			array.Remove(array.GetCount() / 3);
+
+			EXPECT_LT(array.GetCapacity(), array.GetCount() + array.GetBlockCapacity() + 1);
+		}
+
+		EXPECT_EQ(array.GetCapacity(), 0u);
+
+		array.PushBack(MakeElement(0));
+
+		EXPECT_EQ(array.GetFront(), MakeElement(0));
+	}
+
+	EXPECT_EQ(AllocationTracker::GetStatistics("TieredArrayTest.Release").live_bytes, 0);
+}
+
+TEST_F(TieredArrayTest, Operations_RandomPositions_MatchReference)
+{
+	DEFAULT_ARRAY_TYPE array;
+	REFERENCE_ARRAY_TYPE reference;
+
+	std::mt19937 generator(42);
+
+	for (Size counter = 0; counter < DEFAULT_OPERATION_COUNT; counter++)
+	{
+		// Inserts outweigh removals, so the array crosses several block capacity changes.
+		if (!reference.empty() && generator() % 5 < 2)
+		{
+			Size index = generator() % reference.size();
+
+			array.Remove(index);
+			reference.erase(reference.begin() + index);
+		}
+		else
+		{
+			Size index = generator() % (reference.size() + 1);
+
+			if (counter % 2 == 0)
+				array.Insert(index, MakeElement(counter));
+			else
+			{
+				const DEFAULT_ELEMENT_TYPE element = MakeElement(counter);
+
+				array.Insert(index, element);
+			}
+
+			reference.insert(reference.begin() + index, MakeElement(counter));
+		}
+
+		if (counter % 1000 == 0)
+			ExpectEqual(array, reference);
+	}
+
+	EXPECT_GT(array.GetBlockCapacity(), MINIMUM_BLOCK_CAPACITY);
+
+	ExpectEqual(array, reference);
+
+	Size index = 0;
+
+	auto it = dynamic_cast<DEFAULT_ARRAY_TYPE::Iterator&>(array.GetBeginIterator());
+
+	for (; it != array.GetFinalIterator(); ++it)
+		EXPECT_EQ(*it, reference[index++]);
+
+	EXPECT_EQ(index, reference.size());
+}
+
+// -------------------------
+// Copy and Move.
+// -------------------------
+TEST_F(TieredArrayTest, CopyAndMove_GrownArray_KeepElements)
+{
+	DEFAULT_ARRAY_TYPE array;
+	REFERENCE_ARRAY_TYPE reference;
+
+	for (Size counter = 0; counter < DEFAULT_COUNT / 4; counter++)
+	{
+		array.PushFront(MakeElement(counter));
+		reference.insert(reference.begin(), MakeElement(counter));
+	}
+
+	DEFAULT_ARRAY_TYPE copy(array);
+
+	ExpectEqual(copy, reference);
+
+	array.Clear();
+
+	EXPECT_EQ(array.GetBlockCapacity(), MINIMUM_BLOCK_CAPACITY);
+
+	DEFAULT_ARRAY_TYPE moved(std::move(copy));
+
+	EXPECT_TRUE(copy.IsEmpty());
+
+	ExpectEqual(moved, reference);
+
+	array = std::move(moved);
+
+	ExpectEqual(array, reference);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef TRACKING_ALLOCATION_POLICY_TESTS_HPP
+#define TRACKING_ALLOCATION_POLICY_TESTS_HPP
+
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <Collections/DynamicArray.hpp>
+#include <Policies/TrackingAllocationPolicy.hpp>
+
+using namespace Forge;
+
+class TrackingAllocationPolicyTest : public testing::Test
+{
+public:
+	using DEFAULT_ELEMENT_TYPE = U64;
+
+	using DEFAULT_POLICY_TYPE = TrackingAllocationPolicy<HeapAllocationPolicy>;
+	using DEFAULT_ALLOCATOR_TYPE = Allocator<DEFAULT_POLICY_TYPE>;
+	using DEFAULT_ARRAY_TYPE = DynamicArrayWithPolicy<DEFAULT_ELEMENT_TYPE, DEFAULT_POLICY_TYPE>;
+
+public:
+	static constexpr Size DEFAULT_COUNT = 10000;
+	static constexpr Size DEFAULT_THREAD_COUNT = 4;
+};
+
+constexpr Size TrackingAllocationPolicyTest::DEFAULT_COUNT;
+constexpr Size TrackingAllocationPolicyTest::DEFAULT_THREAD_COUNT;
+
+// -------------------------
+// Allocate Function.
+// -------------------------
+TEST_F(TrackingAllocationPolicyTest, Allocate_GrowingArray_RecordsLiveAndPeakBytes)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator("TrackingTest.Array");
+
+	{
+		DEFAULT_ARRAY_TYPE array(&allocator);
+
+		for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+			array.PushBack(DEFAULT_ELEMENT_TYPE(counter));
+
+		AllocationStatistics statistics = AllocationTracker::GetStatistics("TrackingTest.Array");
+
+		EXPECT_GE(statistics.live_bytes, static_cast<I64>(DEFAULT_COUNT * sizeof(DEFAULT_ELEMENT_TYPE)));
+		EXPECT_GE(statistics.peak_bytes, statistics.live_bytes);
+		EXPECT_GE(statistics.allocation_count + statistics.reallocation_count, 2u);
+	}
+
+	AllocationStatistics statistics = AllocationTracker::GetStatistics("TrackingTest.Array");
+
+	EXPECT_EQ(statistics.live_bytes, 0);
+	EXPECT_GE(statistics.peak_bytes, static_cast<I64>(DEFAULT_COUNT * sizeof(DEFAULT_ELEMENT_TYPE)));
+	EXPECT_EQ(statistics.allocation_count, statistics.deallocation_count);
+}
+
+TEST_F(TrackingAllocationPolicyTest, Allocate_ManyThreads_CountsSurviveThreadExit)
+{
+	DEFAULT_ALLOCATOR_TYPE allocator("TrackingTest.Threads");
+
+	std::vector<std::thread> threads;
+
+	for (Size thread_index = 0; thread_index < DEFAULT_THREAD_COUNT; thread_index++)
+	{
+		threads.emplace_back([&allocator]()
+		{
+			for (Size counter = 0; counter < DEFAULT_COUNT; counter++)
+				allocator.Deallocate(allocator.Allocate(64, 8));
+		});
+	}
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	AllocationStatistics statistics = AllocationTracker::GetStatistics("TrackingTest.Threads");
+
+	EXPECT_EQ(statistics.live_bytes, 0);
+	EXPECT_EQ(statistics.allocation_count, DEFAULT_THREAD_COUNT * DEFAULT_COUNT);
+	EXPECT_EQ(statistics.deallocation_count, DEFAULT_THREAD_COUNT * DEFAULT_COUNT);
+}
+
+// -------------------------
+// Snapshot Function.
+// -------------------------
+TEST_F(TrackingAllocationPolicyTest, Snapshot_SameTag_SharesStatistics)
+{
+	DEFAULT_ALLOCATOR_TYPE first("TrackingTest.Shared");
+	DEFAULT_ALLOCATOR_TYPE second("TrackingTest.Shared");
+
+	EXPECT_EQ(first.GetTag(), second.GetTag());
+
+	VoidPtr block = first.Allocate(1000, 8);
+
+	AllocationStatistics statistics[AllocationTracker::MAXIMUM_TAG_COUNT];
+	Size tag_count = AllocationTracker::Snapshot(statistics, AllocationTracker::MAXIMUM_TAG_COUNT);
+
+	ASSERT_GT(tag_count, first.GetTag());
+	EXPECT_STREQ(statistics[first.GetTag()].tag, "TrackingTest.Shared");
+	EXPECT_EQ(statistics[first.GetTag()].live_bytes, 1000);
+
+	second.Deallocate(block);
+
+	EXPECT_EQ(AllocationTracker::GetStatistics("TrackingTest.Shared").live_bytes, 0);
+	EXPECT_THROW(AllocationTracker::GetStatistics("TrackingTest.Missing"), std::out_of_range);
+}
+
+#endif
\ No newline at end of file
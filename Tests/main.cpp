@@ -1,4 +1,31 @@
 #include "StaticArrayTest.hpp"
+#include "DynamicArrayTest.hpp"
+#include "TieredArrayTest.hpp"
+#include "SegmentedArrayTest.hpp"
+#include "IndexedPriorityQueueTest.hpp"
+#include "RadixHeapTest.hpp"
+#include "SparseSetTest.hpp"
+#include "SparseMapTest.hpp"
+#include "HiveTest.hpp"
+#include "SoaArrayTest.hpp"
+#include "SlotMapTest.hpp"
+#include "BitSetTest.hpp"
+#include "FlatMapTest.hpp"
+#include "BTreeMapTest.hpp"
+#include "ConcurrentBTreeMapTest.hpp"
+#include "ConcurrentHashMapTest.hpp"
+#include "EpochManagerTest.hpp"
+#include "SharedArrayTest.hpp"
+#include "PersistentVectorTest.hpp"
+#include "PersistentHashMapTest.hpp"
+#include "RoaringBitmapTest.hpp"
+#include "MmapAllocationPolicyTest.hpp"
+#include "HugePageAllocationPolicyTest.hpp"
+#include "NumaAllocationPolicyTest.hpp"
+#include "ThreadCachingAllocationPolicyTest.hpp"
+#include "TrackingAllocationPolicyTest.hpp"
+#include "StackAllocationPolicyTest.hpp"
+#include "DefaultAllocatorTest.hpp"
 
 int main(int argc, char** args)
 {